@@ -0,0 +1,97 @@
+# Yielding SDOF oscillator analysed with adaptive time stepping.
+#
+# With "-output dtOut" the steps land on multiples of dtOut and the
+# recorders only write at those times. A node recorder without -dT must
+# hold one line for each output time, and the recorded displacements must
+# be the ones the domain had at those times.
+
+puts "AdaptiveOutput.tcl: yielding SDOF - adaptive steps recorded at the output times"
+
+set dT      0.01
+set numIncr 200
+set dtOut   0.05
+set file    AdaptiveOutput.out
+
+wipe
+model Basic -ndm 1 -ndf 1
+uniaxialMaterial Steel01 1 2.0 100.0 0.05
+node 1 0.0
+node 2 1.0 -mass 1.0
+fix 1 1
+element zeroLength 1 1 2 -mat 1 -dir 1
+
+timeSeries Sine 1 0.0 2.0 0.5 -factor 9.81
+pattern UniformExcitation 1 1 -accel 1
+
+recorder Node -file $file -precision 15 -time -node 2 -dof 1 disp
+
+constraints Plain
+numberer Plain
+system FullGeneral
+test NormDispIncr 1.0e-12 20
+algorithm Newton
+integrator Newmark 0.5 0.25
+analysis Transient
+
+set testOK 0
+set tol 1.0e-10
+
+# the displacements at the output times, taken as the analysis goes
+set exact {}
+for {set i 1} {$i <= 4} {incr i 1} {
+    if {[analyze [expr $numIncr/4] $dT -adaptive -tol 1.0e-4 -output $dtOut] != 0} {
+	set testOK -1
+	puts "failed-> the adaptive analysis did not converge"
+    }
+    lappend exact [getTime] [nodeDisp 2 1]
+}
+set endTime [getTime]
+remove recorders
+
+set lines {}
+set channel [open $file r]
+while {[gets $channel line] >= 0} {
+    if {[string trim $line] != ""} {
+	lappend lines $line
+    }
+}
+close $channel
+file delete $file
+
+set numOutput [expr round($endTime/$dtOut)]
+puts "[llength $lines] lines recorded for $numOutput output times"
+if {[llength $lines] != $numOutput} {
+    set testOK -1
+    puts "failed-> [llength $lines] lines recorded, $numOutput expected"
+}
+
+set i 0
+foreach line $lines {
+    incr i
+    set time [lindex $line 0]
+    if {[expr abs($time - $i*$dtOut)] > $tol} {
+	set testOK -1
+	puts "failed-> line $i recorded at $time"
+    }
+}
+
+# the last line of each analyze command
+foreach {time disp} $exact {
+    set line [lindex $lines [expr round($time/$dtOut)-1]]
+    set OpenSeesR [lindex $line 1]
+    puts [format "%10.4f%15.8f%15.8f" $time $OpenSeesR $disp]
+    if {[expr abs($OpenSeesR - $disp)] > $tol} {
+	set testOK -1
+	puts "failed-> $time: $OpenSeesR $disp"
+    }
+}
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test AdaptiveOutput.tcl \n\n"
+    puts $results "| PASSED |  AdaptiveOutput.tcl"
+} else {
+    puts "FAILED Verification Test AdaptiveOutput.tcl \n\n"
+    puts $results "FAILED : AdaptiveOutput.tcl"
+}
+close $results
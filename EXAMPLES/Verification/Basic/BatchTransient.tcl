@@ -0,0 +1,125 @@
+# Batched transient analysis of several ground motions.
+#
+# A damped three story shear building is excited by two ground motions.
+# "batchTransient" factors the Newmark effective stiffness once and
+# advances both records in lockstep, solving them as one block each step.
+# The recorded histories of every record must be those of a separate
+# Newmark analysis with the Linear algorithm under that record alone, for
+# each of the linear systems of equations, up to round-off.
+
+puts "BatchTransient.tcl: three story shear building - batchTransient and Newmark"
+
+set numSteps 300
+set dt 0.01
+
+proc building {system} {
+    wipe
+    model Basic -ndm 1 -ndf 1
+    node 0 0.0
+    node 1 0.0 -mass 1.0
+    node 2 0.0 -mass 1.5
+    node 3 0.0 -mass 0.8
+    fix 0 1
+
+    uniaxialMaterial Elastic 1 400.0
+    uniaxialMaterial Elastic 2 300.0
+    uniaxialMaterial Elastic 3 200.0
+    element zeroLength 1 0 1 -mat 1 -dir 1
+    element zeroLength 2 1 2 -mat 2 -dir 1
+    element zeroLength 3 2 3 -mat 3 -dir 1
+
+    set acc1 {}
+    set acc2 {}
+    for {set i 0} {$i < 400} {incr i 1} {
+	lappend acc1 [expr {$i < 200 ? sin(0.15*$i) : 0.0}]
+	lappend acc2 [expr {$i < 250 ? cos(0.10*$i) : 0.0}]
+    }
+    timeSeries Path 1 -dt 0.01 -values $acc1
+    timeSeries Path 2 -dt 0.01 -values $acc2
+
+    rayleigh 0.1 0.0 0.001 0.0
+    constraints Plain
+    numberer Plain
+    system $system
+    test NormDispIncr 1.0e-12 10
+    algorithm Linear
+    integrator Newmark 0.5 0.25
+    analysis Transient
+}
+
+proc readHistory {fileName} {
+    set f [open $fileName r]
+    set history [read $f]
+    close $f
+    file delete $fileName
+    return $history
+}
+
+set testOK 0
+set tol 1.0e-12
+
+foreach system {FullGeneral BandGeneral BandSPD ProfileSPD SparseGeneral SparseSPD UmfPack} {
+    # each record on its own
+    set exact {}
+    foreach record {1 2} factor {1.0 2.0} {
+	building $system
+	pattern UniformExcitation $record 1 -accel $record -fact $factor
+	recorder Node -file batch$record.out -precision 17 -time -node 1 2 3 -dof 1 disp
+	analyze $numSteps $dt
+	remove recorders
+	lappend exact [readHistory batch$record.out]
+    }
+
+    # both records in one batch
+    building $system
+    pattern UniformExcitation 1 1 -accel 1
+    pattern UniformExcitation 2 1 -accel 2 -fact 2.0
+    set recorder1 [recorder Node -file batch1.out -precision 17 -time -node 1 2 3 -dof 1 disp]
+    set recorder2 [recorder Node -file batch2.out -precision 17 -time -node 1 2 3 -dof 1 disp]
+    set ok [batchTransient $numSteps $dt -record 1 $recorder1 -record 2 $recorder2]
+    remove recorders
+    set result [list [readHistory batch1.out] [readHistory batch2.out]]
+
+    if {$ok != 0} {
+	set testOK -1
+	puts "failed-> batchTransient with $system returned $ok"
+	continue
+    }
+
+    # the right-hand sides of the batch are formed from copies of the mass
+    # and damping matrices rather than element by element, so they may
+    # differ from those of the separate analyses in the last bits
+    set scale 0.0
+    set error 0.0
+    set timeError 0.0
+    foreach resultH $result exactH $exact {
+	if {[llength $resultH] != [llength $exactH] || [llength $exactH] != 4*$numSteps} {
+	    set error -1.0
+	    break
+	}
+	foreach {timeR uR1 uR2 uR3} $resultH {timeE uE1 uE2 uE3} $exactH {
+	    set timeError [expr max($timeError, abs($timeR-$timeE))]
+	    foreach OpenSeesR [list $uR1 $uR2 $uR3] exactR [list $uE1 $uE2 $uE3] {
+		set scale [expr max($scale, abs($exactR))]
+		set error [expr max($error, abs($OpenSeesR-$exactR))]
+	    }
+	}
+    }
+    puts [format "%15s%15.3e" $system [expr $scale > 0.0 ? $error/$scale : -1.0]]
+
+    if {$error < 0.0 || $error > $tol*$scale || $timeError > $tol*$numSteps*$dt} {
+	set testOK -1
+	puts "failed-> $system: $error $scale $timeError"
+    }
+}
+wipe
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test BatchTransient.tcl \n\n"
+    puts $results "| PASSED |  BatchTransient.tcl"
+} else {
+    puts "FAILED Verification Test BatchTransient.tcl \n\n"
+    puts $results "FAILED : BatchTransient.tcl"
+}
+close $results
@@ -0,0 +1,141 @@
+# Contact search with a Verlet list.
+#
+# A row of secondary nodes is moved diagonally over a fixed row of
+# primary nodes, first toward them and then past them. "contactSearch"
+# keeps an element for each pair found within the radius plus a skin at
+# its last search, and searches again only once a node has moved half the
+# skin. The pairs are joined by twoNodeLink elements, which, unlike the
+# zero length contact elements, do not expect their nodes to start at one
+# point. At the start of every step the elements are checked against the
+# distances of all the pairs: each pair closer than the radius must have
+# an element, and no element may join nodes further apart than the radius
+# plus twice the skin, since neither node of a pair has moved half the
+# skin since the search.
+
+puts "ContactSearch.tcl: nodes moved over a row of nodes - Verlet list and all pairs"
+
+set radius 1.0
+set skin 0.2
+
+wipe
+model Basic -ndm 2 -ndf 2
+
+set primary {}
+for {set i 0} {$i <= 20} {incr i 1} {
+    node [expr $i+1] [expr $i*1.0] 0.0
+    fix [expr $i+1] 1 1
+    lappend primary [expr $i+1]
+}
+
+set secondary {}
+for {set i 0} {$i <= 10} {incr i 1} {
+    node [expr $i+101] [expr 0.5+2.0*$i] 3.0
+    lappend secondary [expr $i+101]
+}
+
+# a free spring keeps the system of equations from being empty
+node 998 0.0 -5.0
+node 999 0.0 -5.0
+fix 998 1 1
+uniaxialMaterial Elastic 1 100.0
+element zeroLength 1 998 999 -mat 1 1 -dir 1 2
+
+# the secondary nodes come down to 0.2 above the primary nodes and go
+# back up, while they slide along them
+timeSeries Path 1 -time {0.0 1.0 2.0} -values {0.0 1.0 0.0}
+timeSeries Linear 2
+pattern Plain 1 1 {
+    foreach node $secondary {
+	sp $node 2 -2.8
+    }
+}
+pattern Plain 2 2 {
+    foreach node $secondary {
+	sp $node 1 4.0
+    }
+    load 999 1.0 1.0
+}
+
+contactSearch 1 -primary {*}$primary -secondary {*}$secondary \
+    -radius $radius -skin $skin -eleTag 1000 \
+    -element twoNodeLink -mat 1 1 -dir 1 2
+
+constraints Transformation
+numberer Plain
+system BandGeneral
+test NormDispIncr 1.0e-10 10
+algorithm Newton
+integrator LoadControl 0.025
+analysis Static
+
+proc position {node} {
+    return [list [expr [nodeCoord $node 1]+[nodeDisp $node 1]] \
+		[expr [nodeCoord $node 2]+[nodeDisp $node 2]]]
+}
+
+set testOK 0
+set maxPairs 0
+set numChecked 0
+
+for {set step 0} {$step < 80} {incr step 1} {
+    # the distances at the start of the step, when the search is updated
+    set near {}
+    foreach s $secondary {
+	lassign [position $s] xs ys
+	foreach p $primary {
+	    lassign [position $p] xp yp
+	    set distance($s,$p) [expr hypot($xs-$xp, $ys-$yp)]
+	    if {$distance($s,$p) < $radius} {
+		lappend near "$s,$p"
+	    }
+	}
+    }
+
+    if {[analyze 1] != 0} {
+	set testOK -1
+	puts "failed-> step $step did not converge"
+	break
+    }
+
+    set pairs {}
+    foreach ele [getEleTags] {
+	if {$ele < 1000} {
+	    continue
+	}
+	lassign [eleNodes $ele] s p
+	if {[lsearch $pairs "$s,$p"] >= 0} {
+	    set testOK -1
+	    puts "failed-> step $step: pair $s,$p has two elements"
+	}
+	lappend pairs "$s,$p"
+	if {![info exists distance($s,$p)] || $distance($s,$p) >= $radius+2.0*$skin} {
+	    set testOK -1
+	    puts "failed-> step $step: element $ele joins $s and $p, which are not near"
+	}
+    }
+    foreach pair $near {
+	if {[lsearch $pairs $pair] < 0} {
+	    set testOK -1
+	    puts "failed-> step $step: pair $pair is within the radius and has no element"
+	}
+    }
+    set maxPairs [expr max($maxPairs, [llength $pairs])]
+    incr numChecked [llength $near]
+}
+
+puts [format "%8s%10d%10d" "pairs" $maxPairs $numChecked]
+if {$numChecked == 0 || [llength [getEleTags]] != 1} {
+    set testOK -1
+    puts "failed-> the nodes did not come into contact and leave it again"
+}
+wipe
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test ContactSearch.tcl \n\n"
+    puts $results "| PASSED |  ContactSearch.tcl"
+} else {
+    puts "FAILED Verification Test ContactSearch.tcl \n\n"
+    puts $results "FAILED : ContactSearch.tcl"
+}
+close $results
@@ -0,0 +1,140 @@
+# Newton with the tangent and unbalance formed in one pass.
+#
+# A block of yielding bricks is pushed statically, or shaken at its base.
+# With "algorithm Newton -fused" the elements form their tangent and
+# resisting force in a single visit; stdBrick computes both from one pass
+# over its Gauss points, while SSPbrick falls back on the separate calls. Integrators that assemble in their own way (here HHT) fall back
+# on the separate passes. In each case the iterations and displacements
+# must be those of plain Newton.
+
+puts "FusedNewton.tcl: yielding brick block - fused and separate Newton"
+
+proc block {integrator algorithm} {
+    wipe
+    model Basic -ndm 3 -ndf 3
+    nDMaterial J2Plasticity 1 100.0 50.0 0.5 0.6 0.1 0.0
+
+    set nx 2
+    set ny 2
+    set nz 3
+    for {set k 0} {$k <= $nz} {incr k 1} {
+	for {set j 0} {$j <= $ny} {incr j 1} {
+	    for {set i 0} {$i <= $nx} {incr i 1} {
+		node [expr 1+$i+($nx+1)*($j+($ny+1)*$k)] $i.0 $j.0 $k.0 -mass 0.1 0.1 0.1
+	    }
+	}
+    }
+    fixZ 0.0 1 1 1
+
+    set e 1
+    for {set k 0} {$k < $nz} {incr k 1} {
+	for {set j 0} {$j < $ny} {incr j 1} {
+	    for {set i 0} {$i < $nx} {incr i 1} {
+		set n1 [expr 1+$i+($nx+1)*($j+($ny+1)*$k)]
+		set n2 [expr $n1+1]
+		set n4 [expr $n1+$nx+1]
+		set n3 [expr $n4+1]
+		set up [expr ($nx+1)*($ny+1)]
+		set type [expr {$e % 4 == 0 ? "SSPbrick" : "stdBrick"}]
+		element $type $e $n1 $n2 $n3 $n4 \
+		    [expr $n1+$up] [expr $n2+$up] [expr $n3+$up] [expr $n4+$up] 1
+		incr e
+	    }
+	}
+    }
+    set top [expr ($nx+1)*($ny+1)*($nz+1)]
+
+    timeSeries Linear 1
+    pattern Plain 1 1 {
+	for {set n [expr $top-($nx+1)*($ny+1)+1]} {$n <= $top} {incr n 1} {
+	    load $n 0.3 0.1 -0.2
+	}
+    }
+
+    constraints Plain
+    numberer RCM
+    system BandGeneral
+    test NormDispIncr 1.0e-9 30
+    eval "algorithm $algorithm"
+
+    set iterations {}
+    if {[lindex $integrator 0] == "LoadControl" || [lindex $integrator 0] == "DisplacementControl"} {
+	eval "integrator $integrator"
+	analysis Static
+	set steps {20 {}}
+    } else {
+	rayleigh 0.01 0.001 0.0 0.0
+	eval "integrator $integrator"
+	analysis Transient
+	set steps {40 0.01}
+	# the static load is held at zero while the base is shaken
+	loadConst -time 0.0
+	timeSeries Sine 2 0.0 10.0 0.2 -factor 50.0
+	pattern UniformExcitation 2 1 -accel 2
+    }
+
+    lassign $steps numSteps dt
+    for {set i 0} {$i < $numSteps} {incr i 1} {
+	if {[eval "analyze 1 $dt"] != 0} {
+	    return -1
+	}
+	lappend iterations [testIter]
+    }
+
+    set u {}
+    for {set n 1} {$n <= $top} {incr n 1} {
+	foreach dof {1 2 3} {
+	    lappend u [nodeDisp $n $dof]
+	}
+    }
+    return [list $iterations $u]
+}
+
+set testOK 0
+set tol 1.0e-12
+
+foreach integrator {
+    {LoadControl 0.02}
+    {DisplacementControl 36 1 0.002}
+    {Newmark 0.5 0.25}
+    {HHT 0.9}
+} {
+    set exact  [block $integrator Newton]
+    set result [block $integrator "Newton -fused"]
+    if {$exact == -1 || $result == -1} {
+	set testOK -1
+	puts "failed-> $integrator did not converge"
+	continue
+    }
+
+    set scale 0.0
+    set error 0.0
+    foreach OpenSeesR [lindex $result 1] exactR [lindex $exact 1] {
+	set scale [expr max($scale, abs($exactR))]
+	set error [expr max($error, abs($OpenSeesR-$exactR))]
+    }
+    set numIter 0
+    foreach i [lindex $exact 0] {
+	incr numIter $i
+    }
+    puts [format "%30s%8d%15.3e" $integrator $numIter [expr $error/$scale]]
+    if {[lindex $result 0] != [lindex $exact 0]} {
+	set testOK -1
+	puts "failed-> $integrator: iterations [lindex $result 0] and [lindex $exact 0]"
+    }
+    if {$scale == 0.0 || $error > $tol*$scale} {
+	set testOK -1
+	puts "failed-> $integrator: $error $scale"
+    }
+}
+wipe
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test FusedNewton.tcl \n\n"
+    puts $results "| PASSED |  FusedNewton.tcl"
+} else {
+    puts "FAILED Verification Test FusedNewton.tcl \n\n"
+    puts $results "FAILED : FusedNewton.tcl"
+}
+close $results
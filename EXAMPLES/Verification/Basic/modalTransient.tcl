@@ -0,0 +1,83 @@
+#
+# compare modalTransient with a direct transient analysis for a 5 dof
+# chain under a uniform ground acceleration
+#
+# every mode is used, so the modal solution differs from the direct one
+# only by the period error of the average acceleration method, which is
+# kept small by the short time step of the direct analysis
+#
+
+puts "modalTransient.tcl: 5 dof chain - modal superposition under UniformExcitation"
+
+set numDOF 5
+set dT     0.01
+set numSteps 150
+set myTol  1.0e-4
+
+proc buildModel {} {
+    global numDOF
+
+    wipe
+    model Basic -ndm 2 -ndf 2
+    uniaxialMaterial Elastic 1 1000.0
+
+    node 1 0.0 0.0
+    fix 1 1 1
+    for {set i 1} {$i <= $numDOF} {incr i 1} {
+	node [expr $i+1] [expr $i*1.0] 0.0 -mass [expr 1.0 + 0.5*$i] 0.0
+	fix  [expr $i+1] 0 1
+	element truss $i $i [expr $i+1] 1.0 1
+    }
+
+    timeSeries Path 1 -dt 0.05 -values {0.0 1.0 2.0 0.5 -1.5 -2.0 -0.5 1.0 0.5 0.0} -factor 9.81
+    pattern UniformExcitation 1 1 -accel 1
+}
+
+# modal superposition
+buildModel
+eigen -fullGenLapack $numDOF
+modalProperties
+modalTransient $dT $numSteps -modes $numDOF
+
+set modal {}
+for {set i 2} {$i <= $numDOF+1} {incr i 1} {
+    lappend modal [nodeDisp $i 1]
+}
+
+# direct integration
+buildModel
+constraints Plain
+system FullGeneral
+numberer Plain
+test NormDispIncr 1.0e-12 10
+algorithm Linear
+integrator Newmark 0.5 0.25
+analysis Transient
+analyze [expr 100*$numSteps] [expr $dT/100.0]
+
+set testOK 0
+set scale 0.0
+foreach u $modal {
+    set scale [expr max($scale, abs($u))]
+}
+set formatString {%10s%15.6f%15.6f}
+puts [format "%10s%15s%15s" node modal direct]
+for {set i 2} {$i <= $numDOF+1} {incr i 1} {
+    set OpenSeesR [lindex $modal [expr $i-2]]
+    set exactR    [nodeDisp $i 1]
+    puts [format $formatString $i $OpenSeesR $exactR]
+    if {[expr abs($OpenSeesR-$exactR)] > [expr $myTol*$scale]} {
+	set testOK -1
+	puts "failed-> node $i: [expr abs($OpenSeesR-$exactR)] [expr $myTol*$scale]"
+    }
+}
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test modalTransient.tcl \n\n"
+    puts $results "| PASSED |  modalTransient.tcl"
+} else {
+    puts "FAILED Verification Test modalTransient.tcl \n\n"
+    puts $results "FAILED : modalTransient.tcl"
+}
+close $results
@@ -0,0 +1,102 @@
+# Branching after parallel section state determination.
+#
+# A cantilever of ForceFrame elements created with -parallel is pushed
+# past yield, so the OpenMP threads have been started when the analysis
+# is branched. Every task continues the push by a different number of
+# steps in its own process and writes the tip displacement to a file;
+# each must match the same analysis run without branching. A task that is
+# killed by a signal must make branch fail. Run with OMP_NUM_THREADS > 1
+# to share the sections out between threads.
+
+puts "BranchParallel.tcl: 3d fiber cantilever - branching after a parallel region"
+
+proc column {} {
+    wipe
+    model Basic -ndm 3 -ndf 6
+    uniaxialMaterial Steel01 1 50.0 29000.0 0.02
+
+    section FrameFiber 1 -GJ 1.0e6 {
+	patch rect 1 8 8 -6.0 -4.0 6.0 4.0
+    }
+    geomTransf Linear 1 1.0 0.0 0.0
+
+    for {set i 0} {$i <= 4} {incr i 1} {
+	node [expr $i+1] 0.0 0.0 [expr $i*36.0]
+    }
+    fix 1 1 1 1 1 1 1
+    for {set i 1} {$i <= 4} {incr i 1} {
+	element ForceFrame $i $i [expr $i+1] 7 1 1 -parallel
+    }
+
+    timeSeries Linear 1
+    pattern Plain 1 1 {
+	load 5 1.0 0.5 -20.0 0.0 0.0 0.0
+    }
+
+    constraints Plain
+    numberer RCM
+    system BandGeneral
+    test NormDispIncr 1.0e-10 50
+    algorithm Newton
+    integrator DisplacementControl 5 1 0.4
+    analysis Static
+    return [analyze 10]
+}
+
+set testOK 0
+set tol 1.0e-10
+set tasks {2 4 6}
+
+# continue each task from the same committed state
+column
+set status [branch -jobs 2 numSteps $tasks {
+    if {[analyze $numSteps] != 0} {
+	error "analysis failed"
+    }
+    set channel [open BranchParallel.$numSteps.out w]
+    puts $channel [nodeDisp 5 2]
+    close $channel
+}]
+
+if {$status != {0 0 0}} {
+    set testOK -1
+    puts "failed-> the tasks returned $status"
+}
+
+foreach numSteps $tasks {
+    column
+    analyze $numSteps
+    set exact [nodeDisp 5 2]
+
+    if {[catch {open BranchParallel.$numSteps.out r} channel]} {
+	set testOK -1
+	puts "failed-> task $numSteps wrote no result"
+	continue
+    }
+    set OpenSeesR [string trim [read $channel]]
+    close $channel
+    file delete BranchParallel.$numSteps.out
+
+    puts [format "%10d%15.8f%15.8f" $numSteps $OpenSeesR $exact]
+    if {abs($OpenSeesR-$exact) > $tol*abs($exact)} {
+	set testOK -1
+	puts "failed-> task $numSteps: $OpenSeesR $exact"
+    }
+}
+
+# a task that dies reports the signal and fails the branch
+column
+if {[catch {branch t {1} {exec kill -9 [pid]}}] == 0} {
+    set testOK -1
+    puts "failed-> branch returned normally from a killed task"
+}
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test BranchParallel.tcl \n\n"
+    puts $results "| PASSED |  BranchParallel.tcl"
+} else {
+    puts "FAILED Verification Test BranchParallel.tcl \n\n"
+    puts $results "FAILED : BranchParallel.tcl"
+}
+close $results
@@ -0,0 +1,105 @@
+# Large rotations of a cantilever with the two corotational transformations.
+#
+# A cantilever is bent about both axes and twisted into large rotations,
+# statically and then dynamically under a suddenly applied load. The
+# displacements and the reactions found with "CorotationalCrd"
+# (CorotCrdTransf3d) must be those found with "Corotational"
+# (CorotFrameTransf3d).
+#
+# The nodal rotations are not compared. In 3d they are the sums of the
+# iterative spins, which do not commute, so they depend on the path of
+# the iterations and the size of the steps even for one transformation;
+# the two transformations converge along slightly different paths and
+# their tip rotations differ in the fourth or fifth significant digit.
+# Newmark integrates the rotational velocities and accelerations from
+# these same rotations, so the transient response agrees less closely.
+
+puts "CorotCantilever.tcl: large rotation cantilever - CorotationalCrd and Corotational"
+
+proc cantilever {transf mode} {
+    wipe
+    model Basic -ndm 3 -ndf 6
+
+    set n 10
+    set L 100.0
+    for {set i 0} {$i <= $n} {incr i 1} {
+	node [expr $i+1] [expr $i*$L/$n] 0.0 0.0 -mass 0.01 0.01 0.01 0.001 0.001 0.001
+    }
+    fix 1 1 1 1 1 1 1
+    set tip [expr $n+1]
+
+    geomTransf $transf 1 0.0 0.0 1.0
+    for {set i 1} {$i <= $n} {incr i 1} {
+	element elasticBeamColumn $i $i [expr $i+1] 10.0 1000.0 400.0 20.0 10.0 10.0 1
+    }
+
+    constraints Plain
+    numberer Plain
+    system FullGeneral
+    test NormDispIncr 1.0e-10 50
+    algorithm Newton
+
+    if {$mode == "static"} {
+	timeSeries Linear 1
+	pattern Plain 1 1 {
+	    load $tip 0.0 0.5 0.3 20.0 0.0 60.0
+	}
+	integrator LoadControl 0.05
+	analysis Static
+	set ok [analyze 20]
+    } else {
+	timeSeries Constant 1
+	pattern Plain 1 1 {
+	    load $tip 0.0 0.2 0.1 4.0 0.0 10.0
+	}
+	integrator Newmark 0.5 0.25
+	analysis Transient
+	set ok [analyze 200 0.01]
+    }
+
+    reactions
+    set response {}
+    foreach node [list 4 8 $tip] {
+	foreach dof {1 2 3} {
+	    lappend response [nodeDisp $node $dof]
+	}
+    }
+    return [list $ok $response [nodeReaction 1]]
+}
+
+set testOK 0
+
+foreach mode {static transient} tol {1.0e-10 1.0e-6} {
+    lassign [cantilever Corotational $mode] okF dispF reacF
+    lassign [cantilever CorotationalCrd $mode] okC dispC reacC
+    if {$okF != 0 || $okC != 0} {
+	set testOK -1
+	puts "failed-> $mode analysis failed $okF $okC"
+	continue
+    }
+
+    foreach label {displacements reactions} exact [list $dispF $reacF] result [list $dispC $reacC] {
+	set scale 0.0
+	set error 0.0
+	foreach OpenSeesR $result exactR $exact {
+	    set scale [expr max($scale, abs($exactR))]
+	    set error [expr max($error, abs($OpenSeesR-$exactR))]
+	}
+	puts [format "%10s %14s%15.3e" $mode $label [expr $error/$scale]]
+	if {$error > $tol*$scale} {
+	    set testOK -1
+	    puts "failed-> $mode $label: $error $scale"
+	}
+    }
+}
+wipe
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test CorotCantilever.tcl \n\n"
+    puts $results "| PASSED |  CorotCantilever.tcl"
+} else {
+    puts "FAILED Verification Test CorotCantilever.tcl \n\n"
+    puts $results "FAILED : CorotCantilever.tcl"
+}
+close $results
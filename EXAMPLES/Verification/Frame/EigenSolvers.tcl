@@ -0,0 +1,76 @@
+# This checks the linear systems that can be given to eigen with -solver
+# for the shift-invert solves of ARPACK.
+#
+# A 20 element cantilever with lumped translational masses is solved with
+# every system, twice in a row so that a kept factorization is reused, and
+# once more after the domain has changed. The eigenvalues are compared
+# with those of eigen without -solver.
+
+puts "EigenSolvers.tcl: 2d cantilever - eigenvalues with every eigen -solver system"
+
+set systems {BandSPD BandGeneral BandGen SparseGen SparseGeneral SuperLU SparseSYM SparseSPD SProfileSPD ProfileSPD FullGeneral FullGen UmfPack}
+
+proc cantilever {numEle} {
+    wipe
+    model Basic -ndm 2 -ndf 3
+    for {set i 0} {$i <= $numEle} {incr i 1} {
+	node [expr $i+1] [expr $i*1.0] 0.0 -mass 1.0 1.0 0.0
+    }
+    fix 1 1 1 1
+    geomTransf Linear 1
+    for {set i 1} {$i <= $numEle} {incr i 1} {
+	element elasticBeamColumn $i $i [expr $i+1] 1.0 1000.0 1.0 1
+    }
+}
+
+set numEigen 4
+set tol 1.0e-5;  # SProfileSPD solves in single precision
+set testOK 0
+
+cantilever 20
+set exactResults [eigen $numEigen]
+
+proc check {label values} {
+    global exactResults numEigen tol testOK
+    for {set i 0} {$i < $numEigen} {incr i 1} {
+	set OpenSeesR [lindex $values $i]
+	set exactR    [lindex $exactResults $i]
+	if {$OpenSeesR == "" || [expr abs($OpenSeesR-$exactR)/$exactR] > $tol} {
+	    set testOK -1
+	    puts "failed-> $label mode [expr $i+1]: $OpenSeesR $exactR"
+	}
+    }
+}
+
+set formatString {%15s%15.6f%15.6f%15.6f%15.6f}
+foreach system $systems {
+    cantilever 20
+    check $system [eigen -solver $system $numEigen]
+
+    # again on the same domain
+    set values [eigen -solver $system $numEigen]
+    check "$system (repeated)" $values
+    puts [format $formatString $system {*}$values]
+
+    # again after a change of the domain
+    remove element 20
+    element elasticBeamColumn 20 20 21 1.0 1000.0 1.0 1
+    check "$system (changed)" [eigen -solver $system $numEigen]
+}
+
+# a diagonal system can not be used for the solves
+cantilever 20
+if {[catch {eigen -solver Diagonal $numEigen}] == 0} {
+    set testOK -1
+    puts "failed-> eigen -solver Diagonal was accepted"
+}
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test EigenSolvers.tcl \n\n"
+    puts $results "| PASSED |  EigenSolvers.tcl"
+} else {
+    puts "FAILED Verification Test EigenSolvers.tcl \n\n"
+    puts $results "FAILED : EigenSolvers.tcl"
+}
+close $results
@@ -0,0 +1,118 @@
+# Element recorders of a yielding portal frame.
+#
+# The frame is shaken past yield while Element recorders write the end
+# forces, basic forces and section forces of its force-based elements.
+# These recorders have the elements write their responses straight into
+# the recorder's row, except with -dof, where the selected components are
+# copied out. At every step each recorded value must be the one returned
+# by eleResponse for the same element and response.
+
+puts "ElementRecorders.tcl: yielding portal frame - element recorders and eleResponse"
+
+wipe
+model Basic -ndm 2 -ndf 3
+node 1 0.0 0.0
+node 2 0.0 10.0
+node 3 5.0 10.0
+node 4 5.0 0.0
+fix 1 1 1 1
+fix 4 1 1 1
+mass 2 1.0 1.0 0.0
+mass 3 1.0 1.0 0.0
+
+uniaxialMaterial Steel01 1 50.0 29000.0 0.02
+section Fiber 1 {
+    patch rect 1 6 6 -5.0 -5.0 5.0 5.0
+}
+geomTransf PDelta 1
+element forceBeamColumn 1 1 2 5 1 1
+element forceBeamColumn 2 2 3 5 1 1
+element forceBeamColumn 3 3 4 5 1 1
+
+timeSeries Sine 1 0.0 10.0 1.0 -factor 200.0
+pattern UniformExcitation 1 1 -accel 1
+
+# each recorder with the eleResponse arguments of its values
+set recorders {
+    local   {-ele 1 2 3}  {}        {localForce}
+    global  {-ele 1 2 3}  {}        {globalForce}
+    basic   {-ele 1 3}    {}        {basicForce}
+    section {-ele 1 2 3}  {}        {section 1 force}
+    dofs    {-ele 1 2}    {1 3 5}   {globalForce}
+}
+foreach {name eles dofs response} $recorders {
+    if {$dofs == {}} {
+	recorder Element -file Element.$name.out -precision 17 {*}$eles {*}$response
+    } else {
+	recorder Element -file Element.$name.out -precision 17 {*}$eles -dof {*}$dofs {*}$response
+    }
+}
+
+constraints Plain
+numberer RCM
+system BandGeneral
+test NormDispIncr 1.0e-10 20
+algorithm Newton
+integrator Newmark 0.5 0.25
+analysis Transient
+
+set testOK 0
+for {set step 0} {$step < 150} {incr step 1} {
+    if {[analyze 1 0.01] != 0} {
+	set testOK -1
+	puts "failed-> the analysis did not converge"
+	break
+    }
+    foreach {name eles dofs response} $recorders {
+	set row {}
+	foreach ele [lrange $eles 1 end] {
+	    set values [eleResponse $ele {*}$response]
+	    if {$dofs == {}} {
+		lappend row {*}$values
+	    } else {
+		foreach dof $dofs {
+		    lappend row [lindex $values [expr $dof-1]]
+		}
+	    }
+	}
+	lappend exact($name) $row
+    }
+}
+remove recorders
+
+foreach {name eles dofs response} $recorders {
+    set channel [open Element.$name.out r]
+    set recorded {}
+    while {[gets $channel line] >= 0} {
+	if {[string trim $line] != ""} {
+	    lappend recorded $line
+	}
+    }
+    close $channel
+    file delete Element.$name.out
+
+    set recorded [concat {*}$recorded]
+    set values [concat {*}$exact($name)]
+    set numDiffer 0
+    foreach OpenSeesR $recorded exactR $values {
+	if {$OpenSeesR != $exactR} {
+	    incr numDiffer
+	}
+    }
+    puts [format "%20s%10d%10d" $response [llength $values] $numDiffer]
+    if {$numDiffer != 0 || [llength $recorded] != [llength $values] || [llength $values] == 0} {
+	set testOK -1
+	puts "failed-> $name: [llength $recorded] values recorded, [llength $values] expected, $numDiffer differ"
+    }
+}
+wipe
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test ElementRecorders.tcl \n\n"
+    puts $results "| PASSED |  ElementRecorders.tcl"
+} else {
+    puts "FAILED Verification Test ElementRecorders.tcl \n\n"
+    puts $results "FAILED : ElementRecorders.tcl"
+}
+close $results
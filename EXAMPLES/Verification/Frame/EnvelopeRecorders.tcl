@@ -0,0 +1,197 @@
+# Envelope and RMS recorders of a yielding portal frame.
+#
+# The frame is shaken past yield while plain Node and Element recorders
+# write the whole history of its displacements and element end forces.
+# The EnvelopeNode, EnvelopeElement and NormEnvelopeElement recorders
+# (with and without the time of each peak) and the NodeRMS and ElementRMS
+# recorders must write the minima, maxima, absolute maxima and root mean
+# squares of those histories.
+
+puts "EnvelopeRecorders.tcl: yielding portal frame - envelope and RMS recorders"
+
+wipe
+model Basic -ndm 2 -ndf 3
+node 1 0.0 0.0
+node 2 0.0 10.0
+node 3 5.0 10.0
+node 4 5.0 0.0
+fix 1 1 1 1
+fix 4 1 1 1
+mass 2 1.0 1.0 0.0
+mass 3 1.0 1.0 0.0
+
+uniaxialMaterial Steel01 1 50.0 29000.0 0.02
+section Fiber 1 {
+    patch rect 1 6 6 -5.0 -5.0 5.0 5.0
+}
+geomTransf PDelta 1
+element forceBeamColumn 1 1 2 5 1 1
+element forceBeamColumn 2 2 3 5 1 1
+element forceBeamColumn 3 3 4 5 1 1
+
+timeSeries Sine 1 0.0 10.0 1.0 -factor 200.0
+pattern UniformExcitation 1 1 -accel 1
+
+set nodes {-node 2 3 -dof 1 2 3 disp}
+set eles {-ele 1 2 3 localForce}
+recorder Node             -file Envelope.node.out    -precision 17 -time {*}$nodes
+recorder EnvelopeNode     -file Envelope.envNode.out -precision 17 {*}$nodes
+recorder EnvelopeNode     -file Envelope.envNodeTime.out -precision 17 -time {*}$nodes
+recorder NodeRMS          -file Envelope.rmsNode.out -precision 17 {*}$nodes
+recorder Element          -file Envelope.ele.out     -precision 17 -time {*}$eles
+recorder EnvelopeElement  -file Envelope.envEle.out  -precision 17 {*}$eles
+recorder EnvelopeElement  -file Envelope.envEleTime.out -precision 17 -time {*}$eles
+recorder ElementRMS       -file Envelope.rmsEle.out  -precision 17 {*}$eles
+recorder NormEnvelopeElement -file Envelope.normEle.out -precision 17 {*}$eles
+
+constraints Plain
+numberer RCM
+system BandGeneral
+test NormDispIncr 1.0e-10 20
+algorithm Newton
+integrator Newmark 0.5 0.25
+analysis Transient
+
+set testOK 0
+if {[analyze 150 0.01] != 0} {
+    set testOK -1
+    puts "failed-> the analysis did not converge"
+}
+remove recorders
+
+proc readRows {name} {
+    set channel [open Envelope.$name.out r]
+    set rows {}
+    while {[gets $channel line] >= 0} {
+	if {[string trim $line] != ""} {
+	    lappend rows $line
+	}
+    }
+    close $channel
+    file delete Envelope.$name.out
+    return $rows
+}
+
+# the min, max and abs max rows of each column of a history, and the rows
+# with the time of each value before it
+proc envelope {history} {
+    set times {}
+    foreach row $history {
+	lappend times [lindex $row 0]
+	set i 0
+	foreach value [lrange $row 1 end] {
+	    lappend columns($i) $value
+	    incr i
+	}
+    }
+    set numColumns [expr [llength [lindex $history 0]]-1]
+    set rows {{} {} {}}
+    set timeRows {{} {} {}}
+    for {set i 0} {$i < $numColumns} {incr i 1} {
+	set lo [lindex $columns($i) 0]
+	set hi $lo
+	set am [expr abs($lo)]
+	set tlo [lindex $times 0]
+	set thi $tlo
+	set tam $tlo
+	foreach value $columns($i) time $times {
+	    if {$value < $lo} {set lo $value; set tlo $time}
+	    if {$value > $hi} {set hi $value; set thi $time}
+	    if {abs($value) > $am} {set am [expr abs($value)]; set tam $time}
+	}
+	foreach r {0 1 2} value [list $lo $hi $am] time [list $tlo $thi $tam] {
+	    lset rows $r [concat [lindex $rows $r] $value]
+	    lset timeRows $r [concat [lindex $timeRows $r] $time $value]
+	}
+    }
+    return [list $rows $timeRows]
+}
+
+proc rms {history} {
+    set sums {}
+    foreach row $history {
+	set i 0
+	foreach value [lrange $row 1 end] {
+	    if {$i >= [llength $sums]} {
+		lappend sums 0.0
+	    }
+	    lset sums $i [expr [lindex $sums $i] + $value*$value]
+	    incr i
+	}
+    }
+    set result {}
+    foreach sum $sums {
+	lappend result [expr sqrt($sum/[llength $history])]
+    }
+    return [list $result]
+}
+
+# the norm of the forces of each element at each step
+proc norms {history numEle} {
+    set result {}
+    foreach row $history {
+	set normRow [lindex $row 0]
+	set forces [lrange $row 1 end]
+	set size [expr [llength $forces]/$numEle]
+	for {set e 0} {$e < $numEle} {incr e 1} {
+	    set sum 0.0
+	    foreach value [lrange $forces [expr $e*$size] [expr ($e+1)*$size-1]] {
+		set sum [expr $sum + $value*$value]
+	    }
+	    lappend normRow [expr sqrt($sum)]
+	}
+	lappend result $normRow
+    }
+    return $result
+}
+
+proc compare {label recorded exact tol} {
+    global testOK
+    set recorded [concat {*}$recorded]
+    set exact [concat {*}$exact]
+    if {[llength $recorded] != [llength $exact] || [llength $exact] == 0} {
+	set testOK -1
+	puts "failed-> $label: [llength $recorded] values recorded, [llength $exact] expected"
+	return
+    }
+    set scale 0.0
+    set error 0.0
+    foreach OpenSeesR $recorded exactR $exact {
+	set scale [expr max($scale, abs($exactR))]
+	set error [expr max($error, abs($OpenSeesR-$exactR))]
+    }
+    puts [format "%20s%10d%15.3e" $label [llength $exact] [expr $error/$scale]]
+    if {$error > $tol*$scale} {
+	set testOK -1
+	puts "failed-> $label: [expr $error/$scale] $tol"
+    }
+}
+
+set nodeHistory [readRows node]
+set eleHistory  [readRows ele]
+
+# the envelopes pick recorded values and times, which must be the same;
+# the sums of squares and norms may round differently
+lassign [envelope $nodeHistory] rows timeRows
+compare EnvelopeNode     [readRows envNode]     $rows 0.0
+compare "EnvelopeNode -time" [readRows envNodeTime] $timeRows 0.0
+compare NodeRMS          [readRows rmsNode]     [rms $nodeHistory] 1.0e-14
+
+lassign [envelope $eleHistory] rows timeRows
+compare EnvelopeElement  [readRows envEle]      $rows 0.0
+compare "EnvelopeElement -time" [readRows envEleTime] $timeRows 0.0
+compare ElementRMS       [readRows rmsEle]      [rms $eleHistory] 1.0e-14
+
+lassign [envelope [norms $eleHistory 3]] rows
+compare NormEnvelopeElement [readRows normEle]  $rows 1.0e-14
+wipe
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test EnvelopeRecorders.tcl \n\n"
+    puts $results "| PASSED |  EnvelopeRecorders.tcl"
+} else {
+    puts "FAILED Verification Test EnvelopeRecorders.tcl \n\n"
+    puts $results "FAILED : EnvelopeRecorders.tcl"
+}
+close $results
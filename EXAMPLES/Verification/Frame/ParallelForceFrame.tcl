@@ -0,0 +1,88 @@
+# Yielding 3d cantilever of ForceFrame elements with fiber sections.
+#
+# The column is pushed back and forth past yield, once with the section
+# states of its elements determined in parallel (element option -parallel)
+# and once serially. The contributions of the sections are summed in the
+# same order either way, so the two must agree to round-off. With OpenMP
+# the sections are shared out between OMP_NUM_THREADS threads.
+
+puts "ParallelForceFrame.tcl: 3d fiber cantilever - parallel section state determination"
+
+proc column {options} {
+    wipe
+    model Basic -ndm 3 -ndf 6
+    uniaxialMaterial Steel01 1 50.0 29000.0 0.02
+
+    section FrameFiber 1 -GJ 1.0e6 {
+	patch rect 1 8 8 -6.0 -4.0 6.0 4.0
+    }
+    geomTransf Linear 1 1.0 0.0 0.0
+
+    set numEle 4
+    for {set i 0} {$i <= $numEle} {incr i 1} {
+	node [expr $i+1] 0.0 0.0 [expr $i*36.0]
+    }
+    fix 1 1 1 1 1 1 1
+    for {set i 1} {$i <= $numEle} {incr i 1} {
+	eval "element ForceFrame $i $i [expr $i+1] 7 1 1 $options"
+    }
+
+    timeSeries Linear 1
+    pattern Plain 1 1 {
+	load [expr $numEle+1] 1.0 0.5 -20.0 0.0 0.0 0.0
+    }
+
+    constraints Plain
+    numberer RCM
+    system BandGeneral
+    test NormDispIncr 1.0e-10 50
+    algorithm Newton
+
+    set u {}
+    foreach target {8.0 -8.0 10.0} {
+	set current [nodeDisp [expr $numEle+1] 1]
+	integrator DisplacementControl [expr $numEle+1] 1 [expr ($target-$current)/20.0]
+	analysis Static
+	if {[analyze 20] != 0} {
+	    return {}
+	}
+	lappend u [nodeDisp [expr $numEle+1] 2] [nodeDisp [expr $numEle+1] 3]
+	foreach force [eleForce 1] {
+	    lappend u $force
+	}
+    }
+    return $u
+}
+
+set testOK 0
+set tol 1.0e-10
+
+set serial   [column ""]
+set parallel [column "-parallel"]
+
+if {[llength $serial] == 0 || [llength $parallel] != [llength $serial]} {
+    set testOK -1
+    puts "failed-> the analyses did not converge"
+} else {
+    set scale 0.0
+    set error 0.0
+    foreach OpenSeesR $parallel exactR $serial {
+	set scale [expr max($scale, abs($exactR))]
+	set error [expr max($error, abs($OpenSeesR-$exactR))]
+    }
+    puts [format "%15s%15.3e" "rel. error" [expr $error/$scale]]
+    if {$error > $tol*$scale} {
+	set testOK -1
+	puts "failed-> [expr $error/$scale] $tol"
+    }
+}
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test ParallelForceFrame.tcl \n\n"
+    puts $results "| PASSED |  ParallelForceFrame.tcl"
+} else {
+    puts "FAILED Verification Test ParallelForceFrame.tcl \n\n"
+    puts $results "FAILED : ParallelForceFrame.tcl"
+}
+close $results
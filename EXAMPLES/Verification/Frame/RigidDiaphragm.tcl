@@ -0,0 +1,128 @@
+# Transient response of a frame with rigid diaphragms and a beam hinge.
+#
+# A two storey 3d frame has a rigid diaphragm at each floor and a roof
+# beam with a hinge formed by an equalDOF between two coincident nodes.
+# The frame is excited in both horizontal directions. The response with
+# the constraints enforced by transformation must be that obtained with
+# stiff penalties, to within the error of the penalty method (about 3e-6
+# for the penalty of 1e12, below which it grows and above which the
+# equations become too poorly conditioned).
+
+puts "RigidDiaphragm.tcl: 3d frame - transformation and penalty constraints"
+
+proc frame {handler} {
+    wipe
+    model Basic -ndm 3 -ndf 6
+
+    set E  29000.0
+    set G  11200.0
+    set h  144.0
+    geomTransf Linear 1 1.0 0.0 0.0
+    geomTransf Linear 2 0.0 0.0 1.0
+
+    foreach {floor z} {0 0.0 1 144.0 2 288.0} {
+	node [expr 10*$floor+1]   0.0   0.0 $z
+	node [expr 10*$floor+2] 240.0   0.0 $z
+	node [expr 10*$floor+3] 240.0 360.0 $z
+	node [expr 10*$floor+4]   0.0 360.0 $z
+    }
+    fix 1 1 1 1 1 1 1
+    fix 2 1 1 1 1 1 1
+    fix 3 1 1 1 1 1 1
+    fix 4 1 1 1 1 1 1
+
+    set tag 1
+    foreach floor {1 2} {
+	# columns
+	for {set i 1} {$i <= 4} {incr i} {
+	    element elasticBeamColumn $tag [expr 10*($floor-1)+$i] [expr 10*$floor+$i] \
+		100.0 $E $G 2000.0 1200.0 [expr 1000.0+100*$i] 1
+	    incr tag
+	}
+	# beams around the floor
+	foreach {i j} {1 2 3 4 4 1} {
+	    element elasticBeamColumn $tag [expr 10*$floor+$i] [expr 10*$floor+$j] \
+		50.0 $E $G 500.0 400.0 1500.0 2
+	    incr tag
+	}
+
+	# the diaphragm, its centre of mass carrying the mass of the floor
+	set master [expr 10*$floor+5]
+	node $master 120.0 180.0 [expr $h*$floor]
+	fix $master 0 0 1 1 1 0
+	mass $master 2.0 2.0 0.0 0.0 0.0 [expr 2.0*(240.0*240.0+360.0*360.0)/12.0]
+	rigidDiaphragm 3 $master [expr 10*$floor+1] [expr 10*$floor+2] \
+	    [expr 10*$floor+3] [expr 10*$floor+4]
+    }
+
+    # the first floor beam from 12 to 13 is hinged at midspan for bending
+    # in the plane of the floor
+    node 16 240.0 180.0 144.0
+    node 17 240.0 180.0 144.0
+    mass 16 0.01 0.01 0.01 0.0 0.0 0.0
+    element elasticBeamColumn $tag 12 16 50.0 $E $G 500.0 400.0 1500.0 2
+    incr tag
+    element elasticBeamColumn $tag 17 13 50.0 $E $G 500.0 400.0 1500.0 2
+    equalDOF 16 17 1 2 3 4 5
+
+    timeSeries Trig 1 0.0 10.0 0.35
+    timeSeries Trig 2 0.0 10.0 0.55
+    pattern UniformExcitation 1 1 -accel 1 -fact 50.0
+    pattern UniformExcitation 2 2 -accel 2 -fact 30.0
+
+    if {$handler == "Penalty"} {
+	constraints Penalty 1.0e12 1.0e12
+    } else {
+	constraints $handler
+    }
+    numberer RCM
+    system BandGeneral
+    test NormDispIncr 1.0e-12 10
+    algorithm Linear
+    integrator Newmark 0.5 0.25
+    analysis Transient
+
+    set ok [analyze 100 0.01]
+    set response {}
+    foreach node {15 25 11 23 16 17} {
+	foreach dof {1 2 3 4 5 6} {
+	    lappend response [nodeDisp $node $dof]
+	}
+    }
+    return [list $ok $response]
+}
+
+set testOK 0
+set tol 1.0e-5
+
+lassign [frame Transformation] okT transformation
+lassign [frame Penalty] okP penalty
+if {$okT != 0 || $okP != 0} {
+    set testOK -1
+    puts "failed-> analysis failed $okT $okP"
+}
+
+set scale 0.0
+set error 0.0
+foreach OpenSeesR $transformation exactR $penalty {
+    set scale [expr max($scale, abs($exactR))]
+    set error [expr max($error, abs($OpenSeesR-$exactR))]
+}
+foreach dof {1 2 6} {
+    puts [format "%5d%18.10e%18.10e" $dof \
+	      [lindex $transformation [expr $dof-1]] [lindex $penalty [expr $dof-1]]]
+}
+if {$scale == 0.0 || $error > $tol*$scale} {
+    set testOK -1
+    puts "failed-> $error $scale"
+}
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test RigidDiaphragm.tcl \n\n"
+    puts $results "| PASSED |  RigidDiaphragm.tcl"
+} else {
+    puts "FAILED Verification Test RigidDiaphragm.tcl \n\n"
+    puts $results "FAILED : RigidDiaphragm.tcl"
+}
+close $results
@@ -0,0 +1,81 @@
+# Rotational uniform excitation of a portal frame whose node is moved.
+#
+# The influence matrix of a rotational excitation (dof 3 in 2d) depends
+# on the coordinates of the nodes. The frame is excited together with a
+# horizontal excitation, a node is moved with setNodeCoord between steps,
+# and the analysis continues. The response must be that of the same
+# analysis in which the patterns are removed and formed afresh after the
+# node has been moved.
+
+puts "RotationalExcitation.tcl: portal frame - rotational excitation of a moved node"
+
+proc frame {refresh} {
+    wipe
+    model Basic -ndm 2 -ndf 3
+
+    node 1 0.0   0.0
+    node 2 0.0 120.0
+    node 3 240.0 120.0
+    node 4 240.0   0.0
+    fix 1 1 1 1
+    fix 4 1 1 1
+    mass 2 1.0 1.0 0.0
+    mass 3 1.0 1.0 0.0
+
+    geomTransf Linear 1
+    element elasticBeamColumn 1 1 2 20.0 29000.0 1000.0 1
+    element elasticBeamColumn 2 2 3 20.0 29000.0 1000.0 1
+    element elasticBeamColumn 3 3 4 20.0 29000.0 1000.0 1
+
+    timeSeries Trig 1 0.0 100.0 0.5
+    timeSeries Trig 2 0.0 100.0 0.3
+    pattern UniformExcitation 1 3 -accel 1 -fact 0.01
+    pattern UniformExcitation 2 1 -accel 2
+
+    constraints Plain
+    numberer RCM
+    system BandGeneral
+    test NormDispIncr 1.0e-12 10
+    algorithm Linear
+    integrator Newmark 0.5 0.25
+    analysis Transient
+
+    analyze 10 0.02
+    setNodeCoord 3 1 200.0
+    if {$refresh} {
+	remove loadPattern 1
+	remove loadPattern 2
+	pattern UniformExcitation 1 3 -accel 1 -fact 0.01
+	pattern UniformExcitation 2 1 -accel 2
+    }
+    analyze 10 0.02
+    return [list [nodeDisp 2 1] [nodeDisp 3 1] [nodeDisp 3 2] [nodeDisp 3 3]]
+}
+
+set testOK 0
+set tol 1.0e-10
+
+set kept  [frame 0]
+set fresh [frame 1]
+
+set scale 0.0
+set error 0.0
+foreach OpenSeesR $kept exactR $fresh {
+    puts [format "%18.10e%18.10e" $OpenSeesR $exactR]
+    set scale [expr max($scale, abs($exactR))]
+    set error [expr max($error, abs($OpenSeesR-$exactR))]
+}
+if {$scale == 0.0 || $error > $tol*$scale} {
+    set testOK -1
+    puts "failed-> $error $scale"
+}
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test RotationalExcitation.tcl \n\n"
+    puts $results "| PASSED |  RotationalExcitation.tcl"
+} else {
+    puts "FAILED Verification Test RotationalExcitation.tcl \n\n"
+    puts $results "FAILED : RotationalExcitation.tcl"
+}
+close $results
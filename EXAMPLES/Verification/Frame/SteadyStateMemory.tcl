@@ -0,0 +1,83 @@
+# Allocations of a dynamic analysis in steady state.
+#
+# A portal frame of force-based fiber elements is shaken past yield with
+# Newton iterations. Once the first steps have been taken, the Vector,
+# Matrix and ID storage of the state determination, assembly and solution
+# is served by the arrays released by the previous steps, and further
+# steps must take no arrays from the heap. Wiping the model must then give
+# back to the heap the arrays kept for reuse.
+
+puts "SteadyStateMemory.tcl: yielding portal frame - allocations per step"
+
+wipe
+model Basic -ndm 2 -ndf 3
+node 1 0.0 0.0
+node 2 0.0 10.0
+node 3 5.0 10.0
+node 4 5.0 0.0
+fix 1 1 1 1
+fix 4 1 1 1
+mass 2 1.0 1.0 0.0
+mass 3 1.0 1.0 0.0
+
+uniaxialMaterial Steel01 1 50.0 29000.0 0.02
+section Fiber 1 {
+    patch rect 1 6 6 -5.0 -5.0 5.0 5.0
+}
+geomTransf PDelta 1
+element forceBeamColumn 1 1 2 5 1 1
+element forceBeamColumn 2 2 3 5 1 1
+element forceBeamColumn 3 3 4 5 1 1
+
+timeSeries Sine 1 0.0 10.0 1.0 -factor 200.0
+pattern UniformExcitation 1 1 -accel 1
+
+constraints Plain
+numberer RCM
+system BandGeneral
+test NormDispIncr 1.0e-10 20
+algorithm Newton
+integrator Newmark 0.5 0.25
+analysis Transient
+
+set testOK 0
+if {[analyze 5 0.01] != 0} {
+    set testOK -1
+    puts "failed-> the first steps did not converge"
+}
+
+memoryStatistics reset
+set numIter 0
+for {set step 0} {$step < 50} {incr step 1} {
+    if {[analyze 1 0.01] != 0} {
+	set testOK -1
+	puts "failed-> step $step did not converge"
+	break
+    }
+    incr numIter [testIter]
+}
+array set steady [memoryStatistics]
+puts [format "%10s%8d%15s%8d%15s%8d" steps 50 iterations $numIter allocations $steady(allocations)]
+if {$steady(allocations) != 0 || $steady(deallocations) != 0} {
+    set testOK -1
+    puts "failed-> steady state: [memoryStatistics]"
+}
+
+memoryStatistics reset
+wipe
+array set wiped [memoryStatistics]
+puts [format "%10s%8s%15s%8d" wipe "" deallocations $wiped(deallocations)]
+if {$wiped(deallocations) == 0 || $wiped(allocations) != 0} {
+    set testOK -1
+    puts "failed-> wipe: [memoryStatistics]"
+}
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test SteadyStateMemory.tcl \n\n"
+    puts $results "| PASSED |  SteadyStateMemory.tcl"
+} else {
+    puts "FAILED Verification Test SteadyStateMemory.tcl \n\n"
+    puts $results "FAILED : SteadyStateMemory.tcl"
+}
+close $results
@@ -0,0 +1,78 @@
+# Elastic portal frame under two simultaneous uniform excitations.
+#
+# The horizontal and vertical UniformExcitation patterns each form their
+# own influence vectors on the nodes at every step. By superposition the
+# response to both must equal the sum of the responses to each alone.
+
+puts "UniformExcitationXY.tcl: 2d portal frame - horizontal and vertical uniform excitation"
+
+proc portal {directions} {
+    wipe
+    model Basic -ndm 2 -ndf 3
+    node 1   0.0   0.0
+    node 2 240.0   0.0
+    node 3   0.0 144.0 -mass 0.5 0.5 0.0
+    node 4 240.0 144.0 -mass 0.5 0.5 0.0
+    node 5 120.0 144.0 -mass 1.0 1.0 0.0
+    fix 1 1 1 1
+    fix 2 1 1 1
+
+    geomTransf Linear 1
+    element elasticBeamColumn 1 1 3 20.0 29000.0 800.0 1
+    element elasticBeamColumn 2 2 4 20.0 29000.0 800.0 1
+    element elasticBeamColumn 3 3 5 30.0 29000.0 1200.0 1
+    element elasticBeamColumn 4 5 4 30.0 29000.0 1200.0 1
+
+    timeSeries Sine 1 0.0 2.0 0.35 -factor 386.4
+    timeSeries Sine 2 0.0 2.0 0.20 -factor 193.2
+    foreach dir $directions {
+	pattern UniformExcitation $dir $dir -accel $dir
+    }
+
+    constraints Plain
+    numberer RCM
+    system BandGeneral
+    test NormDispIncr 1.0e-12 10
+    algorithm Linear
+    integrator Newmark 0.5 0.25
+    analysis Transient
+    analyze 200 0.01
+
+    set u {}
+    foreach node {3 4 5} {
+	foreach dof {1 2 3} {
+	    lappend u [nodeDisp $node $dof]
+	}
+    }
+    return $u
+}
+
+set testOK 0
+set tol 1.0e-10
+
+set both [portal {1 2}]
+set x    [portal {1}]
+set y    [portal {2}]
+
+set scale 0.0
+foreach u $both {
+    set scale [expr max($scale, abs($u))]
+}
+foreach OpenSeesR $both ux $x uy $y {
+    set exactR [expr $ux + $uy]
+    puts [format "%15.8f%15.8f" $OpenSeesR $exactR]
+    if {[expr abs($OpenSeesR-$exactR)] > [expr $tol*$scale]} {
+	set testOK -1
+	puts "failed-> [expr abs($OpenSeesR-$exactR)] [expr $tol*$scale]"
+    }
+}
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test UniformExcitationXY.tcl \n\n"
+    puts $results "| PASSED |  UniformExcitationXY.tcl"
+} else {
+    puts "FAILED Verification Test UniformExcitationXY.tcl \n\n"
+    puts $results "FAILED : UniformExcitationXY.tcl"
+}
+close $results
@@ -0,0 +1,166 @@
+# Bulk model definition from a binary file.
+#
+# A wall of plane stress quads with a truss chord along its top is built
+# once with node, fix and element commands, and once with "bulkImport"
+# from a binary file holding the same nodes, fixities and elements, read
+# with one and with four threads. There are enough nodes and quads for
+# them to be constructed in parallel. The three models must give the same
+# displacements to the last bit under a static push and under a short
+# dynamic excitation.
+
+puts "BulkImport.tcl: quad wall with a truss chord - bulkImport and Tcl commands"
+
+set nx 40
+set ny 30
+set bulkFile bulkWall.bin
+
+proc nodeTag {i j} {
+    global nx
+    return [expr $j*($nx+1)+$i+1]
+}
+
+proc quadNodes {i j} {
+    return [list [nodeTag $i $j] [nodeTag [expr $i+1] $j] \
+		[nodeTag [expr $i+1] [expr $j+1]] [nodeTag $i [expr $j+1]]]
+}
+
+# the records read by bulkImport, with integers and reals in the byte
+# order of this machine
+proc writeBulkFile {fileName} {
+    global nx ny
+    set nodeTags {}
+    set crds {}
+    for {set j 0} {$j <= $ny} {incr j 1} {
+	for {set i 0} {$i <= $nx} {incr i 1} {
+	    lappend nodeTags [nodeTag $i $j]
+	    lappend crds [expr $i*0.25] [expr $j*0.25]
+	}
+    }
+    set fixTags {}
+    set codes {}
+    for {set i 0} {$i <= $nx} {incr i 1} {
+	lappend fixTags [nodeTag $i 0]
+	lappend codes 1 1
+    }
+    set quadTags {}
+    set quadNodes {}
+    for {set j 0} {$j < $ny} {incr j 1} {
+	for {set i 0} {$i < $nx} {incr i 1} {
+	    lappend quadTags [expr $j*$nx+$i+1]
+	    lappend quadNodes {*}[quadNodes $i $j]
+	}
+    }
+    set trussTags {}
+    set trussNodes {}
+    for {set i 0} {$i < $nx} {incr i 1} {
+	lappend trussTags [expr 5001+$i]
+	lappend trussNodes [nodeTag $i $ny] [nodeTag [expr $i+1] $ny]
+    }
+
+    set f [open $fileName w]
+    fconfigure $f -translation binary
+    puts -nonewline $f "OPSBULK1"
+    puts -nonewline $f [binary format nnnn*d* 1 [llength $nodeTags] 2 $nodeTags $crds]
+    puts -nonewline $f [binary format nnnn*n* 2 [llength $fixTags] 2 $fixTags $codes]
+    puts -nonewline $f [binary format na32a32nnnd*nnn*n* 3 quad PlaneStress 1 0 1 {0.2} \
+			    [llength $quadTags] 4 $quadTags $quadNodes]
+    puts -nonewline $f [binary format na32a32nnnd*nnn*n* 3 truss "" 2 0 1 {0.5} \
+			    [llength $trussTags] 2 $trussTags $trussNodes]
+    close $f
+}
+
+proc wall {how} {
+    global nx ny bulkFile
+    wipe
+    model Basic -ndm 2 -ndf 2
+    nDMaterial ElasticIsotropic 1 1000.0 0.25 0.002
+    uniaxialMaterial Elastic 2 5000.0
+
+    if {$how == "Tcl"} {
+	for {set j 0} {$j <= $ny} {incr j 1} {
+	    for {set i 0} {$i <= $nx} {incr i 1} {
+		node [nodeTag $i $j] [expr $i*0.25] [expr $j*0.25]
+	    }
+	}
+	for {set i 0} {$i <= $nx} {incr i 1} {
+	    fix [nodeTag $i 0] 1 1
+	}
+	for {set j 0} {$j < $ny} {incr j 1} {
+	    for {set i 0} {$i < $nx} {incr i 1} {
+		element quad [expr $j*$nx+$i+1] {*}[quadNodes $i $j] 0.2 PlaneStress 1
+	    }
+	}
+	for {set i 0} {$i < $nx} {incr i 1} {
+	    element truss [expr 5001+$i] [nodeTag $i $ny] [nodeTag [expr $i+1] $ny] 0.5 2
+	}
+    } else {
+	bulkImport $bulkFile -threads $how
+    }
+
+    set top [nodeTag $nx $ny]
+    timeSeries Linear 1
+    pattern Plain 1 1 {
+	load $top 1.0 -0.5
+	load [nodeTag 0 $ny] 1.0 0.0
+    }
+
+    constraints Plain
+    numberer RCM
+    system BandGeneral
+    test NormDispIncr 1.0e-12 10
+    algorithm Newton
+    integrator LoadControl 0.5
+    analysis Static
+    analyze 2
+
+    loadConst -time 0.0
+    timeSeries Sine 2 0.0 1.0 0.1 -factor 5.0
+    pattern UniformExcitation 2 1 -accel 2
+    wipeAnalysis
+    constraints Plain
+    numberer RCM
+    system BandGeneral
+    test NormDispIncr 1.0e-12 10
+    algorithm Newton
+    integrator Newmark 0.5 0.25
+    analysis Transient
+    analyze 10 0.01
+
+    set response [list [getNumElements] [llength [getNodeTags]]]
+    foreach node [getNodeTags] {
+	lappend response [nodeDisp $node 1] [nodeDisp $node 2]
+    }
+    lappend response [eleResponse 5001 axialForce]
+    return $response
+}
+
+set testOK 0
+
+writeBulkFile $bulkFile
+set exact [wall Tcl]
+foreach threads {1 4} {
+    set result [wall $threads]
+    set numDiffer 0
+    foreach OpenSeesR $result exactR $exact {
+	if {$OpenSeesR != $exactR} {
+	    incr numDiffer
+	}
+    }
+    puts [format "%10s%3d%10d%10d" "threads" $threads [llength $result] $numDiffer]
+    if {$numDiffer != 0 || [llength $result] != [llength $exact]} {
+	set testOK -1
+	puts "failed-> bulkImport with $threads threads: $numDiffer values differ"
+    }
+}
+file delete $bulkFile
+wipe
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test BulkImport.tcl \n\n"
+    puts $results "| PASSED |  BulkImport.tcl"
+} else {
+    puts "FAILED Verification Test BulkImport.tcl \n\n"
+    puts $results "FAILED : BulkImport.tcl"
+}
+close $results
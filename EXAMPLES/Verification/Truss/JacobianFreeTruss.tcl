@@ -0,0 +1,105 @@
+# Yielding planar truss solved with the Jacobian-free Newton-Krylov
+# algorithm.
+#
+# A static push past first yield is followed by a short transient
+# analysis. Each combination of preconditioner and tangent-vector product
+# of "algorithm JFNK" must reproduce the displacements found with Newton.
+
+puts "JacobianFreeTruss.tcl: yielding planar truss - JFNK against Newton"
+
+proc truss {algorithm} {
+    wipe
+    model Basic -ndm 2 -ndf 2
+    uniaxialMaterial Steel01 1 50.0 29000.0 0.02
+
+    set n 6
+    for {set i 0} {$i <= $n} {incr i 1} {
+	node [expr $i+1]   [expr $i*60.0]   0.0 -mass 0.1 0.1
+	node [expr $i+101] [expr $i*60.0] 60.0 -mass 0.1 0.1
+    }
+    fix 1 1 1; fix [expr $n+1] 0 1
+
+    set e 1
+    for {set i 1} {$i <= $n} {incr i 1} {
+	element truss $e $i [expr $i+1] 2.0 1;             incr e
+	element truss $e [expr $i+100] [expr $i+101] 2.0 1; incr e
+	element truss $e [expr $i+1] [expr $i+101] 1.0 1;   incr e
+	element truss $e $i [expr $i+101] 1.0 1;           incr e
+    }
+    element truss $e 1 101 1.0 1
+
+    timeSeries Linear 1
+    pattern Plain 1 1 {
+	for {set i 2} {$i <= $n} {incr i 1} {
+	    load [expr $i+100] 0.0 -10.0
+	}
+    }
+
+    constraints Plain
+    numberer RCM
+    system BandGeneral
+    test NormDispIncr 1.0e-10 50
+    eval "algorithm $algorithm"
+    integrator LoadControl 0.1
+    analysis Static
+    set ok [analyze 12]
+
+    loadConst -time 0.0
+    timeSeries Sine 2 0.0 1.0 0.4 -factor 100.0
+    pattern UniformExcitation 2 2 -accel 2
+    wipeAnalysis
+    constraints Plain
+    numberer RCM
+    system BandGeneral
+    test NormDispIncr 1.0e-10 50
+    eval "algorithm $algorithm"
+    integrator Newmark 0.5 0.25
+    analysis Transient
+    incr ok [analyze 40 0.01]
+
+    set u {}
+    foreach node [list 4 104 [expr $n+1]] {
+	lappend u [nodeDisp $node 1] [nodeDisp $node 2]
+    }
+    return [list $ok $u]
+}
+
+set testOK 0
+set tol 1.0e-6
+
+set exact [lindex [truss Newton] 1]
+set scale 0.0
+foreach u $exact {
+    set scale [expr max($scale, abs($u))]
+}
+
+foreach pc {none diagonal factor} {
+    foreach product {difference element} {
+	set label "-pc $pc -product $product"
+	set result [truss "JFNK $label -eta 1.0e-8"]
+	if {[lindex $result 0] != 0} {
+	    set testOK -1
+	    puts "failed-> $label did not converge"
+	    continue
+	}
+	set error 0.0
+	foreach OpenSeesR [lindex $result 1] exactR $exact {
+	    set error [expr max($error, abs($OpenSeesR-$exactR))]
+	}
+	puts [format "%35s%15.3e" $label [expr $error/$scale]]
+	if {$error > $tol*$scale} {
+	    set testOK -1
+	    puts "failed-> $label: [expr $error/$scale] $tol"
+	}
+    }
+}
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test JacobianFreeTruss.tcl \n\n"
+    puts $results "| PASSED |  JacobianFreeTruss.tcl"
+} else {
+    puts "FAILED Verification Test JacobianFreeTruss.tcl \n\n"
+    puts $results "FAILED : JacobianFreeTruss.tcl"
+}
+close $results
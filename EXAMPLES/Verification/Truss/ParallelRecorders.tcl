@@ -0,0 +1,137 @@
+# Recorders of a long planar truss girder.
+#
+# The girder has more than 4096 nodes and bottom-to-top drifts, so node
+# and drift recorders share them out between threads when built with
+# OpenMP. An element recorder created with -parallel gathers its
+# responses the same way. The recorded values must be the ones queried
+# from the domain, and the element recorder must write the same file with
+# and without -parallel.
+
+puts "ParallelRecorders.tcl: planar truss girder - recorders with more than 4096 nodes"
+
+set n 2100
+set precision 12
+
+wipe
+model Basic -ndm 2 -ndf 2
+uniaxialMaterial Elastic 1 1000.0
+
+set bottom {}
+set top {}
+for {set i 0} {$i <= $n} {incr i 1} {
+    node [expr $i+1]     [expr $i*1.0] 0.0
+    node [expr $i+10001] [expr $i*1.0] 1.0
+    lappend bottom [expr $i+1]
+    lappend top    [expr $i+10001]
+}
+fix 1 1 1; fix 10001 1 1
+
+set e 1
+for {set i 1} {$i <= $n} {incr i 1} {
+    element truss $e $i [expr $i+1] 1.0 1;                 incr e
+    element truss $e [expr $i+10000] [expr $i+10001] 1.0 1; incr e
+    element truss $e [expr $i+1] [expr $i+10001] 1.0 1;     incr e
+    element truss $e $i [expr $i+10001] 1.0 1;             incr e
+}
+set numEle [expr $e-1]
+
+timeSeries Linear 1
+pattern Plain 1 1 {
+    for {set i 2} {$i <= $n+1} {incr i 1} {
+	load [expr $i+10000] 0.0 -1.0e-6
+    }
+}
+
+recorder Node -file ParallelRecorders.node.out -precision $precision -time -dof 1 2 disp
+recorder Drift -file ParallelRecorders.drift.out -precision $precision -time -iNode {*}$bottom -jNode {*}$top -dof 1 -perpDirn 2
+recorder Element -file ParallelRecorders.ele.out -precision $precision -time -eleRange 1 $numEle axialForce
+recorder Element -file ParallelRecorders.parallel.out -precision $precision -time -parallel -eleRange 1 $numEle axialForce
+
+constraints Plain
+numberer RCM
+system BandGeneral
+test NormDispIncr 1.0e-12 10
+algorithm Linear
+integrator LoadControl 0.5
+analysis Static
+analyze 2
+remove recorders
+
+set testOK 0
+set tol 1.0e-10
+
+proc lastLine {file} {
+    set channel [open $file r]
+    set last {}
+    while {[gets $channel line] >= 0} {
+	if {[string trim $line] != ""} {
+	    set last $line
+	}
+    }
+    close $channel
+    return $last
+}
+
+proc compare {label recorded exact} {
+    global testOK tol
+    if {[llength $recorded] != [llength $exact]} {
+	set testOK -1
+	puts "failed-> $label: [llength $recorded] values recorded, [llength $exact] expected"
+	return
+    }
+    set scale 0.0
+    set error 0.0
+    foreach OpenSeesR $recorded exactR $exact {
+	set scale [expr max($scale, abs($exactR))]
+	set error [expr max($error, abs($OpenSeesR-$exactR))]
+    }
+    puts [format "%10s%10d%15.3e" $label [llength $exact] [expr $error/$scale]]
+    if {$error > $tol*$scale} {
+	set testOK -1
+	puts "failed-> $label: [expr $error/$scale] $tol"
+    }
+}
+
+set exact [getTime]
+foreach node [getNodeTags] {
+    lappend exact [nodeDisp $node 1] [nodeDisp $node 2]
+}
+compare node [lastLine ParallelRecorders.node.out] $exact
+
+set exact [getTime]
+foreach i $bottom j $top {
+    lappend exact [expr [nodeDisp $j 1] - [nodeDisp $i 1]]
+}
+compare drift [lastLine ParallelRecorders.drift.out] $exact
+
+set exact [getTime]
+for {set i 1} {$i <= $numEle} {incr i 1} {
+    lappend exact [eleResponse $i axialForce]
+}
+compare element [lastLine ParallelRecorders.parallel.out] $exact
+
+# the parallel element recorder writes what the serial one writes
+set channel [open ParallelRecorders.ele.out r]
+set serial [read $channel]
+close $channel
+set channel [open ParallelRecorders.parallel.out r]
+set parallel [read $channel]
+close $channel
+if {$serial != $parallel} {
+    set testOK -1
+    puts "failed-> the element recorder wrote different files with -parallel"
+}
+
+foreach file {node drift ele parallel} {
+    file delete ParallelRecorders.$file.out
+}
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test ParallelRecorders.tcl \n\n"
+    puts $results "| PASSED |  ParallelRecorders.tcl"
+} else {
+    puts "FAILED Verification Test ParallelRecorders.tcl \n\n"
+    puts $results "FAILED : ParallelRecorders.tcl"
+}
+close $results
@@ -0,0 +1,119 @@
+# Factorization counter of the analysis profiler.
+#
+# A planar truss is pushed past first yield and then excited dynamically.
+# The profiler counts a factorization each time the linear solver factors
+# a newly assembled matrix. Newton forms and factors a tangent for every
+# iteration, while modified Newton factors the tangent once per step and
+# reuses it for the remaining iterations of the step.
+
+puts "ProfileFactorizations.tcl: yielding planar truss - factorization counts"
+
+proc truss {algorithm system} {
+    wipe
+    model Basic -ndm 2 -ndf 2
+    uniaxialMaterial Steel01 1 50.0 29000.0 0.02
+
+    set n 6
+    for {set i 0} {$i <= $n} {incr i 1} {
+	node [expr $i+1]   [expr $i*60.0]   0.0 -mass 0.1 0.1
+	node [expr $i+101] [expr $i*60.0] 60.0 -mass 0.1 0.1
+    }
+    fix 1 1 1; fix [expr $n+1] 0 1
+
+    set e 1
+    for {set i 1} {$i <= $n} {incr i 1} {
+	element truss $e $i [expr $i+1] 2.0 1;             incr e
+	element truss $e [expr $i+100] [expr $i+101] 2.0 1; incr e
+	element truss $e [expr $i+1] [expr $i+101] 1.0 1;   incr e
+	element truss $e $i [expr $i+101] 1.0 1;           incr e
+    }
+    element truss $e 1 101 1.0 1
+
+    timeSeries Linear 1
+    pattern Plain 1 1 {
+	for {set i 2} {$i <= $n} {incr i 1} {
+	    load [expr $i+100] 0.0 -10.0
+	}
+    }
+
+    profile reset
+    profile start
+
+    set steps 0
+    set iterations 0
+
+    constraints Plain
+    numberer RCM
+    system $system
+    test NormDispIncr 1.0e-10 100
+    algorithm $algorithm
+    integrator LoadControl 0.1
+    analysis Static
+    for {set i 0} {$i < 12} {incr i 1} {
+	if {[analyze 1] != 0} {
+	    return -1
+	}
+	incr steps
+	incr iterations [testIter]
+    }
+
+    loadConst -time 0.0
+    timeSeries Sine 2 0.0 1.0 0.4 -factor 100.0
+    pattern UniformExcitation 2 2 -accel 2
+    wipeAnalysis
+    constraints Plain
+    numberer RCM
+    system $system
+    test NormDispIncr 1.0e-10 100
+    algorithm $algorithm
+    integrator Newmark 0.5 0.25
+    analysis Transient
+    for {set i 0} {$i < 40} {incr i 1} {
+	if {[analyze 1 0.01] != 0} {
+	    return -1
+	}
+	incr steps
+	incr iterations [testIter]
+    }
+
+    profile stop
+    if {![regexp {"Factorizations": ([0-9]+)} [profile report -json] -> factorizations]} {
+	return -1
+    }
+    return [list $steps $iterations $factorizations]
+}
+
+set testOK 0
+
+foreach system {BandGeneral BandSPD ProfileSPD SparseSPD FullGeneral SparseGeneral UmfPack} {
+    foreach algorithm {Newton ModifiedNewton} {
+	set result [truss $algorithm $system]
+	if {$result == -1} {
+	    set testOK -1
+	    puts "failed-> $algorithm with $system did not converge"
+	    continue
+	}
+	lassign $result steps iterations factorizations
+	if {$algorithm == "Newton"} {
+	    set expected $iterations
+	} else {
+	    set expected $steps
+	}
+	puts [format "%15s%15s%8d%8d%8d" $system $algorithm $steps $iterations $factorizations]
+	if {$factorizations != $expected || $iterations <= $steps} {
+	    set testOK -1
+	    puts "failed-> $algorithm with $system: $factorizations factorizations, expected $expected"
+	}
+    }
+}
+wipe
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test ProfileFactorizations.tcl \n\n"
+    puts $results "| PASSED |  ProfileFactorizations.tcl"
+} else {
+    puts "FAILED Verification Test ProfileFactorizations.tcl \n\n"
+    puts $results "FAILED : ProfileFactorizations.tcl"
+}
+close $results
@@ -0,0 +1,94 @@
+# Staged construction of a planar truss girder.
+#
+# Between two analyses, diagonals are replaced and bars are added. The
+# changes are made once inside "domainChange begin" ... "domainChange
+# commit", and once with the analysis wiped and rebuilt. The two must give
+# the same displacements. While the modification is open, the analysis
+# must refuse to run.
+
+puts "StagedTruss.tcl: planar truss girder - staged element changes"
+
+proc girder {staging} {
+    wipe
+    model Basic -ndm 2 -ndf 2
+    uniaxialMaterial Elastic 1 1000.0
+
+    set n 40
+    for {set i 0} {$i <= $n} {incr i 1} {
+	node [expr $i+1]   [expr $i*1.0] 0.0
+	node [expr $i+101] [expr $i*1.0] 1.0
+    }
+    fix 1 1 1; fix 101 1 1
+
+    set e 1
+    for {set i 1} {$i <= $n} {incr i 1} {
+	element truss $e $i [expr $i+1] 1.0 1;             incr e
+	element truss $e [expr $i+100] [expr $i+101] 1.0 1; incr e
+	element truss $e [expr $i+1] [expr $i+101] 1.0 1;   incr e
+	element truss $e $i [expr $i+101] 1.0 1;           incr e
+    }
+
+    timeSeries Linear 1
+    pattern Plain 1 1 {
+	load [expr $n+101] 0.0 -1.0
+    }
+    proc setup {} {
+	constraints Plain; numberer RCM; system BandGeneral
+	test NormDispIncr 1e-10 10; algorithm Newton
+	integrator LoadControl 0.1; analysis Static
+    }
+    setup
+    analyze 5
+
+    set refused 1
+    if {$staging == "batch"} {
+	domainChange begin
+    }
+    for {set i 1} {$i <= $n} {incr i 1} {
+	element truss [expr 1000+$i] [expr $i+100] [expr $i+1] 1.0 1
+    }
+    for {set i 1} {$i <= $n} {incr i 2} {
+	remove element [expr 4*$i]
+	element truss [expr 4*$i] $i [expr $i+101] 2.0 1
+    }
+    if {$staging == "batch"} {
+	set refused [expr [analyze 1] < 0]
+	domainChange commit
+    } else {
+	wipeAnalysis
+	setup
+    }
+    analyze 5
+
+    return [list $refused [nodeDisp [expr $n+101] 1] [nodeDisp [expr $n+101] 2]]
+}
+
+set testOK 0
+set tol 1.0e-12
+
+set batch   [girder batch]
+set rebuilt [girder rebuild]
+
+if {[lindex $batch 0] != 1} {
+    set testOK -1
+    puts "failed-> analyze ran while the domain was being modified"
+}
+foreach i {1 2} {
+    set OpenSeesR [lindex $batch $i]
+    set exactR    [lindex $rebuilt $i]
+    puts [format "%15.8f%15.8f" $OpenSeesR $exactR]
+    if {[expr abs($OpenSeesR-$exactR)] > $tol} {
+	set testOK -1
+	puts "failed-> [expr abs($OpenSeesR-$exactR)] $tol"
+    }
+}
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test StagedTruss.tcl \n\n"
+    puts $results "| PASSED |  StagedTruss.tcl"
+} else {
+    puts "FAILED Verification Test StagedTruss.tcl \n\n"
+    puts $results "FAILED : StagedTruss.tcl"
+}
+close $results
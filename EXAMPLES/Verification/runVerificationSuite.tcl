@@ -11,18 +11,38 @@ source sdofTransient.tcl
 source SmallEigen.tcl
 source NewmarkIntegrator.tcl
 source mdofModal.tcl
+source modalTransient.tcl
+source AdaptiveOutput.tcl
+source FusedNewton.tcl
+source ContactSearch.tcl
+source BatchTransient.tcl
 cd ..
 
 source Truss/PlanarTruss.tcl
 source Truss/PlanarTruss.Extra.tcl
+source Truss/StagedTruss.tcl
+source Truss/JacobianFreeTruss.tcl
+source Truss/ParallelRecorders.tcl
+source Truss/ProfileFactorizations.tcl
 
 source Frame/PortalFrame2d.tcl
 source Frame/EigenFrame.tcl
 source Frame/EigenFrame.Extra.tcl
+source Frame/EigenSolvers.tcl
+source Frame/UniformExcitationXY.tcl
+source Frame/RotationalExcitation.tcl
+source Frame/RigidDiaphragm.tcl
+source Frame/CorotCantilever.tcl
+source Frame/ParallelForceFrame.tcl
+source Frame/BranchParallel.tcl
+source Frame/SteadyStateMemory.tcl
+source Frame/ElementRecorders.tcl
+source Frame/EnvelopeRecorders.tcl
 source Frame/AISC25.tcl
 
 source Plane/PlaneStrain.tcl
 source Plane/QuadBending.tcl
+source Plane/BulkImport.tcl
 
 # Shells
 source Shell/PinchedCylinder.tcl
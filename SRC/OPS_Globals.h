@@ -41,10 +41,12 @@ extern OPS_Stream *opserrPtr;
 class Domain;
 class Element;
 
-extern double   ops_Dt;                // current delta T for current domain doing an update
+// The following are thread_local so that independent domains can be
+// updated concurrently from different threads
+extern thread_local double   ops_Dt;                // current delta T for current domain doing an update
 extern int ops_Creep;
-extern Domain  *ops_TheActiveDomain;   // current domain undergoing an update
-extern Element *ops_TheActiveElement;  // current element undergoing an update
+extern thread_local Domain  *ops_TheActiveDomain;   // current domain undergoing an update
+extern thread_local Element *ops_TheActiveElement;  // current element undergoing an update
 
 // global variable for initial state analysis
 // added: Chris McGann, University of Washington
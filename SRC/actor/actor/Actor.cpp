@@ -243,6 +243,24 @@ Actor::recvID(ID &theID, ChannelAddress *theAddress )
 	return theChannel->recvID(0, commitTag, theID,theAddress);	
 }
 
+int
+Actor::startBatch(void)
+{
+    return theChannel->startBatch();
+}
+
+int
+Actor::endBatch(void)
+{
+    return theChannel->endBatch();
+}
+
+int
+Actor::progress(void)
+{
+    return theChannel->progress();
+}
+
 
 void
 Actor::setCommitTag(int tag)
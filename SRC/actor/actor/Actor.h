@@ -92,6 +92,10 @@ class Actor
     virtual int recvID(ID &theID, 
 		       ChannelAddress *theAddress =0);  
 
+    int startBatch(void);
+    int endBatch(void);
+    int progress(void);
+
     Channel 		*getChannelPtr(void) const;
     FEM_ObjectBroker 	*getObjectBrokerPtr(void) const;    
     ChannelAddress  	*getShadowsAddressPtr(void) const;            
@@ -68,6 +68,24 @@ Channel::getTag(void)
 		return tag;
 }
 
+int
+Channel::startBatch(void)
+{
+  return 0;
+}
+
+int
+Channel::endBatch(void)
+{
+  return 0;
+}
+
+int
+Channel::progress(void)
+{
+  return 0;
+}
+
 int
 Channel::recvMsgUnknownSize(int dataTag, int commitTag, Message &, ChannelAddress *theAddress)
 {
@@ -109,6 +109,15 @@ class Channel
 		    ID &theID, 
 		    ChannelAddress *theAddress =0) =0;      
 
+    // methods to mark the sends between them as one batch, which a
+    // channel may coalesce into a single message to the peer
+    virtual int startBatch(void);
+    virtual int endBatch(void);
+
+    // method to advance outstanding sends and receives without blocking,
+    // called by the analysis between its computations
+    virtual int progress(void);
+
   protected:
     
   private:
@@ -36,13 +36,42 @@
 #include <Message.h>
 #include <MPI_ChannelAddress.h>
 #include <MovableObject.h>
+#include <string.h>
+
+bool MPI_Channel::aggregate = false;
+
+namespace {
+  // entries of an aggregated message: a header, then the data, each
+  // padded to a multiple of a double
+  enum EntryType {CharEntry = 1, DoubleEntry = 2, IntEntry = 3};
+
+  struct EntryHeader {
+    int type;
+    int count;
+  };
+
+  constexpr std::size_t Alignment = sizeof(double);
+
+  inline std::size_t
+  padded(std::size_t numBytes)
+  {
+    return (numBytes + Alignment - 1)/Alignment*Alignment;
+  }
+
+  // spare send buffers kept for reuse by a channel
+  constexpr std::size_t MaxSpareBuffers = 4;
+
+  MPI_Channel::Statistics theStatistics = {0, 0, 0, 0};
+}
 
 // MPI_Channel(unsigned int other_Port, char *other_InetAddr): 
 // 	constructor to open a socket with my inet_addr and with a port number 
 //	given by the OS. 
 
 MPI_Channel::MPI_Channel(int other)
- :otherTag(other), otherComm(MPI_COMM_WORLD)
+ :otherTag(other), otherComm(MPI_COMM_WORLD),
+  batchDepth(0), sendTag(other), sendComm(MPI_COMM_WORLD),
+  recvPos(0), recvTag(other)
 {
   
 }    
@@ -52,7 +81,14 @@ MPI_Channel::MPI_Channel(int other)
 
 MPI_Channel::~MPI_Channel()
 {
-
+  // complete any outstanding sends, unless MPI has already been shut down
+  int finalized = 0;
+  MPI_Finalized(&finalized);
+  if (finalized == 0) {
+    batchDepth = 0;
+    this->flush();
+    this->completeSends(true);
+  }
 }
 
 
@@ -166,10 +202,15 @@ MPI_Channel::recvMsg(int dbTag, int commitTag, Message &msg, ChannelAddress *the
     gMsg = msg.data;
     int nleft = msg.length;
 
+    if (aggregate)
+      return this->recvEntry(CharEntry, gMsg, nleft, sizeof(char), "recvMsg()");
+
     MPI_Status status;
     MPI_Recv((void *)gMsg, nleft, MPI_CHAR, otherTag, 0, otherComm, &status);
     int count =0;
     MPI_Get_count(&status, MPI_CHAR, &count);
+    theStatistics.messagesReceived++;
+    theStatistics.bytesReceived += count;
     if (count != nleft) {
       opserr << "MPI_Channel::recvMesg() -";
       opserr << " incorrect size of Message received ";
@@ -217,7 +258,12 @@ MPI_Channel::sendMsg(int dbTag, int commitTag, const Message &msg, ChannelAddres
     gMsg = msg.data;
     int nleft = msg.length;
 
+    if (aggregate)
+      return this->sendEntry(CharEntry, gMsg, nleft, sizeof(char));
+
     MPI_Send((void *)gMsg, nleft, MPI_CHAR, otherTag, 0, otherComm);
+    theStatistics.messagesSent++;
+    theStatistics.bytesSent += nleft;
     return 0;
 }
 
@@ -246,11 +292,16 @@ MPI_Channel::recvMatrix(int dbTag, int commitTag, Matrix &theMatrix, ChannelAddr
     char *gMsg = (char *)data;;
     int nleft  =  theMatrix.dataSize;
 
+    if (aggregate)
+      return this->recvEntry(DoubleEntry, gMsg, nleft, sizeof(double), "recvMatrix()");
+
     MPI_Status status;
     MPI_Recv((void *)gMsg, nleft, MPI_DOUBLE, otherTag, 0, 
 	     otherComm, &status);
     int count = 0;
     MPI_Get_count(&status, MPI_DOUBLE, &count);
+    theStatistics.messagesReceived++;
+    theStatistics.bytesReceived += count*sizeof(double);
     if (count != nleft) {
       opserr << "MPI_Channel::recvMatrix() -";
       opserr << " incorrect number of entries for Matrix received: " << count << "\n";
@@ -288,7 +339,12 @@ MPI_Channel::sendMatrix(int dbTag, int commitTag, const Matrix &theMatrix, Chann
     char *gMsg = (char *)data;
     int nleft  =  theMatrix.dataSize;
 
+    if (aggregate)
+      return this->sendEntry(DoubleEntry, gMsg, nleft, sizeof(double));
+
     MPI_Send((void *)gMsg, nleft, MPI_DOUBLE, otherTag, 0, otherComm);
+    theStatistics.messagesSent++;
+    theStatistics.bytesSent += nleft*sizeof(double);
 
     return 0;
 }
@@ -327,10 +383,15 @@ MPI_Channel::recvVector(int dbTag, int commitTag, Vector &theVector, ChannelAddr
     char *gMsg = (char *)data;;
     int nleft =  theVector.sz;
 
+    if (aggregate)
+      return this->recvEntry(DoubleEntry, gMsg, nleft, sizeof(double), "recvVector()");
+
     MPI_Status status;
     MPI_Recv((void *)gMsg, nleft, MPI_DOUBLE, otherTag, 0, otherComm, &status);
     int count =0;
     MPI_Get_count(&status, MPI_DOUBLE, &count);
+    theStatistics.messagesReceived++;
+    theStatistics.bytesReceived += count*sizeof(double);
     if (count != nleft) {
       opserr << "MPI_Channel::recvVector() -";
       opserr << " incorrect number of entries for Vector received: " << count << 
@@ -372,7 +433,12 @@ MPI_Channel::sendVector(int dbTag, int commitTag, const Vector &theVector, Chann
 
     //    opserr << "MPI:sendVector " << otherTag << " " << theVector.Size() << endln;
 
+    if (aggregate)
+      return this->sendEntry(DoubleEntry, gMsg, nleft, sizeof(double));
+
     MPI_Send((void *)gMsg, nleft, MPI_DOUBLE, otherTag, 0, otherComm);
+    theStatistics.messagesSent++;
+    theStatistics.bytesSent += nleft*sizeof(double);
     
     return 0;
 }
@@ -404,10 +470,15 @@ MPI_Channel::recvID(int dbTag, int commitTag, ID &theID, ChannelAddress *theAddr
     char *gMsg = (char *)data;;
     int nleft =  theID.sz;
 
+    if (aggregate)
+      return this->recvEntry(IntEntry, gMsg, nleft, sizeof(int), "recvID()");
+
     MPI_Status status;
     MPI_Recv((void *)gMsg, nleft, MPI_INT, otherTag, 0, otherComm, &status);
     int count =0;
     MPI_Get_count(&status, MPI_INT, &count);
+    theStatistics.messagesReceived++;
+    theStatistics.bytesReceived += count*sizeof(int);
 
     if (count != nleft) {
       opserr << "MPI_Channel::recvID() -";
@@ -446,11 +517,256 @@ MPI_Channel::sendID(int dbTag, int commitTag, const ID &theID, ChannelAddress *t
     char *gMsg = (char *)data;
     int nleft =  theID.sz;
 
+    if (aggregate)
+      return this->sendEntry(IntEntry, gMsg, nleft, sizeof(int));
+
     MPI_Send((void *)gMsg, nleft, MPI_INT, otherTag, 0, otherComm);
+    theStatistics.messagesSent++;
+    theStatistics.bytesSent += nleft*sizeof(int);
+
+    return 0;
+}
+
+
+// int startBatch(), endBatch():
+//	Methods to mark the sends between them as one batch; with
+//	aggregation on they are sent as one message at the outermost
+//	endBatch().
+
+int
+MPI_Channel::startBatch(void)
+{
+    if (aggregate)
+      batchDepth++;
+    return 0;
+}
+
+int
+MPI_Channel::endBatch(void)
+{
+    if (batchDepth == 0)
+      return 0;
+
+    batchDepth--;
+    if (batchDepth == 0)
+      return this->flush();
 
     return 0;
 }
 
+// int progress():
+//	Method to complete the sends that have finished and take in the
+//	messages that have arrived, without waiting for either.
+
+int
+MPI_Channel::progress(void)
+{
+    this->completeSends(false);
+
+    if (aggregate) {
+      int res;
+      while ((res = this->recvBuffered(false)) > 0)
+	;
+      if (res < 0)
+	return -1;
+    }
+    return 0;
+}
+
+void
+MPI_Channel::setAggregation(bool onOff)
+{
+    aggregate = onOff;
+}
+
+bool
+MPI_Channel::getAggregation(void)
+{
+    return aggregate;
+}
+
+MPI_Channel::Statistics
+MPI_Channel::getStatistics(void)
+{
+    return theStatistics;
+}
+
+void
+MPI_Channel::resetStatistics(void)
+{
+    theStatistics = {0, 0, 0, 0};
+}
+
+
+int
+MPI_Channel::sendEntry(int type, const void *data, int count, int size)
+{
+    // entries for another process go out before this one is added
+    if (!sendBuffer.empty() && (sendTag != otherTag || sendComm != otherComm))
+      if (this->flush() != 0)
+	return -1;
+
+    sendTag  = otherTag;
+    sendComm = otherComm;
+
+    EntryHeader header = {type, count};
+    std::size_t numBytes = (std::size_t)count*size;
+    std::size_t loc = sendBuffer.size();
+    sendBuffer.resize(loc + padded(sizeof(EntryHeader)) + padded(numBytes));
+    memcpy(&sendBuffer[loc], &header, sizeof(EntryHeader));
+    if (numBytes != 0)
+      memcpy(&sendBuffer[loc + padded(sizeof(EntryHeader))], data, numBytes);
+
+    if (batchDepth == 0)
+      return this->flush();
+
+    return 0;
+}
+
+
+int
+MPI_Channel::recvEntry(int type, void *data, int count, int size, const char *method)
+{
+    if (recvPos < recvBuffer.size() && recvTag != otherTag) {
+      opserr << "MPI_Channel::" << method << " -";
+      opserr << " entries from process " << recvTag << " have not been read\n";
+      return -1;
+    }
+
+    if (recvPos == recvBuffer.size())
+      if (this->recvBuffered(true) < 0)
+	return -1;
+
+    EntryHeader header;
+    memcpy(&header, &recvBuffer[recvPos], sizeof(EntryHeader));
+    recvPos += padded(sizeof(EntryHeader));
+
+    int entrySize = header.type == CharEntry ? sizeof(char) :
+                    header.type == IntEntry  ? sizeof(int)  : sizeof(double);
+    std::size_t numBytes = (std::size_t)header.count*entrySize;
+
+    if (header.type != type || header.count != count) {
+      recvPos += padded(numBytes);
+      opserr << "MPI_Channel::" << method << " -";
+      opserr << " incorrect number of entries received: " << header.count;
+      opserr << " expected: " << count << endln;
+      return -1;
+    }
+
+    if (numBytes != 0)
+      memcpy(data, &recvBuffer[recvPos], numBytes);
+    recvPos += padded(numBytes);
+
+    return 0;
+}
+
+
+// int flush():
+//	Method to post a non-blocking send of the buffered entries.
+
+int
+MPI_Channel::flush(void)
+{
+    if (sendBuffer.empty())
+      return 0;
+
+    this->completeSends(false);
+
+    pendingSends.emplace_back();
+    PendingSend &theSend = pendingSends.back();
+    theSend.data.swap(sendBuffer);
+    if (!spareBuffers.empty()) {
+      sendBuffer.swap(spareBuffers.back());
+      spareBuffers.pop_back();
+    }
+
+    int numBytes = (int)theSend.data.size();
+    if (MPI_Isend((void *)theSend.data.data(), numBytes, MPI_BYTE, 
+		  sendTag, 0, sendComm, &theSend.request) != MPI_SUCCESS) {
+      opserr << "MPI_Channel::flush() - failed to send " << numBytes << " bytes\n";
+      pendingSends.pop_back();
+      return -1;
+    }
+
+    theStatistics.messagesSent++;
+    theStatistics.bytesSent += numBytes;
+    return 0;
+}
+
+
+// int completeSends(bool wait):
+//	Method to release the buffers of the sends that have completed,
+//	waiting for all of them if wait is true.
+
+int
+MPI_Channel::completeSends(bool wait)
+{
+    std::size_t numPending = 0;
+    for (std::size_t i=0; i<pendingSends.size(); i++) {
+      int done = 1;
+      if (wait)
+	MPI_Wait(&pendingSends[i].request, MPI_STATUS_IGNORE);
+      else
+	MPI_Test(&pendingSends[i].request, &done, MPI_STATUS_IGNORE);
+
+      if (done) {
+	if (spareBuffers.size() < MaxSpareBuffers) {
+	  pendingSends[i].data.clear();
+	  spareBuffers.push_back(std::move(pendingSends[i].data));
+	}
+      } else {
+	if (i != numPending)
+	  pendingSends[numPending] = std::move(pendingSends[i]);
+	numPending++;
+      }
+    }
+    pendingSends.resize(numPending);
+    return 0;
+}
+
+
+// int recvBuffered(bool wait):
+//	Method to take in the next message from the peer and add its
+//	entries to the receive buffer; returns 1 if a message was taken
+//	in, 0 if wait is false and no message has arrived.
+
+int
+MPI_Channel::recvBuffered(bool wait)
+{
+    // entries from another process are not mixed with those not yet read
+    if (recvPos < recvBuffer.size() && recvTag != otherTag)
+      return 0;
+
+    int flag = 1;
+    MPI_Status status;
+    if (wait)
+      MPI_Probe(otherTag, 0, otherComm, &status);
+    else
+      MPI_Iprobe(otherTag, 0, otherComm, &flag, &status);
+
+    if (flag == 0)
+      return 0;
+
+    int numBytes = 0;
+    MPI_Get_count(&status, MPI_BYTE, &numBytes);
+
+    // drop the entries already read
+    if (recvPos != 0) {
+      recvBuffer.erase(recvBuffer.begin(), recvBuffer.begin() + recvPos);
+      recvPos = 0;
+    }
+
+    std::size_t loc = recvBuffer.size();
+    recvBuffer.resize(loc + numBytes);
+    MPI_Recv((void *)&recvBuffer[loc], numBytes, MPI_BYTE, 
+	     otherTag, 0, otherComm, &status);
+    recvTag = otherTag;
+
+    theStatistics.messagesReceived++;
+    theStatistics.bytesReceived += numBytes;
+    return 1;
+}
+
 
 /*
 int 
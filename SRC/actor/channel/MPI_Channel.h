@@ -30,12 +30,22 @@
 // MPI_Channel is a sub-class of channel. It is implemented with Berkeley
 // stream sockets using the TCP protocol. Messages delivery is garaunteed. 
 // Communication is full-duplex between a pair of connected sockets.
+//
+// When aggregation is on (it must then be on in every process) each
+// send is copied into a buffer for the peer, and the buffer is posted
+// with a non-blocking send when the outermost endBatch() is reached, or
+// at once for a send outside of any batch; the sends between
+// startBatch() and endBatch() thus travel as one message. The receiver
+// takes one message at a time and hands out its entries in the order
+// they were sent. progress() completes finished sends and takes in any
+// message that has arrived, so that it can be called during computation.
 
 #ifndef MPI_Channel_h
 #define MPI_Channel_h
 
 #include <mpi.h>
 #include <Channel.h>
+#include <vector>
 
 class MPI_Channel : public Channel
 {
@@ -74,12 +84,52 @@ class MPI_Channel : public Channel
     int sendID(int dbTag, int commitTag, const ID &theID, ChannelAddress *theAddress =0);
     int recvID(int dbTag, int commitTag, ID &theID, ChannelAddress *theAddress =0);    
     
+    int startBatch(void);
+    int endBatch(void);
+    int progress(void);
+
+    static void setAggregation(bool onOff);
+    static bool getAggregation(void);
+
+    // messages and bytes passed to and taken from MPI by all channels
+    struct Statistics {
+      long long messagesSent;
+      long long bytesSent;
+      long long messagesReceived;
+      long long bytesReceived;
+    };
+    static Statistics getStatistics(void);
+    static void resetStatistics(void);
     
   protected:
 	
   private:
+    int sendEntry(int type, const void *data, int count, int size);
+    int recvEntry(int type, void *data, int count, int size, const char *method);
+    int flush(void);
+    int recvBuffered(bool wait);
+    int completeSends(bool wait);
+
     int otherTag;
     MPI_Comm otherComm;    
+
+    // aggregation buffers
+    int batchDepth;
+    std::vector<char> sendBuffer;
+    int sendTag;                  // peer of the entries in sendBuffer
+    MPI_Comm sendComm;
+    std::vector<char> recvBuffer;
+    std::size_t recvPos;          // next unread entry in recvBuffer
+    int recvTag;                  // peer of the entries in recvBuffer
+
+    struct PendingSend {
+      MPI_Request request;
+      std::vector<char> data;
+    };
+    std::vector<PendingSend> pendingSends;
+    std::vector<std::vector<char> > spareBuffers;
+
+    static bool aggregate;
 };
 
 
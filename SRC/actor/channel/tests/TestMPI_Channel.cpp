@@ -0,0 +1,147 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Purpose: This file is a driver to test the MPI_Channel. Two processes
+// exchange ID, Vector and Matrix objects step after step, as a
+// ShadowSubdomain and an ActorSubdomain do: process 0 sends a batch of
+// three objects and a single ID outside of any batch, and process 1
+// replies with a Vector. Process 1 calls progress() between its receives,
+// as the analysis does between the state determination and the solve.
+// A size mismatch must be reported without spoiling the objects that
+// follow it.
+//
+// Run on two processes, with aggregation on if the first argument is 1;
+// the objects received must be the same either way, and with aggregation
+// on the batch must travel as a single message.
+//
+// Returns 0 when the test passes.
+//
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <MPI_Channel.h>
+#include <Vector.h>
+#include <Matrix.h>
+#include <ID.h>
+
+static const int numSteps = 100;
+
+int
+main(int argc, char **argv)
+{
+  MPI_Init(&argc, &argv);
+
+  int rank, size;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  if (size != 2) {
+    if (rank == 0)
+      fprintf(stderr, "FAILED - the test must be run on two processes\n");
+    MPI_Finalize();
+    return -1;
+  }
+
+  const bool aggregate = argc > 1 && atoi(argv[1]) != 0;
+  MPI_Channel::setAggregation(aggregate);
+
+  int numErrors = 0;
+  {
+    MPI_Channel theChannel(1-rank);
+
+    for (int step=0; step<numSteps; step++) {
+      if (rank == 0) {
+        ID id(3);
+        id(0) = step;
+        id(1) = 2*step;
+        id(2) = 7;
+        Vector v(5);
+        for (int i=0; i<5; i++)
+          v(i) = step + 0.5*i;
+        Matrix m(2,3);
+        m(1,2) = step;
+
+        theChannel.startBatch();
+        theChannel.sendID(0, 0, id);
+        theChannel.sendVector(0, 0, v);
+        theChannel.sendMatrix(0, 0, m);
+        theChannel.endBatch();
+        theChannel.sendID(0, 0, id);
+
+        Vector reply(5);
+        theChannel.recvVector(0, 0, reply);
+        if (reply(4) != -step)
+          numErrors++;
+      }
+      else {
+        ID id(3);
+        Vector v(5);
+        Matrix m(2,3);
+        theChannel.recvID(0, 0, id);
+        theChannel.progress();
+        theChannel.recvVector(0, 0, v);
+        theChannel.progress();
+        theChannel.recvMatrix(0, 0, m);
+        if (id(0) != step || id(1) != 2*step || v(4) != step+2.0 || m(1,2) != step)
+          numErrors++;
+
+        theChannel.progress();
+        theChannel.recvID(0, 0, id);
+        if (id(2) != 7)
+          numErrors++;
+
+        Vector reply(5);
+        reply(4) = -step;
+        theChannel.sendVector(0, 0, reply);
+        theChannel.progress();
+      }
+    }
+
+    // a Vector of the wrong size is refused, and the next object arrives
+    if (rank == 0) {
+      Vector v(3);
+      theChannel.sendVector(0, 0, v);
+      ID id(1);
+      id(0) = 42;
+      theChannel.sendID(0, 0, id);
+    }
+    else {
+      Vector v(4);
+      if (theChannel.recvVector(0, 0, v) == 0)
+        numErrors++;
+      ID id(1);
+      theChannel.recvID(0, 0, id);
+      if (aggregate && id(0) != 42)
+        numErrors++;
+    }
+
+    // let the last sends complete before the channel goes away
+    MPI_Barrier(MPI_COMM_WORLD);
+    theChannel.progress();
+  }
+
+  MPI_Channel::Statistics stats = MPI_Channel::getStatistics();
+  printf("process %d: %lld messages (%lld bytes) sent, %lld messages (%lld bytes) received\n",
+         rank, stats.messagesSent, stats.bytesSent, stats.messagesReceived, stats.bytesReceived);
+
+  const long long expectedSent = rank == 0 ? (aggregate ? 2 : 4)*numSteps + 2 : numSteps;
+  if (stats.messagesSent != expectedSent) {
+    fprintf(stderr, "FAILED - process %d sent %lld messages, expected %lld\n",
+            rank, stats.messagesSent, expectedSent);
+    numErrors++;
+  }
+
+  int totalErrors = 0;
+  MPI_Reduce(&numErrors, &totalErrors, 1, MPI_INT, MPI_SUM, 0, MPI_COMM_WORLD);
+  if (rank == 0) {
+    if (totalErrors == 0)
+      printf("PASSED - objects received as sent\n");
+    else
+      fprintf(stderr, "FAILED - %d objects were not received as sent\n", totalErrors);
+  }
+
+  MPI_Finalize();
+  return totalErrors == 0 ? 0 : -1;
+}
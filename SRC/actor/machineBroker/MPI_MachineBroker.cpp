@@ -33,6 +33,8 @@
 #include <ID.h>
 
 #include <mpi.h>
+#include <stdlib.h>
+#include <string.h>
 
 MPI_MachineBroker::MPI_MachineBroker(FEM_ObjectBroker *theBroker, int argc, char **argv)
   :MachineBroker(theBroker)
@@ -45,6 +47,12 @@ MPI_MachineBroker::MPI_MachineBroker(FEM_ObjectBroker *theBroker, int argc, char
   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
   MPI_Comm_size(MPI_COMM_WORLD, &size);
 
+  // aggregation of channel messages is chosen from the environment,
+  // which mpirun passes alike to every process
+  const char *aggregate = getenv("OPENSEES_MPI_AGGREGATE");
+  if (aggregate != nullptr && strcmp(aggregate, "0") != 0)
+    MPI_Channel::setAggregation(true);
+
   theChannels = new MPI_Channel *[size];
   for (int i=0; i<size; i++) {
     theChannels[i] = new MPI_Channel(i);
@@ -538,6 +538,7 @@
 #include "Broyden.h"
 #include "NewtonLineSearch.h"
 #include "KrylovNewton.h"
+#include "JacobianFreeNewton.h"
 #include "AcceleratedNewton.h"
 #include "ModifiedNewton.h"
 
@@ -2601,6 +2602,9 @@ FEM_ObjectBrokerAllClasses::getNewEquiSolnAlgo(int classTag)
 	case EquiALGORITHM_TAGS_KrylovNewton:  
 	     return new KrylovNewton();
 
+	case EquiALGORITHM_TAGS_JacobianFreeNewton:  
+	     return new JacobianFreeNewton();
+
 	case EquiALGORITHM_TAGS_AcceleratedNewton:  
 	     return new AcceleratedNewton();
 	     
@@ -161,6 +161,18 @@ Shadow::recvID(ID &theID)
     return theChannel->recvID(0, commitTag, theID, theRemoteActorsAddress);
 }
 
+int
+Shadow::startBatch(void)
+{
+    return theChannel->startBatch();
+}
+
+int
+Shadow::endBatch(void)
+{
+    return theChannel->endBatch();
+}
+
 
 void
 Shadow::setCommitTag(int tag)
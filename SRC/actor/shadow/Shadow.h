@@ -75,6 +75,8 @@ class Shadow
     virtual int recvVector(Vector &theVector);      
     virtual int sendID(const ID &theID);  
     virtual int recvID(ID &theID);      
+    int startBatch(void);
+    int endBatch(void);
     void setCommitTag(int commitTag);
 
     Channel 		  *getChannelPtr(void) const;
@@ -0,0 +1,524 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+//
+// Description: This file contains the implementation of
+// JacobianFreeNewton, an inexact Newton method that solves for each
+// correction with restarted GMRES using tangent-vector products in
+// place of an assembled tangent.
+//
+// References:
+//   Saad, Y. and Schultz, M.H. (1986) "GMRES: A generalized minimal
+//   residual algorithm for solving nonsymmetric linear systems",
+//   SIAM J. Sci. Stat. Comput. 7(3), 856-869.
+//   Knoll, D.A. and Keyes, D.E. (2004) "Jacobian-free Newton-Krylov
+//   methods: a survey of approaches and applications",
+//   J. Comput. Phys. 193(2), 357-397.
+//
+#include <math.h>
+#include <JacobianFreeNewton.h>
+#include <AnalysisModel.h>
+#include <IncrementalIntegrator.h>
+#include <TransientIntegrator.h>
+#include <LinearSOE.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+#include <ConvergenceTest.h>
+#include <FE_Element.h>
+#include <FE_EleIter.h>
+#include <DOF_Group.h>
+#include <DOF_GrpIter.h>
+#include <Profiler.h>
+#include <ID.h>
+
+JacobianFreeNewton::JacobianFreeNewton(int maxDim, int maxRst, double tol,
+                                       int pc, int prod, double delta)
+:EquiSolnAlgo(EquiALGORITHM_TAGS_JacobianFreeNewton),
+ maxDimension(maxDim), maxRestart(maxRst), eta(tol),
+ preconditioner(pc), product(prod), perturbation(delta),
+ numEqns(0), normU(0.0), V(nullptr)
+{
+  if (maxDimension < 1)
+    maxDimension = 1;
+  if (maxRestart < 0)
+    maxRestart = 0;
+}
+
+JacobianFreeNewton::~JacobianFreeNewton()
+{
+  this->freeBasis();
+}
+
+void
+JacobianFreeNewton::freeBasis(void)
+{
+  // V holds maxDimension+1 vectors, so this must precede any change
+  // of maxDimension
+  if (V != nullptr) {
+    for (int i = 0; i < maxDimension+1; i++)
+      delete V[i];
+    delete [] V;
+    V = nullptr;
+  }
+}
+
+int
+JacobianFreeNewton::setSize(int n)
+{
+  this->freeBasis();
+
+  numEqns = n;
+  V = new Vector*[maxDimension+1];
+  for (int i = 0; i < maxDimension+1; i++)
+    V[i] = new Vector(numEqns);
+
+  H.resize(maxDimension+1, maxDimension);
+  cs.resize(maxDimension);
+  sn.resize(maxDimension);
+  g.resize(maxDimension+1);
+  y.resize(maxDimension);
+
+  residual.resize(numEqns);
+  correction.resize(numEqns);
+  w.resize(numEqns);
+  z.resize(numEqns);
+  dx.resize(numEqns);
+  if (preconditioner == DiagonalPreconditioner)
+    diagonal.resize(numEqns);
+
+  return 0;
+}
+
+int
+JacobianFreeNewton::solveCurrentStep(void)
+{
+  AnalysisModel *theAnaModel = this->getAnalysisModelPtr();
+  IncrementalIntegrator *theIntegrator = this->getIncrementalIntegratorPtr();
+  LinearSOE *theSOE = this->getLinearSOEptr();
+
+  if (  (theAnaModel == nullptr)
+     || (theIntegrator == nullptr)
+     || (theSOE == nullptr)
+     || (theTest == nullptr)) {
+    opserr << "WARNING JacobianFreeNewton::solveCurrentStep() - setLinks() has";
+    opserr << " not been called - or no ConvergenceTest has been set\n";
+    return SolutionAlgorithm::BadAlgorithm;
+  }
+
+  if (theSOE->getNumEqn() != numEqns || V == nullptr)
+    this->setSize(theSOE->getNumEqn());
+
+  if (theIntegrator->formUnbalance() < 0) {
+    opserr << "WARNING JacobianFreeNewton::solveCurrentStep() - ";
+    opserr << "the Integrator failed in formUnbalance()\n";
+    return SolutionAlgorithm::BadFormResidual;
+  }
+
+  theTest->setEquiSolnAlgo(*this);
+  if (theTest->start() < 0) {
+    opserr << "JacobianFreeNewton::solveCurrentStep() - ";
+    opserr << "the ConvergenceTest object failed in start()\n";
+    return SolutionAlgorithm::BadTestStart;
+  }
+
+  // The preconditioner is lagged; it is formed once per step
+  if (this->formPreconditioner() < 0) {
+    opserr << "WARNING JacobianFreeNewton::solveCurrentStep() - ";
+    opserr << "failed to form the preconditioner\n";
+    return SolutionAlgorithm::BadFormTangent;
+  }
+
+  int k = 1;
+  int result = -1;
+  do {
+    OpenSees::Profiler::count(OpenSees::Profiler::Iterations);
+
+    residual = theSOE->getB();
+
+    // The difference product scales its step by the trial state; the
+    // element products of this iteration share one set of tangents
+    if (product == DifferenceProduct)
+      normU = this->trialNorm();
+    else if (this->formTangents() < 0) {
+      opserr << "WARNING JacobianFreeNewton::solveCurrentStep() - ";
+      opserr << "failed to form the element tangents\n";
+      return SolutionAlgorithm::BadFormTangent;
+    }
+
+    // Solve K dU = R(U) to the forcing tolerance
+    if (this->gmres(residual, correction) < 0) {
+      opserr << "WARNING JacobianFreeNewton::solveCurrentStep() - ";
+      opserr << "the Krylov solver failed\n";
+      return SolutionAlgorithm::BadLinearSolve;
+    }
+
+    if (theIntegrator->update(correction) < 0) {
+      opserr << "WARNING JacobianFreeNewton::solveCurrentStep() - ";
+      opserr << "the Integrator failed in update()\n";
+      return SolutionAlgorithm::BadStepUpdate;
+    }
+
+    // The convergence tests look for the correction in the SOE
+    theSOE->setX(correction);
+
+    if (theIntegrator->formUnbalance() < 0) {
+      opserr << "WARNING JacobianFreeNewton::solveCurrentStep() - ";
+      opserr << "the Integrator failed in formUnbalance()\n";
+      return SolutionAlgorithm::BadFormResidual;
+    }
+
+    result = theTest->test();
+    this->record(k++);
+
+  } while (result == ConvergenceTest::Continue);
+
+  if (result == ConvergenceTest::Failure)
+    return SolutionAlgorithm::TestFailed;
+
+  return result;
+}
+
+//
+// Restarted GMRES with right preconditioning, K M^{-1} (M x) = b.
+// The basis is orthogonalized with modified Gram-Schmidt and the
+// Hessenberg least squares problem is reduced with Givens rotations,
+// so the residual norm is available at every iteration.
+//
+int
+JacobianFreeNewton::gmres(const Vector &b, Vector &x)
+{
+  x.Zero();
+
+  const double normB = b.Norm();
+  if (normB == 0.0)
+    return 0;
+  const double tol = eta*normB;
+
+  Vector &r = dx;
+  for (int cycle = 0; cycle <= maxRestart; cycle++) {
+
+    // r = b - K x; the product uses r as scratch, so form it first
+    if (cycle > 0 && this->formProduct(x, w) < 0)
+      return -1;
+    r = b;
+    if (cycle > 0)
+      r.addVector(1.0, w, -1.0);
+
+    const double beta = r.Norm();
+    if (beta <= tol)
+      return 0;
+
+    V[0]->addVector(0.0, r, 1.0/beta);
+    g.Zero();
+    g(0) = beta;
+
+    int m = 0;
+    while (m < maxDimension) {
+      const int j = m++;
+
+      // w = K M^{-1} v_j
+      if (this->applyPreconditioner(*V[j], z) < 0 ||
+          this->formProduct(z, w) < 0)
+        return -1;
+
+      for (int i = 0; i <= j; i++) {
+        H(i,j) = w ^ (*V[i]);
+        w.addVector(1.0, *V[i], -H(i,j));
+      }
+      H(j+1,j) = w.Norm();
+      if (H(j+1,j) > 0.0)
+        V[j+1]->addVector(0.0, w, 1.0/H(j+1,j));
+
+      // apply the previous rotations to the new column
+      for (int i = 0; i < j; i++) {
+        const double hij = H(i,j);
+        H(i,j)   =  cs(i)*hij + sn(i)*H(i+1,j);
+        H(i+1,j) = -sn(i)*hij + cs(i)*H(i+1,j);
+      }
+
+      // and eliminate the subdiagonal entry
+      const double d = sqrt(H(j,j)*H(j,j) + H(j+1,j)*H(j+1,j));
+      if (d == 0.0)
+        return -2;
+      cs(j) = H(j,j)/d;
+      sn(j) = H(j+1,j)/d;
+      H(j,j)   = d;
+      H(j+1,j) = 0.0;
+      g(j+1) = -sn(j)*g(j);
+      g(j)   =  cs(j)*g(j);
+
+      if (fabs(g(j+1)) <= tol)
+        break;
+    }
+
+    // back substitution for the subspace coordinates
+    for (int i = m-1; i >= 0; i--) {
+      double sum = g(i);
+      for (int l = i+1; l < m; l++)
+        sum -= H(i,l)*y(l);
+      y(i) = sum/H(i,i);
+    }
+
+    // x += M^{-1} V y
+    w.Zero();
+    for (int i = 0; i < m; i++)
+      w.addVector(1.0, *V[i], y(i));
+    if (this->applyPreconditioner(w, z) < 0)
+      return -1;
+    x.addVector(1.0, z, 1.0);
+
+    if (fabs(g(m)) <= tol)
+      return 0;
+  }
+
+  // Not converged to the forcing tolerance; the correction is
+  // still a descent direction, so leave it to the convergence test
+  return 0;
+}
+
+int
+JacobianFreeNewton::formProduct(const Vector &v, Vector &Kv)
+{
+  IncrementalIntegrator *theIntegrator = this->getIncrementalIntegratorPtr();
+  LinearSOE *theSOE = this->getLinearSOEptr();
+
+  if (product == ElementProduct) {
+    Kv.Zero();
+
+    for (std::size_t t = 0; t < tangents.size(); t++) {
+      const Matrix &K = tangents[t];
+      const ID &id = *tangentIDs[t];
+      const int n = id.Size();
+      for (int i = 0; i < n; i++) {
+        if (id(i) < 0)
+          continue;
+        double sum = 0.0;
+        for (int j = 0; j < n; j++)
+          if (id(j) >= 0)
+            sum += K(i,j)*v(id(j));
+        Kv(id(i)) += sum;
+      }
+    }
+    return 0;
+  }
+
+  const double normV = v.Norm();
+  if (normV == 0.0) {
+    Kv.Zero();
+    return 0;
+  }
+
+  // The step is scaled so that the perturbation is small relative
+  // to the trial state rather than to the direction
+  const double h = perturbation*(1.0 + normU)/normV;
+
+  Vector &dU = Kv;
+  dU.addVector(0.0, v, h);
+  if (theIntegrator->update(dU) < 0 || theIntegrator->formUnbalance() < 0)
+    return -1;
+
+  // K v = (R(U) - R(U + h v)) / h
+  Kv.addVector(0.0, residual, 1.0/h);
+  Kv.addVector(1.0, theSOE->getB(), -1.0/h);
+
+  // restore the trial state
+  dx.addVector(0.0, v, -h);
+  if (theIntegrator->update(dx) < 0)
+    return -1;
+
+  return 0;
+}
+
+int
+JacobianFreeNewton::formPreconditioner(void)
+{
+  IncrementalIntegrator *theIntegrator = this->getIncrementalIntegratorPtr();
+
+  switch (preconditioner) {
+
+    case FactorPreconditioner:
+      // assemble the tangent; the first solve factors it and the
+      // factorization is reused for the rest of the step
+      return theIntegrator->formTangent(CURRENT_TANGENT);
+
+    case DiagonalPreconditioner: {
+      AnalysisModel *theModel = this->getAnalysisModelPtr();
+      diagonal.Zero();
+
+      FE_Element *elePtr;
+      FE_EleIter &theEles = theModel->getFEs();
+      while ((elePtr = theEles()) != nullptr) {
+        const Matrix &K = elePtr->getTangent(theIntegrator);
+        const ID &id = elePtr->getID();
+        for (int i = 0; i < id.Size(); i++)
+          if (id(i) >= 0)
+            diagonal(id(i)) += K(i,i);
+      }
+
+      // the nodal (inertia) terms only exist for a transient integrator
+      if (dynamic_cast<TransientIntegrator*>(theIntegrator) == nullptr)
+        return 0;
+
+      DOF_Group *dofPtr;
+      DOF_GrpIter &theDOFs = theModel->getDOFs();
+      while ((dofPtr = theDOFs()) != nullptr) {
+        const Matrix &K = dofPtr->getTangent(theIntegrator);
+        const ID &id = dofPtr->getID();
+        for (int i = 0; i < id.Size(); i++)
+          if (id(i) >= 0)
+            diagonal(id(i)) += K(i,i);
+      }
+      return 0;
+    }
+
+    default:
+      return 0;
+  }
+}
+
+//
+// Copy the element (and, for a transient integrator, nodal) tangents
+// at the current iterate, so that the element products of the Krylov
+// iterations do not form them again.
+//
+int
+JacobianFreeNewton::formTangents(void)
+{
+  AnalysisModel *theModel = this->getAnalysisModelPtr();
+  IncrementalIntegrator *theIntegrator = this->getIncrementalIntegratorPtr();
+
+  std::size_t n = 0;
+  auto keep = [&](const Matrix &K, const ID &id) {
+    if (n == tangents.size()) {
+      tangents.push_back(K);
+      tangentIDs.push_back(&id);
+    } else {
+      tangents[n] = K;
+      tangentIDs[n] = &id;
+    }
+    n++;
+  };
+
+  FE_Element *elePtr;
+  FE_EleIter &theEles = theModel->getFEs();
+  while ((elePtr = theEles()) != nullptr)
+    keep(elePtr->getTangent(theIntegrator), elePtr->getID());
+
+  if (dynamic_cast<TransientIntegrator*>(theIntegrator) != nullptr) {
+    DOF_Group *dofPtr;
+    DOF_GrpIter &theDOFs = theModel->getDOFs();
+    while ((dofPtr = theDOFs()) != nullptr)
+      keep(dofPtr->getTangent(theIntegrator), dofPtr->getID());
+  }
+
+  tangents.erase(tangents.begin() + n, tangents.end());
+  tangentIDs.erase(tangentIDs.begin() + n, tangentIDs.end());
+  return 0;
+}
+
+int
+JacobianFreeNewton::applyPreconditioner(const Vector &v, Vector &Mv)
+{
+  switch (preconditioner) {
+
+    case FactorPreconditioner: {
+      LinearSOE *theSOE = this->getLinearSOEptr();
+      theSOE->setB(v);
+      if (theSOE->solve() < 0)
+        return -1;
+      Mv = theSOE->getX();
+      return 0;
+    }
+
+    case DiagonalPreconditioner:
+      for (int i = 0; i < numEqns; i++)
+        Mv(i) = (diagonal(i) != 0.0) ? v(i)/diagonal(i) : v(i);
+      return 0;
+
+    default:
+      Mv = v;
+      return 0;
+  }
+}
+
+double
+JacobianFreeNewton::trialNorm(void)
+{
+  double sum = 0.0;
+
+  DOF_Group *dofPtr;
+  DOF_GrpIter &theDOFs = this->getAnalysisModelPtr()->getDOFs();
+  while ((dofPtr = theDOFs()) != nullptr) {
+    const Vector &u = dofPtr->getTrialDisp();
+    sum += u ^ u;
+  }
+  return sqrt(sum);
+}
+
+int
+JacobianFreeNewton::sendSelf(int cTag, Channel &theChannel)
+{
+  static Vector data(6);
+  data(0) = maxDimension;
+  data(1) = maxRestart;
+  data(2) = eta;
+  data(3) = preconditioner;
+  data(4) = product;
+  data(5) = perturbation;
+  if (theChannel.sendVector(this->getDbTag(), cTag, data) < 0) {
+    opserr << "JacobianFreeNewton::sendSelf() - failed\n";
+    return -1;
+  }
+  return 0;
+}
+
+int
+JacobianFreeNewton::recvSelf(int cTag, Channel &theChannel,
+                             FEM_ObjectBroker &theBroker)
+{
+  static Vector data(6);
+  if (theChannel.recvVector(this->getDbTag(), cTag, data) < 0) {
+    opserr << "JacobianFreeNewton::recvSelf() - failed\n";
+    return -1;
+  }
+  this->freeBasis();
+  maxDimension   = (int)data(0);
+  maxRestart     = (int)data(1);
+  eta            = data(2);
+  preconditioner = (int)data(3);
+  product        = (int)data(4);
+  perturbation   = data(5);
+  numEqns = 0;
+  return 0;
+}
+
+void
+JacobianFreeNewton::Print(OPS_Stream &s, int flag)
+{
+  s << "JacobianFreeNewton";
+  s << "\n\tMax subspace dimension: " << maxDimension;
+  s << "\n\tMax restarts: " << maxRestart;
+  s << "\n\tForcing tolerance: " << eta;
+  s << "\n\tPreconditioner: "
+    << (preconditioner == FactorPreconditioner ? "factor" :
+        preconditioner == DiagonalPreconditioner ? "diagonal" : "none");
+  s << "\n\tProduct: "
+    << (product == ElementProduct ? "element" : "difference");
+  s << "\n\tNumber of equations: " << numEqns << endln;
+}
@@ -0,0 +1,129 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+//
+#ifndef JacobianFreeNewton_h
+#define JacobianFreeNewton_h
+//
+// Description: This file contains the class definition for
+// JacobianFreeNewton. JacobianFreeNewton is an inexact Newton method
+// in which each correction is found with restarted, right-preconditioned
+// GMRES. The global tangent is never assembled; its action on a vector
+// is obtained either from a finite difference of the residual,
+//
+//      K z ~ (R(U) - R(U + h z)) / h
+//
+// or from the sum of the element tangent-vector products. For the latter
+// the element tangents are formed once per Newton iteration and reused by
+// every product of its Krylov solve.
+//
+// The preconditioner is formed once at the start of each step. It is
+// either the diagonal of the tangent (Jacobi), which needs no global
+// matrix, or the factorization of the tangent held by the LinearSOE,
+// which is then reused for every Krylov iteration of the step.
+//
+// The finite difference product perturbs the trial state through
+// IncrementalIntegrator::update(), so it requires an integrator whose
+// update is linear in the increment (e.g. LoadControl, Newmark); the
+// element product does not perturb the state.
+//
+#include <vector>
+#include <EquiSolnAlgo.h>
+#include <Vector.h>
+#include <Matrix.h>
+
+class ID;
+
+class JacobianFreeNewton: public EquiSolnAlgo
+{
+  public:
+    enum Preconditioner {
+      NoPreconditioner,
+      DiagonalPreconditioner,
+      FactorPreconditioner
+    };
+
+    enum Product {
+      DifferenceProduct,
+      ElementProduct
+    };
+
+    JacobianFreeNewton(int maxDim = 30, int maxRestart = 5,
+                       double eta = 1.0e-3,
+                       int preconditioner = DiagonalPreconditioner,
+                       int product = DifferenceProduct,
+                       double perturbation = 1.0e-7);
+    ~JacobianFreeNewton();
+
+    int solveCurrentStep(void);
+
+    virtual int sendSelf(int commitTag, Channel &theChannel);
+    virtual int recvSelf(int commitTag, Channel &theChannel,
+                         FEM_ObjectBroker &theBroker);
+    void Print(OPS_Stream &s, int flag =0);
+
+  private:
+    int setSize(int numEqn);
+    void freeBasis(void);
+
+    // Krylov solution of K x = b
+    int gmres(const Vector &b, Vector &x);
+
+    // y = K z
+    int formProduct(const Vector &z, Vector &y);
+
+    // z = M^{-1} v
+    int applyPreconditioner(const Vector &v, Vector &z);
+    int formPreconditioner(void);
+
+    // Element and nodal tangents for the element product
+    int formTangents(void);
+
+    // Norm of the trial displacements, used to scale the perturbation
+    double trialNorm(void);
+
+    int maxDimension;
+    int maxRestart;
+    double eta;
+    int preconditioner;
+    int product;
+    double perturbation;
+
+    int numEqns;
+    double normU;
+
+    // Orthonormal Krylov basis
+    Vector **V;
+
+    // Hessenberg matrix and Givens rotations
+    Matrix H;
+    Vector cs, sn, g, y;
+
+    Vector residual;   // R(U) at the current iterate
+    Vector correction; // Newton correction
+    Vector w, z, dx;   // work vectors
+    Vector diagonal;   // Jacobi preconditioner
+
+    // Tangents at the current iterate and the equations they act on,
+    // formed once per Newton iteration for the element product
+    std::vector<Matrix> tangents;
+    std::vector<const ID*> tangentIDs;
+};
+
+#endif
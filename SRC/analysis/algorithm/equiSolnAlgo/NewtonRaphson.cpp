@@ -39,6 +39,7 @@
 #include <ConvergenceTest.h>
 #include <ID.h>
 #include <elementAPI.h>
+#include <Profiler.h>
 
 
 void *
@@ -47,10 +48,13 @@ OPS_ADD_RUNTIME_VPV(OPS_NewtonRaphsonAlgorithm)
     int formTangent = CURRENT_TANGENT;
     double iFactor = 0;
     double cFactor = 1;
+    bool fused = false;
 
     while (OPS_GetNumRemainingInputArgs() > 0) {
       const char* type = OPS_GetString();
-      if(strcmp(type,"-secant")==0 || strcmp(type,"-Secant")==0) {
+      if(strcmp(type,"-fused")==0) {
+        fused = true;
+      } else if(strcmp(type,"-secant")==0 || strcmp(type,"-Secant")==0) {
         formTangent = CURRENT_SECANT;
         iFactor = 0;
         cFactor = 1.0;
@@ -79,21 +83,21 @@ OPS_ADD_RUNTIME_VPV(OPS_NewtonRaphsonAlgorithm)
       }
     }
 
-    return new NewtonRaphson(formTangent, iFactor, cFactor);
+    return new NewtonRaphson(formTangent, iFactor, cFactor, fused);
 
 }
 
 // Constructor
-NewtonRaphson::NewtonRaphson(int theTangentToUse, double iFact, double cFact)
+NewtonRaphson::NewtonRaphson(int theTangentToUse, double iFact, double cFact, bool fuse)
 :EquiSolnAlgo(EquiALGORITHM_TAGS_NewtonRaphson),
- tangent(theTangentToUse), iFactor(iFact), cFactor(cFact)
+ tangent(theTangentToUse), iFactor(iFact), cFactor(cFact), fused(fuse)
 {
 
 }
 
 NewtonRaphson::NewtonRaphson()
         :EquiSolnAlgo(EquiALGORITHM_TAGS_NewtonRaphson),
-        tangent(CURRENT_TANGENT), iFactor(0.), cFactor(1.)
+        tangent(CURRENT_TANGENT), iFactor(0.), cFactor(1.), fused(false)
 {
 
 }
@@ -101,7 +105,7 @@ NewtonRaphson::NewtonRaphson()
 
 NewtonRaphson::NewtonRaphson(ConvergenceTest &theT, int theTangentToUse, double iFact, double cFact)
 :EquiSolnAlgo(EquiALGORITHM_TAGS_NewtonRaphson),
- tangent(theTangentToUse), iFactor(iFact), cFactor(cFact)
+ tangent(theTangentToUse), iFactor(iFact), cFactor(cFact), fused(false)
 {
 
 }
@@ -131,10 +135,21 @@ NewtonRaphson::solveCurrentStep()
         return SolutionAlgorithm::BadAlgorithm;
     }        
 
+    // when fused, the tangent for the next iteration is formed in the
+    // same pass over the elements as the unbalance
+    const bool fuse = fused && (tangent == CURRENT_TANGENT);
+
     //
     // 1 Form unbalance
     //
-    if (theIntegrator->formUnbalance() < 0) {
+    if (fuse) {
+      if (theIntegrator->formTangentAndUnbalance(tangent, iFactor, cFactor) < 0) {
+        opserr << "WARNING NewtonRaphson::solveCurrentStep() - ";
+        opserr << "the Integrator failed in formTangentAndUnbalance()\n";
+        return SolutionAlgorithm::BadFormResidual;
+      }
+    }
+    else if (theIntegrator->formUnbalance() < 0) {
       opserr << "WARNING NewtonRaphson::solveCurrentStep() - ";
       opserr << "the Integrator failed in formUnbalance()\n";        
       return SolutionAlgorithm::BadFormResidual;
@@ -176,7 +191,7 @@ NewtonRaphson::solveCurrentStep()
       } else {
 
         SOLUTION_ALGORITHM_tangentFlag = tangent;
-        if (theIntegrator->formTangent(tangent, iFactor, cFactor) < 0)
+        if (!fuse && theIntegrator->formTangent(tangent, iFactor, cFactor) < 0)
           return SolutionAlgorithm::BadFormTangent;
 
       }
@@ -192,7 +207,11 @@ NewtonRaphson::solveCurrentStep()
       if (theIntegrator->update(theSOE->getX()) < 0)
         return SolutionAlgorithm::BadStepUpdate;
 
-      if (theIntegrator->formUnbalance() < 0)
+      if (fuse) {
+        if (theIntegrator->formTangentAndUnbalance(tangent, iFactor, cFactor) < 0)
+          return SolutionAlgorithm::BadFormResidual;
+      }
+      else if (theIntegrator->formUnbalance() < 0)
         return SolutionAlgorithm::BadFormResidual;
 
       //
@@ -200,6 +219,7 @@ NewtonRaphson::solveCurrentStep()
       //
       result = theTest->test();
       numIterations++;
+      OpenSees::Profiler::count(OpenSees::Profiler::Iterations);
       this->record(numIterations);
 
     }  while (result == ConvergenceTest::Continue);
@@ -216,10 +236,11 @@ NewtonRaphson::solveCurrentStep()
 int
 NewtonRaphson::sendSelf(int cTag, Channel &theChannel)
 {
-  static Vector data(3);
+  static Vector data(4);
   data(0) = tangent;
   data(1) = iFactor;
   data(2) = cFactor;
+  data(3) = fused ? 1.0 : 0.0;
   return theChannel.sendVector(this->getDbTag(), cTag, data);
 }
 
@@ -228,11 +249,12 @@ NewtonRaphson::recvSelf(int cTag,
                         Channel &theChannel, 
                         FEM_ObjectBroker &theBroker)
 {
-  static Vector data(3);
+  static Vector data(4);
   theChannel.recvVector(this->getDbTag(), cTag, data);
   tangent = int(data(0));
   iFactor = data(1);
   cFactor = data(2);
+  fused   = data(3) != 0.0;
   return 0;
 }
 
@@ -49,7 +49,7 @@ class NewtonRaphson: public EquiSolnAlgo
 {
   public:
   NewtonRaphson();
-  NewtonRaphson(int tangent, double iFactor = 0.0, double cFactor = 1.0);    
+  NewtonRaphson(int tangent, double iFactor = 0.0, double cFactor = 1.0, bool fused = false);
   NewtonRaphson(ConvergenceTest &theTest, int tangent = CURRENT_TANGENT, double iFactor = 0.0, double cFactor = 1.0);
   ~NewtonRaphson();
   
@@ -71,6 +71,10 @@ class NewtonRaphson: public EquiSolnAlgo
   
   double iFactor;
   double cFactor;
+
+  // form the tangent together with the unbalance after each update,
+  // so elements are visited once per iteration (CURRENT_TANGENT only)
+  bool fused;
 };
 
 #endif
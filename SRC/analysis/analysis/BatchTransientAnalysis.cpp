@@ -0,0 +1,331 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of
+// BatchTransientAnalysis.
+//
+#include <BatchTransientAnalysis.h>
+#include <Domain.h>
+#include <AnalysisModel.h>
+#include <LinearSOE.h>
+#include <FE_Element.h>
+#include <FE_EleIter.h>
+#include <DOF_Group.h>
+#include <DOF_GrpIter.h>
+#include <UniformExcitation.h>
+#include <GroundMotion.h>
+#include <Recorder.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+#include <OPS_Stream.h>
+#include <algorithm>
+#include <utility>
+
+BatchTransientAnalysis::BatchTransientAnalysis(double gamma, double beta)
+	: m_gamma(gamma)
+	, m_beta(beta)
+	, m_num_eqn(0)
+{
+
+}
+
+BatchTransientAnalysis::~BatchTransientAnalysis()
+{
+}
+
+int BatchTransientAnalysis::addRecord(UniformExcitation& pattern, const std::vector<Recorder*>& recorders)
+{
+	for (const Record& record : m_records)
+		if (record.pattern == &pattern) {
+			opserr << "BatchTransientAnalysis::addRecord() - pattern " << pattern.getTag()
+				<< " has already been added\n";
+			return -1;
+		}
+
+	m_records.push_back({&pattern, recorders});
+	return 0;
+}
+
+int BatchTransientAnalysis::analyze(Domain& domain, AnalysisModel& model, LinearSOE& soe,
+                                    int numSteps, double dT)
+{
+	const int K = (int)m_records.size();
+	if (K == 0 || numSteps <= 0)
+		return 0;
+
+	if (m_beta <= 0.0 || dT <= 0.0) {
+		opserr << "BatchTransientAnalysis::analyze() - beta and the time step must be positive\n";
+		return -1;
+	}
+
+	m_num_eqn = model.getNumEqn();
+	const int n = m_num_eqn;
+	if (n != soe.getNumEqn()) {
+		opserr << "BatchTransientAnalysis::analyze() - the system of equations has not been sized\n";
+		return -1;
+	}
+
+	if (formMatrices(model) < 0 || formInfluence(model) < 0)
+		return -1;
+
+	if (formTangent(model, soe, dT) < 0)
+		return -2;
+
+	// Newmark constants
+	const double gamma = m_gamma;
+	const double beta = m_beta;
+	const double c2 = gamma/(beta*dT);
+	const double c3 = 1.0/(beta*dT*dT);
+	const double m1 = 1.0/(beta*dT);
+	const double m2 = 0.5/beta - 1.0;
+	const double d1 = gamma/beta - 1.0;
+	const double d2 = dT*(0.5*gamma/beta - 1.0);
+
+	const std::size_t size = (std::size_t)n*K;
+	m_u.assign(size, 0.0);
+	m_v.assign(size, 0.0);
+	m_a.assign(size, 0.0);
+	m_rhs.assign(size, 0.0);
+	m_xm.resize(n);
+	m_xc.resize(n);
+
+	const double t0 = domain.getCurrentTime();
+	int result = 0;
+
+	for (int step = 1; step <= numSteps && result == 0; ++step) {
+		const double time = t0 + step*dT;
+
+		//
+		// right-hand sides
+		//   p + M (c3 u + m1 v + m2 a) + C (c2 u + d1 v + d2 a)
+		//
+		for (int k = 0; k < K; ++k) {
+			const double* u = &m_u[(std::size_t)k*n];
+			const double* v = &m_v[(std::size_t)k*n];
+			const double* a = &m_a[(std::size_t)k*n];
+			const double* Mr = &m_Mr[(std::size_t)k*n];
+			double* rhs = &m_rhs[(std::size_t)k*n];
+
+			UniformExcitation* pattern = m_records[k].pattern;
+			GroundMotion* motion = const_cast<GroundMotion*>(pattern->getGroundMotion());
+			const double p = -pattern->getFactor()*motion->getAccel(time);
+
+			for (int i = 0; i < n; ++i) {
+				rhs[i] = p*Mr[i];
+				m_xm[i] = c3*u[i] + m1*v[i] + m2*a[i];
+				m_xc[i] = c2*u[i] + d1*v[i] + d2*a[i];
+			}
+			m_M.product(m_xm.data(), rhs, 1.0);
+			m_C.product(m_xc.data(), rhs, 1.0);
+		}
+
+		if (soe.solveMultiple(K, m_rhs.data()) < 0) {
+			opserr << "BatchTransientAnalysis::analyze() - the solve failed at time " << time << "\n";
+			result = -3;
+			break;
+		}
+
+		// update the states
+		for (int k = 0; k < K; ++k) {
+			double* u = &m_u[(std::size_t)k*n];
+			double* v = &m_v[(std::size_t)k*n];
+			double* a = &m_a[(std::size_t)k*n];
+			const double* u1 = &m_rhs[(std::size_t)k*n];
+			for (int i = 0; i < n; ++i) {
+				const double a1 = c3*(u1[i] - u[i]) - m1*v[i] - m2*a[i];
+				v[i] += dT*((1.0 - gamma)*a[i] + gamma*a1);
+				a[i] = a1;
+				u[i] = u1[i];
+			}
+
+			if (!m_records[k].recorders.empty() && record(domain, model, k, time) < 0) {
+				result = -4;
+				break;
+			}
+		}
+	}
+
+	// leave the domain as it was found
+	domain.revertToLastCommit();
+
+	return result;
+}
+
+void BatchTransientAnalysis::Sparse::product(const double* x, double* y, double fact) const
+{
+	const int n = (int)rows.size() - 1;
+	for (int i = 0; i < n; ++i) {
+		double sum = 0.0;
+		for (int j = rows[i]; j < rows[i + 1]; ++j)
+			sum += vals[j]*x[cols[j]];
+		y[i] += fact*sum;
+	}
+}
+
+int BatchTransientAnalysis::formMatrices(AnalysisModel& model)
+{
+	const int n = m_num_eqn;
+
+	// collect the mass and damping of the elements and nodes row by row
+	std::vector<std::vector<std::pair<int, double>>> M(n), C(n);
+
+	auto gather = [n](std::vector<std::vector<std::pair<int, double>>>& A,
+	                  const Matrix& m, const ID& id) {
+		const int size = id.Size();
+		for (int j = 0; j < size; ++j) {
+			const int col = id(j);
+			if (col < 0 || col >= n)
+				continue;
+			for (int i = 0; i < size; ++i) {
+				const int row = id(i);
+				if (row < 0 || row >= n || m(i, j) == 0.0)
+					continue;
+				A[row].emplace_back(col, m(i, j));
+			}
+		}
+	};
+
+	FE_Element* fe;
+	FE_EleIter& fes = model.getFEs();
+	while ((fe = fes()) != nullptr) {
+		// constraint elements carry no mass or damping
+		if (fe->getElement() == nullptr)
+			continue;
+		fe->zeroTangent();
+		fe->addMtoTang(1.0);
+		gather(M, fe->getTangent(nullptr), fe->getID());
+		fe->zeroTangent();
+		fe->addCtoTang(1.0);
+		gather(C, fe->getTangent(nullptr), fe->getID());
+	}
+
+	DOF_Group* dof;
+	DOF_GrpIter& dofs = model.getDOFs();
+	while ((dof = dofs()) != nullptr) {
+		dof->zeroTangent();
+		dof->addMtoTang(1.0);
+		gather(M, dof->getTangent(nullptr), dof->getID());
+		dof->zeroTangent();
+		dof->addCtoTang(1.0);
+		gather(C, dof->getTangent(nullptr), dof->getID());
+	}
+
+	// compress, summing duplicate entries
+	auto compress = [n](std::vector<std::vector<std::pair<int, double>>>& A, Sparse& S) {
+		S.rows.assign(n + 1, 0);
+		S.cols.clear();
+		S.vals.clear();
+		for (int i = 0; i < n; ++i) {
+			std::vector<std::pair<int, double>>& row = A[i];
+			std::sort(row.begin(), row.end(),
+			          [](const std::pair<int, double>& a, const std::pair<int, double>& b) {
+			              return a.first < b.first;
+			          });
+			for (std::size_t j = 0; j < row.size(); ++j) {
+				if ((int)S.cols.size() > S.rows[i] && S.cols.back() == row[j].first)
+					S.vals.back() += row[j].second;
+				else {
+					S.cols.push_back(row[j].first);
+					S.vals.push_back(row[j].second);
+				}
+			}
+			S.rows[i + 1] = (int)S.cols.size();
+			std::vector<std::pair<int, double>>().swap(row);
+		}
+	};
+
+	compress(M, m_M);
+	compress(C, m_C);
+	return 0;
+}
+
+int BatchTransientAnalysis::formInfluence(AnalysisModel& model)
+{
+	const int n = m_num_eqn;
+	const int K = (int)m_records.size();
+
+	m_Mr.assign((std::size_t)n*K, 0.0);
+	std::vector<double> r(n);
+
+	for (int k = 0; k < K; ++k) {
+		const int dir = m_records[k].pattern->getDirection();
+
+		// rigid body translation of the free DOFs in the direction of
+		// the excitation
+		std::fill(r.begin(), r.end(), 0.0);
+		DOF_Group* dof;
+		DOF_GrpIter& dofs = model.getDOFs();
+		while ((dof = dofs()) != nullptr) {
+			const ID& id = dof->getID();
+			if (dir < id.Size() && id(dir) >= 0 && id(dir) < n)
+				r[id(dir)] = 1.0;
+		}
+
+		m_M.product(r.data(), &m_Mr[(std::size_t)k*n], 1.0);
+	}
+
+	return 0;
+}
+
+int BatchTransientAnalysis::formTangent(AnalysisModel& model, LinearSOE& soe, double dT)
+{
+	const double c2 = m_gamma/(m_beta*dT);
+	const double c3 = 1.0/(m_beta*dT*dT);
+
+	soe.zeroA();
+
+	FE_Element* fe;
+	FE_EleIter& fes = model.getFEs();
+	while ((fe = fes()) != nullptr) {
+		if (fe->getElement() != nullptr) {
+			fe->zeroTangent();
+			fe->addKtToTang(1.0);
+			fe->addCtoTang(c2);
+			fe->addMtoTang(c3);
+		}
+		if (soe.addA(fe->getTangent(nullptr), fe->getID()) < 0) {
+			opserr << "BatchTransientAnalysis::formTangent() - failed to add an element tangent\n";
+			return -1;
+		}
+	}
+
+	DOF_Group* dof;
+	DOF_GrpIter& dofs = model.getDOFs();
+	while ((dof = dofs()) != nullptr) {
+		dof->zeroTangent();
+		dof->addCtoTang(c2);
+		dof->addMtoTang(c3);
+		if (soe.addA(dof->getTangent(nullptr), dof->getID()) < 0) {
+			opserr << "BatchTransientAnalysis::formTangent() - failed to add a nodal tangent\n";
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+int BatchTransientAnalysis::record(Domain& domain, AnalysisModel& model, int k, double time)
+{
+	const int n = m_num_eqn;
+	const Vector u(&m_u[(std::size_t)k*n], n);
+	const Vector v(&m_v[(std::size_t)k*n], n);
+	const Vector a(&m_a[(std::size_t)k*n], n);
+
+	domain.setCurrentTime(time);
+	model.setResponse(u, v, a);
+	if (model.updateDomain() < 0) {
+		opserr << "BatchTransientAnalysis::analyze() - the domain failed to update at time " << time << "\n";
+		return -1;
+	}
+
+	const int tag = domain.getCommitTag();
+	for (Recorder* recorder : m_records[k].recorders)
+		if (recorder->record(tag, time) < 0)
+			return -1;
+
+	return 0;
+}
@@ -0,0 +1,92 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the class definition for
+// BatchTransientAnalysis. BatchTransientAnalysis advances the linear
+// response of a model to several ground motions in lockstep.
+//
+// Each record is a UniformExcitation pattern of the domain, paired with
+// the recorders that should see its response. The Newmark effective
+// stiffness
+//
+//     K + gamma/(beta dt) C + 1/(beta dt^2) M
+//
+// is the same for every record, so it is assembled and factored once
+// for the whole study. At each step the right-hand sides of all records
+// are formed from sparse copies of M and C and solved together as a
+// block by LinearSOE::solveMultiple().
+//
+// The records start from rest and only their own excitation is applied;
+// other load patterns are ignored. Element states are not advanced, so
+// the model is assumed to be linear (or equivalent-linear) about the
+// committed state. The domain is returned to its committed state when
+// the analysis ends.
+//
+#ifndef BatchTransientAnalysis_h
+#define BatchTransientAnalysis_h
+
+#include <vector>
+
+class Domain;
+class AnalysisModel;
+class LinearSOE;
+class UniformExcitation;
+class Recorder;
+
+class BatchTransientAnalysis
+{
+public:
+	BatchTransientAnalysis(double gamma = 0.5, double beta = 0.25);
+	~BatchTransientAnalysis();
+
+	int addRecord(UniformExcitation& pattern, const std::vector<Recorder*>& recorders);
+	int getNumRecords() const { return (int)m_records.size(); }
+
+	int analyze(Domain& domain, AnalysisModel& model, LinearSOE& soe,
+	            int numSteps, double dT);
+
+private:
+	// compressed sparse rows of a matrix in the equation numbering
+	struct Sparse {
+		std::vector<int> rows;
+		std::vector<int> cols;
+		std::vector<double> vals;
+		// y += fact*A*x
+		void product(const double* x, double* y, double fact) const;
+	};
+
+	struct Record {
+		UniformExcitation* pattern;
+		std::vector<Recorder*> recorders;
+	};
+
+	int formMatrices(AnalysisModel& model);
+	int formTangent(AnalysisModel& model, LinearSOE& soe, double dT);
+	int formInfluence(AnalysisModel& model);
+	int record(Domain& domain, AnalysisModel& model, int k, double time);
+
+private:
+	double m_gamma;
+	double m_beta;
+	int m_num_eqn;
+
+	std::vector<Record> m_records;
+
+	Sparse m_M;
+	Sparse m_C;
+
+	// M r for each record, stored one record after the other
+	std::vector<double> m_Mr;
+
+	// record states and right-hand sides, stored the same way
+	std::vector<double> m_u, m_v, m_a;
+	std::vector<double> m_rhs;
+
+	// work vectors for one record
+	std::vector<double> m_xm, m_xc;
+};
+
+#endif
@@ -266,6 +266,16 @@ DomainDecompositionAnalysis::domainChanged(void)
 int
 DomainDecompositionAnalysis::getNumExternalEqn(void)
 {
+    // the FE_Element of the subdomain asks for its size before the
+    // tangent is formed, so we check here too to see if the domain
+    // has changed
+    Domain *the_Domain = this->getDomainPtr();
+    int stamp = the_Domain->hasDomainChanged();
+    if (stamp != domainStamp) {
+	domainStamp = stamp;
+	this->domainChanged();
+    }
+
     return numExtEqn;
 }
 
@@ -0,0 +1,550 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of
+// ModalTransientAnalysis.
+//
+// References:
+//   Nigam, N.C. and Jennings, P.C. (1969) "Calculation of response
+//   spectra from strong-motion earthquake records", BSSA 59(2), 909-922.
+//   Chopra, A.K., "Dynamics of Structures", Section 5.2.
+//
+#include <ModalTransientAnalysis.h>
+#include <Domain.h>
+#include <DomainModalProperties.h>
+#include <Node.h>
+#include <NodeIter.h>
+#include <Element.h>
+#include <ElementIter.h>
+#include <LoadPattern.h>
+#include <LoadPatternIter.h>
+#include <UniformExcitation.h>
+#include <MultiSupportPattern.h>
+#include <SP_Constraint.h>
+#include <SP_ConstraintIter.h>
+#include <ImposedMotionSP.h>
+#include <ImposedMotionSP1.h>
+#include <GroundMotion.h>
+#include <classTags.h>
+#include <elementAPI.h>
+#include <runtimeAPI.h>
+#include <Vector.h>
+#include <Matrix.h>
+#include <ID.h>
+#include <map>
+#include <cmath>
+#include <string.h>
+
+int
+OPS_ADD_RUNTIME_VXV(OPS_ModalTransientAnalysis)
+{
+	// modalTransient $dt $numSteps <-modes $n> <-damp $zeta>
+	//                <-nodes $tags...> <-elements $tags...>
+
+	Domain* domain = OPS_GetDomain();
+	if (domain == nullptr) {
+		opserr << "ModalTransientAnalysis Error: no Domain available.\n";
+		return -1;
+	}
+
+	if (OPS_GetNumRemainingInputArgs() < 2) {
+		opserr << "modalTransient $dt $numSteps <-modes $n> <-damp $zeta> "
+			"<-nodes $tags> <-elements $tags>\n";
+		return -1;
+	}
+
+	int numData = 1;
+	double dt;
+	if (OPS_GetDoubleInput(&numData, &dt) < 0 || dt <= 0.0) {
+		opserr << "ModalTransientAnalysis Error: invalid time step.\n";
+		return -1;
+	}
+	int numSteps;
+	if (OPS_GetIntInput(&numData, &numSteps) < 0 || numSteps < 0) {
+		opserr << "ModalTransientAnalysis Error: invalid number of steps.\n";
+		return -1;
+	}
+
+	int numModes = 0;
+	double damping = 0.0;
+	std::vector<int> nodes, elements;
+	bool restrict_nodes = false, restrict_elements = false;
+
+	while (OPS_GetNumRemainingInputArgs() > 0) {
+		const char* flag = OPS_GetString();
+		if (strcmp(flag, "-modes") == 0) {
+			if (OPS_GetNumRemainingInputArgs() < 1 || OPS_GetIntInput(&numData, &numModes) < 0) {
+				opserr << "ModalTransientAnalysis Error: failed to get the number of modes.\n";
+				return -1;
+			}
+		}
+		else if (strcmp(flag, "-damp") == 0) {
+			if (OPS_GetNumRemainingInputArgs() < 1 || OPS_GetDoubleInput(&numData, &damping) < 0) {
+				opserr << "ModalTransientAnalysis Error: failed to get the damping ratio.\n";
+				return -1;
+			}
+		}
+		else if (strcmp(flag, "-nodes") == 0 || strcmp(flag, "-elements") == 0) {
+			std::vector<int>& tags = (flag[1] == 'n') ? nodes : elements;
+			(flag[1] == 'n' ? restrict_nodes : restrict_elements) = true;
+			while (OPS_GetNumRemainingInputArgs() > 0) {
+				int tag;
+				auto old_num_rem = OPS_GetNumRemainingInputArgs();
+				if (OPS_GetIntInput(&numData, &tag) < 0) {
+					if (OPS_GetNumRemainingInputArgs() < old_num_rem)
+						OPS_ResetCurrentInputArg(-1);
+					break;
+				}
+				tags.push_back(tag);
+			}
+		}
+		else {
+			opserr << "ModalTransientAnalysis Error: unknown option " << flag << "\n";
+			return -1;
+		}
+	}
+
+	ModalTransientAnalysis mta(domain, numModes, damping);
+
+	ID nodeTags((int)nodes.size());
+	for (std::size_t i = 0; i < nodes.size(); ++i)
+		nodeTags((int)i) = nodes[i];
+	ID elementTags((int)elements.size());
+	for (std::size_t i = 0; i < elements.size(); ++i)
+		elementTags((int)i) = elements[i];
+
+	if (mta.setRecovery(restrict_nodes ? &nodeTags : nullptr,
+	                    restrict_elements ? &elementTags : nullptr) < 0)
+		return -1;
+
+	return mta.analyze(numSteps, dt);
+}
+
+ModalTransientAnalysis::ModalTransientAnalysis(Domain* theDomain, int numModes, double dampingRatio)
+	: m_domain(theDomain)
+	, m_num_modes(numModes)
+	, m_damping(dampingRatio)
+	, m_all_nodes(true)
+	, m_all_elements(true)
+{
+
+}
+
+ModalTransientAnalysis::~ModalTransientAnalysis()
+{
+}
+
+int ModalTransientAnalysis::setRecovery(const ID* nodeTags, const ID* elementTags)
+{
+	m_all_nodes = (nodeTags == nullptr);
+	m_all_elements = (elementTags == nullptr);
+	m_node_tags.clear();
+	m_element_tags.clear();
+
+	if (nodeTags != nullptr) {
+		for (int i = 0; i < nodeTags->Size(); ++i) {
+			if (m_domain->getNode((*nodeTags)(i)) == nullptr) {
+				opserr << "ModalTransientAnalysis::setRecovery() - no node with tag " << (*nodeTags)(i) << "\n";
+				return -1;
+			}
+			m_node_tags.push_back((*nodeTags)(i));
+		}
+	}
+
+	if (elementTags != nullptr) {
+		for (int i = 0; i < elementTags->Size(); ++i) {
+			if (m_domain->getElement((*elementTags)(i)) == nullptr) {
+				opserr << "ModalTransientAnalysis::setRecovery() - no element with tag " << (*elementTags)(i) << "\n";
+				return -1;
+			}
+			m_element_tags.push_back((*elementTags)(i));
+		}
+		// elements listed without nodes only need their own nodes
+		if (nodeTags == nullptr)
+			m_all_nodes = false;
+	}
+
+	return 0;
+}
+
+int ModalTransientAnalysis::analyze(int numSteps, double dT)
+{
+	int error_code;
+
+	if ((error_code = formModes()) < 0)
+		return error_code;
+
+	if ((error_code = formExcitations()) < 0)
+		return error_code;
+
+	if ((error_code = formRecovery()) < 0)
+		return error_code;
+
+	formCoefficients(dT);
+
+	// start from rest at the current time
+	const int N = m_num_modes;
+	const double t0 = m_domain->getCurrentTime();
+	m_q.assign(N, 0.0);
+	m_qd.assign(N, 0.0);
+	m_p0.assign(N, 0.0);
+	m_p1.assign(N, 0.0);
+	formLoad(t0, m_p0);
+	m_qdd = m_p0;
+
+	for (int step = 1; step <= numSteps; ++step) {
+		const double time = t0 + step*dT;
+		formLoad(time, m_p1);
+
+		const double* p0 = m_p0.data();
+		const double* p1 = m_p1.data();
+		double* q   = m_q.data();
+		double* qd  = m_qd.data();
+		double* qdd = m_qdd.data();
+		for (int n = 0; n < N; ++n) {
+			const double qn  = m_A[n]*q[n]  + m_B[n]*qd[n]  + m_C[n]*p0[n]  + m_D[n]*p1[n];
+			const double qdn = m_Av[n]*q[n] + m_Bv[n]*qd[n] + m_Cv[n]*p0[n] + m_Dv[n]*p1[n];
+			const double w = m_omega[n];
+			q[n]   = qn;
+			qd[n]  = qdn;
+			qdd[n] = p1[n] - 2.0*m_zeta[n]*w*qdn - w*w*qn;
+		}
+		m_p0.swap(m_p1);
+
+		if (recover(time) < 0) {
+			opserr << "ModalTransientAnalysis::analyze() - failed to recover the response at time " << time << "\n";
+			return -2;
+		}
+	}
+
+	return 0;
+}
+
+int ModalTransientAnalysis::formModes()
+{
+	DomainModalProperties mp;
+	if (m_domain->getModalProperties(mp) < 0) {
+		opserr << "ModalTransientAnalysis - eigen and modalProperties have not been called" << endln;
+		return -1;
+	}
+
+	const Vector& eigenvalues = m_domain->getEigenvalues();
+	const int num_eigen = eigenvalues.Size();
+	if (num_eigen < 1 || mp.eigenvalues().Size() != num_eigen) {
+		opserr << "ModalTransientAnalysis - the modal properties do not match the last eigen analysis;\n"
+			"call 'modalProperties' after 'eigen'\n";
+		return -1;
+	}
+
+	if (m_num_modes <= 0 || m_num_modes > num_eigen)
+		m_num_modes = num_eigen;
+
+	const Vector* modal_damping = m_domain->getModalDampingFactors();
+
+	m_omega.resize(m_num_modes);
+	m_zeta.resize(m_num_modes);
+	m_scale.resize(m_num_modes);
+	m_mass.resize(m_num_modes);
+	for (int n = 0; n < m_num_modes; ++n) {
+		const double lambda = eigenvalues(n);
+		if (lambda <= 0.0) {
+			opserr << "ModalTransientAnalysis - mode " << n + 1 << " has a non-positive eigenvalue\n";
+			return -1;
+		}
+		m_omega[n] = std::sqrt(lambda);
+
+		double zeta = m_damping;
+		if (modal_damping != nullptr && modal_damping->Size() > 0 && m_damping == 0.0)
+			zeta = (*modal_damping)(n < modal_damping->Size() ? n : modal_damping->Size() - 1);
+		if (zeta < 0.0 || zeta >= 1.0) {
+			opserr << "ModalTransientAnalysis - damping ratio of mode " << n + 1 << " must be in [0, 1)\n";
+			return -1;
+		}
+		m_zeta[n] = zeta;
+		m_scale[n] = mp.eigenVectorScaleFactors()(n);
+		m_mass[n] = mp.generalizedMasses()(n);
+	}
+
+	return 0;
+}
+
+int ModalTransientAnalysis::formExcitations()
+{
+	DomainModalProperties mp;
+	m_domain->getModalProperties(mp);
+	const Matrix& MPF = mp.modalParticipationFactors();
+	const int N = m_num_modes;
+
+	m_uniform.clear();
+	m_support.clear();
+
+	LoadPattern* pattern;
+	LoadPatternIter& patterns = m_domain->getLoadPatterns();
+	while ((pattern = patterns()) != nullptr) {
+
+		if (pattern->getClassTag() == PATTERN_TAG_UniformExcitation) {
+			UniformExcitation* uniform = static_cast<UniformExcitation*>(pattern);
+			const int dof = uniform->getDirection();
+			if (dof < 0 || dof >= MPF.noCols()) {
+				opserr << "ModalTransientAnalysis - UniformExcitation " << pattern->getTag()
+					<< " acts in a direction without modal participation factors\n";
+				return -1;
+			}
+			Uniform entry;
+			entry.motion = uniform->getGroundMotion();
+			entry.gamma.resize(N);
+			for (int n = 0; n < N; ++n)
+				entry.gamma[n] = -uniform->getFactor()*MPF(n, dof);
+			m_uniform.push_back(entry);
+		}
+
+		else if (pattern->getClassTag() == PATTERN_TAG_MultiSupportPattern) {
+			SP_Constraint* sp;
+			SP_ConstraintIter& sps = pattern->getSPs();
+			while ((sp = sps()) != nullptr) {
+				int motion_tag;
+				if (sp->getClassTag() == CNSTRNT_TAG_ImposedMotionSP)
+					motion_tag = static_cast<ImposedMotionSP*>(sp)->getGroundMotionTag();
+				else if (sp->getClassTag() == CNSTRNT_TAG_ImposedMotionSP1)
+					motion_tag = static_cast<ImposedMotionSP1*>(sp)->getGroundMotionTag();
+				else
+					continue;
+
+				Support entry;
+				entry.node = m_domain->getNode(sp->getNodeTag());
+				entry.dof = sp->getDOF_Number();
+				entry.motion = pattern->getMotion(motion_tag);
+				if (entry.node == nullptr || entry.motion == nullptr) {
+					opserr << "ModalTransientAnalysis - imposed motion on node " << sp->getNodeTag()
+						<< " has no node or ground motion\n";
+					return -1;
+				}
+				entry.gamma.assign(N, 0.0);
+				m_support.push_back(entry);
+			}
+		}
+	}
+
+	if (m_support.empty())
+		return 0;
+
+	//
+	// The support displacements load the free DOFs through the coupling
+	// stiffness, f = -K(:,s) d_s(t); project the columns of K for each
+	// supported DOF onto the modes
+	//
+	std::map<Node*, std::vector<int>> supported;
+	for (std::size_t s = 0; s < m_support.size(); ++s)
+		supported[m_support[s].node].push_back((int)s);
+
+	Element* element;
+	ElementIter& elements = m_domain->getElements();
+	while ((element = elements()) != nullptr) {
+		const int num_nodes = element->getNumExternalNodes();
+		Node** nodes = element->getNodePtrs();
+
+		bool coupled = false;
+		for (int a = 0; a < num_nodes && !coupled; ++a)
+			coupled = supported.count(nodes[a]) != 0;
+		if (!coupled)
+			continue;
+
+		const Matrix& K = element->getInitialStiff();
+
+		for (int a = 0, off_a = 0; a < num_nodes; off_a += nodes[a]->getNumberDOF(), ++a) {
+			auto it = supported.find(nodes[a]);
+			if (it == supported.end())
+				continue;
+
+			for (int s : it->second) {
+				Support& entry = m_support[s];
+				const int col = off_a + entry.dof;
+
+				for (int b = 0, off_b = 0; b < num_nodes; off_b += nodes[b]->getNumberDOF(), ++b) {
+					const Matrix& V = nodes[b]->getEigenvectors();
+					const int rows = std::min(nodes[b]->getNumberDOF(), V.noRows());
+					const int cols = std::min(N, V.noCols());
+					for (int i = 0; i < rows; ++i) {
+						const double k = K(off_b + i, col);
+						if (k == 0.0)
+							continue;
+						for (int n = 0; n < cols; ++n)
+							entry.gamma[n] -= V(i, n)*m_scale[n]*k/m_mass[n];
+					}
+				}
+			}
+		}
+	}
+
+	return 0;
+}
+
+int ModalTransientAnalysis::formRecovery()
+{
+	m_nodes.clear();
+	m_elements.clear();
+
+	if (m_all_elements) {
+		Element* element;
+		ElementIter& elements = m_domain->getElements();
+		while ((element = elements()) != nullptr)
+			m_elements.push_back(element);
+	}
+	else {
+		for (int tag : m_element_tags)
+			m_elements.push_back(m_domain->getElement(tag));
+	}
+
+	if (m_all_nodes) {
+		Node* node;
+		NodeIter& nodes = m_domain->getNodes();
+		while ((node = nodes()) != nullptr)
+			m_nodes.push_back(node);
+	}
+	else {
+		// requested nodes, the nodes of the requested elements and the
+		// supports, each once
+		std::map<int, Node*> unique;
+		for (int tag : m_node_tags)
+			unique[tag] = m_domain->getNode(tag);
+		for (Element* element : m_elements) {
+			Node** nodes = element->getNodePtrs();
+			for (int a = 0; a < element->getNumExternalNodes(); ++a)
+				unique[nodes[a]->getTag()] = nodes[a];
+		}
+		for (const Support& entry : m_support)
+			unique[entry.node->getTag()] = entry.node;
+		for (auto& item : unique)
+			m_nodes.push_back(item.second);
+	}
+
+	return 0;
+}
+
+void ModalTransientAnalysis::formCoefficients(double dT)
+{
+	const int N = m_num_modes;
+	m_A.resize(N);  m_B.resize(N);  m_C.resize(N);  m_D.resize(N);
+	m_Av.resize(N); m_Bv.resize(N); m_Cv.resize(N); m_Dv.resize(N);
+
+	for (int n = 0; n < N; ++n) {
+		const double w  = m_omega[n];
+		const double z  = m_zeta[n];
+		const double sq = std::sqrt(1.0 - z*z);
+		const double wd = w*sq;
+		const double k  = w*w;
+		const double e  = std::exp(-z*w*dT);
+		const double s  = std::sin(wd*dT);
+		const double c  = std::cos(wd*dT);
+		const double r  = z/sq;
+
+		m_A[n] = e*(r*s + c);
+		m_B[n] = e*s/wd;
+		m_C[n] = (2.0*z/(w*dT) + e*(((1.0 - 2.0*z*z)/(wd*dT) - r)*s - (1.0 + 2.0*z/(w*dT))*c))/k;
+		m_D[n] = (1.0 - 2.0*z/(w*dT) + e*((2.0*z*z - 1.0)/(wd*dT)*s + 2.0*z/(w*dT)*c))/k;
+
+		m_Av[n] = -e*w/sq*s;
+		m_Bv[n] = e*(c - r*s);
+		m_Cv[n] = (-1.0/dT + e*((w/sq + z/(dT*sq))*s + c/dT))/k;
+		m_Dv[n] = (1.0 - e*(r*s + c))/(k*dT);
+	}
+}
+
+void ModalTransientAnalysis::formLoad(double time, std::vector<double>& p) const
+{
+	const int N = m_num_modes;
+	p.assign(N, 0.0);
+
+	for (const Uniform& entry : m_uniform) {
+		const double ag = const_cast<GroundMotion*>(entry.motion)->getAccel(time);
+		if (ag != 0.0)
+			for (int n = 0; n < N; ++n)
+				p[n] += entry.gamma[n]*ag;
+	}
+
+	for (const Support& entry : m_support) {
+		const double dg = entry.motion->getDisp(time);
+		if (dg != 0.0)
+			for (int n = 0; n < N; ++n)
+				p[n] += entry.gamma[n]*dg;
+	}
+}
+
+int ModalTransientAnalysis::recover(double time)
+{
+	const int N = m_num_modes;
+
+	for (Node* node : m_nodes) {
+		const Matrix& V = node->getEigenvectors();
+		const int ndf = node->getNumberDOF();
+		const int rows = std::min(ndf, V.noRows());
+		const int cols = std::min(N, V.noCols());
+
+		if ((int)m_disp.size() <= ndf) {
+			m_disp.resize(ndf + 1);
+			m_vel.resize(ndf + 1);
+			m_accel.resize(ndf + 1);
+		}
+		Vector& u = m_disp[ndf];
+		Vector& v = m_vel[ndf];
+		Vector& a = m_accel[ndf];
+		if (u.Size() != ndf) {
+			u.resize(ndf);
+			v.resize(ndf);
+			a.resize(ndf);
+		}
+		u.Zero();
+		v.Zero();
+		a.Zero();
+
+		for (int i = 0; i < rows; ++i) {
+			double ui = 0.0, vi = 0.0, ai = 0.0;
+			for (int n = 0; n < cols; ++n) {
+				const double phi = V(i, n)*m_scale[n];
+				ui += phi*m_q[n];
+				vi += phi*m_qd[n];
+				ai += phi*m_qdd[n];
+			}
+			u(i) = ui;
+			v(i) = vi;
+			a(i) = ai;
+		}
+
+		node->setTrialDisp(u);
+		node->setTrialVel(v);
+		node->setTrialAccel(a);
+	}
+
+	// the supported DOFs follow their ground motion
+	for (const Support& entry : m_support) {
+		const double dg = entry.motion->getDisp(time);
+		const double vg = entry.motion->getVel(time);
+		const double ag = entry.motion->getAccel(time);
+		entry.node->setTrialDisp(dg, entry.dof);
+		Vector& v = m_vel[entry.node->getNumberDOF()];
+		Vector& a = m_accel[entry.node->getNumberDOF()];
+		v = entry.node->getTrialVel();
+		a = entry.node->getTrialAccel();
+		v(entry.dof) = vg;
+		a(entry.dof) = ag;
+		entry.node->setTrialVel(v);
+		entry.node->setTrialAccel(a);
+	}
+
+	m_domain->setCurrentTime(time);
+
+	for (Element* element : m_elements)
+		if (element->update() < 0)
+			return -1;
+
+	for (Node* node : m_nodes)
+		node->commitState();
+	for (Element* element : m_elements)
+		element->commitState();
+
+	m_domain->setCommittedTime(time);
+	return m_domain->record() < 0 ? -1 : 0;
+}
@@ -0,0 +1,109 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the class definition for
+// ModalTransientAnalysis. ModalTransientAnalysis computes the linear
+// response history of a domain by modal superposition.
+//
+// The UniformExcitation and MultiSupportPattern load patterns of the
+// domain are projected onto the modes found by the last eigen analysis,
+// and the resulting uncoupled SDOF equations
+//
+//     q''_n + 2 zeta_n w_n q'_n + w_n^2 q_n = p_n(t)
+//
+// are integrated exactly for a modal load that varies linearly over
+// each step (Nigam and Jennings, 1969). The modal coordinates start
+// from rest.
+//
+// Physical responses are recovered, and the recorders invoked, only for
+// the nodes and elements requested; by default every node and element
+// of the domain is recovered.
+//
+// The analysis requires the modal properties of the domain (the
+// "modalProperties" command) to have been computed after the eigen
+// analysis.
+//
+#ifndef ModalTransientAnalysis_h
+#define ModalTransientAnalysis_h
+
+#include <vector>
+#include <Vector.h>
+
+class Domain;
+class Node;
+class Element;
+class GroundMotion;
+class ID;
+
+class ModalTransientAnalysis
+{
+public:
+	ModalTransientAnalysis(Domain* theDomain, int numModes = 0, double dampingRatio = 0.0);
+	~ModalTransientAnalysis();
+
+public:
+	// restrict the recovery of physical responses; a null pointer
+	// leaves that set at its default (all nodes or all elements)
+	int setRecovery(const ID* nodeTags, const ID* elementTags);
+
+	int analyze(int numSteps, double dT);
+
+private:
+	int formModes();
+	int formExcitations();
+	int formRecovery();
+	void formCoefficients(double dT);
+	void formLoad(double time, std::vector<double>& p) const;
+	int recover(double time);
+
+private:
+	// a UniformExcitation, projected onto the modes
+	struct Uniform {
+		const GroundMotion* motion;
+		std::vector<double> gamma;   // -fact*MPF_n
+	};
+	// an imposed support motion, projected onto the modes
+	struct Support {
+		Node* node;
+		int dof;
+		GroundMotion* motion;
+		std::vector<double> gamma;   // -phi_n' K(:,dof) / m_n
+	};
+
+	Domain* m_domain;
+	int m_num_modes;
+	double m_damping;
+
+	// modal data
+	std::vector<double> m_omega;
+	std::vector<double> m_zeta;
+	std::vector<double> m_scale;
+	std::vector<double> m_mass;
+
+	// exact step coefficients, one entry per mode
+	std::vector<double> m_A, m_B, m_C, m_D;
+	std::vector<double> m_Av, m_Bv, m_Cv, m_Dv;
+
+	// modal state
+	std::vector<double> m_q, m_qd, m_qdd;
+	std::vector<double> m_p0, m_p1;
+
+	std::vector<Uniform> m_uniform;
+	std::vector<Support> m_support;
+
+	// recovery sets
+	bool m_all_nodes;
+	bool m_all_elements;
+	std::vector<int> m_node_tags;
+	std::vector<int> m_element_tags;
+	std::vector<Node*> m_nodes;
+	std::vector<Element*> m_elements;
+
+	// nodal work vectors, indexed by the number of DOFs
+	std::vector<Vector> m_disp, m_vel, m_accel;
+};
+
+#endif
@@ -83,3 +83,13 @@ SubstructuringAnalysis::~SubstructuringAnalysis()
 }    
 
 
+// the condensed subdomain takes no step of its own; the analysis of
+// the PartitionedDomain solves for it through the condensed tangent
+// and residual and computeInternalResponse()
+int
+SubstructuringAnalysis::analysisStep(double dT)
+{
+    return 0;
+}
+
+
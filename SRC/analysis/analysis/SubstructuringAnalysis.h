@@ -66,6 +66,8 @@ class SubstructuringAnalysis: public DomainDecompositionAnalysis
 			   ConvergenceTest *theTest);
 
     virtual ~SubstructuringAnalysis();
+
+    virtual int analysisStep(double dT);
     
   protected: 
     
@@ -37,10 +37,22 @@
 #define MAX_NUM_DOF 256
 
 
-// static variables initialisation
-Matrix **DOF_Group::theMatrices; // array of pointers to class wide matrices
-Vector **DOF_Group::theVectors;  // array of pointers to class widde vectors
-int DOF_Group::numDOFs(0);       // number of objects
+// The tangent and unbalance of a group with no more than MAX_NUM_DOF dof
+// are formed in a matrix and vector shared by all the DOF_Groups of that
+// size on the calling thread, as for the FE_Elements.
+namespace {
+struct ScratchStorage {
+  Matrix *theMatrices[MAX_NUM_DOF+1] = {};
+  Vector *theVectors[MAX_NUM_DOF+1]  = {};
+  ~ScratchStorage() {
+    for (int i=0; i<=MAX_NUM_DOF; i++) {
+      delete theMatrices[i];
+      delete theVectors[i];
+    }
+  }
+};
+thread_local ScratchStorage scratch;
+}
 
 
 //  DOF_Group(Node *);
@@ -48,7 +60,7 @@ int DOF_Group::numDOFs(0);       // number of objects
 
 DOF_Group::DOF_Group(int tag, Node *node)
 :TaggedObject(tag),
- unbalance(0), tangent(0), myNode(node), 
+ myNode(node), theUnbalance(nullptr), theTangent(nullptr),
  myID(node->getNumberDOF()), 
  numDOF(node->getNumberDOF())
 {
@@ -71,46 +83,18 @@ DOF_Group::DOF_Group(int tag, Node *node)
     for (int i=0; i<numDOF; i++)
 	myID(i) = -2;
     
-    // if this is the first DOF_Group we now
-    // create the arrays used to store pointers to class wide
-    // matrix and vector objects used to return tangent and residual
-    if (numDOFs == 0) {
-	theMatrices = new Matrix *[MAX_NUM_DOF+1];
-	theVectors  = new Vector *[MAX_NUM_DOF+1];
-	
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    theMatrices[i] = 0;
-	    theVectors[i] = 0;
-	}
-    }    
-    
-    // set the pointers for the tangent and residual
-    if (numDOF <= MAX_NUM_DOF) {
-	// use class wide objects
-	if (theVectors[numDOF] == 0) {
-	    // have to create matrix and vector of size as none yet created
-	    theVectors[numDOF] = new Vector(numDOF);
-	    theMatrices[numDOF] = new Matrix(numDOF,numDOF);
-	    unbalance = theVectors[numDOF];
-	    tangent = theMatrices[numDOF];
-
-	} else {
-	    unbalance = theVectors[numDOF];
-	    tangent = theMatrices[numDOF];
-	}
-    } else {
-	// create matrices and vectors for each object instance
-	unbalance = new Vector(numDOF);
-	tangent = new Matrix(numDOF, numDOF);
+    // create matrices and vectors for each object instance too
+    // large for the storage shared on a thread
+    if (numDOF > MAX_NUM_DOF) {
+	theUnbalance = new Vector(numDOF);
+	theTangent = new Matrix(numDOF, numDOF);
     }
-    
-    numDOFs++;
 }
 
 
 DOF_Group::DOF_Group(int tag, int ndof)
 :TaggedObject(tag),
- unbalance(0), tangent(0), myNode(0), 
+ myNode(0), theUnbalance(nullptr), theTangent(nullptr),
  myID(ndof), 
  numDOF(ndof)
 {
@@ -126,38 +110,12 @@ DOF_Group::DOF_Group(int tag, int ndof)
     for (int i=0; i<numDOF; i++)
 	myID(i) = -2;
     
-    // if this is the first DOF_Group we now
-    // create the arrays used to store pointers to class wide
-    // matrix and vector objects used to return tangent and residual
-    if (numDOFs == 0) {
-	theMatrices = new Matrix *[MAX_NUM_DOF+1];
-	theVectors  = new Vector *[MAX_NUM_DOF+1];
-	
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    theMatrices[i] = 0;
-	    theVectors[i]  = 0;
-	}
-    }    
-
-    // set the pointers for the tangent and residual
-    if (numDOF <= MAX_NUM_DOF) {
-	// use class wide objects
-	if (theVectors[numDOF] == 0) {
-	    // have to create matrix and vector of size as none yet created
-	    theVectors[numDOF] = new Vector(numDOF);
-	    theMatrices[numDOF] = new Matrix(numDOF,numDOF);
-	    unbalance = theVectors[numDOF];
-	    tangent   = theMatrices[numDOF];
-	} else {
-	    unbalance = theVectors[numDOF];
-	    tangent   = theMatrices[numDOF];
-	}
-    } else {
-	// create matrices and vectors for each object instance
-	unbalance = new Vector(numDOF);
-	tangent   = new Matrix(numDOF, numDOF);
+    // create matrices and vectors for each object instance too
+    // large for the storage shared on a thread
+    if (numDOF > MAX_NUM_DOF) {
+	theUnbalance = new Vector(numDOF);
+	theTangent = new Matrix(numDOF, numDOF);
     }
-    numDOFs++;
 }
 
 // ~DOF_Group();    
@@ -165,9 +123,6 @@ DOF_Group::DOF_Group(int tag, int ndof)
 
 DOF_Group::~DOF_Group()
 {
-  numDOFs--;
-
-  int numDOF = unbalance->Size();
 
   // set the pointer in the associated Node to 0, to stop
   // segmentation fault if node tries to use this object after destroyed
@@ -175,23 +130,8 @@ DOF_Group::~DOF_Group()
     myNode->setDOF_GroupPtr(0);
 
   // delete tangent and residual if created specially
-  if (numDOF > MAX_NUM_DOF) {
-      if (tangent != 0) delete tangent;
-      if (unbalance != 0) delete unbalance;
-  }
-
-  // if this is the last FE_Element, clean up the
-  // storage for the matrix and vector objects
-  if (numDOFs == 0) {
-    for (int i=0; i<MAX_NUM_DOF; i++) {
-        if (theVectors[i] != nullptr)
-            delete theVectors[i];
-        if (theMatrices[i] != nullptr)
-            delete theMatrices[i];
-    }
-    delete [] theMatrices;
-    delete [] theVectors;
-  }
+  delete theTangent;
+  delete theUnbalance;
 }    
 
 // void setID(int index, int value);
@@ -273,13 +213,13 @@ DOF_Group::getTangent(Integrator *theIntegrator)
 {	
   if (theIntegrator != nullptr)
       theIntegrator->formNodTangent(this);    
-  return *tangent;
+  return tangent();
 }
 
 void  
 DOF_Group::zeroTangent(void)
 {
-  tangent->Zero();
+  tangent().Zero();
 }
 
 
@@ -289,7 +229,7 @@ DOF_Group::addMtoTang(double fact)
   // if there is no associated node, subclass should 
   // implement this method (ie addMtoTang())
   assert(myNode != nullptr);
-  tangent->addMatrix(1.0, myNode->getMass(), fact);
+  tangent().addMatrix(1.0, myNode->getMass(), fact);
 }
 
 
@@ -299,7 +239,7 @@ DOF_Group::addCtoTang(double fact)
   // if there is no associated node, subclass should 
   // implement this method (ie addCtoTang())
   assert(myNode != nullptr);
-  tangent->addMatrix(1.0, myNode->getDamp(), fact);
+  tangent().addMatrix(1.0, myNode->getDamp(), fact);
 }
 
 
@@ -307,7 +247,7 @@ DOF_Group::addCtoTang(double fact)
 void
 DOF_Group::zeroUnbalance(void) 
 {
-  unbalance->Zero();
+  unbalance().Zero();
 }
 
 
@@ -317,7 +257,7 @@ DOF_Group::getUnbalance(Integrator *theIntegrator)
   if (theIntegrator != nullptr)
     theIntegrator->formNodUnbalance(this);
 
-  return *unbalance;
+  return unbalance();
 }
 
 
@@ -327,7 +267,7 @@ DOF_Group::addPtoUnbalance(double fact)
   // if there is no associated node, subclass should 
   // implement this method (ie addPtoUnbalance())
   assert(myNode != nullptr);
-  unbalance->addVector(1.0, myNode->getUnbalancedLoad(), fact);
+  unbalance().addVector(1.0, myNode->getUnbalancedLoad(), fact);
 }
 
 
@@ -337,7 +277,7 @@ DOF_Group::addPIncInertiaToUnbalance(double fact)
   // if there is no associated node, subclass should 
   // implement this method (ie addPIncInertiaToUnbalance())
   assert(myNode != nullptr);
-  unbalance->addVector(1.0, myNode->getUnbalancedLoadIncInertia(), fact);
+  unbalance().addVector(1.0, myNode->getUnbalancedLoadIncInertia(), fact);
 }
 
 
@@ -360,7 +300,7 @@ DOF_Group::addM_Force(const Vector &Udotdot, double fact)
 	else accel(i) = 0.0;
     }
 
-    unbalance->addMatrixVector(1.0, myNode->getMass(), accel, fact);
+    unbalance().addMatrixVector(1.0, myNode->getMass(), accel, fact);
 }
 
 
@@ -369,7 +309,7 @@ const Vector &
 DOF_Group::getTangForce(const Vector &Udotdot, double fact)
 {
   opserr << "DOF_Group::getTangForce() - not yet implemented";
-  return *unbalance;
+  return unbalance();
 }
 
 
@@ -379,7 +319,7 @@ DOF_Group::getM_Force(const Vector &Udotdot, double fact)
     if (myNode == 0) {
 	opserr << "DOF_Group::getM_Force() - no Node associated";	
 	opserr << " subclass should not call this method \n";	    
-	return *unbalance;
+	return unbalance();
     }
 
     Vector accel(numDOF);
@@ -391,9 +331,9 @@ DOF_Group::getM_Force(const Vector &Udotdot, double fact)
 	else accel(i) = 0.0;
     }
 	
-    unbalance->addMatrixVector(0.0, myNode->getMass(), accel, fact);
+    unbalance().addMatrixVector(0.0, myNode->getMass(), accel, fact);
     
-    return *unbalance;
+    return unbalance();
 }
 
 
@@ -412,8 +352,8 @@ DOF_Group::getC_Force(const Vector &Udotdot, double fact)
       else accel(i) = 0.0;
   }
       
-  unbalance->addMatrixVector(0.0, myNode->getDamp(), accel, fact);
-  return *unbalance;
+  unbalance().addMatrixVector(0.0, myNode->getDamp(), accel, fact);
+  return unbalance();
 }
 
 
@@ -447,7 +387,7 @@ void
 DOF_Group::setNodeDisp(const Vector &u)
 {
   assert(myNode != nullptr); 
-  Vector &disp = *unbalance;
+  Vector &disp = unbalance();
   disp = myNode->getTrialDisp();
   int i;
   
@@ -471,7 +411,7 @@ DOF_Group::setNodeVel(const Vector &udot)
 {
   assert(myNode != nullptr);
 
-  Vector &vel = *unbalance;
+  Vector &vel = unbalance();
   vel = myNode->getTrialVel();
   int i;
   
@@ -495,7 +435,7 @@ DOF_Group::setNodeAccel(const Vector &udotdot)
 
   assert(myNode != nullptr);
 
-  Vector &accel = *unbalance;;
+  Vector &accel = unbalance();;
   accel = myNode->getTrialAccel();
   int i;
   
@@ -519,7 +459,7 @@ DOF_Group::incrNodeDisp(const Vector &u)
 {
   assert(myNode != nullptr);
 
-  Vector &disp = *unbalance;
+  Vector &disp = unbalance();
 
   assert(disp.Size() != 0);
 
@@ -545,7 +485,7 @@ DOF_Group::incrNodeVel(const Vector &udot)
 {
   assert(myNode != nullptr);
     
-  Vector &vel = *unbalance;
+  Vector &vel = unbalance();
   
   // get vel for my dof out of vector udot
   for (int i=0; i<numDOF; i++) {
@@ -570,7 +510,7 @@ DOF_Group::incrNodeAccel(const Vector &udotdot)
 
   assert(myNode != nullptr);
 
-  Vector &accel = *unbalance;
+  Vector &accel = unbalance();
   
   // get disp for the unconstrained dof
   for (int i=0; i<numDOF; i++) {
@@ -611,7 +551,7 @@ void
 DOF_Group::setEigenvector(int mode, const Vector &theVector)
 {
   assert(myNode != nullptr);
-  Vector &eigenvector = *unbalance;
+  Vector &eigenvector = unbalance();
   
   // get disp for the unconstrained dof
   for (int i=0; i<numDOF; i++) {
@@ -646,7 +586,31 @@ void
 DOF_Group::addLocalM_Force(const Vector &accel, double fact)
 {
   assert(myNode != nullptr);
-  unbalance->addMatrixVector(1.0, myNode->getMass(), accel, fact);
+  unbalance().addMatrixVector(1.0, myNode->getMass(), accel, fact);
+}
+
+Vector &
+DOF_Group::unbalance()
+{
+    if (theUnbalance != nullptr)
+      return *theUnbalance;
+
+    Vector *&theVector = scratch.theVectors[numDOF];
+    if (theVector == nullptr)
+      theVector = new Vector(numDOF);
+    return *theVector;
+}
+
+Matrix &
+DOF_Group::tangent()
+{
+    if (theTangent != nullptr)
+      return *theTangent;
+
+    Matrix *&theMatrix = scratch.theMatrices[numDOF];
+    if (theMatrix == nullptr)
+      theMatrix = new Matrix(numDOF, numDOF);
+    return *theMatrix;
 }
 
 
@@ -654,7 +618,7 @@ DOF_Group::addLocalM_Force(const Vector &accel, double fact)
 const Vector &
 DOF_Group::getDispSensitivity(int gradNumber)
 {
-  Vector &result = *unbalance;
+  Vector &result = unbalance();
   for (int i=0; i<numDOF; i++) {
     result(i) = myNode->getDispSensitivity(i+1,gradNumber);
   }
@@ -664,7 +628,7 @@ DOF_Group::getDispSensitivity(int gradNumber)
 const Vector &
 DOF_Group::getVelSensitivity(int gradNumber)
 {
-    Vector &result = *unbalance;
+    Vector &result = unbalance();
     for (int i=0; i<numDOF; i++)
       result(i) = myNode->getVelSensitivity(i+1,gradNumber);
 
@@ -674,7 +638,7 @@ DOF_Group::getVelSensitivity(int gradNumber)
 const Vector &
 DOF_Group::getAccSensitivity(int gradNumber)
 {
-    Vector &result = *unbalance;
+    Vector &result = unbalance();
     for (int i=0; i<numDOF; i++)
       result(i) = myNode->getAccSensitivity(i+1,gradNumber);
 
@@ -686,7 +650,7 @@ DOF_Group::getAccSensitivity(int gradNumber)
 int 
 DOF_Group::saveDispSensitivity(const Vector &v, int gradNum, int numGrads)
 {
-  Vector &dudh = *unbalance;
+  Vector &dudh = unbalance();
 
   for (int i = 0; i < numDOF; i++) {
     int loc = myID(i);
@@ -702,7 +666,7 @@ DOF_Group::saveDispSensitivity(const Vector &v, int gradNum, int numGrads)
 int 
 DOF_Group::saveVelSensitivity(const Vector &v, int gradNum, int numGrads)
 {
-  Vector &dudh = *unbalance;
+  Vector &dudh = unbalance();
 
   for (int i = 0; i < numDOF; i++) {
     int loc = myID(i);
@@ -718,7 +682,7 @@ DOF_Group::saveVelSensitivity(const Vector &v, int gradNum, int numGrads)
 int 
 DOF_Group::saveAccSensitivity(const Vector &v, int gradNum, int numGrads)
 {
-  Vector &dudh = *unbalance;
+  Vector &dudh = unbalance();
 
   for (int i = 0; i < numDOF; i++) {
     int loc = myID(i);
@@ -759,7 +723,7 @@ DOF_Group::addM_ForceSensitivity(const Vector &Udotdot, double fact)
       else accel(i) = 0.0;
   }
       
-  unbalance->addMatrixVector(1.0, myNode->getMassSensitivity(), accel, fact);
+  unbalance().addMatrixVector(1.0, myNode->getMassSensitivity(), accel, fact);
 }
 
 void
@@ -776,7 +740,7 @@ DOF_Group::addD_Force(const Vector &Udot, double fact)
       else vel(i) = 0.0;
   }
 
-  unbalance->addMatrixVector(1.0, myNode->getDamp(), vel, fact);
+  unbalance().addMatrixVector(1.0, myNode->getDamp(), vel, fact);
 }
 
 void
@@ -793,7 +757,7 @@ DOF_Group::addD_ForceSensitivity(const Vector &Udot, double fact)
       else vel(i) = 0.0;
   }
 
-  unbalance->addMatrixVector(1.0, myNode->getDampSensitivity(), vel, fact);
+  unbalance().addMatrixVector(1.0, myNode->getDampSensitivity(), vel, fact);
 }
 
 // AddingSensitivity:END //////////////////////////////////////////
@@ -835,7 +799,7 @@ DOF_Group::getDampingBetaForce(int mode, double beta)
   for (int i=0; i<numDOF; i++)
     eigenvector(i) = eigenVectors(i,mode);
 
-  unbalance->addMatrixVector(0.0, mass, eigenvector, -beta);
-  return *unbalance;
+  unbalance().addMatrixVector(0.0, mass, eigenvector, -beta);
+  return unbalance();
 }
 
@@ -125,21 +125,18 @@ class DOF_Group: public TaggedObject
   
    protected:
     void  addLocalM_Force(const Vector &Udotdot, double fact = 1.0);     
+    Vector &unbalance();
+    Matrix &tangent();
 
     // protected variables - a copy for each object of the class            
-    Vector *unbalance;
-    Matrix *tangent;
     Node   *myNode;
     
   private:
     // private variables - a copy for each object of the class        
+    Vector *theUnbalance;   // own storage, if no thread's is used
+    Matrix *theTangent;
     ID 	myID;
     int numDOF;
-
-    // static variables - single copy for all objects of the class	    
-    static Matrix **theMatrices; // array of pointers to class wide matrices
-    static Vector **theVectors;  // array of pointers to class widde vectors
-    static int numDOFs;          // number of objects    
 };
 
 #endif
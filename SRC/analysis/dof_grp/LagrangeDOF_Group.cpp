@@ -68,13 +68,8 @@ const Matrix &
 LagrangeDOF_Group::getTangent(Integrator *theIntegrator)
 {
     // does nothing - the Lagrange FE_Elements provide coeffs to tangent
-    if (tangent == nullptr) {
-	int numDOF = this->getNumDOF();
-	tangent = new Matrix(numDOF,numDOF);
-    }
-    
-    tangent->Zero();
-    return *tangent;
+    tangent().Zero();
+    return tangent();
     
 }
 
@@ -82,8 +77,8 @@ const Vector &
 LagrangeDOF_Group::getUnbalance(Integrator *theIntegrator)
 {
     // does nothing - the Lagrange FE_Elements provide residual 
-    unbalance->Zero();
-    return *unbalance;
+    unbalance().Zero();
+    return unbalance();
 }
 
 // void setNodeDisp(const Vector &u);
@@ -185,15 +180,15 @@ LagrangeDOF_Group::getCommittedDisp(void)
 const Vector &
 LagrangeDOF_Group::getCommittedVel(void)
 {
-    unbalance->Zero();
-    return *unbalance;
+    unbalance().Zero();
+    return unbalance();
 }
 
 const Vector &
 LagrangeDOF_Group::getCommittedAccel(void)
 {
-    unbalance->Zero();
-    return *unbalance;
+    unbalance().Zero();
+    return unbalance();
 }
 
 const Vector& LagrangeDOF_Group::getTrialDisp()
@@ -203,14 +198,14 @@ const Vector& LagrangeDOF_Group::getTrialDisp()
 
 const Vector& LagrangeDOF_Group::getTrialVel()
 {
-    unbalance->Zero();
-    return *unbalance;
+    unbalance().Zero();
+    return unbalance();
 }
 
 const Vector& LagrangeDOF_Group::getTrialAccel()
 {
-    unbalance->Zero();
-    return *unbalance;
+    unbalance().Zero();
+    return unbalance();
 }
 
 void  
@@ -250,21 +245,21 @@ const Vector &
 LagrangeDOF_Group::getTangForce(const Vector &disp, double fact)
 {
   opserr << "WARNING LagrangeDOF_Group::getTangForce() - not yet implemented\n";
-  unbalance->Zero();
-  return *unbalance;
+  unbalance().Zero();
+  return unbalance();
 }
 
 const Vector &
 LagrangeDOF_Group::getC_Force(const Vector &disp, double fact)
 {
-  unbalance->Zero();
-  return *unbalance;
+  unbalance().Zero();
+  return unbalance();
 }
 
 const Vector &
 LagrangeDOF_Group::getM_Force(const Vector &disp, double fact)
 {
-  unbalance->Zero();
-  return *unbalance;
+  unbalance().Zero();
+  return unbalance();
 }
 
@@ -42,17 +42,30 @@
 
 #define MAX_NUM_DOF 16
 
+// The reduced tangent and unbalance are formed in storage shared by the
+// groups of that size on the calling thread, as for the DOF_Groups.
+namespace {
+struct ScratchStorage {
+  Matrix *modMatrices[MAX_NUM_DOF+1] = {};
+  Vector *modVectors[MAX_NUM_DOF+1]  = {};
+  ~ScratchStorage() {
+    for (int i=0; i<=MAX_NUM_DOF; i++) {
+      delete modMatrices[i];
+      delete modVectors[i];
+    }
+  }
+};
+thread_local ScratchStorage scratch;
+}
+
 // static variables initialisation
-Matrix **TransformationDOF_Group::modMatrices; 
-Vector **TransformationDOF_Group::modVectors;  
-int TransformationDOF_Group::numTransDOFs(0);     // number of objects
 TransformationConstraintHandler *TransformationDOF_Group::theHandler = 0;     // number of objects
 
 TransformationDOF_Group::TransformationDOF_Group(int tag, Node *node, 
 						 MP_Constraint *mp,
 						 TransformationConstraintHandler *theTHandler)  
 :DOF_Group(tag,node),
- theMP(mp),Trans(0),modTangent(0),modUnbalance(0),modID(0),theSPs(0)
+ theMP(mp),Trans(0),theModTangent(0),theModUnbalance(0),modID(0),theSPs(0)
 {
     // determine the number of DOF 
     int numNodalDOF = node->getNumberDOF();
@@ -114,63 +127,11 @@ TransformationDOF_Group::TransformationDOF_Group(int tag, Node *node,
     for (int k=numConstrainedNodeRetainedDOF; k<modNumDOF; k++)
 	(*modID)(k) = -1;
     
-    // if this is the first TransformationDOF_Group we now
-    // create the arrays used to store pointers to class wide
-    // matrix and vector objects used to return modTangent and residual
-    if (numTransDOFs == 0) {
-	modMatrices = new Matrix *[MAX_NUM_DOF+1];
-	modVectors  = new Vector *[MAX_NUM_DOF+1];
-	
-	if (modMatrices == 0 || modVectors == 0) {
-	    opserr << "TransformationDOF_Group::TransformationDOF_Group(Node *) ";
-	    opserr << " ran out of memory";	    
-	}
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    modMatrices[i] = 0;
-	    modVectors[i] = 0;
-	}
-    }    
-
-    // set the pointers for the modTangent and residual
-    if (modNumDOF <= MAX_NUM_DOF) {
-	// use class wide objects
-	if (modVectors[modNumDOF] == 0) {
-	    // have to create matrix and vector of size as none yet created
-	    modVectors[modNumDOF] = new Vector(modNumDOF);
-	    modMatrices[modNumDOF] = new Matrix(modNumDOF,modNumDOF);
-	    modUnbalance = modVectors[modNumDOF];
-	    modTangent = modMatrices[modNumDOF];
-	    if (modUnbalance == 0 || modUnbalance->Size() != modNumDOF ||	
-		modTangent == 0 || modTangent->noCols() != modNumDOF)	{  
-		opserr << "TransformationDOF_Group::TransformationDOF_Group(Node *) ";
-		opserr << " ran out of memory for vector/Matrix of size :";
-		opserr << modNumDOF << endln;
-		exit(-1);
-	    }
-	} else {
-	    modUnbalance = modVectors[modNumDOF];
-	    modTangent = modMatrices[modNumDOF];
-	}
-    } else {
-	// create matrices and vectors for each object instance
-	modUnbalance = new Vector(modNumDOF);
-	modTangent = new Matrix(modNumDOF, modNumDOF);
-	if (modUnbalance == 0 || modTangent ==0 ||
-	    modTangent ==0 || modTangent->noRows() ==0) {
-	    
-	    opserr << "TransformationDOF_Group::TransformationDOF_Group(Node *) ";
-	    opserr << " ran out of memory for vector/Matrix of size :";
-	    opserr << modNumDOF << endln;
-	    exit(-1);
-	}
-    }
-
 #ifdef TRANSF_INCREMENTAL_MP
     modTotalDisp.resize(modNumDOF);
     modTotalDisp = getTrialDisp();
 #endif // TRANSF_INCREMENTAL_MP
     
-    numTransDOFs++;
     theHandler = theTHandler;
 }
 
@@ -189,7 +150,7 @@ TransformationDOF_Group::TransformationDOF_Group(int tag,
 						 Node *node, 
 						 TransformationConstraintHandler *theTHandler)
 :DOF_Group(tag,node),
- theMP(0),Trans(0),modTangent(0),modUnbalance(0),modID(0),theSPs(0) 
+ theMP(0),Trans(0),theModTangent(0),theModUnbalance(0),modID(0),theSPs(0) 
 {
     needRetainedData = -1;
     modNumDOF = node->getNumberDOF();
@@ -210,29 +171,11 @@ TransformationDOF_Group::TransformationDOF_Group(int tag,
 	}
     }    
     
-    // if this is the first TransformationDOF_Group we now
-    // create the arrays used to store pointers to class wide
-    // matrix and vector objects used to return modTangent and residual
-    if (numTransDOFs == 0) {
-	modMatrices = new Matrix *[MAX_NUM_DOF+1];
-	modVectors  = new Vector *[MAX_NUM_DOF+1];
-	
-	if (modMatrices == 0 || modVectors == 0) {
-	    opserr << "TransformationDOF_Group::TransformationDOF_Group(Node *) ";
-	    opserr << " ran out of memory";	    
-	}
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    modMatrices[i] = 0;
-	    modVectors[i] = 0;
-	}
-    }    
-
 #ifdef TRANSF_INCREMENTAL_MP
     modTotalDisp.resize(modNumDOF);
     modTotalDisp = getTrialDisp();
 #endif // TRANSF_INCREMENTAL_MP
 
-    numTransDOFs++;
     theHandler = theTHandler;
 }
 
@@ -242,31 +185,44 @@ TransformationDOF_Group::TransformationDOF_Group(int tag,
 
 TransformationDOF_Group::~TransformationDOF_Group()
 {
-    numTransDOFs--;
-
     // delete modTangent and residual if created specially
-    if (modNumDOF > MAX_NUM_DOF) {
-	if (modTangent != 0) delete modTangent;
-	if (modUnbalance != 0) delete modUnbalance;
-    }
+    delete theModTangent;
+    delete theModUnbalance;
     
     if (modID != 0) delete modID;
     if (Trans != 0) delete Trans;
     if (theSPs != 0) delete [] theSPs;
+}
 
-    // if this is the last FE_Element, clean up the
-    // storage for the matrix and vector objects
-    if (numTransDOFs == 0) {
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    if (modVectors[i] != 0)
-		delete modVectors[i];
-	    if (modMatrices[i] != 0)
-		delete modMatrices[i];
-	}	
-	delete [] modMatrices;
-	delete [] modVectors;
-    }    
-}    
+
+Matrix &
+TransformationDOF_Group::modTangent()
+{
+    // a group too large for the storage shared on a thread has its own
+    if (theModTangent != nullptr)
+      return *theModTangent;
+    if (modNumDOF > MAX_NUM_DOF)
+      return *(theModTangent = new Matrix(modNumDOF, modNumDOF));
+
+    Matrix *&theMatrix = scratch.modMatrices[modNumDOF];
+    if (theMatrix == nullptr)
+      theMatrix = new Matrix(modNumDOF, modNumDOF);
+    return *theMatrix;
+}
+
+Vector &
+TransformationDOF_Group::modUnbalance()
+{
+    if (theModUnbalance != nullptr)
+      return *theModUnbalance;
+    if (modNumDOF > MAX_NUM_DOF)
+      return *(theModUnbalance = new Vector(modNumDOF));
+
+    Vector *&theVector = scratch.modVectors[modNumDOF];
+    if (theVector == nullptr)
+      theVector = new Vector(modNumDOF);
+    return *theVector;
+}
 
 
 const ID &
@@ -322,8 +278,8 @@ TransformationDOF_Group::getTangent(Integrator *theIntegrator)
     Matrix *T = this->getT();
     if (T != 0) {
 	// *modTangent = (*T) ^ unmodTangent * (*T);
-	modTangent->addMatrixTripleProduct(0.0, *T, unmodTangent, 1.0);
-	return *modTangent;
+	modTangent().addMatrixTripleProduct(0.0, *T, unmodTangent, 1.0);
+	return modTangent();
 	
     } else 
       return unmodTangent;
@@ -338,7 +294,7 @@ TransformationDOF_Group::getEigenvectors(void)
     Matrix *T = this->getT();
     if (T != 0) {
 	// *modTangent = (*T) ^ unmodTangent * (*T);
-      static Matrix res;
+      static thread_local Matrix res;
       res = (*T) ^ unmodTangent;
       return res;
       // modTangent->addMatrixTripleProduct(0.0, *T, unmodTangent, 1.0);
@@ -357,8 +313,8 @@ TransformationDOF_Group::getUnbalance(Integrator *theIntegrator)
     Matrix *T = this->getT();
     if (T != 0) {
 	// *modUnbalance = (*T) ^ unmodUnbalance;
-	modUnbalance->addMatrixTransposeVector(0.0, *T, unmodUnbalance, 1.0);
-	return *modUnbalance;    
+	modUnbalance().addMatrixTransposeVector(0.0, *T, unmodUnbalance, 1.0);
+	return modUnbalance();    
     } else
 	return unmodUnbalance;
 }
@@ -384,17 +340,17 @@ TransformationDOF_Group::getCommittedDisp(void)
 	int loc = 0;
 	for (int i=0; i<numCNodeDOF; i++) {
 	    if (constrainedDOF.getLocation(i) < 0) {
-		(*modUnbalance)(loc) = responseC(i);
+		modUnbalance()(loc) = responseC(i);
 		loc++;
 	    } 
 	}
 	for (int j=0; j<numRetainedNodeDOF; j++) {
 	    int dof = retainedDOF(j);
-	    (*modUnbalance)(loc) = responseR(dof);
+	    modUnbalance()(loc) = responseR(dof);
 	    loc++;
 	}
 
-	return *modUnbalance;
+	return modUnbalance();
     }
 }
 
@@ -418,17 +374,17 @@ TransformationDOF_Group::getCommittedVel(void)
 	int loc = 0;
 	for (int i=0; i<numCNodeDOF; i++) {
 	    if (constrainedDOF.getLocation(i) < 0) {
-		(*modUnbalance)(loc) = responseC(i);
+		modUnbalance()(loc) = responseC(i);
 		loc++;
 	    } 
 	}
 	for (int j=0; j<numRetainedNodeDOF; j++) {
 	    int dof = retainedDOF(j);
-	    (*modUnbalance)(loc) = responseR(dof);
+	    modUnbalance()(loc) = responseR(dof);
 	    loc++;
 	}
 	
-	return *modUnbalance;
+	return modUnbalance();
     }
 }
 
@@ -453,17 +409,17 @@ TransformationDOF_Group::getCommittedAccel(void)
 	int loc = 0;
 	for (int i=0; i<numCNodeDOF; i++) {
 	    if (constrainedDOF.getLocation(i) < 0) {
-		(*modUnbalance)(loc) = responseC(i);
+		modUnbalance()(loc) = responseC(i);
 		loc++;
 	    } 
 	}
 	for (int j=0; j<numRetainedNodeDOF; j++) {
 	    int dof = retainedDOF(j);
-	    (*modUnbalance)(loc) = responseR(dof);
+	    modUnbalance()(loc) = responseR(dof);
 	    loc++;
 	}
 	
-	return *modUnbalance;
+	return modUnbalance();
     }
 }
 
@@ -476,7 +432,7 @@ TransformationDOF_Group::setNodeDisp(const Vector &u)
 {
 #ifdef TRANSF_INCREMENTAL_MP
     // save the previous mod trial here
-    static Vector modTrialDispOld;
+    static thread_local Vector modTrialDispOld;
     modTrialDispOld = modTotalDisp; // at previous iteration
 #endif // TRANSF_INCREMENTAL_MP
 
@@ -490,9 +446,9 @@ TransformationDOF_Group::setNodeDisp(const Vector &u)
   for (int i=0; i<modNumDOF; i++) {
     int loc = theID(i);
     if (loc >= 0)
-      (*modUnbalance)(i) = u(loc);
+      modUnbalance()(i) = u(loc);
     else 
-      (*modUnbalance)(i) = 0.0;
+      modUnbalance()(i) = 0.0;
   }
 
 
@@ -506,18 +462,18 @@ TransformationDOF_Group::setNodeDisp(const Vector &u)
     for (int i=numConstrainedNodeRetainedDOF, j=0; i<modNumDOF; i++, j++) {
       int loc = theID(i);
       if (loc < 0)
-	(*modUnbalance)(i) = responseR(retainedDOF(j));
+	modUnbalance()(i) = responseR(retainedDOF(j));
     }
   }
 
 #ifdef TRANSF_INCREMENTAL_MP
-  modTotalDisp = *modUnbalance; // save it for next iteration
+  modTotalDisp = modUnbalance(); // save it for next iteration
 #endif // TRANSF_INCREMENTAL_MP
 
   // at this point the modUnbalance contains the reduced total displacement.
   // remove the trial one to obtain the increment, so that we transform only the increment
 #ifdef TRANSF_INCREMENTAL_MP
-  modUnbalance->addVector(1.0, modTrialDispOld, -1.0);
+  modUnbalance().addVector(1.0, modTrialDispOld, -1.0);
 #ifdef TRANSF_INCREMENTAL_MP_DEBUG
   opserr << " N = " << myNode->getTag() << "\n";
   opserr << " solut: " << u;
@@ -537,7 +493,7 @@ TransformationDOF_Group::setNodeDisp(const Vector &u)
 
   Matrix *T = this->getT();
   // *unbalance = (*T) * (*modUnbalance);
-  unbalance->addMatrixVector(0.0, *T, *modUnbalance, 1.0);
+  unbalance().addMatrixVector(0.0, *T, modUnbalance(), 1.0);
 
   const Vector &disp = myNode->getTrialDisp();
 
@@ -545,16 +501,16 @@ TransformationDOF_Group::setNodeDisp(const Vector &u)
   for (int i=0; i<numDOF; i++) {
     if (theSPs[i] != 0)
 #ifdef TRANSF_INCREMENTAL_MP
-      (*unbalance)(i) = 0.0; // don't enfore the SP here as in incrNodeDisp!
+      unbalance()(i) = 0.0; // don't enfore the SP here as in incrNodeDisp!
 #else
-      (*unbalance)(i) = disp(i);
+      unbalance()(i) = disp(i);
 #endif // TRANSF_INCREMENTAL_MP
   }
 
 #ifdef TRANSF_INCREMENTAL_MP
-  myNode->incrTrialDisp(*unbalance);
+  myNode->incrTrialDisp(unbalance());
 #else
-  myNode->setTrialDisp(*unbalance);
+  myNode->setTrialDisp(unbalance());
 #endif // #ifdef TRANSF_INCREMENTAL_MP
 }
 
@@ -571,9 +527,9 @@ TransformationDOF_Group::setNodeVel(const Vector &u)
    for (int i=0; i<modNumDOF; i++) {
      int loc = theID(i);
      if (loc >= 0)
-       (*modUnbalance)(i) = u(loc);
+       modUnbalance()(i) = u(loc);
      else   
-       (*modUnbalance)(i) = 0.0;	    
+       modUnbalance()(i) = 0.0;	    
    }    
 
   if (needRetainedData == 0) {
@@ -586,21 +542,21 @@ TransformationDOF_Group::setNodeVel(const Vector &u)
     for (int i=numConstrainedNodeRetainedDOF, j=0; i<modNumDOF; i++, j++) {
       int loc = theID(i);
       if (loc < 0)
-	(*modUnbalance)(i) = responseR(retainedDOF(j));
+	modUnbalance()(i) = responseR(retainedDOF(j));
     }
   }
 
   Matrix *T = this->getT();
   // *unbalance = (*T) * (*modUnbalance);
-  unbalance->addMatrixVector(0.0, *T, *modUnbalance, 1.0);
+  unbalance().addMatrixVector(0.0, *T, modUnbalance(), 1.0);
 
   const Vector &vel = myNode->getTrialVel();
   int numDOF = myNode->getNumberDOF();
   for (int i=0; i<numDOF; i++) {
     if (theSPs[i] != 0)
-      (*unbalance)(i) = vel(i);
+      unbalance()(i) = vel(i);
   }
-  myNode->setTrialVel(*unbalance);
+  myNode->setTrialVel(unbalance());
 }
 
 
@@ -617,9 +573,9 @@ TransformationDOF_Group::setNodeAccel(const Vector &u)
    for (int i=0; i<modNumDOF; i++) {
 	int loc = theID(i);
 	if (loc >= 0)
-	    (*modUnbalance)(i) = u(loc);
+	    modUnbalance()(i) = u(loc);
 	else 	// NO SP STUFF .. WHAT TO DO
-	    (*modUnbalance)(i) = 0.0;	    
+	    modUnbalance()(i) = 0.0;	    
 
     }    
 
@@ -633,20 +589,20 @@ TransformationDOF_Group::setNodeAccel(const Vector &u)
     for (int i=numConstrainedNodeRetainedDOF, j=0; i<modNumDOF; i++, j++) {
       int loc = theID(i);
       if (loc < 0)
-	(*modUnbalance)(i) = responseR(retainedDOF(j));
+	modUnbalance()(i) = responseR(retainedDOF(j));
     }
   }
 
     Matrix *T = this->getT();
     // *unbalance = (*T) * (*modUnbalance);
-    unbalance->addMatrixVector(0.0, *T, *modUnbalance, 1.0);
+    unbalance().addMatrixVector(0.0, *T, modUnbalance(), 1.0);
     const Vector &accel = myNode->getTrialAccel();
     int numDOF = myNode->getNumberDOF();
     for (int i=0; i<numDOF; i++) {
       if (theSPs[i] != 0)
-	(*unbalance)(i) = accel(i);
+	unbalance()(i) = accel(i);
     }
-    myNode->setTrialAccel(*unbalance);
+    myNode->setTrialAccel(unbalance());
 }
 
 
@@ -668,25 +624,25 @@ TransformationDOF_Group::incrNodeDisp(const Vector &u)
    for (int i=0; i<modNumDOF; i++) {
      int loc = theID(i);
      if (loc >= 0)
-       (*modUnbalance)(i) = u(loc);
+       modUnbalance()(i) = u(loc);
      else  
-       (*modUnbalance)(i) = 0.0;	    
+       modUnbalance()(i) = 0.0;	    
    }    
    
 #ifdef TRANSF_INCREMENTAL_MP
-   modTotalDisp.addVector(1.0, *modUnbalance, 1.0); // accumulate it for next iteration
+   modTotalDisp.addVector(1.0, modUnbalance(), 1.0); // accumulate it for next iteration
 #endif // TRANSF_INCREMENTAL_MP
 
    Matrix *T = this->getT();
    // *unbalance = (*T) * (*modUnbalance);
-   unbalance->addMatrixVector(0.0, *T, *modUnbalance, 1.0);
+   unbalance().addMatrixVector(0.0, *T, modUnbalance(), 1.0);
    
    int numDOF = myNode->getNumberDOF();
    for (int i=0; i<numDOF; i++) {
      if (theSPs[i] != 0)
-       (*unbalance)(i) = 0.0;
+       unbalance()(i) = 0.0;
    }
-   myNode->incrTrialDisp(*unbalance);
+   myNode->incrTrialDisp(unbalance());
 }
 
 
@@ -703,21 +659,21 @@ TransformationDOF_Group::incrNodeVel(const Vector &u)
   for (int i=0; i<modNumDOF; i++) {
     int loc = theID(i);
     if (loc >= 0)
-      (*modUnbalance)(i) = u(loc);
+      modUnbalance()(i) = u(loc);
     else   
-      (*modUnbalance)(i) = 0.0;	    
+      modUnbalance()(i) = 0.0;	    
   }    
   Matrix *T = this->getT();
   
   // *unbalance = (*T) * (*modUnbalance);
-  unbalance->addMatrixVector(0.0, *T, *modUnbalance, 1.0);
+  unbalance().addMatrixVector(0.0, *T, modUnbalance(), 1.0);
   
   int numDOF = myNode->getNumberDOF();
   for (int i=0; i<numDOF; i++) {
     if (theSPs[i] != 0)
-      (*unbalance)(i) = 0.0;
+      unbalance()(i) = 0.0;
   }
-  myNode->incrTrialVel(*unbalance);
+  myNode->incrTrialVel(unbalance());
 }
 
 
@@ -734,20 +690,20 @@ TransformationDOF_Group::incrNodeAccel(const Vector &u)
   for (int i=0; i<modNumDOF; i++) {
     int loc = theID(i);
     if (loc >= 0)
-      (*modUnbalance)(i) = u(loc);
+      modUnbalance()(i) = u(loc);
     else 	
-      (*modUnbalance)(i) = 0.0;	    
+      modUnbalance()(i) = 0.0;	    
   }    
   Matrix *T = this->getT();
 
   // *unbalance = (*T) * (*modUnbalance);
-  unbalance->addMatrixVector(0.0, *T, *modUnbalance, 1.0);
+  unbalance().addMatrixVector(0.0, *T, modUnbalance(), 1.0);
   int numDOF = myNode->getNumberDOF();
   for (int i=0; i<numDOF; i++) {
     if (theSPs[i] != 0)
-      (*unbalance)(i) = 0.0;
+      unbalance()(i) = 0.0;
   }
-  myNode->incrTrialAccel(*unbalance);
+  myNode->incrTrialAccel(unbalance());
 }
 
 const Vector & 
@@ -770,17 +726,17 @@ TransformationDOF_Group::getTrialDisp(void)
 	int loc = 0;
 	for (int i=0; i<numCNodeDOF; i++) {
 	    if (constrainedDOF.getLocation(i) < 0) {
-		(*modUnbalance)(loc) = responseC(i);
+		modUnbalance()(loc) = responseC(i);
 		loc++;
 	    } 
 	}
 	for (int j=0; j<numRetainedNodeDOF; j++) {
 	    int dof = retainedDOF(j);
-	    (*modUnbalance)(loc) = responseR(dof);
+	    modUnbalance()(loc) = responseR(dof);
 	    loc++;
 	}
 
-	return *modUnbalance;
+	return modUnbalance();
     }
 }
 
@@ -804,17 +760,17 @@ TransformationDOF_Group::getTrialVel(void)
 	int loc = 0;
 	for (int i=0; i<numCNodeDOF; i++) {
 	    if (constrainedDOF.getLocation(i) < 0) {
-		(*modUnbalance)(loc) = responseC(i);
+		modUnbalance()(loc) = responseC(i);
 		loc++;
 	    } 
 	}
 	for (int j=0; j<numRetainedNodeDOF; j++) {
 	    int dof = retainedDOF(j);
-	    (*modUnbalance)(loc) = responseR(dof);
+	    modUnbalance()(loc) = responseR(dof);
 	    loc++;
 	}
 	
-	return *modUnbalance;
+	return modUnbalance();
     }
 }
 
@@ -839,17 +795,17 @@ TransformationDOF_Group::getTrialAccel(void)
 	int loc = 0;
 	for (int i=0; i<numCNodeDOF; i++) {
 	    if (constrainedDOF.getLocation(i) < 0) {
-		(*modUnbalance)(loc) = responseC(i);
+		modUnbalance()(loc) = responseC(i);
 		loc++;
 	    } 
 	}
 	for (int j=0; j<numRetainedNodeDOF; j++) {
 	    int dof = retainedDOF(j);
-	    (*modUnbalance)(loc) = responseR(dof);
+	    modUnbalance()(loc) = responseR(dof);
 	    loc++;
 	}
 	
-	return *modUnbalance;
+	return modUnbalance();
     }
 }
 
@@ -867,18 +823,18 @@ TransformationDOF_Group::setEigenvector(int mode, const Vector &u)
   for (int i=0; i<modNumDOF; i++) {
     int loc = theID(i);
     if (loc >= 0)
-      (*modUnbalance)(i) = u(loc);
+      modUnbalance()(i) = u(loc);
     else 	
-      (*modUnbalance)(i) = 0.0;	    
+      modUnbalance()(i) = 0.0;	    
   }    
   Matrix *T = this->getT();
 
     if (T != 0) {
       // *unbalance = (*T) * (*modUnbalance);
-      unbalance->addMatrixVector(0.0, *T, *modUnbalance, 1.0);
-      myNode->setEigenvector(mode, *unbalance);
+      unbalance().addMatrixVector(0.0, *T, modUnbalance(), 1.0);
+      myNode->setEigenvector(mode, unbalance());
     } else
-      myNode->setEigenvector(mode, *modUnbalance);
+      myNode->setEigenvector(mode, modUnbalance());
 }
 
 
@@ -917,6 +873,13 @@ TransformationDOF_Group::getT(void)
 }
 
 
+bool
+TransformationDOF_Group::isTimeVarying(void) const
+{
+    return theMP != 0 && theMP->isTimeVarying();
+}
+
+
 int
 TransformationDOF_Group::doneID(void)
 {
@@ -961,40 +924,6 @@ TransformationDOF_Group::doneID(void)
     }
   }
   
-  // set the pointers for the tangent and residual
-  if (modNumDOF <= MAX_NUM_DOF) {
-    // use class wide objects
-    if (modVectors[modNumDOF] == 0) {
-      // have to create matrix and vector of size as none yet created
-      modVectors[modNumDOF] = new Vector(modNumDOF);
-      modMatrices[modNumDOF] = new Matrix(modNumDOF,modNumDOF);
-      modUnbalance = modVectors[modNumDOF];
-      modTangent = modMatrices[modNumDOF];
-      if (modUnbalance == 0 || modUnbalance->Size() != modNumDOF ||	
-	  modTangent == 0 || modTangent->noCols() != modNumDOF)	{  
-	opserr << "DOF_Group::DOF_Group(Node *) ";
-	opserr << " ran out of memory for vector/Matrix of size :";
-	opserr << modNumDOF << endln;
-	exit(-1);
-      }
-    } else {
-      modUnbalance = modVectors[modNumDOF];
-      modTangent = modMatrices[modNumDOF];
-    }
-  } else {
-    // create matrices and vectors for each object instance
-    modUnbalance = new Vector(modNumDOF);
-    modTangent = new Matrix(modNumDOF, modNumDOF);
-    if (modUnbalance == 0 || modUnbalance->Size() ==0 ||
-	modTangent ==0 || modTangent->noRows() ==0) {
-      
-      opserr << "DOF_Group::DOF_Group(Node *) ";
-      opserr << " ran out of memory for vector/Matrix of size :";
-      opserr << modNumDOF << endln;
-      exit(-1);
-    }
-  }    
-  
   if (modID != 0) {
     for (int i=numConstrainedNodeRetainedDOF; i<modNumDOF; i++)
       if ((*modID)(i) == -1)
@@ -1061,23 +990,23 @@ TransformationDOF_Group::enforceSPs(int doMP)
 	const Vector &responseR = retainedNodePtr->getTrialDisp();
 	const ID &retainedDOF = theMP->getRetainedDOFs();
 	
-	modUnbalance->Zero();    
+	modUnbalance().Zero();    
 	for (int i=numConstrainedNodeRetainedDOF, j=0; i<modNumDOF; i++, j++) {
 	  int loc = theID(i);
 	  if (loc < 0)
-	    (*modUnbalance)(i) = responseR(retainedDOF(j));
+	    modUnbalance()(i) = responseR(retainedDOF(j));
 	}
 	
 	Matrix *T = this->getT();
 	if (T != 0) {
 	  
 	  // *unbalance = (*T) * (*modUnbalance);
-	  unbalance->addMatrixVector(0.0, *T, *modUnbalance, 1.0);
+	  unbalance().addMatrixVector(0.0, *T, modUnbalance(), 1.0);
 	  
 	  const ID &constrainedDOF = theMP->getConstrainedDOFs();
 	  for (int i=0; i<constrainedDOF.Size(); i++) {
 	    int cDOF = constrainedDOF(i);
-	    myNode->setTrialDisp((*unbalance)(cDOF), cDOF);
+	    myNode->setTrialDisp(unbalance()(cDOF), cDOF);
 	  }
 	}
       }
@@ -1099,14 +1028,14 @@ TransformationDOF_Group::addM_Force(const Vector &Udotdot, double fact)
    for (int i=0; i<modNumDOF; i++) {
 	int loc = (*modID)(i);
 	if (loc >= 0)
-	    (*modUnbalance)(i) = Udotdot(loc);
+	    modUnbalance()(i) = Udotdot(loc);
 	else 	// DO THE SP STUFF
-	    (*modUnbalance)(i) = 0.0;	    
+	    modUnbalance()(i) = 0.0;	    
     }    
 
     Vector unmod(Trans->noRows());
     //unmod = (*Trans) * (*modUnbalance);
-    unmod.addMatrixVector(0.0, *Trans, *modUnbalance, 1.0);
+    unmod.addMatrixVector(0.0, *Trans, modUnbalance(), 1.0);
     this->addLocalM_Force(unmod, fact);
 }
 
@@ -1136,13 +1065,13 @@ TransformationDOF_Group::getM_Force(const Vector &Udotdot, double fact)
   Matrix *T = this->getT();
   if (T != 0) {
     // *modTangent = (*T) ^ unmodTangent * (*T);
-    modTangent->addMatrixTripleProduct(0.0, *T, unmodTangent, 1.0);
-    modUnbalance->addMatrixVector(0.0, *modTangent, data, 1.0);
+    modTangent().addMatrixTripleProduct(0.0, *T, unmodTangent, 1.0);
+    modUnbalance().addMatrixVector(0.0, modTangent(), data, 1.0);
     
-    return *modUnbalance;
+    return modUnbalance();
   } else {
-      modUnbalance->addMatrixVector(0.0, unmodTangent, data, 1.0);
-      return *modUnbalance;
+      modUnbalance().addMatrixVector(0.0, unmodTangent, data, 1.0);
+      return modUnbalance();
   }
 }
 
@@ -1150,14 +1079,14 @@ const Vector &
 TransformationDOF_Group::getC_Force(const Vector &Udotdot, double fact)
 {
   opserr << "TransformationDOF_Group::getC_Force() - not yet implemented\n";
-  return *modUnbalance;
+  return modUnbalance();
 }
 
 const Vector &
 TransformationDOF_Group::getTangForce(const Vector &Udotdot, double fact)
 {
   opserr << "TransformationDOF_Group::getTangForce() - not yet implemented\n";
-  return *modUnbalance;
+  return modUnbalance();
 }
 
 
@@ -1171,8 +1100,8 @@ TransformationDOF_Group::getDispSensitivity(int gradNumber)
   Matrix *T = this->getT();
   if (T != 0) {
     // *modUnbalance = (*T) ^ unmodUnbalance;
-    modUnbalance->addMatrixTransposeVector(0.0, *T, result, 1.0);
-    return *modUnbalance;    
+    modUnbalance().addMatrixTransposeVector(0.0, *T, result, 1.0);
+    return modUnbalance();    
   } else
     return result;
 
@@ -1186,8 +1115,8 @@ TransformationDOF_Group::getVelSensitivity(int gradNumber)
   Matrix *T = this->getT();
   if (T != 0) {
     // *modUnbalance = (*T) ^ unmodUnbalance;
-    modUnbalance->addMatrixTransposeVector(0.0, *T, result, 1.0);
-    return *modUnbalance;    
+    modUnbalance().addMatrixTransposeVector(0.0, *T, result, 1.0);
+    return modUnbalance();    
   } else
     return result;
 }
@@ -1200,8 +1129,8 @@ TransformationDOF_Group::getAccSensitivity(int gradNumber)
   Matrix *T = this->getT();
   if (T != 0) {
     // *modUnbalance = (*T) ^ unmodUnbalance;
-    modUnbalance->addMatrixTransposeVector(0.0, *T, result, 1.0);
-    return *modUnbalance;    
+    modUnbalance().addMatrixTransposeVector(0.0, *T, result, 1.0);
+    return modUnbalance();    
   } else
     return result;
 }
@@ -1220,20 +1149,20 @@ TransformationDOF_Group::saveDispSensitivity(const Vector &u,
   for (int i=0; i<modNumDOF; i++) {
     int loc = theID(i);
     if (loc >= 0)
-      (*modUnbalance)(i) = u(loc);
+      modUnbalance()(i) = u(loc);
     // DO THE SP STUFF
   }    
   Matrix *T = this->getT();
   if (T != 0) {
     
     // *unbalance = (*T) * (*modUnbalance);
-    unbalance->addMatrixVector(0.0, *T, *modUnbalance, 1.0);
+    unbalance().addMatrixVector(0.0, *T, modUnbalance(), 1.0);
     
   } else
-    *unbalance = *modUnbalance;
+    unbalance() = modUnbalance();
 
 
-  myNode->saveDispSensitivity(*unbalance, gradNum, numGrads);
+  myNode->saveDispSensitivity(unbalance(), gradNum, numGrads);
   
   return 0;
 }
@@ -1251,20 +1180,20 @@ TransformationDOF_Group::saveVelSensitivity(const Vector &u,
   for (int i=0; i<modNumDOF; i++) {
     int loc = theID(i);
     if (loc >= 0)
-      (*modUnbalance)(i) = u(loc);
+      modUnbalance()(i) = u(loc);
     // DO THE SP STUFF
   }    
   Matrix *T = this->getT();
   if (T != 0) {
     
     // *unbalance = (*T) * (*modUnbalance);
-    unbalance->addMatrixVector(0.0, *T, *modUnbalance, 1.0);
+    unbalance().addMatrixVector(0.0, *T, modUnbalance(), 1.0);
     
   } else
-    *unbalance = *modUnbalance;
+    unbalance() = modUnbalance();
 
 
-  myNode->saveVelSensitivity(*unbalance, gradNum, numGrads);
+  myNode->saveVelSensitivity(unbalance(), gradNum, numGrads);
   
   return 0;
 }
@@ -1282,20 +1211,20 @@ TransformationDOF_Group::saveAccSensitivity(const Vector &u,
   for (int i=0; i<modNumDOF; i++) {
     int loc = theID(i);
     if (loc >= 0)
-      (*modUnbalance)(i) = u(loc);
+      modUnbalance()(i) = u(loc);
     // DO THE SP STUFF
   }    
   Matrix *T = this->getT();
   if (T != 0) {
     
     // *unbalance = (*T) * (*modUnbalance);
-    unbalance->addMatrixVector(0.0, *T, *modUnbalance, 1.0);
+    unbalance().addMatrixVector(0.0, *T, modUnbalance(), 1.0);
     
   } else
-    *unbalance = *modUnbalance;
+    unbalance() = modUnbalance();
 
 
-  myNode->saveAccelSensitivity(*unbalance, gradNum, numGrads);
+  myNode->saveAccelSensitivity(unbalance(), gradNum, numGrads);
   
   return 0;
 }
@@ -1332,14 +1261,14 @@ TransformationDOF_Group::addM_ForceSensitivity(const Vector &Udotdot, double fac
    for (int i=0; i<modNumDOF; i++) {
 	int loc = (*modID)(i);
 	if (loc >= 0)
-	    (*modUnbalance)(i) = Udotdot(loc);
+	    modUnbalance()(i) = Udotdot(loc);
 	else 	// DO THE SP STUFF
-	    (*modUnbalance)(i) = 0.0;	    
+	    modUnbalance()(i) = 0.0;	    
     }    
 
     Vector unmod(Trans->noRows());
     //unmod = (*Trans) * (*modUnbalance);
-    unmod.addMatrixVector(0.0, *Trans, *modUnbalance, 1.0);
+    unmod.addMatrixVector(0.0, *Trans, modUnbalance(), 1.0);
     this->DOF_Group::addM_ForceSensitivity(unmod, fact);
 }
 
@@ -1355,14 +1284,14 @@ TransformationDOF_Group::addD_Force(const Vector &Udot, double fact)
    for (int i=0; i<modNumDOF; i++) {
 	int loc = (*modID)(i);
 	if (loc >= 0)
-	    (*modUnbalance)(i) = Udot(loc);
+	    modUnbalance()(i) = Udot(loc);
 	else 	// DO THE SP STUFF
-	    (*modUnbalance)(i) = 0.0;	    
+	    modUnbalance()(i) = 0.0;	    
     }    
 
     Vector unmod(Trans->noRows());
     //unmod = (*Trans) * (*modUnbalance);
-    unmod.addMatrixVector(0.0, *Trans, *modUnbalance, 1.0);
+    unmod.addMatrixVector(0.0, *Trans, modUnbalance(), 1.0);
     this->DOF_Group::addD_Force(unmod, fact);
 }
 
@@ -1378,14 +1307,14 @@ TransformationDOF_Group::addD_ForceSensitivity(const Vector &Udot, double fact)
    for (int i=0; i<modNumDOF; i++) {
 	int loc = (*modID)(i);
 	if (loc >= 0)
-	    (*modUnbalance)(i) = Udot(loc);
+	    modUnbalance()(i) = Udot(loc);
 	else 	// DO THE SP STUFF
-	    (*modUnbalance)(i) = 0.0;	    
+	    modUnbalance()(i) = 0.0;	    
     }    
 
     Vector unmod(Trans->noRows());
     //unmod = (*Trans) * (*modUnbalance);
-    unmod.addMatrixVector(0.0, *Trans, *modUnbalance, 1.0);
+    unmod.addMatrixVector(0.0, *Trans, modUnbalance(), 1.0);
     this->DOF_Group::addD_ForceSensitivity(unmod, fact);
 }
 
@@ -65,6 +65,7 @@ class TransformationDOF_Group: public DOF_Group
     const ID &getID(void) const; 
     virtual void setID(int dof, int value);    
     Matrix *getT(void);
+    bool isTimeVarying(void) const;
     virtual int getNumDOF(void) const;    
     virtual int getNumFreeDOF(void) const;
     virtual int getNumConstrainedDOF(void) const;
@@ -122,11 +123,14 @@ class TransformationDOF_Group: public DOF_Group
   protected:
     
   private:
+    Matrix &modTangent();
+    Vector &modUnbalance();
+
     // private variables - a copy for each object of the class            
     MP_Constraint *theMP;
     Matrix *Trans;
-    Matrix *modTangent;
-    Vector *modUnbalance;
+    Matrix *theModTangent;    // own storage, if no thread's is used
+    Vector *theModUnbalance;
     ID *modID;
     int modNumDOF;
     int numConstrainedNodeRetainedDOF; 
@@ -134,9 +138,6 @@ class TransformationDOF_Group: public DOF_Group
     SP_Constraint **theSPs;
     
     // static variables - single copy for all objects of the class	    
-    static Matrix **modMatrices; // array of pointers to class wide matrices
-    static Vector **modVectors;  // array of pointers to class widde vectors
-    static int numTransDOFs;           // number of objects        
     static TransformationConstraintHandler *theHandler;
 
 #ifdef TRANSF_INCREMENTAL_MP
@@ -38,13 +38,27 @@
 #include <AnalysisModel.h>
 #include <Matrix.h>
 #include <Vector.h>
+#include <vector>
 
 #define MAX_NUM_DOF 64
 
-// static variables initialisation
-Matrix **FE_Element::theMatrices; // pointers to class wide matrices
-Vector **FE_Element::theVectors;  // pointers to class widde vectors
-int FE_Element::numFEs(0);           // number of objects
+// The tangent and residual of an element with no more than MAX_NUM_DOF
+// dof are formed in a matrix and vector shared by all the FE_Elements of
+// that size on the calling thread. Analyses running on different threads,
+// or threads assembling one analysis, each form them in their own.
+namespace {
+struct ScratchStorage {
+  Matrix *theMatrices[MAX_NUM_DOF+1] = {};
+  Vector *theVectors[MAX_NUM_DOF+1]  = {};
+  ~ScratchStorage() {
+    for (int i=0; i<=MAX_NUM_DOF; i++) {
+      delete theMatrices[i];
+      delete theVectors[i];
+    }
+  }
+};
+thread_local ScratchStorage scratch;
+}
 
 //  FE_Element(Element *, Integrator *theIntegrator);
 //        construictor that take the corresponding model element.
@@ -52,7 +66,8 @@ FE_Element::FE_Element(int tag, Element *ele)
   :TaggedObject(tag),
    myDOF_Groups((ele->getExternalNodes()).Size()), myID(ele->getNumDOF()),
    numDOF(ele->getNumDOF()), theModel(0), myEle(ele),
-   theResidual(nullptr), theTangent(nullptr), theIntegrator(nullptr)
+   theResidual(nullptr), theTangent(nullptr), theIntegrator(nullptr),
+   fusedTangent(nullptr), fusedForce(nullptr), fusedInertia(false)
 {
     assert(numDOF > 0);
 
@@ -73,38 +88,12 @@ FE_Element::FE_Element(int tag, Element *ele)
         myDOF_Groups(i) = dofGrpPtr->getTag();
     }
 
-    // if this is the first FE_Element we now
-    // create the arrays used to store pointers to class wide
-    // matrix and vector objects used to return tangent and residual
-    if (numFEs == 0) {
-        theMatrices = new Matrix *[MAX_NUM_DOF+1];
-        theVectors  = new Vector *[MAX_NUM_DOF+1];
-
-        for (int i=0; i<MAX_NUM_DOF; i++) {
-            theMatrices[i] = nullptr;
-            theVectors[i]  = nullptr;
-        }
-    }
-
     if (ele->isSubdomain() == false) {
 
-        // if Elements are not subdomains, set up pointers to
-        // objects to return tangent Matrix and residual Vector.
-        if (numDOF <= MAX_NUM_DOF) {
-            // use class wide objects
-            if (theVectors[numDOF] == nullptr) {
-                theVectors[numDOF] = new Vector(numDOF);
-                theMatrices[numDOF] = new Matrix(numDOF,numDOF);
-                theResidual = theVectors[numDOF];
-                theTangent = theMatrices[numDOF];
-
-            } else {
-                theResidual = theVectors[numDOF];
-                theTangent = theMatrices[numDOF];
-            }
-
-        } else {
-            // create matrices and vectors for each object instance
+        // if Elements are not subdomains, create the objects to return
+        // the tangent Matrix and residual Vector for a large element;
+        // the others use those of their thread (see tangent())
+        if (numDOF > MAX_NUM_DOF) {
             theResidual = new Vector(numDOF);
             theTangent  = new Matrix(numDOF, numDOF);
         }
@@ -118,31 +107,16 @@ FE_Element::FE_Element(int tag, Element *ele)
         theSub->setFE_ElementPtr(this);
     }
 
-    // increment number of FE_Elements by 1
-    numFEs++;
 }
 
 
 FE_Element::FE_Element(int tag, int numDOF_Group, int ndof)
   :TaggedObject(tag),
    myDOF_Groups(numDOF_Group), myID(ndof), numDOF(ndof), theModel(nullptr),
-   myEle(nullptr), theResidual(nullptr), theTangent(nullptr), theIntegrator(nullptr)
+   myEle(nullptr), theResidual(nullptr), theTangent(nullptr), theIntegrator(nullptr),
+   fusedTangent(nullptr), fusedForce(nullptr), fusedInertia(false)
 {
     // this is for a subtype, the subtype must set the myDOF_Groups ID array
-    numFEs++;
-
-    // if this is the first FE_Element we now
-    // create the arrays used to store pointers to class wide
-    // matrix and vector objects used to return tangent and residual
-    if (numFEs == 0) {
-        theMatrices = new Matrix *[MAX_NUM_DOF+1];
-        theVectors  = new Vector *[MAX_NUM_DOF+1];
-
-        for (int i=0; i<MAX_NUM_DOF; i++) {
-          theMatrices[i] = nullptr;
-          theVectors[i]  = nullptr;
-        }
-    }
 
     // as subtypes have no access to the tangent or residual we don't set them
     // this way we can detect if subclass does not provide all methods it should
@@ -154,29 +128,38 @@ FE_Element::FE_Element(int tag, int numDOF_Group, int ndof)
 //        destructor.
 FE_Element::~FE_Element()
 {
-    // decrement number of FE_Elements
-    numFEs--;
-
     // delete tangent and residual if created specially
-    if (numDOF > MAX_NUM_DOF) {
-        if (theTangent != nullptr)
-          delete theTangent;
-        if (theResidual != nullptr) 
-          delete theResidual;
-    }
+    if (theTangent != nullptr)
+      delete theTangent;
+    if (theResidual != nullptr) 
+      delete theResidual;
+}
 
-    // if this is the last FE_Element, clean up the
-    // storage for the matrix and vector objects
-    if (numFEs == 0) {
-        for (int i=0; i<MAX_NUM_DOF; i++) {
-            if (theVectors[i] != nullptr)
-                delete theVectors[i];
-            if (theMatrices[i] != nullptr)
-                delete theMatrices[i];
-        }
-        delete [] theMatrices;
-        delete [] theVectors;
-    }
+//
+// The matrix and vector the tangent and residual are formed in
+//
+Matrix &
+FE_Element::tangent()
+{
+    if (theTangent != nullptr)
+      return *theTangent;
+
+    Matrix *&theMatrix = scratch.theMatrices[numDOF];
+    if (theMatrix == nullptr)
+      theMatrix = new Matrix(numDOF, numDOF);
+    return *theMatrix;
+}
+
+Vector &
+FE_Element::residual()
+{
+    if (theResidual != nullptr)
+      return *theResidual;
+
+    Vector *&theVector = scratch.theVectors[numDOF];
+    if (theVector == nullptr)
+      theVector = new Vector(numDOF);
+    return *theVector;
 }
 
 
@@ -242,7 +225,7 @@ FE_Element::getTangent(Integrator *theNewIntegrator)
     if (theNewIntegrator != nullptr)
       theNewIntegrator->formEleTangent(this);
 
-    return *theTangent;
+    return tangent();
 
   } else {
     Subdomain *theSub = (Subdomain *)myEle;
@@ -259,7 +242,7 @@ FE_Element::zeroTangent()
 {
     assert(myEle != nullptr);
     assert(myEle->isSubdomain() == false);
-    theTangent->Zero();
+    tangent().Zero();
 }
 
 void
@@ -271,8 +254,10 @@ FE_Element::addKtToTang(double fact)
     // check for a quick return
     if (fact == 0.0)
         return;
+    else if (fusedTangent != nullptr)
+        tangent().addMatrix(*fusedTangent, fact);
     else
-        theTangent->addMatrix(myEle->getTangentStiff(),fact);
+        tangent().addMatrix(myEle->getTangentStiff(),fact);
 }
 
 void
@@ -285,7 +270,7 @@ FE_Element::addCtoTang(double fact)
     if (fact == 0.0)
       return;
     else
-      theTangent->addMatrix(myEle->getDamp(),fact);
+      tangent().addMatrix(myEle->getDamp(),fact);
 }
 
 void
@@ -298,7 +283,7 @@ FE_Element::addMtoTang(double fact)
     if (fact == 0.0)
       return;
     else
-      theTangent->addMatrix(myEle->getMass(),fact);
+      tangent().addMatrix(myEle->getMass(),fact);
   }
 }
 
@@ -314,7 +299,7 @@ FE_Element::addKiToTang(double fact)
       return;
 
     else // if (myEle->isSubdomain() == false)
-      theTangent->addMatrix(myEle->getInitialStiff(), fact);
+      tangent().addMatrix(myEle->getInitialStiff(), fact);
   }
 }
 
@@ -329,7 +314,7 @@ FE_Element::addKgToTang(double fact)
       return;
 
     else
-      theTangent->addMatrix(myEle->getGeometricTangentStiff(), fact);
+      tangent().addMatrix(myEle->getGeometricTangentStiff(), fact);
   }
 }
 
@@ -344,7 +329,7 @@ FE_Element::addKpToTang(double fact, int numP)
     else if (myEle->isSubdomain() == false) {
       const Matrix *thePrevMat = myEle->getPreviousK(numP);
       if (thePrevMat != nullptr)
-        theTangent->addMatrix(*thePrevMat, fact);
+        tangent().addMatrix(*thePrevMat, fact);
 
     } else {
       opserr << "WARNING FE_Element::addKpToTang() - ";
@@ -372,13 +357,13 @@ FE_Element::getResidual(Integrator *theNewIntegrator)
     theIntegrator = theNewIntegrator;
 
     if (theIntegrator == nullptr)
-      return *theResidual;
+      return residual();
 
     assert(myEle != nullptr);
 
     if (myEle->isSubdomain() == false) {
       theNewIntegrator->formEleResidual(this);
-      return *theResidual;
+      return residual();
 
     } else {
       Subdomain *theSub = (Subdomain *)myEle;
@@ -387,13 +372,65 @@ FE_Element::getResidual(Integrator *theNewIntegrator)
     }
 }
 
+//
+// Form the tangent and the residual at the same trial state. Elements
+// that implement Element::getTangentAndResistingForce() evaluate their
+// integration points once for both; the integrator still decides how
+// the element stiffness, damping, mass and force are combined. The
+// returned references are only valid until the next FE_Element with the
+// same number of DOF forms its tangent or residual.
+//
+int
+FE_Element::getTangentAndResidual(Integrator *theNewIntegrator, bool inertia,
+                                  const Matrix *&tangent, const Vector *&residual)
+{
+  // constraint FE_Elements have no element of their own
+  if (myEle != nullptr && myEle->isSubdomain() == false && theNewIntegrator != nullptr) {
+    if (myEle->getTangentAndResistingForce(fusedTangent, fusedForce, inertia) < 0) {
+      fusedTangent = nullptr;
+      fusedForce   = nullptr;
+    }
+    fusedInertia = inertia;
+  }
+
+  tangent  = &this->getTangent(theNewIntegrator);
+  residual = &this->getResidual(theNewIntegrator);
+
+  fusedTangent = nullptr;
+  fusedForce   = nullptr;
+  return 0;
+}
+
+//
+// Gather the components of a global vector at this element's equations
+// into a work vector, so that the ele-by-ele products do not allocate on
+// every call; equations that are not numbered give zero. The work vector
+// is kept per thread, as analyses may run concurrently in one process.
+//
+const Vector &
+FE_Element::getLocal(const Vector &x)
+{
+  thread_local std::vector<double> work;
+  thread_local Vector local;
+
+  if (work.size() < (std::size_t)numDOF)
+    work.resize(numDOF);
+  local.setData(work.data(), numDOF);
+
+  for (int i=0; i<numDOF; i++) {
+    int loc = myID(i);
+    local(i) = (loc >= 0) ? x(loc) : 0.0;
+  }
+  return local;
+}
+
 void
 FE_Element::zeroResidual()
 {
   assert(myEle != nullptr);
   assert(myEle->isSubdomain() == false);
 
-  theResidual->Zero();
+  residual().Zero();
 }
 
 
@@ -408,8 +445,9 @@ FE_Element::addRtoResidual(double fact)
     return;
 
   else {
-    const Vector &eleResisting = myEle->getResistingForce();
-    theResidual->addVector(1.0, eleResisting, -fact);
+    const Vector &eleResisting = (fusedForce != nullptr && !fusedInertia)
+                               ? *fusedForce : myEle->getResistingForce();
+    residual().addVector(1.0, eleResisting, -fact);
   }
 }
 
@@ -425,8 +463,9 @@ FE_Element::addRIncInertiaToResidual(double fact)
       return;
 
   else {
-    const Vector &eleResisting = myEle->getResistingForceIncInertia();
-    theResidual->addVector(1.0, eleResisting, -fact);
+    const Vector &eleResisting = (fusedForce != nullptr && fusedInertia)
+                               ? *fusedForce : myEle->getResistingForceIncInertia();
+    residual().addVector(1.0, eleResisting, -fact);
   }
 }
 
@@ -437,32 +476,24 @@ FE_Element::getTangForce(const Vector &disp, double fact)
     assert(myEle != nullptr);
 
     // zero out the force vector
-    theResidual->Zero();
+    residual().Zero();
 
     // check for a quick return
     if (fact == 0.0)
-      return *theResidual;
+      return residual();
 
     // get the components we need out of the vector
-    // and place in a temporary vector
-    Vector tmp(numDOF);
-    for (int i=0; i<numDOF; i++) {
-      int dof = myID(i);
-      if (dof >= 0)
-        tmp(i) = disp(myID(i));
-      else
-        tmp(i) = 0.0;
-    }
+    const Vector &tmp = this->getLocal(disp);
 
     if (myEle->isSubdomain() == false) {
       // form the tangent again and then add the force
       theIntegrator->formEleTangent(this);
-      theResidual->addMatrixVector(1.0, *theTangent,tmp,fact);
+      residual().addMatrixVector(1.0, tangent(),tmp,fact);
 
     } else {
-      theResidual->addMatrixVector(1.0, ((Subdomain *)myEle)->getTang(),tmp,fact);
+      residual().addMatrixVector(1.0, ((Subdomain *)myEle)->getTang(),tmp,fact);
     }
-    return *theResidual;
+    return residual();
 }
 
 
@@ -473,26 +504,18 @@ FE_Element::getK_Force(const Vector &disp, double fact)
     assert(myEle != nullptr);
 
     // zero out the force vector
-    theResidual->Zero();
+    residual().Zero();
 
     // check for a quick return
     if (fact == 0.0)
-        return *theResidual;
+        return residual();
 
     // get the components we need out of the vector
-    // and place in a temporary vector
-    Vector tmp(numDOF);
-    for (int i=0; i<numDOF; i++) {
-      int dof = myID(i);
-      if (dof >= 0)
-        tmp(i) = disp(myID(i));
-      else
-        tmp(i) = 0.0;
-    }
+    const Vector &tmp = this->getLocal(disp);
 
-    theResidual->addMatrixVector(1.0, myEle->getTangentStiff(), tmp, fact);
+    residual().addMatrixVector(1.0, myEle->getTangentStiff(), tmp, fact);
 
-    return *theResidual;
+    return residual();
 }
 
 
@@ -502,26 +525,18 @@ FE_Element::getKi_Force(const Vector &disp, double fact)
     assert(myEle != nullptr);
 
     // zero out the force vector
-    theResidual->Zero();
+    residual().Zero();
 
     // check for a quick return
     if (fact == 0.0)
-      return *theResidual;
+      return residual();
 
     // get the components we need out of the vector
-    // and place in a temporary vector
-    Vector tmp(numDOF);
-    for (int i=0; i<numDOF; i++) {
-      int dof = myID(i);
-      if (dof >= 0)
-        tmp(i) = disp(myID(i));
-      else
-        tmp(i) = 0.0;
-    }
+    const Vector &tmp = this->getLocal(disp);
 
-    theResidual->addMatrixVector(1.0, myEle->getInitialStiff(), tmp, fact);
+    residual().addMatrixVector(1.0, myEle->getInitialStiff(), tmp, fact);
 
-    return *theResidual;
+    return residual();
 
 }
 
@@ -531,26 +546,18 @@ FE_Element::getM_Force(const Vector &disp, double fact)
     assert(myEle != nullptr);
 
     // zero out the force vector
-    theResidual->Zero();
+    residual().Zero();
 
     // check for a quick return
     if (fact == 0.0)
-        return *theResidual;
+        return residual();
 
     // get the components we need out of the vector
-    // and place in a temporary vector
-    Vector tmp(numDOF);
-    for (int i=0; i<numDOF; i++) {
-      int dof = myID(i);
-      if (dof >= 0)
-        tmp(i) = disp(myID(i));
-      else
-        tmp(i) = 0.0;
-    }
+    const Vector &tmp = this->getLocal(disp);
 
-    theResidual->addMatrixVector(1.0, myEle->getMass(), tmp, fact);
+    residual().addMatrixVector(1.0, myEle->getMass(), tmp, fact);
 
-    return *theResidual;
+    return residual();
 }
 
 const Vector &
@@ -559,26 +566,18 @@ FE_Element::getC_Force(const Vector &disp, double fact)
   assert(myEle != nullptr);
 
   // zero out the force vector
-  theResidual->Zero();
+  residual().Zero();
 
   // check for a quick return
   if (fact == 0.0)
-      return *theResidual;
+      return residual();
 
   // get the components we need out of the vector
-  // and place in a temporary vector
-  Vector tmp(numDOF);
-  for (int i=0; i<numDOF; i++) {
-    int dof = myID(i);
-    if (dof >= 0)
-      tmp(i) = disp(myID(i));
-    else
-      tmp(i) = 0.0;
-  }
+  const Vector &tmp = this->getLocal(disp);
 
-  theResidual->addMatrixVector(1.0, myEle->getDamp(), tmp, fact);
+  residual().addMatrixVector(1.0, myEle->getDamp(), tmp, fact);
 
-  return *theResidual;
+  return residual();
 }
 
 
@@ -595,18 +594,18 @@ FE_Element::getLastResponse()
     assert(myEle != nullptr);
 
     if (theIntegrator != nullptr) {
-      if (theIntegrator->getLastResponse(*theResidual,myID) < 0) {
+      if (theIntegrator->getLastResponse(residual(),myID) < 0) {
         opserr << "WARNING FE_Element::getLastResponse()";
         opserr << " - the Integrator had problems with getLastResponse()\n";
       }
     }
     else {
-      theResidual->Zero();
+      residual().Zero();
       opserr << "WARNING  FE_Element::getLastResponse()";
       opserr << " No Integrator yet passed\n";
     }
 
-    Vector &result = *theResidual;
+    Vector &result = residual();
     return result;
 }
 
@@ -621,17 +620,9 @@ FE_Element::addM_Force(const Vector &accel, double fact)
         return;
 
     // get the components we need out of the vector
-    // and place in a temporary vector
-    Vector tmp(numDOF);
-    for (int i=0; i<numDOF; i++) {
-        int loc = myID(i);
-        if (loc >= 0)
-            tmp(i) = accel(loc);
-        else
-            tmp(i) = 0.0;
-    }
+    const Vector &tmp = this->getLocal(accel);
 
-    theResidual->addMatrixVector(1.0, myEle->getMass(), tmp, fact);
+    residual().addMatrixVector(1.0, myEle->getMass(), tmp, fact);
 
 }
 
@@ -646,17 +637,9 @@ FE_Element::addD_Force(const Vector &accel, double fact)
     return;
 
   // get the components we need out of the vector
-  // and place in a temporary vector
-  Vector tmp(numDOF);
-  for (int i=0; i<numDOF; i++) {
-    int loc = myID(i);
-    if (loc >= 0)
-        tmp(i) = accel(loc);
-    else
-        tmp(i) = 0.0;
-  }
+  const Vector &tmp = this->getLocal(accel);
 
-  theResidual->addMatrixVector(1.0, myEle->getDamp(), tmp, fact);
+  residual().addMatrixVector(1.0, myEle->getDamp(), tmp, fact);
 }
 
 void
@@ -670,17 +653,9 @@ FE_Element::addK_Force(const Vector &disp, double fact)
     return;
 
   // get the components we need out of the vector
-  // and place in a temporary vector
-  Vector tmp(numDOF);
-  for (int i=0; i<numDOF; i++) {
-    int loc = myID(i);
-    if (loc >= 0)
-        tmp(i) = disp(loc);
-    else
-        tmp(i) = 0.0;
-  }
+  const Vector &tmp = this->getLocal(disp);
 
-  theResidual->addMatrixVector(1.0, myEle->getTangentStiff(), tmp, fact);
+  residual().addMatrixVector(1.0, myEle->getTangentStiff(), tmp, fact);
 }
 
 void
@@ -694,18 +669,9 @@ FE_Element::addKg_Force(const Vector &disp, double fact)
       return;
 
   // get the components we need out of the vector
-  // and place in a temporary vector
-  Vector tmp(numDOF);
+  const Vector &tmp = this->getLocal(disp);
 
-  for (int i=0; i<numDOF; i++) {
-    int loc = myID(i);
-    if (loc >= 0)
-        tmp(i) = disp(loc);
-    else
-        tmp(i) = 0.0;
-  }
-
-  theResidual->addMatrixVector(1.0, myEle->getGeometricTangentStiff(), tmp, fact);
+  residual().addMatrixVector(1.0, myEle->getGeometricTangentStiff(), tmp, fact);
 }
 
 
@@ -719,7 +685,7 @@ FE_Element::addLocalM_Force(const Vector &accel, double fact)
   if (fact == 0.0)
     return;
 
-  theResidual->addMatrixVector(1.0, myEle->getMass(), accel, fact);
+  residual().addMatrixVector(1.0, myEle->getMass(), accel, fact);
 }
 
 void
@@ -732,7 +698,7 @@ FE_Element::addLocalD_Force(const Vector &accel, double fact)
   if (fact == 0.0)
       return;
 
-  if (theResidual->addMatrixVector(1.0, myEle->getDamp(), accel, fact) < 0){
+  if (residual().addMatrixVector(1.0, myEle->getDamp(), accel, fact) < 0){
     opserr << "WARNING FE_Element::addLocalD_Force() - ";
     opserr << "- addMatrixVector returned error\n";
   }
@@ -750,24 +716,15 @@ FE_Element::getElement()
 void
 FE_Element::addResistingForceSensitivity(int gradNumber, double fact)
 {
-  theResidual->addVector(1.0, myEle->getResistingForceSensitivity(gradNumber), -fact);
+  residual().addVector(1.0, myEle->getResistingForceSensitivity(gradNumber), -fact);
 }
 
 void
 FE_Element::addM_ForceSensitivity(int gradNumber, const Vector &vect, double fact)
 {
-  // Get the components we need out of the vector
-  // and place in a temporary vector
-  Vector tmp(numDOF);
-  for (int i=0; i<numDOF; i++) {
-    int loc = myID(i);
-    if (loc >= 0) {
-      tmp(i) = vect(loc);
-    } else {
-      tmp(i) = 0.0;
-    }
-  }
-  if (theResidual->addMatrixVector(1.0, myEle->getMassSensitivity(gradNumber),tmp,fact) < 0) {
+  // get the components we need out of the vector
+  const Vector &tmp = this->getLocal(vect);
+  if (residual().addMatrixVector(1.0, myEle->getMassSensitivity(gradNumber),tmp,fact) < 0) {
     opserr << "WARNING FE_Element::addM_ForceSensitivity() - ";
     opserr << "- addMatrixVector returned error\n";
   }
@@ -784,16 +741,8 @@ FE_Element::addD_ForceSensitivity(int gradNumber, const Vector &vect, double fac
 
     if (myEle->isSubdomain() == false) {
       // get the components we need out of the vector
-      // and place in a temporary vector
-      Vector tmp(numDOF);
-      for (int i=0; i<numDOF; i++) {
-        int loc = myID(i);
-        if (loc >= 0)
-          tmp(i) = vect(loc);
-        else
-          tmp(i) = 0.0;
-      }
-      if (theResidual->addMatrixVector(1.0, myEle->getDampSensitivity(gradNumber), tmp, fact) < 0){
+      const Vector &tmp = this->getLocal(vect);
+      if (residual().addMatrixVector(1.0, myEle->getDampSensitivity(gradNumber), tmp, fact) < 0){
         opserr << "WARNING FE_Element::addD_ForceSensitivity() - ";
         opserr << "- addMatrixVector returned error\n";
       }
@@ -813,7 +762,7 @@ FE_Element::addLocalD_ForceSensitivity(int gradNumber, const Vector &accel, doub
         if (fact == 0.0)
             return;
         if (myEle->isSubdomain() == false) {
-            if (theResidual->addMatrixVector(1.0, myEle->getDampSensitivity(gradNumber),
+            if (residual().addMatrixVector(1.0, myEle->getDampSensitivity(gradNumber),
                                              accel, fact) < 0){
 
               opserr << "WARNING FE_Element::addLocalD_ForceSensitivity() - ";
@@ -841,7 +790,7 @@ FE_Element::addLocalM_ForceSensitivity(int gradNumber, const Vector &accel, doub
     if (fact == 0.0)
         return;
 
-    if (theResidual->addMatrixVector(1.0, myEle->getMassSensitivity(gradNumber), accel, fact) < 0) {
+    if (residual().addMatrixVector(1.0, myEle->getMassSensitivity(gradNumber), accel, fact) < 0) {
       opserr << "WARNING FE_Element::addLocalD_ForceSensitivity() - ";
       opserr << "- addMatrixVector returned error\n";
     }
@@ -54,6 +54,9 @@ class FE_Element: public TaggedObject
     // methods to form and obtain the tangent and residual
     virtual const Matrix &getTangent(Integrator *theIntegrator);
     virtual const Vector &getResidual(Integrator *theIntegrator);
+    virtual int getTangentAndResidual(Integrator *theIntegrator, bool inertia,
+                                      const Matrix *&tangent,
+                                      const Vector *&residual);
 
     // methods called by integrator to build tangent
             void  zeroTangent()                  ; // final;
@@ -107,20 +110,23 @@ class FE_Element: public TaggedObject
     ID myID;
 
   private:
+    const Vector &getLocal(const Vector &x);
+    Matrix &tangent();
+    Vector &residual();
+
     // private variables - a copy for each object of the class    
     int numDOF;
     AnalysisModel *theModel;
     Element       *myEle;
-    Vector        *theResidual;
+    Vector        *theResidual;    // own storage, if no thread's is used
     Matrix        *theTangent;
     Integrator    *theIntegrator; // need for Subdomain
 
-    //
-    // static variables
-    //
-    static Matrix **theMatrices; // array of pointers to class wide matrices
-    static Vector **theVectors;  // array of pointers to class widde vectors
-    static int numFEs;           // number of objects
+    // element tangent and force formed together by getTangentAndResidual(),
+    // used in place of the separate element calls while they are set
+    const Matrix  *fusedTangent;
+    const Vector  *fusedForce;
+    bool           fusedInertia;
 
 };
 
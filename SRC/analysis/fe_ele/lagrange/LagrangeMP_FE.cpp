@@ -228,7 +228,7 @@ const Vector &
 LagrangeMP_FE::getResidual(Integrator *theNewIntegrator)
 {
     // get the solution vector [Uc Ur lambda]
-    static Vector UU;
+    static thread_local Vector UU;
     const ID& id1 = theMP->getConstrainedDOFs();
     const ID& id2 = theMP->getRetainedDOFs();
     const ID& id3 = theDofGroup->getID();
@@ -212,7 +212,7 @@ PenaltyMP_FE::getResidual(Integrator *theNewIntegrator)
     // zero residual, CD = 0
 
     // get the solution vector [Uc Ur]
-    static Vector UU;
+    static thread_local Vector UU;
     const ID& id1 = theMP->getConstrainedDOFs();
     const ID& id2 = theMP->getRetainedDOFs();
     int size = id1.Size() + id2.Size();
@@ -37,26 +37,14 @@
 #include <Matrix.h>
 #include <Vector.h>
 #include <TransformationConstraintHandler.h>
-
-#define MAX_NUM_DOF 64
-
-// static variables initialisation
-Matrix **TransformationFE::modMatrices; 
-Vector **TransformationFE::modVectors;  
-Matrix **TransformationFE::theTransformations; 
-int TransformationFE::numTransFE(0);           
-int TransformationFE::transCounter(0);           
-int TransformationFE::sizeTransformations(0);          
-double *TransformationFE::dataBuffer = 0;          
-double *TransformationFE::localKbuffer = 0;          
-int    *TransformationFE::dofData = 0;    ;          
-int TransformationFE::sizeBuffer(0);            
+#include <TransformationDOF_Group.h>
 
 //  TransformationFE(Element *, Integrator *theIntegrator);
 //	construictor that take the corresponding model element.
 TransformationFE::TransformationFE(int tag, Element *ele)
 :FE_Element(tag, ele), theDOFs(0), numSPs(0), theSPs(0), modID(0), 
-  modTangent(0), modResidual(0), numGroups(0), numTransformedDOF(0)
+  modTangent(0), modResidual(0), modInput(0), response(0), numGroups(0), numTransformedDOF(0),
+  varyingT(false)
 {
   // set number of original dof at ele
     numOriginalDOF = ele->getNumDOF();
@@ -91,46 +79,7 @@ TransformationFE::TransformationFE(int tag, Element *ele)
 	theDOFs[i] = theDofGroup;
     }
 
-    // see if theTransformation array is big enough
-    // if not delete the old and create a new one
-    if (numNodes > sizeTransformations) {
-	if (theTransformations != 0) 
-	    delete [] theTransformations;
-	
-	theTransformations = new Matrix *[numNodes];
-	if (theTransformations == 0) {
-	    opserr << "FATAL TransformationFE::TransformationFE() - out of memory ";
-	    opserr << "for array of pointers for Transformation matrices of size ";
-	    opserr << numNodes;
-	    exit(-1);
-	}		    
-	sizeTransformations = numNodes;
-    }	
-
-    // if this is the first element of this type create the arrays for 
-    // modified tangent and residual matrices
-    if (numTransFE == 0) {
-
-	modMatrices = new Matrix *[MAX_NUM_DOF+1];
-	modVectors  = new Vector *[MAX_NUM_DOF+1];
-	dataBuffer = new double[MAX_NUM_DOF*MAX_NUM_DOF];
-	localKbuffer = new double[MAX_NUM_DOF*MAX_NUM_DOF];
-	dofData      = new int[MAX_NUM_DOF];
-	sizeBuffer = MAX_NUM_DOF*MAX_NUM_DOF;
-	
-	if (modMatrices == 0 || modVectors == 0 || dataBuffer == 0 ||
-	    localKbuffer == 0 || dofData == 0) {
-	    opserr << "TransformationFE::TransformationFE(Element *) ";
-	    opserr << " ran out of memory";	    
-	}
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    modMatrices[i] = 0;
-	    modVectors[i] = 0;
-	}
-    }
-
-    // increment the number of transformations
-    numTransFE++;
+    response = new Vector(numOriginalDOF);
 }
 
 
@@ -140,52 +89,20 @@ TransformationFE::TransformationFE(int tag, Element *ele)
 
 TransformationFE::~TransformationFE()
 {
-
-    numTransFE--;
-    
     if (theDOFs != 0)
 	delete [] theDOFs;
     if (theSPs != 0)
 	delete [] theSPs;
-
-    int numDOF = 0;    
-    if (modID != 0)
-	numDOF = modID->Size();
-    
     if (modID != 0)
 	delete modID;
-
-    if (numDOF > MAX_NUM_DOF) {
-	// tangent and residual may have been  created specially
-	if (modTangent != 0) delete modTangent;
-	if (modResidual != 0) delete modResidual;
-    }
-
-    // if this is the last FE_Element, clean up the
-    // storage for the matrix and vector objects
-    if (numTransFE == 0) {
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    if (modVectors[i] != 0)
-		delete modVectors[i];
-	    if (modMatrices[i] != 0)
-		delete modMatrices[i];
-	}
-	delete [] modMatrices;
-	delete [] modVectors;
-	delete [] theTransformations;
-	delete [] dataBuffer;
-	delete [] localKbuffer;
-	delete [] dofData;
-	modMatrices = 0;
-	modVectors = 0;
-	theTransformations = 0;
-	dataBuffer = 0;
-	localKbuffer = 0;
-	dofData = 0;
-	sizeTransformations = 0;
-	sizeBuffer = 0;
-	transCounter = 0;
-    }
+    if (modTangent != 0)
+	delete modTangent;
+    if (modResidual != 0)
+	delete modResidual;
+    if (modInput != 0)
+	delete modInput;
+    if (response != 0)
+	delete response;
 }    
 
 
@@ -248,190 +165,137 @@ TransformationFE::setID(void)
 	    }		
     }
     
-    // set the pointers to the modified tangent matrix and residual vector
-    if (numTransformedDOF <= MAX_NUM_DOF) {
-	// use class wide objects
-	if (modVectors[numTransformedDOF] == 0) {
-	    modVectors[numTransformedDOF] = new Vector(numTransformedDOF);
-	    modMatrices[numTransformedDOF] = new Matrix(numTransformedDOF,numTransformedDOF);
-	    modResidual = modVectors[numTransformedDOF];
-	    modTangent = modMatrices[numTransformedDOF];
-	    if (modResidual == 0 || modResidual->Size() != numTransformedDOF ||	
-		modTangent == 0 || modTangent->noCols() != numTransformedDOF)	{  
-		opserr << "TransformationFE::setID() ";
-		opserr << " ran out of memory for vector/Matrix of size :";
-		opserr << numTransformedDOF << endln;
-		exit(-1);
-	    }
-	} else {
-	    modResidual = modVectors[numTransformedDOF];
-	    modTangent = modMatrices[numTransformedDOF];
-	}
-    } else {
-	// create matrices and vectors for each object instance
+    // each object owns its modified tangent and residual, so that
+    // the transformation does not rely on any class wide storage
+    if (modTangent == 0 || modTangent->noRows() != numTransformedDOF) {
+	if (modTangent != 0)
+	    delete modTangent;
+	if (modResidual != 0)
+	    delete modResidual;
+	if (modInput != 0)
+	    delete modInput;
 	modResidual = new Vector(numTransformedDOF);
+	modInput = new Vector(numTransformedDOF);
 	modTangent = new Matrix(numTransformedDOF, numTransformedDOF);
-	if (modResidual == 0 || modResidual->Size() ==0 ||
-	    modTangent ==0 || modTangent->noRows() ==0) {
-	    
-	    opserr << "TransformationFE::setID() ";
-	    opserr << " ran out of memory for vector/Matrix of size :";
-	    opserr << numTransformedDOF << endln;
-	    exit(-1);
+    }
+
+    return this->formTransformation();
+}
+
+
+//
+// Form the element transformation T, which maps the transformed DOFs
+// (those in modID) to the DOFs of the element. T is block diagonal with
+// one block per node, the T of the node's DOF_Group or the identity;
+// only its nonzero entries are stored, column by column. Unless one of
+// the constraints varies in time, T is formed once per numbering.
+//
+int
+TransformationFE::formTransformation(void)
+{
+    Tptr.assign(numTransformedDOF+1, 0);
+    Trow.clear();
+    Tval.clear();
+    varyingT = false;
+
+    int startRow = 0;
+    int startCol = 0;
+    for (int a=0; a<numGroups; a++) {
+	const Matrix *T = theDOFs[a]->getT();
+	if (T != 0) {
+	    if (theDOFs[a]->getNumDOF() != T->noCols())
+		return -1;
+	    for (int j=0; j<T->noCols(); j++) {
+		for (int i=0; i<T->noRows(); i++)
+		    if ((*T)(i,j) != 0.0) {
+			Trow.push_back(startRow + i);
+			Tval.push_back((*T)(i,j));
+		    }
+		Tptr[startCol + j + 1] = (int)Trow.size();
+	    }
+	    startRow += T->noRows();
+	    startCol += T->noCols();
+	} else {
+	    int numDOF = theDOFs[a]->getNumDOF();
+	    for (int j=0; j<numDOF; j++) {
+		Trow.push_back(startRow + j);
+		Tval.push_back(1.0);
+		Tptr[startCol + j + 1] = (int)Trow.size();
+	    }
+	    startRow += numDOF;
+	    startCol += numDOF;
 	}
-    }     
+    }
+
+    TransformationDOF_Group *group;
+    for (int a=0; a<numGroups; a++) 
+	if ((group = dynamic_cast<TransformationDOF_Group*>(theDOFs[a])) != 0 &&
+	    group->isTimeVarying())
+	    varyingT = true;
+
+    if (startRow != numOriginalDOF || startCol != numTransformedDOF) {
+	opserr << "WARNING TransformationFE::formTransformation() - the DOF_Groups";
+	opserr << " do not match the element DOFs\n";
+	return -3;
+    }
 
     return 0;
 }
 
+
+//
+// modTangent = T^t K T, using only the nonzero entries of T
+//
 const Matrix &
-TransformationFE::getTangent(Integrator *theNewIntegrator)
+TransformationFE::transformTangent(const Matrix &K)
 {
-    const Matrix &theTangent = this->FE_Element::getTangent(theNewIntegrator);
+    if (varyingT)
+	this->formTransformation();
 
-    static ID numDOFs(dofData, 1);
-    numDOFs.setData(dofData, numGroups);
-    
-    // DO THE SP STUFF TO THE TANGENT 
-    
-    // get the transformation matrix from each dof group & number of local dof
-    // for original node.
-    int numNode = numGroups;
-    for (int a = 0; a<numNode; a++) {
-      Matrix *theT = theDOFs[a]->getT();
-      theTransformations[a] = theT;
-      if (theT != 0)
-	numDOFs[a] = theT->noRows(); // T^ 
-      else
-	numDOFs[a] = theDOFs[a]->getNumDOF();
-    }
+    const int    *ptr = Tptr.data();
+    const int    *row = Trow.data();
+    const double *val = Tval.data();
 
-    // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-    // where blocks are of size equal to num ele dof at a node
-
-    int startRow = 0;
-    int noRowsTransformed = 0;
-    int noRowsOriginal = 0;
-
-    static Matrix localK;
-
-    // foreach block row, for each block col do
-    for (int i=0; i<numNode; i++) {
-
-	int startCol = 0;
-	int numDOFi = numDOFs[i];	
-	int noColsOriginal = 0;
-
-	for (int j=0; j<numNode; j++) {
-
-	    const Matrix *Ti = theTransformations[i];
-	    const Matrix *Tj = theTransformations[j];
-	    int numDOFj = numDOFs[j];	
-	    localK.setData(localKbuffer, numDOFi, numDOFj);
-
-	    // copy K(i,j) into localK matrix
-	    // CHECK SIZE OF BUFFER	    
-	    for (int a=0; a<numDOFi; a++)
-		for (int b=0; b<numDOFj; b++)
-		    localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-
-	    // now perform the matrix computation T(i)^T localK T(j)
-	    // note: if T == 0 then the Identity is assumed
-	    int noColsTransformed = 0;
-	    static Matrix localTtKT;
-	    
-	    if (Ti != 0 && Tj != 0) {
-		noRowsTransformed = Ti->noCols();
-		noColsTransformed = Tj->noCols();
-		// CHECK SIZE OF BUFFER
-		localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-		//localTtKT = (*Ti) ^ localK * (*Tj);
-		localTtKT.addMatrixTripleProduct(0.0, *Ti, localK, *Tj, 1.0);
-	    } else if (Ti == 0 && Tj != 0) {
-		noRowsTransformed = numDOFi;
-		noColsTransformed = Tj->noCols();
-		// CHECK SIZE OF BUFFER
-		localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-		// localTtKT = localK * (*Tj);	       
-		localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-	    } else if (Ti != 0 && Tj == 0) {
-		noRowsTransformed = Ti->noCols();
-		noColsTransformed = numDOFj;
-		localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-		//localTtKT = (*Ti) ^ localK;
-		localTtKT.addMatrixTransposeProduct(0.0, *Ti, localK, 1.0);
-	    } else {
-		noRowsTransformed = numDOFi;
-		noColsTransformed = numDOFj;
-		localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-		localTtKT = localK;
+    for (int q=0; q<numTransformedDOF; q++) {
+	for (int p=0; p<numTransformedDOF; p++) {
+	    double sum = 0.0;
+	    for (int kb=ptr[q]; kb<ptr[q+1]; kb++) {
+		const int b = row[kb];
+		double Kb = 0.0;
+		for (int ka=ptr[p]; ka<ptr[p+1]; ka++)
+		    Kb += val[ka]*K(row[ka], b);
+		sum += Kb*val[kb];
 	    }
-	    // now copy into modTangent the T(i)^t K(i,j) T(j) product
-	    for (int c=0; c<noRowsTransformed; c++) 
-		for (int d=0; d<noColsTransformed; d++) 
-		    (*modTangent)(startRow+c, startCol+d) = localTtKT(c,d);
-	    
-	    startCol += noColsTransformed;
-	    noColsOriginal += numDOFj;
+	    (*modTangent)(p,q) = sum;
 	}
-
-	noRowsOriginal += numDOFi;
-	startRow += noRowsTransformed;
     }
 
     return *modTangent;
 }
 
 
+const Matrix &
+TransformationFE::getTangent(Integrator *theNewIntegrator)
+{
+    const Matrix &theTangent = this->FE_Element::getTangent(theNewIntegrator);
+    return this->transformTangent(theTangent);
+}
+
+
 const Vector &
 TransformationFE::getResidual(Integrator *theNewIntegrator)
-
 {
     const Vector &theResidual = this->FE_Element::getResidual(theNewIntegrator);
-    // DO THE SP STUFF TO THE TANGENT
-    
-    // perform Tt R  -- as T is block diagonal do T(i)^T R(i)
-    // where blocks are of size equal to num ele dof at a node
-
-    int startRowTransformed = 0;
-    int startRowOriginal = 0;
-    int numNode = numGroups;
-
-    // foreach block row, for each block col do
-    for (int i=0; i<numNode; i++) {
-	int noRows = 0;
-	int noCols = 0;
-	const Matrix *Ti = theDOFs[i]->getT();
-	if (Ti != 0) {
-	  noRows = Ti->noCols(); // T^
-	  noCols = Ti->noRows();
-
-	  /*
-	  Vector orig(noCols);
-	  Vector mod(noRows);
-	  for (int k=startRowOriginal; k<startRowOriginal+noCols; k++)
-	    orig(k-startRowOriginal)= theResidual(k);
-	  mod = (*Ti)^orig;
-	  for (int k=startRowTransformed; k<startRowTransformed+noRows; k++)
-	    (*modResidual)(k) = mod (k-startRowTransformed);
-
-	  */
-
-	  for (int j=0; j<noRows; j++) {
-	    double sum = 0.0;
-	    for (int k=0; k<noCols; k++)
-	      sum += (*Ti)(k,j) * theResidual(startRowOriginal + k);
-	    (*modResidual)(startRowTransformed +j) = sum;
-	  }
 
-	} else {
-	  noCols = theDOFs[i]->getNumDOF();
-	  noRows = noCols;
-	  for (int j=0; j<noRows; j++)
-	    (*modResidual)(startRowTransformed +j) = theResidual(startRowOriginal + j);
-	}
-	startRowTransformed += noRows;
-	startRowOriginal += noCols;
+    if (varyingT)
+	this->formTransformation();
+
+    // perform Tt R
+    for (int j=0; j<numTransformedDOF; j++) {
+	double sum = 0.0;
+	for (int k=Tptr[j]; k<Tptr[j+1]; k++)
+	    sum += Tval[k]*theResidual(Trow[k]);
+	(*modResidual)(j) = sum;
     }
 
     return *modResidual;
@@ -448,233 +312,44 @@ TransformationFE::getTangForce(const Vector &disp, double fact)
     return *modResidual;
 }
 
+//
+// Multiply the transformed tangent by the entries of x at the DOFs of
+// this element
+//
+const Vector &
+TransformationFE::formForce(const Matrix &K, const Vector &x, double fact)
+{
+    this->transformTangent(K);
+
+    // get the components we need out of the vector
+    Vector &tmp = *modInput;
+    for (int j=0; j<numTransformedDOF; j++) {
+	int dof = (*modID)(j);
+	if (dof >= 0)
+	    tmp(j) = x(dof);
+	else
+	    tmp(j) = 0.0;
+    }
+
+    modResidual->addMatrixVector(0.0, *modTangent, tmp, fact);
+
+    return *modResidual;
+}
+
 const Vector &
 TransformationFE::getK_Force(const Vector &accel, double fact)
 {
   this->FE_Element::zeroTangent();    
   this->FE_Element::addKtToTang();    
-  const Matrix &theTangent = this->FE_Element::getTangent(0);
-
-  static ID numDOFs(dofData, 1);
-  numDOFs.setData(dofData, numGroups);
-    
-  // DO THE SP STUFF TO THE TANGENT 
-  
-  // get the transformation matrix from each dof group & number of local dof
-  // for original node.
-  int numNode = numGroups;
-  for (int a = 0; a<numNode; a++) {
-    Matrix *theT = theDOFs[a]->getT();
-    theTransformations[a] = theT;
-    if (theT != 0)
-      numDOFs[a] = theT->noRows(); // T^ 
-    else
-      numDOFs[a] = theDOFs[a]->getNumDOF();
-  }
-  
-  // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-  // where blocks are of size equal to num ele dof at a node
-  
-  int startRow = 0;
-  int noRowsTransformed = 0;
-  int noRowsOriginal = 0;
-  
-  static Matrix localK;
-  
-  // foreach block row, for each block col do
-  for (int i=0; i<numNode; i++) {
-    
-    int startCol = 0;
-    int numDOFi = numDOFs[i];	
-    int noColsOriginal = 0;
-    
-    for (int j=0; j<numNode; j++) {
-      
-      const Matrix *Ti = theTransformations[i];
-      const Matrix *Tj = theTransformations[j];
-      int numDOFj = numDOFs[j];	
-      localK.setData(localKbuffer, numDOFi, numDOFj);
-      
-      // copy K(i,j) into localK matrix
-      // CHECK SIZE OF BUFFER	    
-      for (int a=0; a<numDOFi; a++)
-	for (int b=0; b<numDOFj; b++)
-	  localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-      
-      // now perform the matrix computation T(i)^T localK T(j)
-      // note: if T == 0 then the Identity is assumed
-      int noColsTransformed = 0;
-      static Matrix localTtKT;
-      
-      if (Ti != 0 && Tj != 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK * (*Tj);
-	localTtKT.addMatrixTripleProduct(0.0, *Ti, localK, *Tj, 1.0);
-      } else if (Ti == 0 && Tj != 0) {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	// localTtKT = localK * (*Tj);	       
-	localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-      } else if (Ti != 0 && Tj == 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = numDOFj;
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK;
-	localTtKT.addMatrixTransposeProduct(0.0, *Ti, localK, 1.0);
-      } else {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = numDOFj;
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	localTtKT = localK;
-      }
-      // now copy into modTangent the T(i)^t K(i,j) T(j) product
-      for (int c=0; c<noRowsTransformed; c++) 
-	for (int d=0; d<noColsTransformed; d++) 
-	  (*modTangent)(startRow+c, startCol+d) = localTtKT(c,d);
-      
-      startCol += noColsTransformed;
-      noColsOriginal += numDOFj;
-    }
-    
-    noRowsOriginal += numDOFi;
-    startRow += noRowsTransformed;
-  }
-  
-  // get the components we need out of the vector
-  // and place in a temporary vector
-  Vector tmp(numTransformedDOF);
-  for (int j=0; j<numTransformedDOF; j++) {
-    int dof = (*modID)(j);
-    if (dof >= 0)
-      tmp(j) = accel(dof);
-    else
-      tmp(j) = 0.0;
-  }
-
-  modResidual->addMatrixVector(0.0, *modTangent, tmp, 1.0);
-
-  return *modResidual;
+  return this->formForce(this->FE_Element::getTangent(0), accel, fact);
 }
 
-
 const Vector &
 TransformationFE::getKi_Force(const Vector &accel, double fact)
 {
   this->FE_Element::zeroTangent();    
   this->FE_Element::addKiToTang();    
-  const Matrix &theTangent = this->FE_Element::getTangent(0);
-
-  static ID numDOFs(dofData, 1);
-  numDOFs.setData(dofData, numGroups);
-    
-  // DO THE SP STUFF TO THE TANGENT 
-  
-  // get the transformation matrix from each dof group & number of local dof
-  // for original node.
-  int numNode = numGroups;
-  for (int a = 0; a<numNode; a++) {
-    Matrix *theT = theDOFs[a]->getT();
-    theTransformations[a] = theT;
-    if (theT != 0)
-      numDOFs[a] = theT->noRows(); // T^ 
-    else
-      numDOFs[a] = theDOFs[a]->getNumDOF();
-  }
-  
-  // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-  // where blocks are of size equal to num ele dof at a node
-  
-  int startRow = 0;
-  int noRowsTransformed = 0;
-  int noRowsOriginal = 0;
-  
-  static Matrix localK;
-  
-  // foreach block row, for each block col do
-  for (int i=0; i<numNode; i++) {
-    
-    int startCol = 0;
-    int numDOFi = numDOFs[i];	
-    int noColsOriginal = 0;
-    
-    for (int j=0; j<numNode; j++) {
-      
-      const Matrix *Ti = theTransformations[i];
-      const Matrix *Tj = theTransformations[j];
-      int numDOFj = numDOFs[j];	
-      localK.setData(localKbuffer, numDOFi, numDOFj);
-      
-      // copy K(i,j) into localK matrix
-      // CHECK SIZE OF BUFFER	    
-      for (int a=0; a<numDOFi; a++)
-	for (int b=0; b<numDOFj; b++)
-	  localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-      
-      // now perform the matrix computation T(i)^T localK T(j)
-      // note: if T == 0 then the Identity is assumed
-      int noColsTransformed = 0;
-      static Matrix localTtKT;
-      
-      if (Ti != 0 && Tj != 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK * (*Tj);
-	localTtKT.addMatrixTripleProduct(0.0, *Ti, localK, *Tj, 1.0);
-      } else if (Ti == 0 && Tj != 0) {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	// localTtKT = localK * (*Tj);	       
-	localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-      } else if (Ti != 0 && Tj == 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = numDOFj;
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK;
-	localTtKT.addMatrixTransposeProduct(0.0, *Ti, localK, 1.0);
-      } else {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = numDOFj;
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	localTtKT = localK;
-      }
-      // now copy into modTangent the T(i)^t K(i,j) T(j) product
-      for (int c=0; c<noRowsTransformed; c++) 
-	for (int d=0; d<noColsTransformed; d++) 
-	  (*modTangent)(startRow+c, startCol+d) = localTtKT(c,d);
-      
-      startCol += noColsTransformed;
-      noColsOriginal += numDOFj;
-    }
-    
-    noRowsOriginal += numDOFi;
-    startRow += noRowsTransformed;
-  }
-  
-  // get the components we need out of the vector
-  // and place in a temporary vector
-  Vector tmp(numTransformedDOF);
-  for (int j=0; j<numTransformedDOF; j++) {
-    int dof = (*modID)(j);
-    if (dof >= 0)
-      tmp(j) = accel(dof);
-    else
-      tmp(j) = 0.0;
-  }
-
-  modResidual->addMatrixVector(0.0, *modTangent, tmp, 1.0);
-
-  return *modResidual;
+  return this->formForce(this->FE_Element::getTangent(0), accel, fact);
 }
 
 const Vector &
@@ -682,113 +357,7 @@ TransformationFE::getM_Force(const Vector &accel, double fact)
 {
   this->FE_Element::zeroTangent();    
   this->FE_Element::addMtoTang();    
-  const Matrix &theTangent = this->FE_Element::getTangent(0);
-
-  static ID numDOFs(dofData, 1);
-  numDOFs.setData(dofData, numGroups);
-    
-  // DO THE SP STUFF TO THE TANGENT 
-  
-  // get the transformation matrix from each dof group & number of local dof
-  // for original node.
-  int numNode = numGroups;
-  for (int a = 0; a<numNode; a++) {
-    Matrix *theT = theDOFs[a]->getT();
-    theTransformations[a] = theT;
-    if (theT != 0)
-      numDOFs[a] = theT->noRows(); // T^ 
-    else
-      numDOFs[a] = theDOFs[a]->getNumDOF();
-  }
-  
-  // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-  // where blocks are of size equal to num ele dof at a node
-  
-  int startRow = 0;
-  int noRowsTransformed = 0;
-  int noRowsOriginal = 0;
-  
-  static Matrix localK;
-  
-  // foreach block row, for each block col do
-  for (int i=0; i<numNode; i++) {
-    
-    int startCol = 0;
-    int numDOFi = numDOFs[i];	
-    int noColsOriginal = 0;
-    
-    for (int j=0; j<numNode; j++) {
-      
-      const Matrix *Ti = theTransformations[i];
-      const Matrix *Tj = theTransformations[j];
-      int numDOFj = numDOFs[j];	
-      localK.setData(localKbuffer, numDOFi, numDOFj);
-      
-      // copy K(i,j) into localK matrix
-      // CHECK SIZE OF BUFFER	    
-      for (int a=0; a<numDOFi; a++)
-	for (int b=0; b<numDOFj; b++)
-	  localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-      
-      // now perform the matrix computation T(i)^T localK T(j)
-      // note: if T == 0 then the Identity is assumed
-      int noColsTransformed = 0;
-      static Matrix localTtKT;
-      
-      if (Ti != 0 && Tj != 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK * (*Tj);
-	localTtKT.addMatrixTripleProduct(0.0, *Ti, localK, *Tj, 1.0);
-      } else if (Ti == 0 && Tj != 0) {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	// localTtKT = localK * (*Tj);	       
-	localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-      } else if (Ti != 0 && Tj == 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = numDOFj;
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK;
-	localTtKT.addMatrixTransposeProduct(0.0, *Ti, localK, 1.0);
-      } else {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = numDOFj;
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	localTtKT = localK;
-      }
-      // now copy into modTangent the T(i)^t K(i,j) T(j) product
-      for (int c=0; c<noRowsTransformed; c++) 
-	for (int d=0; d<noColsTransformed; d++) 
-	  (*modTangent)(startRow+c, startCol+d) = localTtKT(c,d);
-      
-      startCol += noColsTransformed;
-      noColsOriginal += numDOFj;
-    }
-    
-    noRowsOriginal += numDOFi;
-    startRow += noRowsTransformed;
-  }
-  
-  // get the components we need out of the vector
-  // and place in a temporary vector
-  Vector tmp(numTransformedDOF);
-  for (int j=0; j<numTransformedDOF; j++) {
-    int dof = (*modID)(j);
-    if (dof >= 0)
-      tmp(j) = accel(dof);
-    else
-      tmp(j) = 0.0;
-  }
-
-  modResidual->addMatrixVector(0.0, *modTangent, tmp, 1.0);
-
-  return *modResidual;
+  return this->formForce(this->FE_Element::getTangent(0), accel, fact);
 }
 
 const Vector &
@@ -796,113 +365,7 @@ TransformationFE::getC_Force(const Vector &accel, double fact)
 {
   this->FE_Element::zeroTangent();    
   this->FE_Element::addCtoTang();    
-  const Matrix &theTangent = this->FE_Element::getTangent(0);
-
-  static ID numDOFs(dofData, 1);
-  numDOFs.setData(dofData, numGroups);
-    
-  // DO THE SP STUFF TO THE TANGENT 
-  
-  // get the transformation matrix from each dof group & number of local dof
-  // for original node.
-  int numNode = numGroups;
-  for (int a = 0; a<numNode; a++) {
-    Matrix *theT = theDOFs[a]->getT();
-    theTransformations[a] = theT;
-    if (theT != 0)
-      numDOFs[a] = theT->noRows(); // T^ 
-    else
-      numDOFs[a] = theDOFs[a]->getNumDOF();
-  }
-  
-  // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-  // where blocks are of size equal to num ele dof at a node
-  
-  int startRow = 0;
-  int noRowsTransformed = 0;
-  int noRowsOriginal = 0;
-  
-  static Matrix localK;
-  
-  // foreach block row, for each block col do
-  for (int i=0; i<numNode; i++) {
-    
-    int startCol = 0;
-    int numDOFi = numDOFs[i];	
-    int noColsOriginal = 0;
-    
-    for (int j=0; j<numNode; j++) {
-      
-      const Matrix *Ti = theTransformations[i];
-      const Matrix *Tj = theTransformations[j];
-      int numDOFj = numDOFs[j];	
-      localK.setData(localKbuffer, numDOFi, numDOFj);
-      
-      // copy K(i,j) into localK matrix
-      // CHECK SIZE OF BUFFER	    
-      for (int a=0; a<numDOFi; a++)
-	for (int b=0; b<numDOFj; b++)
-	  localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-      
-      // now perform the matrix computation T(i)^T localK T(j)
-      // note: if T == 0 then the Identity is assumed
-      int noColsTransformed = 0;
-      static Matrix localTtKT;
-      
-      if (Ti != 0 && Tj != 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK * (*Tj);
-	localTtKT.addMatrixTripleProduct(0.0, *Ti, localK, *Tj, 1.0);
-      } else if (Ti == 0 && Tj != 0) {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	// localTtKT = localK * (*Tj);	       
-	localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-      } else if (Ti != 0 && Tj == 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = numDOFj;
-	// CHECK SIZE OF BUFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK;
-	localTtKT.addMatrixTransposeProduct(0.0, *Ti, localK, 1.0);
-      } else {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = numDOFj;
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	localTtKT = localK;
-      }
-      // now copy into modTangent the T(i)^t K(i,j) T(j) product
-      for (int c=0; c<noRowsTransformed; c++) 
-	for (int d=0; d<noColsTransformed; d++) 
-	  (*modTangent)(startRow+c, startCol+d) = localTtKT(c,d);
-      
-      startCol += noColsTransformed;
-      noColsOriginal += numDOFj;
-    }
-    
-    noRowsOriginal += numDOFi;
-    startRow += noRowsTransformed;
-  }
-  
-  // get the components we need out of the vector
-  // and place in a temporary vector
-  Vector tmp(numTransformedDOF);
-  for (int j=0; j<numTransformedDOF; j++) {
-    int dof = (*modID)(j);
-    if (dof >= 0)
-      tmp(j) = accel(dof);
-    else
-      tmp(j) = 0.0;
-  }
-
-  modResidual->addMatrixVector(0.0, *modTangent, tmp, 1.0);
-
-  return *modResidual;
+  return this->formForce(this->FE_Element::getTangent(0), accel, fact);
 }
 
 
@@ -912,9 +375,6 @@ TransformationFE::addD_Force(const Vector &disp,  double fact)
     if (fact == 0.0)
 	return;
 
-    static Vector response;
-    response.setData(dataBuffer, numOriginalDOF);
-		    
     for (int i=0; i<numTransformedDOF; i++) {
 	int loc = (*modID)(i);
 	if (loc >= 0)
@@ -922,8 +382,8 @@ TransformationFE::addD_Force(const Vector &disp,  double fact)
 	else
 	    (*modResidual)(i) = 0.0;
     }
-    transformResponse(*modResidual, response);
-    this->addLocalD_Force(response, fact);
+    transformResponse(*modResidual, *response);
+    this->addLocalD_Force(*response, fact);
 }   	 
 
 void  
@@ -932,9 +392,6 @@ TransformationFE::addM_Force(const Vector &disp,  double fact)
     if (fact == 0.0)
 	return;
 
-    static Vector response;
-    response.setData(dataBuffer, numOriginalDOF);
-		    
     for (int i=0; i<numTransformedDOF; i++) {
 	int loc = (*modID)(i);
 	if (loc >= 0)
@@ -942,8 +399,8 @@ TransformationFE::addM_Force(const Vector &disp,  double fact)
 	else
 	    (*modResidual)(i) = 0.0;
     }
-    transformResponse(*modResidual, response);
-    this->addLocalM_Force(response, fact);
+    transformResponse(*modResidual, *response);
+    this->addLocalM_Force(*response, fact);
 }   	 
 
 
@@ -974,34 +431,16 @@ int
 TransformationFE::transformResponse(const Vector &modResp, 
 				    Vector &unmodResp)
 {
-    // perform T R  -- as T is block diagonal do T(i) R(i)
-    // where blocks are of size equal to num ele dof at a node
-
-    int startRowOriginal = 0;
-    int startRowTransformed = 0;
-    int numNode = numGroups;
-    int noRows = 0;
-    int noCols = 0;
-
-    for (int i=0; i<numNode; i++) {
-	const Matrix *Ti = theDOFs[i]->getT();
-	if (Ti != 0) {
-	    noRows = Ti->noRows();
-	    noCols = Ti->noCols();
-	    for (int j=0; j<noRows; j++) {
-		double sum = 0.0;
-		for (int k=0; k<noCols; k++)
-		    sum += (*Ti)(j,k) * modResp(startRowTransformed +k) ;
-		unmodResp(startRowOriginal + j) = sum;
-	    }
-	} else {
-	    noCols = theDOFs[i]->getNumDOF();
-	    noRows = noCols;
-	    for (int j=0; j<noCols; j++)
-		unmodResp(startRowOriginal + j) = modResp(startRowTransformed +j);
-	}
-	startRowOriginal += noRows;
-	startRowTransformed += noCols;
+    if (varyingT)
+	this->formTransformation();
+
+    // perform T R
+    unmodResp.Zero();
+    for (int j=0; j<numTransformedDOF; j++) {
+	const double r = modResp(j);
+	if (r != 0.0)
+	    for (int k=Tptr[j]; k<Tptr[j+1]; k++)
+		unmodResp(Trow[k]) += Tval[k]*r;
     }
 
     return 0;
@@ -1015,9 +454,6 @@ TransformationFE::addD_ForceSensitivity(int gradNumber, const Vector &disp,  dou
     if (fact == 0.0)
 	return;
 
-    static Vector response;
-    response.setData(dataBuffer, numOriginalDOF);
-		    
     for (int i=0; i<numTransformedDOF; i++) {
 	int loc = (*modID)(i);
 	if (loc >= 0)
@@ -1025,8 +461,8 @@ TransformationFE::addD_ForceSensitivity(int gradNumber, const Vector &disp,  dou
 	else
 	    (*modResidual)(i) = 0.0;
     }
-    transformResponse(*modResidual, response);
-    this->addLocalD_ForceSensitivity(gradNumber, response, fact);
+    transformResponse(*modResidual, *response);
+    this->addLocalD_ForceSensitivity(gradNumber, *response, fact);
 }   	 
 
 void  
@@ -1035,9 +471,6 @@ TransformationFE::addM_ForceSensitivity(int gradNumber, const Vector &disp,  dou
     if (fact == 0.0)
 	return;
 
-    static Vector response;
-    response.setData(dataBuffer, numOriginalDOF);
-		    
     for (int i=0; i<numTransformedDOF; i++) {
 	int loc = (*modID)(i);
 	if (loc >= 0)
@@ -1045,8 +478,8 @@ TransformationFE::addM_ForceSensitivity(int gradNumber, const Vector &disp,  dou
 	else
 	    (*modResidual)(i) = 0.0;
     }
-    transformResponse(*modResidual, response);
-    this->addLocalM_ForceSensitivity(gradNumber, response, fact);
+    transformResponse(*modResidual, *response);
+    this->addLocalM_ForceSensitivity(gradNumber, *response, fact);
 }   	 
 
 // AddingSensitivity:END ////////////////////////////////////
@@ -37,6 +37,7 @@
 // What: "@(#) TransformationFE.h, revA"
 
 #include <FE_Element.h>
+#include <vector>
 class SP_Constraint;
 class DOF_Group;
 class TransformationConstraintHandler;
@@ -79,6 +80,9 @@ class TransformationFE: public FE_Element
     int transformResponse(const Vector &modResponse, Vector &unmodResponse);
     
   private:
+    int formTransformation(void);
+    const Matrix &transformTangent(const Matrix &K);
+    const Vector &formForce(const Matrix &K, const Vector &x, double fact);
     
     // private variables - a copy for each object of the class        
     DOF_Group **theDOFs;
@@ -87,21 +91,18 @@ class TransformationFE: public FE_Element
     ID *modID;
     Matrix *modTangent;
     Vector *modResidual;
+    Vector *modInput;
+    Vector *response;
     int numGroups;
     int numTransformedDOF;
     int numOriginalDOF;
-    
-    // static variables - single copy for all objects of the class	
-    static Matrix **modMatrices; // array of pointers to class wide matrices
-    static Vector **modVectors;  // array of pointers to class widde vectors
-    static Matrix **theTransformations; // for holding pointers to the T matrices
-    static int numTransFE;     // number of objects    
-    static int transCounter;   // a counter used to indicate when to do something
-    static int sizeTransformations; // size of theTransformations array
-    static double *dataBuffer;
-    static double *localKbuffer;
-    static int    *dofData;
-    static int sizeBuffer;
+
+    // the nonzero entries of the element transformation T, by column:
+    // column j holds (Trow[k], Tval[k]) for Tptr[j] <= k < Tptr[j+1]
+    std::vector<int>    Tptr;
+    std::vector<int>    Trow;
+    std::vector<double> Tval;
+    bool varyingT;       // T must be formed again for each use
 };
 
 #endif
@@ -36,6 +36,8 @@
 #include <Integrator.h>
 #include <FE_EleIter.h>
 #include <FE_Element.h>
+#include <Element.h>
+#include <algorithm>
 
 ConstraintHandler::ConstraintHandler(int clasTag)
 :MovableObject(clasTag),
@@ -60,6 +62,57 @@ ConstraintHandler::doneNumberingDOF(void)
   return 0;
 }
 
+int
+ConstraintHandler::handleElements(const std::vector<Element*> &added,
+				  const std::vector<Element*> &removed)
+{
+  return -1;
+}
+
+int
+ConstraintHandler::updateElementFEs(const std::vector<Element*> &added,
+				    const std::vector<Element*> &removed)
+{
+  if (theAnalysisModelPtr == 0)
+    return -1;
+
+  // subdomains are linked to their FE_Element by the handler
+  for (Element *elePtr : added)
+    if (elePtr->isSubdomain() == true)
+      return -1;
+
+  // the removed elements may already have been deleted, so they are only
+  // compared with the elements of the FE_Elements
+  std::vector<Element*> gone(removed);
+  std::sort(gone.begin(), gone.end());
+
+  std::vector<int> feTags;
+  int maxTag = -1;
+  FE_EleIter &theFEs = theAnalysisModelPtr->getFEs();
+  FE_Element *fePtr;
+  while ((fePtr = theFEs()) != 0) {
+    int tag = fePtr->getTag();
+    if (tag > maxTag)
+      maxTag = tag;
+    Element *elePtr = fePtr->getElement();
+    if (elePtr != 0 && std::binary_search(gone.begin(), gone.end(), elePtr))
+      feTags.push_back(tag);
+  }
+
+  for (int tag : feTags)
+    delete theAnalysisModelPtr->removeFE_Element(tag);
+
+  for (Element *elePtr : added) {
+    fePtr = new FE_Element(++maxTag, elePtr);
+    if (theAnalysisModelPtr->addFE_Element(fePtr) == false) {
+      delete fePtr;
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
 void 
 ConstraintHandler::setLinks(Domain &theDomain, 
 			    AnalysisModel &theModel,
@@ -39,6 +39,7 @@
 // What: "@(#) ConstraintHandler.h, revA"
 
 #include <MovableObject.h>
+#include <vector>
 
 class AnalysisMethod;
 class ID;
@@ -46,6 +47,7 @@ class Domain;
 class AnalysisModel;
 class Integrator;
 class FEM_ObjectBroker;
+class Element;
 
 class ConstraintHandler : public MovableObject
 {
@@ -62,12 +64,22 @@ class ConstraintHandler : public MovableObject
     virtual int update(void);
     virtual int applyLoad(void);
     virtual int doneNumberingDOF(void);
+
+    // update the FE_Elements for elements added to and removed from the
+    // domain since the last handle(), leaving the DOF_Groups as they are;
+    // returns a negative value if handle() must be invoked instead
+    virtual int handleElements(const std::vector<Element*> &added,
+			       const std::vector<Element*> &removed);
     virtual void clearAll(void) =0;    
 
   protected:
     Domain *getDomainPtr(void) const;
     AnalysisModel *getAnalysisModelPtr(void) const;
     Integrator *getIntegratorPtr(void) const;
+
+    // handleElements() for handlers that create one FE_Element per element
+    int updateElementFEs(const std::vector<Element*> &added,
+			 const std::vector<Element*> &removed);
     
   private:
     Domain *theDomainPtr;
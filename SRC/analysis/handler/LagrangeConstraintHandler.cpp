@@ -236,6 +236,14 @@ LagrangeConstraintHandler::clearAll(void)
 	nodPtr->setDOF_GroupPtr(nullptr);
 }    
 
+int
+LagrangeConstraintHandler::handleElements(const std::vector<Element*> &added,
+                                           const std::vector<Element*> &removed)
+{
+  // the element FE_Elements do not depend on the constraints
+  return this->updateElementFEs(added, removed);
+}
+
 int
 LagrangeConstraintHandler::sendSelf(int cTag, Channel &theChannel)
 {
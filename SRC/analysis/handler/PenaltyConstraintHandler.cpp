@@ -216,6 +216,14 @@ PenaltyConstraintHandler::clearAll(void)
 	nodPtr->setDOF_GroupPtr(nullptr);
 }    
 
+int
+PenaltyConstraintHandler::handleElements(const std::vector<Element*> &added,
+                                          const std::vector<Element*> &removed)
+{
+  // the element FE_Elements do not depend on the constraints
+  return this->updateElementFEs(added, removed);
+}
+
 int
 PenaltyConstraintHandler::sendSelf(int cTag, Channel &theChannel)
 {
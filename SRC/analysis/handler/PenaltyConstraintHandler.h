@@ -52,6 +52,8 @@ class PenaltyConstraintHandler : public ConstraintHandler
 
     int handle(const ID *nodesNumberedLast =0);
     void clearAll(void);    
+    int  handleElements(const std::vector<Element*> &added,
+			const std::vector<Element*> &removed);
 
     virtual int sendSelf(int commitTag, Channel &theChannel);
     virtual int recvSelf(int commitTag, Channel &theChannel, 
@@ -261,6 +261,14 @@ PlainHandler::clearAll(void)
     nodPtr->setDOF_GroupPtr(nullptr);
 }    
 
+int
+PlainHandler::handleElements(const std::vector<Element*> &added,
+                              const std::vector<Element*> &removed)
+{
+  // the element FE_Elements do not depend on the constraints
+  return this->updateElementFEs(added, removed);
+}
+
 int
 PlainHandler::sendSelf(int cTag,
 		       Channel &theChannel)
@@ -43,6 +43,8 @@ class PlainHandler : public ConstraintHandler
 
     int handle(const ID *nodesNumberedLast =nullptr);
     void clearAll(void);    
+    int  handleElements(const std::vector<Element*> &added,
+			const std::vector<Element*> &removed);
 
     int sendSelf(int commitTag, Channel &theChannel);
     int recvSelf(int commitTag, Channel &theChannel, 
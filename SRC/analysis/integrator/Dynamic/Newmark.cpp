@@ -38,6 +38,8 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <string.h>
+#include <math.h>
+#include <algorithm>
 #include <NodeIter.h>
 #include <Domain.h>
 #include <Node.h> // for sensitivity
@@ -51,7 +53,7 @@
 Newmark::Newmark(int classTag)
     : TransientIntegrator(classTag),
       unknown(Unknown::Displacement), gamma(0), beta(0), 
-      c1(0.0), c2(0.0), c3(0.0), 
+      c1(0.0), c2(0.0), c3(0.0), deltaT(0.0),
       Ut(0), Utdot(0), Utdotdot(0), U(0), Udot(0), Udotdot(0),
       determiningMass(false),
       sensitivityFlag(0), gradNumber(0), massMatrixMultiplicator(0),
@@ -66,7 +68,7 @@ Newmark::Newmark(double _gamma, double _beta, int uFlag, int iFlag, bool aflag,
     : TransientIntegrator(classTag_),
       gamma(_gamma), beta(_beta), 
       unknown(uFlag), unknown_initialize(iFlag),
-      c1(0.0), c2(0.0), c3(0.0), 
+      c1(0.0), c2(0.0), c3(0.0), deltaT(0.0),
       Ut(nullptr), Utdot(nullptr), Utdotdot(nullptr), 
       U(nullptr),  Udot(nullptr),  Udotdot(nullptr),
       determiningMass(false),
@@ -104,6 +106,7 @@ Newmark::~Newmark()
 
 int Newmark::newStep(double deltaT)
 {
+    this->deltaT = deltaT;
 
     if (deltaT <= 0.0)  {
         opserr << "Newmark::newStep() - error in variable\n";
@@ -245,6 +248,33 @@ Newmark::getVel()
   return *Udot;
 }
 
+//
+// Zienkiewicz and Xie (1991): for a linear variation of the acceleration
+// over the step, the leading term of the local error in the displacements
+// is (beta - 1/6) dt^2 (a_{n+1} - a_n).
+//
+double
+Newmark::getErrorEstimate(double absTol, double relTol)
+{
+  if (U == nullptr || deltaT <= 0.0)
+    return -1.0;
+
+  const int size = U->Size();
+  if (size == 0)
+    return 0.0;
+
+  const double scale = (beta - 1.0/6.0)*deltaT*deltaT;
+
+  double sum = 0.0;
+  for (int i=0; i<size; i++) {
+    const double error  = scale*((*Udotdot)(i) - (*Utdotdot)(i));
+    const double weight = absTol + relTol*std::max(fabs((*U)(i)), fabs((*Ut)(i)));
+    sum += (error/weight)*(error/weight);
+  }
+
+  return sqrt(sum/size);
+}
+
 int Newmark::revertToLastStep()
 {
   // set response at t+deltaT to be that at t .. for next newStep
@@ -64,9 +64,17 @@ public:
     int revertToLastStep();
     virtual int update(const Vector &deltaU);
 
+    // the tangent and unbalance are those of TransientIntegrator
+    int formTangentAndUnbalance(int statusFlag) {
+      return this->formFusedTangentAndUnbalance(statusFlag);
+    }
+
     double getCFactor();
+    double getGamma() const {return gamma;}
+    double getBeta()  const {return beta;}
 
     const Vector &getVel();
+    double getErrorEstimate(double absTol, double relTol);
     
     virtual int sendSelf(int commitTag, Channel &theChannel);
     virtual int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
@@ -97,6 +105,7 @@ private:
     double beta;
 
     double c1, c2, c3;              // some constants we need to keep
+    double deltaT;                  // size of the last step
     Vector *Ut, *Utdot, *Utdotdot;  // response quantities at time t
     Vector *U, *Udot, *Udotdot;     // response quantities at time t+deltaT
     bool determiningMass;           // flag to check if just want the mass contribution
@@ -33,6 +33,7 @@
 #include <DOF_Group.h>
 #include <FE_EleIter.h>
 #include <DOF_GrpIter.h>
+#include <Profiler.h>
 #include <cmath>
 
 IncrementalIntegrator::IncrementalIntegrator(int clasTag)
@@ -73,6 +74,8 @@ IncrementalIntegrator::setLinks(AnalysisModel &theModel, LinearSOE &theLinSOE, C
 int 
 IncrementalIntegrator::formTangent(int statFlag)
 {
+    OpenSees::Profiler::Scope scope(OpenSees::Profiler::FormTangent);
+
     int result = 0;
     statusFlag = statFlag;
 
@@ -109,6 +112,26 @@ IncrementalIntegrator::formTangent(int statFlag, double iFact, double cFact)
     return this->formTangent(statFlag);
 }
 
+int
+IncrementalIntegrator::formTangentAndUnbalance(int statFlag)
+{
+    // integrators that assemble the unbalance in their own way form the
+    // two separately
+    int result = this->formTangent(statFlag);
+    if (result < 0)
+        return result;
+
+    return this->formUnbalance();
+}
+
+int
+IncrementalIntegrator::formTangentAndUnbalance(int statFlag, double iFact, double cFact)
+{
+    iFactor = iFact;
+    cFactor = cFact;
+    return this->formTangentAndUnbalance(statFlag);
+}
+
 int
 IncrementalIntegrator::formIndependentSensitivityLHS(int statFlag)
 {
@@ -237,6 +260,38 @@ IncrementalIntegrator::formElementResidual(void)
     return res;            
 }
 
+int
+IncrementalIntegrator::formElementTangentAndResidual(bool inertia)
+{
+    // loop through the FE_Elements adding both their tangent and residual;
+    // the references returned by an FE_Element are only valid until the
+    // next one is formed, so they are assembled right away
+    FE_Element *elePtr;
+
+    int res = 0;
+
+    FE_EleIter &theEles = theAnalysisModel->getFEs();
+    while ((elePtr = theEles()) != nullptr) {
+        const Matrix *tangent;
+        const Vector *residual;
+        elePtr->getTangentAndResidual(this, inertia, tangent, residual);
+
+        const ID &id = elePtr->getID();
+        if (theSOE->addA(*tangent, id) < 0) {
+            opserr << "WARNING IncrementalIntegrator::formElementTangentAndResidual -";
+            opserr << " failed in addA for ID " << id;
+            res = -3;
+        }
+        if (theSOE->addB(*residual, id) < 0) {
+            opserr << "WARNING IncrementalIntegrator::formElementTangentAndResidual -";
+            opserr << " failed in addB for ID " << id;
+            res = -2;
+        }
+    }
+
+    return res;
+}
+
 /*
 int
 IncrementalIntegrator::setModalDampingFactors(const Vector &factors)
@@ -71,6 +71,13 @@ class IncrementalIntegrator : public Integrator
                              double iFactor,
                              double cFactor);    
 
+    // form the tangent and the unbalance at the current trial state,
+    // visiting each element once when the integrator supports it
+    virtual int  formTangentAndUnbalance(int statusFlag = CURRENT_TANGENT);
+            int  formTangentAndUnbalance(int statusFlag,
+                                         double iFactor,
+                                         double cFactor);
+
     // methods to update the domain
 //  virtual int newStep(double deltaT) =0;
     virtual int commit();
@@ -103,6 +110,7 @@ class IncrementalIntegrator : public Integrator
 
     virtual int  formNodalUnbalance();
     virtual int  formElementResidual();
+    int          formElementTangentAndResidual(bool inertia);
 
     LinearSOE       *getLinearSOE() const;
     AnalysisModel   *getAnalysisModel() const;
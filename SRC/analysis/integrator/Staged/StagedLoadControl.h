@@ -58,6 +58,9 @@ public:
 
 
     int  formTangent(int statusFlag = CURRENT_TANGENT);
+    int formTangentAndUnbalance(int statusFlag) {
+      return this->IncrementalIntegrator::formTangentAndUnbalance(statusFlag);
+    }
 
 
 };
@@ -34,6 +34,9 @@ public:
     StagedNewmark(double gamma, double beta, bool disp = true, bool aflag=false);
 
     int  formTangent(int statusFlag = CURRENT_TANGENT);
+    int formTangentAndUnbalance(int statusFlag) {
+      return this->IncrementalIntegrator::formTangentAndUnbalance(statusFlag);
+    }
 
 
 private:
@@ -35,6 +35,7 @@
 #include <FE_EleIter.h>
 #include <DOF_Group.h>
 #include <DOF_GrpIter.h>
+#include <Profiler.h>
 
 StaticIntegrator::StaticIntegrator(int clasTag)
  :IncrementalIntegrator(clasTag)
@@ -50,6 +51,8 @@ StaticIntegrator::~StaticIntegrator()
 int 
 StaticIntegrator::formUnbalance()
 {
+  OpenSees::Profiler::Scope scope(OpenSees::Profiler::FormUnbalance);
+
   LinearSOE* theLinSOE = this->getLinearSOE();
 
   if (theLinSOE == nullptr) {
@@ -76,6 +79,41 @@ StaticIntegrator::formUnbalance()
 }
     
 
+int
+StaticIntegrator::formTangentAndUnbalance(int statFlag)
+{
+  OpenSees::Profiler::Scope scope(OpenSees::Profiler::FormTangent);
+
+  LinearSOE* theLinSOE = this->getLinearSOE();
+  AnalysisModel* theModel = this->getAnalysisModel();
+
+  if (theLinSOE == nullptr || theModel == nullptr) {
+      opserr << "WARNING StaticIntegrator::formTangentAndUnbalance -";
+      opserr << " no AnalysisModel or LinearSOE has been set\n";
+      return -1;
+  }
+
+  statusFlag = statFlag;
+
+  theLinSOE->zeroA();
+  theLinSOE->zeroB();
+
+  if (this->formElementTangentAndResidual(false) < 0) {
+      opserr << "WARNING StaticIntegrator::formTangentAndUnbalance ";
+      opserr << " - this->formElementTangentAndResidual failed\n";
+      return -1;
+  }
+
+  if (this->formNodalUnbalance() < 0) {
+      opserr << "WARNING StaticIntegrator::formTangentAndUnbalance ";
+      opserr << " - this->formNodalUnbalance failed\n";
+      return -2;
+  }
+
+  return 0;
+}
+
+
 int
 StaticIntegrator::formEleTangent(FE_Element *theEle)
 {
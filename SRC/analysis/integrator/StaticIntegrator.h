@@ -51,6 +51,7 @@ class StaticIntegrator : public IncrementalIntegrator
     // methods which define what the FE_Element and DOF_Groups add
     // to the system of equation object.
     virtual int formUnbalance() final;
+    virtual int formTangentAndUnbalance(int statusFlag);
     virtual int formEleTangent(FE_Element *theEle);
     virtual int formEleResidual(FE_Element *theEle)   final;
     virtual int formNodTangent(DOF_Group *theDof)     final;
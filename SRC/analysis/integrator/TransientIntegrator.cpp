@@ -37,6 +37,7 @@
 #include <DOF_Group.h>
 #include <FE_EleIter.h>
 #include <DOF_GrpIter.h>
+#include <Profiler.h>
 
 TransientIntegrator::TransientIntegrator(int clasTag)
 :IncrementalIntegrator(clasTag)
@@ -62,6 +63,8 @@ TransientIntegrator::formTangent(int statFlag, double iFact, double cFact)
 int 
 TransientIntegrator::formTangent(int statFlag)
 {
+    OpenSees::Profiler::Scope scope(OpenSees::Profiler::FormTangent);
+
     int result = 0;
     statusFlag = statFlag;
 
@@ -112,8 +115,63 @@ TransientIntegrator::formTangent(int statFlag)
 
 
     
+int
+TransientIntegrator::formFusedTangentAndUnbalance(int statFlag)
+{
+    OpenSees::Profiler::Scope scope(OpenSees::Profiler::FormTangent);
+
+    int result = 0;
+    statusFlag = statFlag;
+
+    LinearSOE *theLinSOE = this->getLinearSOE();
+    AnalysisModel *theModel = this->getAnalysisModel();
+    if (theLinSOE == nullptr || theModel == nullptr) {
+      opserr << "WARNING TransientIntegrator::formFusedTangentAndUnbalance() ";
+      opserr << "no LinearSOE or AnalysisModel has been set\n";
+      return -1;
+    }
+
+    theLinSOE->zeroA();
+    theLinSOE->zeroB();
+
+    // do modal damping
+    const Vector *modalValues = theModel->getModalDampingFactors();
+    if (modalValues != nullptr) {
+      if (theModel->inclModalDampingMatrix())
+        this->addModalDampingMatrix(modalValues);
+      this->addModalDampingForce(modalValues);
+    }
+
+    // loop through the DOF_Groups and add the tangent
+    DOF_GrpIter &theDOFs = theModel->getDOFs();
+    DOF_Group *dofPtr;
+    while ((dofPtr = theDOFs()) != nullptr) {
+      if (theLinSOE->addA(dofPtr->getTangent(this), dofPtr->getID()) < 0) {
+        opserr << "TransientIntegrator::formFusedTangentAndUnbalance() - failed to addA:dof\n";
+        result = -1;
+      }
+    }
+
+    // each element forms its tangent and residual in one visit
+    if (this->formElementTangentAndResidual(true) < 0) {
+      opserr << "WARNING TransientIntegrator::formFusedTangentAndUnbalance ";
+      opserr << " - this->formElementTangentAndResidual failed\n";
+      return -2;
+    }
+
+    if (this->formNodalUnbalance() < 0) {
+      opserr << "WARNING TransientIntegrator::formFusedTangentAndUnbalance ";
+      opserr << " - this->formNodalUnbalance failed\n";
+      return -2;
+    }
+
+    return result;
+}
+
 int
 TransientIntegrator::formUnbalance(void) {
+    OpenSees::Profiler::Scope scope(OpenSees::Profiler::FormUnbalance);
+
     LinearSOE *theLinSOE = this->getLinearSOE();
     AnalysisModel *theModel = this->getAnalysisModel();
 
@@ -65,8 +65,18 @@ class TransientIntegrator : public IncrementalIntegrator
     virtual const Vector& getVel(void) = 0; // For modal damping  
     virtual int initialize(void) {return 0;};
 
+    // Estimate of the local error in the displacements of the step just
+    // solved, as the root-mean-square of the errors weighted by
+    // absTol + relTol*|U|, so that a step is acceptable when the estimate
+    // does not exceed one. Negative if the integrator has no estimate.
+    virtual double getErrorEstimate(double absTol, double relTol) {return -1.0;};
+
 
   protected:
+    // form the tangent and unbalance of formTangent() and formUnbalance()
+    // in one pass over the elements; for subclasses that use both as they
+    // are and override formTangentAndUnbalance() to call it
+    int formFusedTangentAndUnbalance(int statusFlag);
     
   private:
 };
@@ -164,6 +164,27 @@ AnalysisModel::addFE_Element(FE_Element *theElement)
 
 
 
+// FE_Element *removeFE_Element(int tag);
+//        Method to remove an element from the model, which is returned
+//        for the caller to delete.
+
+FE_Element *
+AnalysisModel::removeFE_Element(int tag)
+{
+  if (theFEs == 0)
+      return 0;
+
+  TaggedObject *mc = theFEs->removeComponent(tag);
+  if (mc == 0)
+      return 0;
+
+  numFE_Ele--;
+  return (FE_Element *)mc;
+}
+
+
+
+
 // void addDOF_Group(DOF_Group *);
 //        Method to add an element to the model.
 
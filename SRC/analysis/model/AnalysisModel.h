@@ -59,6 +59,7 @@ class AnalysisModel: public MovableObject
     // methods to populate/depopulate the AnalysisModel
     VIRTUAL bool addFE_Element(FE_Element *theFE_Ele);
     VIRTUAL bool addDOF_Group(DOF_Group *theDOF_Grp); // called by Handler
+    VIRTUAL FE_Element *removeFE_Element(int tag);   // caller deletes it
     VIRTUAL void clearAll(void);
     VIRTUAL void clearDOFGraph(void);                 // called by Numberer and Analysis
     VIRTUAL void clearDOFGroupGraph(void); 
@@ -121,6 +121,7 @@ TimeSeries *G3_getTimeSeries(G3_Runtime *, G3_Tag);
 
 // Analysis
 AnalysisModel **G3_getAnalysisModelPtr(G3_Runtime *);
+int G3_setAnalysisModel(G3_Runtime *, AnalysisModel *);
 StaticIntegrator *G3_getStaticIntegrator(G3_Runtime *);
 int G3_setStaticIntegrator(G3_Runtime *, StaticIntegrator *);
 
@@ -1019,6 +1019,7 @@ enum {
 #define EquiALGORITHM_TAGS_ElasticAlgorithm 14
 #define EquiALGORITHM_TAGS_NewtonHallM 15
 #define EquiALGORITHM_TAGS_ExpressNewton 16
+#define EquiALGORITHM_TAGS_JacobianFreeNewton 17
 
 #define ACCELERATOR_TAGS_Krylov		1
 #define ACCELERATOR_TAGS_Secant		2
@@ -36,22 +36,22 @@
 #include <Channel.h>
 #include <elementAPI.h>
 #include <string>
+#include <VectorND.h>
+#include <MatrixND.h>
+#include <Vector3D.h>
+#include <Matrix3D.h>
+#include <Triad.h>
+#include <Rotations.hpp>
 #include <CorotCrdTransf3d.h>
 
+using namespace OpenSees;
+
 // initialize static variables
-Matrix CorotCrdTransf3d::RI(3, 3);
-Matrix CorotCrdTransf3d::RJ(3, 3);
-Matrix CorotCrdTransf3d::Rbar(3, 3);
-Matrix CorotCrdTransf3d::e(3, 3);
 Matrix CorotCrdTransf3d::Tp(6, 7);
-Matrix CorotCrdTransf3d::T(7, 12);
 Matrix CorotCrdTransf3d::Tlg(12, 12);
 Matrix CorotCrdTransf3d::TlgInv(12, 12);
 Matrix CorotCrdTransf3d::Tbl(6, 12);
 Matrix CorotCrdTransf3d::kg(12, 12);
-Matrix CorotCrdTransf3d::Lr2(12, 3);
-Matrix CorotCrdTransf3d::Lr3(12, 3);
-Matrix CorotCrdTransf3d::A(3, 3);
 
 void *
 OPS_CorotCrdTransf3d()
@@ -316,133 +316,122 @@ CorotCrdTransf3d::initialize(Node *nodeIPointer, Node *nodeJPointer)
   alphaIq = this->getQuaternionFromRotMatrix(R0); // pseudo-vector for node I
   alphaJq = this->getQuaternionFromRotMatrix(R0); // pseudo-vector for node J
 
+  // form the triads and transformation of the initial configuration
+  if ((error = this->update()))
+    return error;
+
   this->commitState();
 
   return 0;
 }
 
 int
-CorotCrdTransf3d::update(void)
+CorotCrdTransf3d::updateIfMoved(void)
 {
-  int i, j, k;
+  const Vector &uI = nodeIPtr->getTrialDisp();
+  const Vector &uJ = nodeJPtr->getTrialDisp();
 
-  /********* OLD REMO - REPLACED BELOW TO FIX BUG ***************
-    // determine global displacement increments from last iteration
-    const Vector &dispIncrI = nodeIPtr->getIncrDeltaDisp();
-    const Vector &dispIncrJ = nodeJPtr->getIncrDeltaDisp();
-    
-     // get the iterative spins dAlphaI and dAlphaJ 
-     // (rotational displacement increments at both nodes)
-     
-      static Vector dAlphaI(3);
-      static Vector dAlphaJ(3);
-      
-       
-        for (k = 0; k < 3; k++)
-        {
-        dAlphaI(k) = dispIncrI(k+3);
-        dAlphaJ(k) = dispIncrJ(k+3);
-        }   
-    **************************************************************/
+  for (int k = 0; k < 6; k++)
+    if (uI(k) != ug[k] || uJ(k) != ug[k + 6])
+      return this->update();
 
+  return 0;
+}
+
+int
+CorotCrdTransf3d::update(void)
+{
   // determine global displacement increments from last iteration
-  static Vector dispI(6);
-  static Vector dispJ(6);
-  dispI = nodeIPtr->getTrialDisp();
-  dispJ = nodeJPtr->getTrialDisp();
+  const Vector &uI = nodeIPtr->getTrialDisp();
+  const Vector &uJ = nodeJPtr->getTrialDisp();
+
+  VectorND<6> dispI, dispJ;
+  for (int k = 0; k < 6; k++) {
+    dispI[k] = uI(k);
+    dispJ[k] = uJ(k);
+    ug[k]     = uI(k);
+    ug[k + 6] = uJ(k);
+  }
 
   if (nodeIInitialDisp != 0) {
     for (int j = 0; j < 6; j++)
-      dispI(j) -= nodeIInitialDisp[j];
+      dispI[j] -= nodeIInitialDisp[j];
   }
 
   if (nodeJInitialDisp != 0) {
     for (int j = 0; j < 6; j++)
-      dispJ(j) -= nodeJInitialDisp[j];
+      dispJ[j] -= nodeJInitialDisp[j];
   }
 
   // get the iterative spins dAlphaI and dAlphaJ
   // (rotational displacement increments at both nodes)
-
-  static Vector dAlphaI(3);
-  static Vector dAlphaJ(3);
-
-  for (k = 0; k < 3; k++) {
-    dAlphaI(k) = dispI(k + 3) - alphaI(k);
-    dAlphaJ(k) = dispJ(k + 3) - alphaJ(k);
-    alphaI(k)  = dispI(k + 3);
-    alphaJ(k)  = dispJ(k + 3);
+  Vector3D dAlphaI, dAlphaJ;
+  for (int k = 0; k < 3; k++) {
+    dAlphaI[k] = dispI[k + 3] - alphaI(k);
+    dAlphaJ[k] = dispJ[k + 3] - alphaJ(k);
+    alphaI(k)  = dispI[k + 3];
+    alphaJ(k)  = dispJ[k + 3];
   }
 
-  /************** END OF REPLACEMENT **************************/
-
-  // update the nodal triads TI and RJ using quaternions
-  static Vector dAlphaIq(4);
-  static Vector dAlphaJq(4);
+  // update the nodal triads RI and RJ using quaternions
+  Versor qI, qJ;
+  for (int k = 0; k < 4; k++) {
+    qI[k] = alphaIq(k);
+    qJ[k] = alphaJq(k);
+  }
 
-  dAlphaIq = this->getQuaternionFromPseudoRotVector(dAlphaI);
-  dAlphaJq = this->getQuaternionFromPseudoRotVector(dAlphaJ);
+  qI = VersorProduct(qI, VersorFromVector(dAlphaI));
+  qJ = VersorProduct(qJ, VersorFromVector(dAlphaJ));
 
-  alphaIq = this->quaternionProduct(alphaIq, dAlphaIq);
-  alphaJq = this->quaternionProduct(alphaJq, dAlphaJq);
+  for (int k = 0; k < 4; k++) {
+    alphaIq(k) = qI[k];
+    alphaJq(k) = qJ[k];
+  }
 
-  RI = this->getRotationMatrixFromQuaternion(alphaIq);
-  RJ = this->getRotationMatrixFromQuaternion(alphaJq);
+  RI = MatrixFromVersor(qI);
+  RJ = MatrixFromVersor(qJ);
 
   // compute the mean nodal triad
-  static Matrix dRgamma(3, 3);
-  static Vector gammaq(4);
-  static Vector gammaw(3);
-
-  dRgamma.Zero();
+  Matrix3D dRgamma{};
 
   //dRgamma = RJ * RIt;
-  for (i = 0; i < 3; i++)
-    for (j = 0; j < 3; j++)
-      for (k = 0; k < 3; k++)
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++)
+      for (int k = 0; k < 3; k++)
         dRgamma(i, j) += RJ(i, k) * RI(j, k);
 
-  gammaq = this->getQuaternionFromRotMatrix(dRgamma); // pseudo-vector for node J
-  gammaw = this->getTangScaledPseudoVectorFromQuaternion(gammaq);
-
-
-  dRgamma = this->getRotMatrixFromTangScaledPseudoVector(gammaw / 2);
-
-  Rbar.addMatrixProduct(0.0, dRgamma, RI, 1.0);
+  // pseudo-vector for node J
+  const Vector3D gammaw = CayleyFromVersor(VersorFromMatrix(dRgamma));
 
-  // compute the base vectors e1, e2, e3
-  static Vector e1(3);
-  static Vector e2(3);
-  static Vector e3(3);
+  Rbar = CaySO3(gammaw * 0.5) * RI;
 
-  // relative translation displacements
-  static Vector dJI(3);
-  for (int kk = 0; kk < 3; kk++)
-    dJI(kk) = dispJ(kk) - dispI(kk);
+  // relative translation displacements and element projection
+  const Vector &xI = nodeIPtr->getCrds();
+  const Vector &xJ = nodeJPtr->getCrds();
 
-  // element projection
-  static Vector xJI(3);
-  xJI = nodeJPtr->getCrds() - nodeIPtr->getCrds();
+  Vector3D dJI, xJI;
+  for (int k = 0; k < 3; k++) {
+    dJI[k] = dispJ[k] - dispI[k];
+    xJI[k] = xJ(k) - xI(k);
+  }
 
   if (nodeIInitialDisp != 0) {
-    xJI(0) -= nodeIInitialDisp[0];
-    xJI(1) -= nodeIInitialDisp[1];
-    xJI(2) -= nodeIInitialDisp[2];
+    xJI[0] -= nodeIInitialDisp[0];
+    xJI[1] -= nodeIInitialDisp[1];
+    xJI[2] -= nodeIInitialDisp[2];
   }
 
   if (nodeJInitialDisp != 0) {
-    xJI(0) += nodeJInitialDisp[0];
-    xJI(1) += nodeJInitialDisp[1];
-    xJI(2) += nodeJInitialDisp[2];
+    xJI[0] += nodeJInitialDisp[0];
+    xJI[1] += nodeJInitialDisp[1];
+    xJI[2] += nodeJInitialDisp[2];
   }
 
-  static Vector dx(3);
   // dx = xJI + dJI;
-  dx = xJI;
-  dx.addVector(1.0, dJI, 1.0);
+  const Vector3D dx = xJI + dJI;
 
   // calculate the deformed element length
-  Ln = dx.Norm();
+  Ln = dx.norm();
 
   if (Ln == 0.0) {
     opserr << "\nCorotCrdTransf3d::update: 0 deformed length\n";
@@ -450,69 +439,42 @@ CorotCrdTransf3d::update(void)
   }
 
   // compute the base vector e1
-  e1 = dx / Ln;
+  const Vector3D e1 = dx / Ln;
 
   // 'rotate' the mean rotation matrix Rbar on to e1 to
   // obtain e2 and e3 (using the 'mid-point' procedure)
-  static Vector r1(3);
-  static Vector r2(3);
-  static Vector r3(3);
-
-  for (k = 0; k < 3; k++) {
-    r1(k) = Rbar(k, 0);
-    r2(k) = Rbar(k, 1);
-    r3(k) = Rbar(k, 2);
-  }
-
-  //    e2 = r2 - (e1 + r1)*((r2^ e1)*0.5);
-  // e3 = r3 - (e1 + r1)*((r3^ e1)*0.5);
-
-  static Vector tmp(3);
-  tmp = e1;
-  tmp += r1;
-
-  e2 = tmp;
-  e3 = tmp;
-
-  e2 *= (r2 ^ e1) * 0.5;
-  e2.addVector(-1.0, r2, 1.0);
+  const Triad r{Rbar};
+  const Vector3D &r1 = r[1], &r2 = r[2], &r3 = r[3];
 
   // e2 = r2 - (e1 + r1)*((r2^ e1)*0.5);
+  // e3 = r3 - (e1 + r1)*((r3^ e1)*0.5);
+  const Vector3D e1r1 = e1 + r1;
+  const Vector3D e2 = r2 - e1r1 * (r2.dot(e1) * 0.5);
+  const Vector3D e3 = r3 - e1r1 * (r3.dot(e1) * 0.5);
 
-  e3 *= (r3 ^ e1) * 0.5;
-  e3.addVector(-1.0, r3, 1.0);
+  for (int k = 0; k < 3; k++) {
+    e(k, 0) = e1[k];
+    e(k, 1) = e2[k];
+    e(k, 2) = e3[k];
+  }
 
   // compute the basic rotations
-  static Vector rI1(3), rI2(3), rI3(3);
-  static Vector rJ1(3), rJ2(3), rJ3(3);
-
-  for (k = 0; k < 3; k++) {
-    e(k, 0) = e1(k);
-    e(k, 1) = e2(k);
-    e(k, 2) = e3(k);
-
-    rI1(k) = RI(k, 0);
-    rI2(k) = RI(k, 1);
-    rI3(k) = RI(k, 2);
-
-    rJ1(k) = RJ(k, 0);
-    rJ2(k) = RJ(k, 1);
-    rJ3(k) = RJ(k, 2);
-  }
+  const Triad tI{RI}, tJ{RJ};
+  const Vector3D &rI1 = tI[1], &rI2 = tI[2], &rI3 = tI[3],
+                 &rJ1 = tJ[1], &rJ2 = tJ[2], &rJ3 = tJ[3];
 
   // compute the basic displacements
   ulpr  = ul;
-  ul(0) = asin(((rI2 ^ e3) - (rI3 ^ e2)) * 0.5);
-  ul(1) = asin(((rI1 ^ e2) - (rI2 ^ e1)) * 0.5);
-  ul(2) = asin(((rI1 ^ e3) - (rI3 ^ e1)) * 0.5);
-  ul(3) = asin(((rJ2 ^ e3) - (rJ3 ^ e2)) * 0.5);
-  ul(4) = asin(((rJ1 ^ e2) - (rJ2 ^ e1)) * 0.5);
-  ul(5) = asin(((rJ1 ^ e3) - (rJ3 ^ e1)) * 0.5);
+  ul(0) = asin((rI2.dot(e3) - rI3.dot(e2)) * 0.5);
+  ul(1) = asin((rI1.dot(e2) - rI2.dot(e1)) * 0.5);
+  ul(2) = asin((rI1.dot(e3) - rI3.dot(e1)) * 0.5);
+  ul(3) = asin((rJ2.dot(e3) - rJ3.dot(e2)) * 0.5);
+  ul(4) = asin((rJ1.dot(e2) - rJ2.dot(e1)) * 0.5);
+  ul(5) = asin((rJ1.dot(e3) - rJ3.dot(e1)) * 0.5);
 
   // ul = Ln - L;
   // ul(6) = 2 * ((xJI + dJI/2)^ dJI) / (Ln + L);  //mid-point formula
-  xJI.addVector(1.0, dJI, 0.5);
-  ul(6) = 2 * (xJI ^ dJI) / (Ln + L); //mid-point formula
+  ul(6) = 2 * (xJI + dJI * 0.5).dot(dJI) / (Ln + L); //mid-point formula
 
   // compute the transformation matrix
   this->compTransfMatrixBasicGlobal();
@@ -524,48 +486,22 @@ void
 CorotCrdTransf3d::compTransfMatrixBasicGlobal(void)
 {
   // extract columns of rotation matrices
-  int i, j, k;
-
-  static Vector r1(3), r2(3), r3(3);
-  static Vector e1(3), e2(3), e3(3);
-  static Vector rI1(3), rI2(3), rI3(3);
-  static Vector rJ1(3), rJ2(3), rJ3(3);
-
-  for (k = 0; k < 3; k++) {
-    r1(k) = Rbar(k, 0);
-    r2(k) = Rbar(k, 1);
-    r3(k) = Rbar(k, 2);
-
-    e1(k) = e(k, 0);
-    e2(k) = e(k, 1);
-    e3(k) = e(k, 2);
-
-    rI1(k) = RI(k, 0);
-    rI2(k) = RI(k, 1);
-    rI3(k) = RI(k, 2);
-
-    rJ1(k) = RJ(k, 0);
-    rJ2(k) = RJ(k, 1);
-    rJ3(k) = RJ(k, 2);
-  }
+  const Triad E{e}, r{Rbar}, tI{RI}, tJ{RJ};
+  const Vector3D &e1  = E[1],  &e2  = E[2],  &e3  = E[3],
+                 &r2  = r[2],  &r3  = r[3],
+                 &rI1 = tI[1], &rI2 = tI[2], &rI3 = tI[3],
+                 &rJ1 = tJ[1], &rJ2 = tJ[2], &rJ3 = tJ[3];
 
   // compute the transformation matrix from the basic to the
   // global system
-  static Matrix I(3, 3);
 
   //   A = (1/Ln)*(I - e1*e1');
-  for (i = 0; i < 3; i++)
-    I(i, i) = 1;
-
-  for (i = 0; i < 3; i++)
-    for (j = 0; j < 3; j++)
-      A(i, j) = (I(i, j) - e1(i) * e1(j)) / Ln;
-
-  Lr2 = this->getLMatrix(r2);
-  Lr3 = this->getLMatrix(r3);
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++)
+      A(i, j) = ((i == j ? 1.0 : 0.0) - e1[i] * e1[j]) / Ln;
 
-  static Matrix Sr1(3, 3), Sr2(3, 3), Sr3(3, 3);
-  static Vector Se(3), At(3);
+  this->getLMatrix(r2, Lr2);
+  this->getLMatrix(r3, Lr3);
 
   //   T1 = [      O', (-S(rI3)*e2 + S(rI2)*e3)',        O', O']';
   //   T2 = [(A*rI2)', (-S(rI2)*e1 + S(rI1)*e2)', -(A*rI2)', O']';
@@ -574,88 +510,43 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobal(void)
   //   T4 = [      O', O',        O', (-S(rJ3)*e2 + S(rJ2)*e3)']';
   //   T5 = [(A*rJ2)', O', -(A*rJ2)', (-S(rJ2)*e1 + S(rJ1)*e2)']';
   //   T6 = [(A*rJ3)', O', -(A*rJ3)', (-S(rJ3)*e1 + S(rJ1)*e3)']';
+  //
+  // where S(a)*b is the cross product a x b
 
-  T.Zero();
-
-  Sr1 = this->getSkewSymMatrix(rI1);
-  Sr2 = this->getSkewSymMatrix(rI2);
-  Sr3 = this->getSkewSymMatrix(rI3);
-
-  //   T1 = [      O', (-S(rI3)*e2 + S(rI2)*e3)',        O', O']';
-
-  Se.addMatrixVector(0.0, Sr3, e2, -1.0); // (-S(rI3)*e2 + S(rI2)*e3)
-  Se.addMatrixVector(1.0, Sr2, e3, 1.0);
-
-  for (i = 0; i < 3; i++)
-    T(0, i + 3) = Se(i);
-
-  //   T2 = [(A*rI2)', (-S(rI2)*e1 + S(rI1)*e2)', -(A*rI2)', O']';
-
-  At.addMatrixVector(0.0, A, rI2, 1.0);
-
-  Se.addMatrixVector(0.0, Sr2, e1, -1.0); // (-S(rI2)*e1 + S(rI1)*e2)'
-  Se.addMatrixVector(1.0, Sr1, e2, 1.0);
-
-  for (i = 0; i < 3; i++) {
-    T(1, i)     = At(i);
-    T(1, i + 3) = Se(i);
-    T(1, i + 6) = -At(i);
-  }
-
-  //   T3 = [(A*rI3)', (-S(rI3)*e1 + S(rI1)*e3)', -(A*rI3)', O']';
-
-  At.addMatrixVector(0.0, A, rI3, 1.0);
-
-  Se.addMatrixVector(0.0, Sr3, e1, -1.0); // (-S(rI3)*e1 + S(rI1)*e3)
-  Se.addMatrixVector(1.0, Sr1, e3, 1.0);
-
-  for (i = 0; i < 3; i++) {
-    T(2, i)     = At(i);
-    T(2, i + 3) = Se(i);
-    T(2, i + 6) = -At(i);
-  }
-
-  Sr1 = this->getSkewSymMatrix(rJ1);
-  Sr2 = this->getSkewSymMatrix(rJ2);
-  Sr3 = this->getSkewSymMatrix(rJ3);
-
-  //   T4 = [      O', O',        O', (-S(rJ3)*e2 + S(rJ2)*e3)']';
-
-  Se.addMatrixVector(0.0, Sr3, e2, -1.0); // -S(rJ3)*e2 + S(rJ2)*e3
-  Se.addMatrixVector(1.0, Sr2, e3, 1.0);
-
-  for (i = 0; i < 3; i++)
-    T(3, i + 9) = Se(i);
+  const Vector3D AI2 = A * rI2, AI3 = A * rI3,
+                 AJ2 = A * rJ2, AJ3 = A * rJ3;
 
-  //   T5 = [(A*rJ2)', O', -(A*rJ2)', (-S(rJ2)*e1 + S(rJ1)*e2)']';
+  const Vector3D SeI1 = rI2.cross(e3) - rI3.cross(e2),
+                 SeI2 = rI1.cross(e2) - rI2.cross(e1),
+                 SeI3 = rI1.cross(e3) - rI3.cross(e1),
+                 SeJ1 = rJ2.cross(e3) - rJ3.cross(e2),
+                 SeJ2 = rJ1.cross(e2) - rJ2.cross(e1),
+                 SeJ3 = rJ1.cross(e3) - rJ3.cross(e1);
 
-  At.addMatrixVector(0.0, A, rJ2, 1.0);
+  T.zero();
 
-  Se.addMatrixVector(0.0, Sr2, e1, -1.0); // (-S(rJ2)*e1 + S(rJ1)*e2)
-  Se.addMatrixVector(1.0, Sr1, e2, 1.0);
+  for (int i = 0; i < 3; i++) {
+    T(0, i + 3) = SeI1[i];
 
-  for (i = 0; i < 3; i++) {
-    T(4, i)     = At(i);
-    T(4, i + 6) = -At(i);
-    T(4, i + 9) = Se(i);
-  }
+    T(1, i)     = AI2[i];
+    T(1, i + 3) = SeI2[i];
+    T(1, i + 6) = -AI2[i];
 
-  //   T6 = [(A*rJ3)', O', -(A*rJ3)', (-S(rJ3)*e1 + S(rJ1)*e3)']';
+    T(2, i)     = AI3[i];
+    T(2, i + 3) = SeI3[i];
+    T(2, i + 6) = -AI3[i];
 
-  At.addMatrixVector(0.0, A, rJ3, 1.0);
+    T(3, i + 9) = SeJ1[i];
 
-  Se.addMatrixVector(0.0, Sr3, e1, -1.0); // (-S(rJ3)*e1 + S(rJ1)*e3)
-  Se.addMatrixVector(1.0, Sr1, e3, 1.0);
+    T(4, i)     = AJ2[i];
+    T(4, i + 6) = -AJ2[i];
+    T(4, i + 9) = SeJ2[i];
 
-  for (i = 0; i < 3; i++) {
-    T(5, i)     = At(i);
-    T(5, i + 6) = -At(i);
-    T(5, i + 9) = Se(i);
+    T(5, i)     = AJ3[i];
+    T(5, i + 6) = -AJ3[i];
+    T(5, i + 9) = SeJ3[i];
   }
 
-  // setup transformation matrix
-  static Vector Lr(12);
-
   // T(:,1) += Lr3*rI2 - Lr2*rI3;
   // T(:,2) +=           Lr2*rI1;
   // T(:,3) += Lr3*rI1          ;
@@ -664,262 +555,28 @@ CorotCrdTransf3d::compTransfMatrixBasicGlobal(void)
   // T(:,5) += Lr2*rJ1          ;      // ?????? check sign
   // T(:,6) += Lr3*rJ1          ;      // ?????? check sign
 
-  Lr.addMatrixVector(0.0, Lr3, rI2, 1.0); //  T(:,1) += Lr3*rI2 - Lr2*rI3
-  Lr.addMatrixVector(1.0, Lr2, rI3, -1.0);
-
-  for (i = 0; i < 12; i++)
-    T(0, i) += Lr(i);
-
-  Lr.addMatrixVector(0.0, Lr2, rI1, 1.0); //  T(:,2) +=           Lr2*rI1
-
-  for (i = 0; i < 12; i++)
-    T(1, i) += Lr(i);
-
-  Lr.addMatrixVector(0.0, Lr3, rI1, 1.0); //  T(:,3) += Lr3*rI1
-
-  for (i = 0; i < 12; i++)
-    T(2, i) += Lr(i);
-
-  Lr.addMatrixVector(0.0, Lr3, rJ2, 1.0); //  T(:,4) += Lr3*rJ2 - Lr2*rJ3;
-  Lr.addMatrixVector(1.0, Lr2, rJ3, -1.0);
-
-  for (i = 0; i < 12; i++)
-    T(3, i) += Lr(i);
-
-  Lr.addMatrixVector(0.0, Lr2, rJ1, 1.0); //  T(:,5) += Lr2*rJ1
-
-  for (i = 0; i < 12; i++)
-    T(4, i) += Lr(i);
-
-  Lr.addMatrixVector(0.0, Lr3, rJ1, 1.0); //   T(:,6) += Lr3*rJ1
-
-  for (i = 0; i < 12; i++)
-    T(5, i) += Lr(i);
+  for (int i = 0; i < 12; i++)
+    for (int k = 0; k < 3; k++) {
+      T(0, i) += Lr3(i, k) * rI2[k] - Lr2(i, k) * rI3[k];
+      T(1, i) += Lr2(i, k) * rI1[k];
+      T(2, i) += Lr3(i, k) * rI1[k];
+      T(3, i) += Lr3(i, k) * rJ2[k] - Lr2(i, k) * rJ3[k];
+      T(4, i) += Lr2(i, k) * rJ1[k];
+      T(5, i) += Lr3(i, k) * rJ1[k];
+    }
 
-  double c;
-  for (j = 0; j < 6; j++) {
-    c = 2 * cos(ul(j));
+  for (int j = 0; j < 6; j++) {
+    const double c = 2 * cos(ul(j));
 
-    for (i = 0; i < 12; i++)
+    for (int i = 0; i < 12; i++)
       T(j, i) /= c;
   }
 
   // T(:,7) = [-e1' O' e1' O']';
-  for (i = 0; i < 3; i++) {
-    T(6, i)     = -e1(i);
-    T(6, i + 6) = e1(i);
-  }
-}
-
-void
-CorotCrdTransf3d::compTransfMatrixBasicGlobalNew(void)
-{
-  // extract columns of rotation matrices
-  int i, j, k;
-
-  static Vector r1(3), r2(3), r3(3);
-  static Vector e1(3), e2(3), e3(3);
-  static Vector rI1(3), rI2(3), rI3(3);
-  static Vector rJ1(3), rJ2(3), rJ3(3);
-
-  for (k = 0; k < 3; k++) {
-    r1(k) = Rbar(k, 0);
-    r2(k) = Rbar(k, 1);
-    r3(k) = Rbar(k, 2);
-
-    e1(k) = e(k, 0);
-    e2(k) = e(k, 1);
-    e3(k) = e(k, 2);
-
-    rI1(k) = RI(k, 0);
-    rI2(k) = RI(k, 1);
-    rI3(k) = RI(k, 2);
-
-    rJ1(k) = RJ(k, 0);
-    rJ2(k) = RJ(k, 1);
-    rJ3(k) = RJ(k, 2);
-  }
-
-  // compute the transformation matrix from the basic to the
-  // global system
-  static Matrix I(3, 3);
-
-  //   A = (1/Ln)*(I - e1*e1');
-  for (i = 0; i < 3; i++)
-    I(i, i) = 1;
-
-  for (i = 0; i < 3; i++)
-    for (j = 0; j < 3; j++)
-      A(i, j) = (I(i, j) - e1(i) * e1(j)) / Ln;
-
-  Lr2 = this->getLMatrix(r2);
-  Lr3 = this->getLMatrix(r3);
-
-  static Matrix Sr1(3, 3), Sr2(3, 3), Sr3(3, 3);
-  static Vector Se(3), At(3);
-
-  // O = zeros(3,1);
-  // hI1 = [      O', (-S(rI3)*e2 + S(rI2)*e3)',        O', O']';
-  // hI2 = [(A*rI3)', (-S(rI3)*e1 + S(rI1)*e3)', -(A*rI3)', O']';
-  // hI3 = [(A*rI2)', (-S(rI2)*e1 + S(rI1)*e2)', -(A*rI2)', O']';
-  // hJ1 = [      O', O',        O', (-S(rJ3)*e2 + S(rJ2)*e3)']';
-  // hJ2 = [(A*rJ3)', O', -(A*rJ3)', (-S(rJ3)*e1 + S(rJ1)*e3)']';
-  // hJ3 = [(A*rJ2)', O', -(A*rJ2)', (-S(rJ2)*e1 + S(rJ1)*e2)']';
-
-  static Vector hI1(12);
-  static Vector hI2(12);
-  static Vector hI3(12);
-  static Vector hJ1(12);
-  static Vector hJ2(12);
-  static Vector hJ3(12);
-
-  Sr1 = this->getSkewSymMatrix(rI1);
-  Sr2 = this->getSkewSymMatrix(rI2);
-  Sr3 = this->getSkewSymMatrix(rI3);
-
-  // hI1 = [      O', (-S(rI3)*e2 + S(rI2)*e3)',        O', O']';
-  Se.addMatrixVector(0.0, Sr3, e2, -1.0); // (-S(rI3)*e2 + S(rI2)*e3)
-  Se.addMatrixVector(1.0, Sr2, e3, 1.0);
-  for (i = 0; i < 3; i++)
-    hI1(i + 3) = Se(i);
-
-  // hI2 = [(A*rI3)', (-S(rI3)*e1 + S(rI1)*e3)', -(A*rI3)', O']';
-  At.addMatrixVector(0.0, A, rI3, 1.0);
-  Se.addMatrixVector(0.0, Sr3, e1, -1.0); // (-S(rI3)*e1 + S(rI1)*e3)
-  Se.addMatrixVector(1.0, Sr1, e3, 1.0);
-
-  for (i = 0; i < 3; i++) {
-    hI2(i)     = At(i);
-    hI2(i + 3) = Se(i);
-    hI2(i + 6) = -At(i);
-  }
-
-  // hI3 = [(A*rI2)', (-S(rI2)*e1 + S(rI1)*e2)', -(A*rI2)', O']';
-  At.addMatrixVector(0.0, A, rI2, 1.0);
-  Se.addMatrixVector(0.0, Sr2, e1, -1.0); // (-S(rI2)*e1 + S(rI1)*e2)'
-  Se.addMatrixVector(1.0, Sr1, e2, 1.0);
-
-  for (i = 0; i < 3; i++) {
-    hI3(i)     = At(i);
-    hI3(i + 3) = Se(i);
-    hI3(i + 6) = -At(i);
-  }
-
-  Sr1 = this->getSkewSymMatrix(rJ1);
-  Sr2 = this->getSkewSymMatrix(rJ2);
-  Sr3 = this->getSkewSymMatrix(rJ3);
-
-  // hJ1 = [      O', O',        O', (-S(rJ3)*e2 + S(rJ2)*e3)']';
-  Se.addMatrixVector(0.0, Sr3, e2, -1.0); // -S(rJ3)*e2 + S(rJ2)*e3
-  Se.addMatrixVector(1.0, Sr2, e3, 1.0);
-  for (i = 0; i < 3; i++)
-    hJ1(i + 9) = Se(i);
-
-  // hJ2 = [(A*rJ3)', O', -(A*rJ3)', (-S(rJ3)*e1 + S(rJ1)*e3)']';
-  At.addMatrixVector(0.0, A, rJ3, 1.0);
-  Se.addMatrixVector(0.0, Sr3, e1, -1.0); // (-S(rJ3)*e1 + S(rJ1)*e3)
-  Se.addMatrixVector(1.0, Sr1, e3, 1.0);
-
-  for (i = 0; i < 3; i++) {
-    hJ2(i)     = At(i);
-    hJ2(i + 6) = -At(i);
-    hJ2(i + 9) = Se(i);
-  }
-
-  // hJ3 = [(A*rJ2)', O', -(A*rJ2)', (-S(rJ2)*e1 + S(rJ1)*e2)']';
-  At.addMatrixVector(0.0, A, rJ2, 1.0);
-  Se.addMatrixVector(0.0, Sr2, e1, -1.0); // (-S(rJ2)*e1 + S(rJ1)*e2)
-  Se.addMatrixVector(1.0, Sr1, e2, 1.0);
-
-  for (i = 0; i < 3; i++) {
-    hJ3(i)     = At(i);
-    hJ3(i + 6) = -At(i);
-    hJ3(i + 9) = Se(i);
-  }
-
-
-  // f1 =  [-e1' O' e1' O'];
-  // f2  = ( Lr2*rI1 + hI3)'./(2*(cos(thetalI(3))));
-  // f3  = ( Lr2*rJ1 + hJ3)'./(2*(cos(thetalJ(3))));
-  // f4  = (-Lr3*rI1 - hI2)'./(2*(cos(thetalI(2))));
-  // f5  = (-Lr3*rJ1 - hJ2)'./(2*(cos(thetalJ(2))));
-  // f6I = ( Lr3*rI2 - Lr2*rI3 + hI1)'./(2*(cos(thetalI(1))));
-  // f6J = ( Lr3*rJ2 - Lr2*rJ3 + hJ1)'./(2*(cos(thetalJ(1))));
-
-  // F = [f1;
-  //     f2;
-  //     f3;
-  //     f4;
-  //     f5;
-  //     f6J-f6I];
-
-  // T = F'
-  T.Zero();
-  static Vector Lr(12);
-
-  // f1 =  [-e1' O' e1' O'];
-  for (i = 0; i < 3; i++) {
-    T(i, 0)     = -e1(i);
-    T(i + 3, 0) = e1(i);
+  for (int i = 0; i < 3; i++) {
+    T(6, i)     = -e1[i];
+    T(6, i + 6) = e1[i];
   }
-
-  static Vector thetaI(3);
-  static Vector thetaJ(3);
-
-  thetaI(0) = ul(0);
-  thetaI(1) = -ul(2);
-  thetaI(2) = ul(1);
-
-  thetaJ(0) = ul(3);
-  thetaJ(1) = -ul(5);
-  thetaJ(2) = ul(4);
-
-
-  double c;
-
-  // f2  = ( Lr2*rI1 + hI3)'./(2*(cos(thetalI(3))));
-  Lr.addMatrixVector(0.0, Lr2, rI1, 1.0);
-  Lr += hI3;
-  c = 1.0 / (2.0 * cos(thetaI(2)));
-  for (i = 0; i < 12; i++)
-    T(1, i) = Lr(i) * c;
-
-  // f3  = ( Lr2*rJ1 + hJ3)'./(2*(cos(thetalJ(3))));
-  Lr.addMatrixVector(0.0, Lr2, rJ1, 1.0);
-  Lr += hJ3;
-  c = 1.0 / (2.0 * cos(thetaJ(2)));
-  for (i = 0; i < 12; i++)
-    T(2, i) = Lr(i) * c;
-
-  // f4  = (-Lr3*rI1 - hI2)'./(2*(cos(thetalI(2))));
-  Lr.addMatrixVector(0.0, Lr3, rI1, -1.0);
-  Lr -= hI2;
-  c = 1.0 / (2.0 * cos(thetaI(1)));
-  for (i = 0; i < 12; i++)
-    T(3, i) = Lr(i) * c;
-
-  // f5  = (-Lr3*rJ1 - hJ2)'./(2*(cos(thetalJ(2))));
-  Lr.addMatrixVector(0.0, Lr3, rJ1, -1.0);
-  Lr -= hJ2;
-  c = 1.0 / (2.0 * cos(thetaJ(1)));
-  for (i = 0; i < 12; i++)
-    T(4, i) = Lr(i) * c;
-
-  // f6I = ( Lr3*rI2 - Lr2*rI3 + hI1)'./(2*(cos(thetalI(1))));
-  Lr.addMatrixVector(0.0, Lr3, rI2, 1.0);
-  Lr.addMatrixVector(1.0, Lr2, rI3, -1.0);
-  Lr += hI1;
-  c = 1.0 / (2.0 * cos(thetaI(0)));
-  for (i = 0; i < 12; i++)
-    T(5, i) = Lr(i) * c;
-
-  // f6J = ( Lr3*rJ2 - Lr2*rJ3 + hJ1)'./(2*(cos(thetalJ(1))));
-  Lr.addMatrixVector(0.0, Lr3, rJ2, 1.0);
-  Lr.addMatrixVector(1.0, Lr2, rJ3, -1.0);
-  Lr += hJ1;
-  c = 1.0 / (2.0 * cos(thetaI(0)));
-  for (i = 0; i < 12; i++)
-    T(6, i) -= Lr(i) * c;
 }
 
 void
@@ -947,7 +604,7 @@ CorotCrdTransf3d::compTransfMatrixBasicLocal(Matrix &Tbl)
 
   // first get transformation matrix from basic to global
   static Matrix Tbg(6, 12);
-  Tbg.addMatrixProduct(0.0, Tp, T, 1.0);
+  Tbg.addMatrixProduct(0.0, Tp, Matrix(&T(0, 0), 7, 12), 1.0);
 
   // get inverse of transformation matrix from local to global
   this->compTransfMatrixLocalGlobal(Tlg);
@@ -1024,23 +681,28 @@ CorotCrdTransf3d::getBasicTrialAccel(void)
 const Vector &
 CorotCrdTransf3d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
 {
-  this->update();
+  // T and the triads are those of the last update(), unless the nodes
+  // have moved since
+  this->updateIfMoved();
 
   static Vector pg(12);
-  pg.Zero();
 
-  // if there are no element loads present
-  if (p0 == 0.0) {
-    // transform resisting forces from the basic system to local coordinates
-    static Vector pl(7);
-    pl.addMatrixTransposeVector(0.0, Tp, pb, 1.0); // pl = Tp ^ pb;
-
-    // transform resisting forces from local to global coordinates
-    pg.addMatrixTransposeVector(0.0, T, pl, 1.0); // pg = T ^ pl; residual
+  // transform resisting forces from the basic system to local coordinates
+  VectorND<7> pl{};
+  for (int a = 0; a < 7; a++)
+    for (int i = 0; i < 6; i++)
+      pl[a] += Tp(i, a) * pb(i); // pl = Tp ^ pb;
+
+  // transform resisting forces from local to global coordinates
+  for (int i = 0; i < 12; i++) {
+    double sum = 0.0;
+    for (int k = 0; k < 7; k++)
+      sum += T(k, i) * pl[k];
+    pg(i) = sum; // pg = T ^ pl; residual
   }
 
   // if there are element loads present
-  else {
+  if (p0 != 0.0) {
     // SLOWER!!!! THIS IS SAME APPROACH AS 2D CASE
     // ===========================================
     /* transform resisting forces from the basic system to local coordinates
@@ -1061,13 +723,6 @@ CorotCrdTransf3d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
 
     // FASTER!!!! TRANSFORM REACTIONS AND ADD AT END
     // =============================================
-    // transform resisting forces from the basic system to local coordinates
-    static Vector pl(7);
-    pl.addMatrixTransposeVector(0.0, Tp, pb, 1.0); // pl = Tp ^ pb;
-
-    // transform resisting forces from local to global coordinates
-    pg.addMatrixTransposeVector(0.0, T, pl, 1.0); // pg = T ^ pl; residual
-
     // add end forces due to element p0 loads
     // assuming member loads are in local system
     static Vector pl0(12), pg0(12);
@@ -1088,52 +743,41 @@ CorotCrdTransf3d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
 const Matrix &
 CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
 {
-  this->update();
-
-  int i, j, k;
-  // transform tangent stiffness matrix from the basic system to local coordinates
-  static Matrix kl(7, 7);
-  kl.addMatrixTripleProduct(0.0, Tp, kb, 1.0); // kl = Tp ^ kb * Tp;
-
-
-  // transform resisting forces from the basic system to local coordinates
-  static Vector pl(7);
-  pl.addMatrixTransposeVector(0.0, Tp, pb, 1.0); // pl = Tp ^ pb;
-
-  // transform tangent  stiffness matrix from local to global coordinates
-  //static Matrix kg(12,12);
+  // T and the triads are those of the last update(), unless the nodes
+  // have moved since
+  this->updateIfMoved();
+
+  // transform tangent stiffness matrix and resisting forces from the
+  // basic system to local coordinates
+  //   kl = Tp ^ kb * Tp;
+  //   pl = Tp ^ pb;
+  MatrixND<7,7> kl{};
+  VectorND<7>   pl{};
+  for (int a = 0; a < 7; a++)
+    for (int i = 0; i < 6; i++) {
+      const double tia = Tp(i, a);
+      if (tia == 0.0)
+        continue;
+      pl[a] += tia * pb(i);
+      for (int b = 0; b < 7; b++)
+        for (int j = 0; j < 6; j++)
+          kl(a, b) += tia * kb(i, j) * Tp(j, b);
+    }
 
   // compute the tangent stiffness matrix in global coordinates
-  kg.addMatrixTripleProduct(0.0, T, kl, 1.0);
+  MatrixND<12,12> K;
+  K.addMatrixTripleProduct(0.0, T, kl, 1.0);
 
-  static Vector m(6);
-  for (i = 0; i < 6; i++)
-    m(i) = pl(i) / (2 * cos(ul(i)));
+  VectorND<6> m;
+  for (int i = 0; i < 6; i++)
+    m[i] = pl[i] / (2 * cos(ul(i)));
 
   // compute the basic rotations
-
-  static Vector e1(3), e2(3), e3(3);
-  static Vector r1(3), r2(3), r3(3);
-  static Vector rI1(3), rI2(3), rI3(3);
-  static Vector rJ1(3), rJ2(3), rJ3(3);
-
-  for (k = 0; k < 3; k++) {
-    e1(k) = e(k, 0);
-    e2(k) = e(k, 1);
-    e3(k) = e(k, 2);
-
-    r1(k) = Rbar(k, 0);
-    r2(k) = Rbar(k, 1);
-    r3(k) = Rbar(k, 2);
-
-    rI1(k) = RI(k, 0);
-    rI2(k) = RI(k, 1);
-    rI3(k) = RI(k, 2);
-
-    rJ1(k) = RJ(k, 0);
-    rJ2(k) = RJ(k, 1);
-    rJ3(k) = RJ(k, 2);
-  }
+  const Triad E{e}, r{Rbar}, tI{RI}, tJ{RJ};
+  const Vector3D &e1  = E[1],  &e2  = E[2],  &e3  = E[3],
+                 &r2  = r[2],  &r3  = r[3],
+                 &rI1 = tI[1], &rI2 = tI[2], &rI3 = tI[3],
+                 &rJ1 = tJ[1], &rJ2 = tJ[2], &rJ3 = tJ[3];
 
   //   ks = t'*kl*t + ks1 + t * diag (m .* tan(thetal))*t' + ...
   //        m(4)*(ks2r2t3_u3 + ks2r3u2_t2) + ...
@@ -1141,21 +785,9 @@ CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
   //        m(5)*ks2r2u1 + m(6)*ks2r3u1 + ...
   //        ks3 + ks3' + ks4 + ks5;
 
-  static Matrix Se1(3, 3), Se2(3, 3), Se3(3, 3);
-  static Matrix SrI1(3, 3), SrI2(3, 3), SrI3(3, 3);
-  static Matrix SrJ1(3, 3), SrJ2(3, 3), SrJ3(3, 3);
-
-  Se1 = this->getSkewSymMatrix(e1);
-  Se2 = this->getSkewSymMatrix(e2);
-  Se3 = this->getSkewSymMatrix(e3);
-
-  SrJ1 = this->getSkewSymMatrix(rJ1);
-  SrJ2 = this->getSkewSymMatrix(rJ2);
-  SrJ3 = this->getSkewSymMatrix(rJ3);
-
-  SrI1 = this->getSkewSymMatrix(rI1);
-  SrI2 = this->getSkewSymMatrix(rI2);
-  SrI3 = this->getSkewSymMatrix(rI3);
+  const Matrix3D Se1  = Hat(e1),  Se2  = Hat(e2),  Se3  = Hat(e3),
+                 SrI1 = Hat(rI1), SrI2 = Hat(rI2), SrI3 = Hat(rI3),
+                 SrJ1 = Hat(rJ1), SrJ2 = Hat(rJ2), SrJ3 = Hat(rJ3);
 
   // ksigma1 -------------------------------
   //   ks1_11 =  a*pl(6);
@@ -1164,12 +796,10 @@ CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
   //          -ks1_11  o   ks1_11  o;
   //             o     o      o    o];
 
-  double factor;
-
-  kg.Assemble(A, 0, 0, pl(6));
-  kg.Assemble(A, 0, 6, -pl(6));
-  kg.Assemble(A, 6, 0, -pl(6));
-  kg.Assemble(A, 6, 6, pl(6));
+  K.assemble(A, 0, 0,  pl[6]);
+  K.assemble(A, 0, 6, -pl[6]);
+  K.assemble(A, 6, 0, -pl[6]);
+  K.assemble(A, 6, 6,  pl[6]);
 
 
   // ksigma3 -------------------------------
@@ -1181,34 +811,19 @@ CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
 
   //     ks3 = [o kbar2 o kbar4];
 
-  static Matrix Sm(3, 3);
-  static Matrix kbar(12, 3);
+  MatrixND<12,3> kbar{};
+  kbar.addMatrixProduct(Lr2, SrI3 * m[3] + SrI1 * m[1], -1.0);
+  kbar.addMatrixProduct(Lr3, SrI2 * m[3] - SrI1 * m[2],  1.0);
 
-  Sm.addMatrix(0.0, SrI3, m(3));
-  Sm.addMatrix(1.0, SrI1, m(1));
+  K.assemble(kbar, 0, 3, 1.0);
+  K.assembleTranspose(kbar, 3, 0, 1.0);
 
-  kbar.addMatrixProduct(0.0, Lr2, Sm, -1.0);
+  kbar.zero();
+  kbar.addMatrixProduct(Lr2, SrJ3 * m[3] - SrJ1 * m[4],  1.0);
+  kbar.addMatrixProduct(Lr3, SrJ2 * m[3] + SrJ1 * m[5], -1.0);
 
-  Sm.addMatrix(0.0, SrI2, m(3));
-  Sm.addMatrix(1.0, SrI1, -m(2));
-
-  kbar.addMatrixProduct(1.0, Lr3, Sm, 1.0);
-
-  kg.Assemble(kbar, 0, 3, 1.0);
-  kg.AssembleTranspose(kbar, 3, 0, 1.0);
-
-  Sm.addMatrix(0.0, SrJ3, m(3));
-  Sm.addMatrix(1.0, SrJ1, -m(4));
-
-  kbar.addMatrixProduct(0.0, Lr2, Sm, 1.0);
-
-  Sm.addMatrix(0.0, SrJ2, m(3));
-  Sm.addMatrix(1.0, SrJ1, m(5));
-
-  kbar.addMatrixProduct(1.0, Lr3, Sm, -1.0);
-
-  kg.Assemble(kbar, 0, 9, 1.0);
-  kg.AssembleTranspose(kbar, 9, 0, 1.0);
+  K.assemble(kbar, 0, 9, 1.0);
+  K.assembleTranspose(kbar, 9, 0, 1.0);
 
 
   // Ksigma4 -------------------------------
@@ -1225,29 +840,19 @@ CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
   //           O    O     O    O;
   //           O    O     O  Ks4_44];
 
-  static Matrix ks33(3, 3);
-
-  ks33.addMatrixProduct(0.0, Se2, SrI3, m(3));
-  ks33.addMatrixProduct(1.0, Se3, SrI2, -m(3));
-
-  ks33.addMatrixProduct(1.0, Se2, SrI1, m(1));
-  ks33.addMatrixProduct(1.0, Se1, SrI2, -m(1));
-
-  ks33.addMatrixProduct(1.0, Se3, SrI1, m(2));
-  ks33.addMatrixProduct(1.0, Se1, SrI3, -m(2));
+  Matrix3D ks33;
 
-  kg.Assemble(ks33, 3, 3, 1.0);
+  ks33 = (Se2 * SrI3 - Se3 * SrI2) * m[3]
+       + (Se2 * SrI1 - Se1 * SrI2) * m[1]
+       + (Se3 * SrI1 - Se1 * SrI3) * m[2];
 
-  ks33.addMatrixProduct(0.0, Se2, SrJ3, -m(3));
-  ks33.addMatrixProduct(1.0, Se3, SrJ2, m(3));
+  K.assemble(ks33, 3, 3, 1.0);
 
-  ks33.addMatrixProduct(1.0, Se2, SrJ1, m(4));
-  ks33.addMatrixProduct(1.0, Se1, SrJ2, -m(4));
+  ks33 = (Se3 * SrJ2 - Se2 * SrJ3) * m[3]
+       + (Se2 * SrJ1 - Se1 * SrJ2) * m[4]
+       + (Se3 * SrJ1 - Se1 * SrJ3) * m[5];
 
-  ks33.addMatrixProduct(1.0, Se3, SrJ1, m(5));
-  ks33.addMatrixProduct(1.0, Se1, SrJ3, -m(5));
-
-  kg.Assemble(ks33, 9, 9, 1.0);
+  K.assemble(ks33, 9, 9, 1.0);
 
 
   // Ksigma5 -------------------------------
@@ -1258,88 +863,63 @@ CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
   //          Ks5_14t     O   -Ks5_14t   O];
 
   // v = (1/Ln)*(m(2)*rI2 + m(3)*rI3 + m(5)*rJ2 + m(6)*rJ3);
-  static Vector v(3);
-  v.addVector(0.0, rI2, m(1));
-  v.addVector(1.0, rI3, m(2));
-  v.addVector(1.0, rJ2, m(4));
-  v.addVector(1.0, rJ3, m(5));
-
-  v /= Ln;
+  const Vector3D v = (rI2 * m[1] + rI3 * m[2] + rJ2 * m[4] + rJ3 * m[5]) / Ln;
 
   //Ks5_11 = A*v*e1' + e1*v'*A + (e1'*v)*A;
-  static Matrix m33(3, 3);
-  double e1tv = 0; // dot product e1. v
-
-  for (i = 0; i < 3; i++)
-    e1tv += e1(i) * v(i);
-
-  ks33.addMatrix(0.0, A, e1tv);
-
-  for (i = 0; i < 3; i++)
-    for (j = 0; j < 3; j++)
-      m33(i, j) = v(i) * e1(j);
-
-  ks33.addMatrixProduct(1.0, A, m33, 1.0);
-
-  for (i = 0; i < 3; i++)
-    for (j = 0; j < 3; j++)
-      m33(i, j) = e1(i) * v(j);
+  ks33 = A * e1.dot(v);
+  ks33.addMatrixProduct(A, v.bun(e1), 1.0);
+  ks33.addMatrixProduct(e1.bun(v), A, 1.0);
 
-  ks33.addMatrixProduct(1.0, m33, A, 1.0);
-
-  kg.Assemble(ks33, 0, 0, 1.0);
-  kg.Assemble(ks33, 0, 6, -1.0);
-  kg.Assemble(ks33, 6, 0, -1.0);
-  kg.Assemble(ks33, 6, 6, 1.0);
+  K.assemble(ks33, 0, 0,  1.0);
+  K.assemble(ks33, 0, 6, -1.0);
+  K.assemble(ks33, 6, 0, -1.0);
+  K.assemble(ks33, 6, 6,  1.0);
 
   //Ks5_12 = -(m(2)*A*S(rI2) + m(3)*A*S(rI3));
+  ks33.zero();
+  ks33.addMatrixProduct(A, SrI2, -m[1]);
+  ks33.addMatrixProduct(A, SrI3, -m[2]);
 
-  ks33.addMatrixProduct(0.0, A, SrI2, -m(1));
-  ks33.addMatrixProduct(1.0, A, SrI3, -m(2));
-
-  kg.Assemble(ks33, 0, 3, 1.0);
-  kg.Assemble(ks33, 6, 3, -1.0);
+  K.assemble(ks33, 0, 3,  1.0);
+  K.assemble(ks33, 6, 3, -1.0);
 
-  kg.AssembleTranspose(ks33, 3, 0, 1.0);
-  kg.AssembleTranspose(ks33, 3, 6, -1.0);
+  K.assembleTranspose(ks33, 3, 0,  1.0);
+  K.assembleTranspose(ks33, 3, 6, -1.0);
 
   //  Ks5_14 = -(m(5)*A*S(rJ2) + m(6)*A*S(rJ3));
+  ks33.zero();
+  ks33.addMatrixProduct(A, SrJ2, -m[4]);
+  ks33.addMatrixProduct(A, SrJ3, -m[5]);
 
-  ks33.addMatrixProduct(0.0, A, SrJ2, -m(4));
-  ks33.addMatrixProduct(1.0, A, SrJ3, -m(5));
-
-  kg.Assemble(ks33, 0, 9, 1.0);
-  kg.Assemble(ks33, 6, 9, -1.0);
+  K.assemble(ks33, 0, 9,  1.0);
+  K.assemble(ks33, 6, 9, -1.0);
 
-  kg.AssembleTranspose(ks33, 9, 0, 1.0);
-  kg.AssembleTranspose(ks33, 9, 6, -1.0);
+  K.assembleTranspose(ks33, 9, 0,  1.0);
+  K.assembleTranspose(ks33, 9, 6, -1.0);
 
 
   // Ksigma -------------------------------
-  static Vector rm(3);
-
-  rm = rI3;
-  rm.addVector(1.0, rJ3, -1.0);
-  kg.addMatrix(1.0, this->getKs2Matrix(r2, rm), m(3));
-
-  rm = rJ2;
-  rm.addVector(1.0, rI2, -1.0);
-  kg.addMatrix(1.0, this->getKs2Matrix(r3, rm), m(3));
-  kg.addMatrix(1.0, this->getKs2Matrix(r2, rI1), m(1));
-  kg.addMatrix(1.0, this->getKs2Matrix(r3, rI1), m(2));
-  kg.addMatrix(1.0, this->getKs2Matrix(r2, rJ1), m(4));
-  kg.addMatrix(1.0, this->getKs2Matrix(r3, rJ1), m(5));
+  this->addKs2Matrix(K, r2, rI3 - rJ3, m[3]);
+  this->addKs2Matrix(K, r3, rJ2 - rI2, m[3]);
+  this->addKs2Matrix(K, r2, rI1, m[1]);
+  this->addKs2Matrix(K, r3, rI1, m[2]);
+  this->addKs2Matrix(K, r2, rJ1, m[4]);
+  this->addKs2Matrix(K, r3, rJ1, m[5]);
 
 
   //  T * diag (M .* tan(thetal))*T'
 
-  for (k = 0; k < 6; k++) {
-    factor = pl(k) * tan(ul(k));
-    for (i = 0; i < 12; i++)
-      for (j = 0; j < 12; j++)
-        kg(i, j) += T(k, i) * factor * T(k, j);
+  for (int k = 0; k < 6; k++) {
+    const double factor = pl[k] * tan(ul(k));
+    for (int i = 0; i < 12; i++)
+      for (int j = 0; j < 12; j++)
+        K(i, j) += T(k, i) * factor * T(k, j);
   }
-  
+
+  for (int j = 0; j < 12; j++)
+    for (int i = 0; i < 12; i++)
+      kg(i, j) = K(i, j);
+
   return kg;
 }
 
@@ -1354,7 +934,8 @@ CorotCrdTransf3d::getInitialGlobalStiffMatrix(const Matrix &kb)
   //static Matrix kg(12,12);
 
   // compute the tangent stiffness matrix in global coordinates
-  kg.addMatrixTripleProduct(0.0, T, kl, 1.0);
+  const Matrix Tg(&T(0, 0), 7, 12);
+  kg.addMatrixTripleProduct(0.0, Tg, kl, 1.0);
 
   return kg;
 }
@@ -1501,232 +1082,50 @@ CorotCrdTransf3d::getQuaternionFromRotMatrix(const Matrix &R) const
   return q;
 }
 
-const Vector &
-CorotCrdTransf3d::getQuaternionFromPseudoRotVector(const Vector &theta) const
-{
-  double t; // norm of the pseudo rotation vector
-  double factor;
-  static Vector q(4); // normalized quaternion
-
-  t = theta.Norm();
-
-  if (t == 0)
-    q.Zero();
-  else {
-    factor = sin(t * 0.5) / t;
-    for (int i = 0; i < 3; i++)
-      q(i) = theta(i) * factor;
-  }
-
-  q(3) = cos(t * 0.5);
-
-  return q;
-}
-
-const Vector &
-CorotCrdTransf3d::quaternionProduct(const Vector &q1, const Vector &q2) const
-{
-
-  static Vector q12(4);
-  int i;
-  double q1Tq2 = 0;       // dot product
-  static Vector q1xq2(3); // cross product
-
-  // calculate the dot product q1.q2
-  for (i = 0; i < 3; i++) // NOTE i <3, not i<4
-    q1Tq2 += q1(i) * q2(i);
-
-  // calculate the cross-product q1 x q2
-  q1xq2(0) = q1(1) * q2(2) - q1(2) * q2(1);
-  q1xq2(1) = q1(2) * q2(0) - q1(0) * q2(2);
-  q1xq2(2) = q1(0) * q2(1) - q1(1) * q2(0);
-
-  // calculate the quaternion product
-  for (i = 0; i < 3; i++)
-    q12(i) = q1(3) * q2(i) + q2(3) * q1(i) - q1xq2(i);
-
-  q12(3) = q1(3) * q2(3) - q1Tq2;
-
-  return q12;
-}
-
-const Matrix &
-CorotCrdTransf3d::getRotationMatrixFromQuaternion(const Vector &q) const
-{
-  int i, j;
-  double factor;
-  static Matrix I(3, 3); // identity matrix
-  static Matrix qqT(3, 3);
-  static Matrix S(3, 3);
-  static Matrix R(3, 3);
-
-  // R = (q0^2 - q' * q) * I + 2 * q * q' + 2*q0*S(q);
-
-  factor = q(3) * q(3) - (q(0) * q(0) + q(1) * q(1) + q(2) * q(2));
-
-  for (i = 0; i < 3; i++)
-    for (j = 0; j < 3; j++)
-      qqT(i, j) = q(i) * q(j);
-
-  // get skew symmetric matrix
-  S = this->getSkewSymMatrix(q);
-
-  R.Zero();
-
-  for (i = 0; i < 3; i++)
-    R(i, i) = factor;
-
-  R.addMatrix(1.0, qqT, 2.0);
-  R.addMatrix(1.0, S, 2.0 * q(3));
-
-  return R;
-}
-
-const Vector &
-CorotCrdTransf3d::getTangScaledPseudoVectorFromQuaternion(const Vector &q) const
-{
-  static Vector w(3);
-
-  for (int i = 0; i < 3; i++)
-    w(i) = 2.0 * q(i) / q(3);
-
-  return w;
-}
-
-const Matrix &
-CorotCrdTransf3d::getRotMatrixFromTangScaledPseudoVector(const Vector &w) const
-{
-  // Rotation matrix in terms of the tangent-scaled pseudo-vector
-  static Matrix S(3, 3);
-  static Matrix S2(3, 3);
-  static Matrix R(3, 3);
-  double normw2;
-
-  S = this->getSkewSymMatrix(w);
-
-  // R = I + (S + S*S/2)/(1 + w' * w / 4);
-
-  R.Zero();
-
-  for (int i = 0; i < 3; i++)
-    R(i, i) = 1;
-
-  S2 = S;
-  S2.addMatrixProduct(1.0, S, S, 0.5);
-
-  normw2 = w ^ w;
-
-  R.addMatrix(1.0, S2, 1.0 / (1 + normw2 / 4.0));
-
-  return R;
-}
-
-const Matrix &
-CorotCrdTransf3d::getSkewSymMatrix(const Vector &theta) const
-{
-  static Matrix S(3, 3);
-
-  //  St = [   0       -theta(2)  theta(1);
-  //         theta(2)     0      -theta(0);
-  //        -theta(1)   theta(0)      0   ];
-
-  S(0, 0) = 0.0;
-  S(0, 1) = -theta(2);
-  S(0, 2) = theta(1);
-
-  S(1, 0) = theta(2);
-  S(1, 1) = 0.0;
-  S(1, 2) = -theta(0);
-
-  S(2, 0) = -theta(1);
-  S(2, 1) = theta(0);
-  S(2, 2) = 0.0;
-
-  //opserr << "getSkew  theta: " << theta;
-  //opserr << "getSkew  S: " << S;
-
-  return S;
-}
-
-const Matrix &
-CorotCrdTransf3d::getLMatrix(const Vector &ri) const
+void
+CorotCrdTransf3d::getLMatrix(const Vector3D &ri, MatrixND<12,3> &L) const
 {
-  static Matrix L1(3, 3), L2(3, 3);
-  static Vector r1(3), e1(3);
-  double rie1, e1r1k;
-  static Matrix rie1r1(3, 3);
-  static Matrix e1e1r1(3, 3);
-  static Matrix Sri(3, 3);
-  static Matrix Sr1(3, 3);
-  static Matrix L(12, 3);
-
-  int j, k;
-
-  for (j = 0; j < 3; j++) {
-    e1(j) = e(j, 0);
-    r1(j) = Rbar(j, 0);
-  }
+  const Vector3D e1{e(0, 0), e(1, 0), e(2, 0)};
+  const Vector3D r1{Rbar(0, 0), Rbar(1, 0), Rbar(2, 0)};
 
-  rie1 = ri ^ e1;
+  const double rie1 = ri.dot(e1);
 
-  //opserr << "rie1: " << rie1 << endln;
-
-  for (k = 0; k < 3; k++) {
-    e1r1k = (e1(k) + r1(k));
-    for (j = 0; j < 3; j++) {
-      rie1r1(j, k) = ri(j) * e1r1k;
-      e1e1r1(j, k) = e1(j) * e1r1k;
+  Matrix3D rie1r1, e1e1r1;
+  for (int k = 0; k < 3; k++) {
+    const double e1r1k = (e1[k] + r1[k]);
+    for (int j = 0; j < 3; j++) {
+      rie1r1(j, k) = ri[j] * e1r1k;
+      e1e1r1(j, k) = e1[j] * e1r1k;
     }
   }
 
-  //opserr << "rie1r1: " << rie1r1;
-
-  //opserr << "e1e1r1: " << e1e1r1;
-
   //L1  = ri'*e1 * A/2 + A*ri*(e1 + r1)'/2;
-
-  L1.addMatrix(0.0, A, rie1 * 0.5);
-  L1.addMatrixProduct(1.0, A, rie1r1, 0.5);
-
-  //opserr << "L1: " << L1;
-
-  Sri = this->getSkewSymMatrix(ri); // Change ??????????????????????
-  Sr1 = this->getSkewSymMatrix(r1); // Change ??????????????????????
+  Matrix3D L1 = A * (rie1 * 0.5);
+  L1.addMatrixProduct(A, rie1r1, 0.5);
 
   // L2  = Sri/2 - ri'*e1*S(r1)/4 - Sri*e1*(e1 + r1)'/4;
-  L2.addMatrix(0.0, Sri, 0.5);
-  L2.addMatrix(1.0, Sr1, -rie1 / 4.0);
-  L2.addMatrixProduct(1.0, Sri, e1e1r1, -0.25);
-
-  //opserr << "L2: " << L2;
+  Matrix3D L2{};
+  L2.addSpin(ri, 0.5);
+  L2.addSpin(r1, -rie1 / 4.0);
+  L2.addSpinMatrixProduct(ri, e1e1r1, -0.25);
 
   // L = [L1
   //      L2
   //     -L1
   //      L2 ;
 
-  L.Zero();
-  L.Assemble(L1, 0, 0, 1.0);
-  L.Assemble(L2, 3, 0, 1.0);
-  L.Assemble(L1, 6, 0, -1.0);
-  L.Assemble(L2, 9, 0, 1.0);
-
-  //opserr << "L: " << L;
-
-  return L;
+  L.zero();
+  L.assemble(L1, 0, 0, 1.0);
+  L.assemble(L2, 3, 0, 1.0);
+  L.assemble(L1, 6, 0, -1.0);
+  L.assemble(L2, 9, 0, 1.0);
 }
 
-const Matrix &
-CorotCrdTransf3d::getKs2Matrix(const Vector &ri, const Vector &z) const
+void
+CorotCrdTransf3d::addKs2Matrix(MatrixND<12,12> &K, const Vector3D &ri, const Vector3D &z, double scale) const
 {
-  static Matrix ks2(12, 12);
-  static Vector e1(3), r1(3);
-
-  //opserr << "\ngetKs2Matrix:\n";
-  //opserr << "ri: " << ri;
-
-  //opserr << "z: " << z;
-
+  // K += scale*Ksigma2, where
+  //
   //  Ksigma2 = [ K11   K12 -K11   K12;
   //              K12t  K22 -K12t  K22;
   //             -K11  -K12  K11  -K12;
@@ -1735,133 +1134,60 @@ CorotCrdTransf3d::getKs2Matrix(const Vector &ri, const Vector &z) const
   // U = (-1/2)*A*z*ri'*A + ri'*e1*A*z*e1'/(2*Ln)+...
   //      z'*(e1+r1)*A*ri*e1'/(2*Ln);
 
-  int i, j;
-  double rite1 = 0; // dot product ri . e1
-  double zte1  = 0; // dot product z  . e1
-  double ztr1  = 0; // dot product z  . r1
-
-  for (i = 0; i < 3; i++) {
-    e1(i) = e(i, 0);
-    r1(i) = Rbar(i, 0);
-    rite1 += ri(i) * e1(i);
-    zte1 += z(i) * e1(i);
-    ztr1 += z(i) * r1(i);
-  }
-
-  static Matrix zrit(3, 3), ze1t(3, 3);
-  static Matrix rizt(3, 3), r1e1t(3, 3), rie1t(3, 3);
-  static Matrix e1zt(3, 3);
-
-  for (i = 0; i < 3; i++)
-    for (j = 0; j < 3; j++) {
-      zrit(i, j)  = z(i) * ri(j);
-      rizt(i, j)  = ri(i) * z(j);
-      ze1t(i, j)  = z(i) * e1(j);
-      e1zt(i, j)  = e1(i) * z(j);
-      r1e1t(i, j) = r1(i) * e1(j);
-      rie1t(i, j) = ri(i) * e1(j);
-    }
-
-  static Matrix U(3, 3);
-  //opserr << " rite1: "<< rite1;
-  //opserr << " zte1: "<< zte1;
-  //opserr << " ztr1: "<< ztr1;
-
-  //opserr << " A: "<< A;
-  //opserr << " zrit: "<< zrit;
-  //opserr << " ze1t: "<< ze1t;
-  //opserr << " rie1t: "<< rie1t;
-
-  //opserr << " Ln: "<< Ln;
+  const Vector3D e1{e(0, 0), e(1, 0), e(2, 0)};
+  const Vector3D r1{Rbar(0, 0), Rbar(1, 0), Rbar(2, 0)};
 
-  U.addMatrixTripleProduct(0.0, A, zrit, -0.5);
+  const double rite1 = ri.dot(e1); // dot product ri . e1
+  const double zte1  = z.dot(e1);  // dot product z  . e1
+  const double ztr1  = z.dot(r1);  // dot product z  . r1
 
-  //opserr << "U: A*zrit*zrit " << U;
-  U.addMatrixProduct(1.0, A, ze1t, rite1 / (2 * Ln));
-  //opserr << "U: A*ze1t*rite1/(2*Ln) " << U;
-  U.addMatrixProduct(1.0, A, rie1t, (zte1 + ztr1) / (2 * Ln));
+  const Matrix3D zrit  = z.bun(ri),
+                 rizt  = ri.bun(z),
+                 ze1t  = z.bun(e1),
+                 e1zt  = e1.bun(z),
+                 rie1t = ri.bun(e1);
 
-  //opserr << "U: " << U;
-  static Matrix ks(3, 3);
+  Matrix3D U = A * zrit * A * (-0.5);
+  U.addMatrixProduct(A, ze1t, rite1 / (2 * Ln));
+  U.addMatrixProduct(A, rie1t, (zte1 + ztr1) / (2 * Ln));
 
   //K11 = U + U' + ri'*e1*(2*(e1'*z)+z'*r1)*A/(2*Ln);
+  Matrix3D ks = U + U.transpose() + A * (rite1 * (2 * zte1 + ztr1) / (2 * Ln));
 
-  ks.addMatrix(0.0, U, 1.0);
-
-  // add matrix U transpose
-  for (i = 0; i < 3; i++)
-    for (j = 0; j < 3; j++)
-      ks(i, j) += U(j, i);
-
-  ks.addMatrix(1.0, A, rite1 * (2 * zte1 + ztr1) / (2 * Ln));
-
-  //opserr << "Ks211: " << ks;
-
-  ks2.Zero();
+  K.assemble(ks, 0, 0,  scale);
+  K.assemble(ks, 0, 6, -scale);
+  K.assemble(ks, 6, 0, -scale);
+  K.assemble(ks, 6, 6,  scale);
 
-  ks2.Assemble(ks, 0, 0, 1.0);
-  ks2.Assemble(ks, 0, 6, -1.0);
-  ks2.Assemble(ks, 6, 0, -1.0);
-  ks2.Assemble(ks, 6, 6, 1.0);
-
-  static Matrix Sri(3, 3), Sr1(3, 3), Sz(3, 3), Se1(3, 3);
-
-  Sri = this->getSkewSymMatrix(ri);
-  Sr1 = this->getSkewSymMatrix(r1);
-  Sz  = this->getSkewSymMatrix(z);
-  Se1 = this->getSkewSymMatrix(e1);
+  const Matrix3D Sri = Hat(ri), Sr1 = Hat(r1), Sz = Hat(z), Se1 = Hat(e1);
 
   //K12 = (1/4)*(-A*z*e1'*Sri - A*ri*z'*Sr1 - z'*(e1+r1)*A*Sri);
+  ks = A * ze1t * Sri * (-0.25)
+     - A * rizt * Sr1 * 0.25
+     - A * Sri * (0.25 * (zte1 + ztr1));
 
-  static Matrix m1(3, 3);
-
-  m1.addMatrixProduct(0.0, A, ze1t, -1.0);
-  ks.addMatrixProduct(0.0, m1, Sri, 0.25);
-
-  m1.addMatrixProduct(0.0, A, rizt, -1.0);
-  ks.addMatrixProduct(1.0, m1, Sr1, 0.25);
-
-  ks.addMatrixProduct(1.0, A, Sri, -0.25 * (zte1 + ztr1));
+  K.assemble(ks, 0, 3,  scale);
+  K.assemble(ks, 0, 9,  scale);
+  K.assemble(ks, 6, 3, -scale);
+  K.assemble(ks, 6, 9, -scale);
 
-  //opserr << "Ks2_12: " << ks;
-
-  ks2.Assemble(ks, 0, 3, 1.0);
-  ks2.Assemble(ks, 0, 9, 1.0);
-  ks2.Assemble(ks, 6, 3, -1.0);
-  ks2.Assemble(ks, 6, 9, -1.0);
-
-  ks2.AssembleTranspose(ks, 3, 0, 1.0);
-  ks2.AssembleTranspose(ks, 3, 6, -1.0);
-  ks2.AssembleTranspose(ks, 9, 0, 1.0);
-  ks2.AssembleTranspose(ks, 9, 6, -1.0);
+  K.assembleTranspose(ks, 3, 0,  scale);
+  K.assembleTranspose(ks, 3, 6, -scale);
+  K.assembleTranspose(ks, 9, 0,  scale);
+  K.assembleTranspose(ks, 9, 6, -scale);
 
   //K22 = (1/8)*((-ri'*e1)*Sz*Sr1 + Sr1*z*e1'*Sri + ...
   //      Sri*e1*z'*Sr1 - (e1+r1)'*z*S(e1)*Sri + 2*Sz*Sri);
-
-  ks.addMatrixProduct(0.0, Sz, Sr1, -0.125 * (rite1));
-
-  m1.addMatrixProduct(0.0, Sr1, ze1t, 1.0);
-  ks.addMatrixProduct(1.0, m1, Sri, 0.125);
-
-  m1.addMatrixProduct(0.0, Sri, e1zt, 1.0);
-  ks.addMatrixProduct(1.0, m1, Sr1, 0.125);
-
-  ks.addMatrixProduct(1.0, Se1, Sri, -0.125 * (zte1 + ztr1));
-  ks.addMatrixProduct(1.0, Sz, Sri, 0.25);
-
-  //opserr << "Ks2_22: " << ks;
-
-  //  Ksigma2 = [ K11   K12 -K11   K12;
-  //              K12t  K22 -K12t  K22;
-  //             -K11  -K12  K11  -K12;
-  //              K12t  K22 -K12t  K22];
-
-  ks2.Assemble(ks, 3, 3, 1.0);
-  ks2.Assemble(ks, 3, 9, 1.0);
-  ks2.Assemble(ks, 9, 3, 1.0);
-  ks2.Assemble(ks, 9, 9, 1.0);
-
-  return ks2;
+  ks = Sz * Sr1 * (-0.125 * rite1)
+     + Sr1 * ze1t * Sri * 0.125
+     + Sri * e1zt * Sr1 * 0.125
+     - Se1 * Sri * (0.125 * (zte1 + ztr1))
+     + Sz * Sri * 0.25;
+
+  K.assemble(ks, 3, 3, scale);
+  K.assemble(ks, 3, 9, scale);
+  K.assemble(ks, 9, 3, scale);
+  K.assemble(ks, 9, 9, scale);
 }
 
 FrameTransform3d *
@@ -1882,8 +1208,20 @@ CorotCrdTransf3d::getCopy()
   theCopy->alphaJq       = alphaJq;
   theCopy->alphaIqcommit = alphaIqcommit;
   theCopy->alphaJqcommit = alphaJqcommit;
+  theCopy->alphaI        = alphaI;
+  theCopy->alphaJ        = alphaJ;
   theCopy->ul            = ul;
   theCopy->ulcommit      = ulcommit;
+  theCopy->ulpr          = ulpr;
+  theCopy->RI            = RI;
+  theCopy->RJ            = RJ;
+  theCopy->Rbar          = Rbar;
+  theCopy->e             = e;
+  theCopy->A             = A;
+  theCopy->Lr2           = Lr2;
+  theCopy->Lr3           = Lr3;
+  theCopy->T             = T;
+  theCopy->ug            = ug;
 
   return theCopy;
 }
@@ -34,6 +34,10 @@
 #include <FrameTransform.h>
 #include <Vector.h>
 #include <Matrix.h>
+#include <VectorND.h>
+#include <MatrixND.h>
+#include <Matrix3D.h>
+#include <Vector3D.h>
 
 class CorotCrdTransf3d: public FrameTransform3d
 {
@@ -84,19 +88,13 @@ public:
     int getRigidOffsets(Vector &offsets);
   
 private:
+    int  updateIfMoved(void);
     void compTransfMatrixBasicGlobal(void);
-    void compTransfMatrixBasicGlobalNew(void);
     void compTransfMatrixLocalGlobal(Matrix &Tlg);
     void compTransfMatrixBasicLocal(Matrix &Tbl);
     const Vector &getQuaternionFromRotMatrix(const Matrix &RotMatrix) const;
-    const Vector &getQuaternionFromPseudoRotVector(const Vector &theta) const;
-    const Vector &getTangScaledPseudoVectorFromQuaternion(const Vector &theta) const;
-    const Vector &quaternionProduct(const Vector &q1, const Vector &q2) const;
-    const Matrix &getRotationMatrixFromQuaternion(const Vector &q) const;
-    const Matrix &getRotMatrixFromTangScaledPseudoVector(const Vector &w) const;
-    const Matrix &getSkewSymMatrix(const Vector &theta) const;
-    const Matrix &getLMatrix(const Vector &ri) const;
-    const Matrix &getKs2Matrix(const Vector &ri, const Vector &z) const;
+    void getLMatrix(const Vector3D &ri, OpenSees::MatrixND<12,3> &L) const;
+    void addKs2Matrix(OpenSees::MatrixND<12,12> &K, const Vector3D &ri, const Vector3D &z, double scale) const;
     
     // internal data
     Node *nodeIPtr, *nodeJPtr;  // pointers to the element two endnodes
@@ -122,17 +120,21 @@ private:
     Vector ulcommit;            // committed local displacements
     Vector ulpr;                // previous local displacements
     
-    static Matrix RI;           // nodal triad for node 1
-    static Matrix RJ;           // nodal triad for node 2
-    static Matrix Rbar;         // mean nodal triad 
-    static Matrix e;            // base vectors
+    // state of the trial configuration, computed by update()
+    OpenSees::VectorND<12> ug;   // nodal trial displacements it was computed for
+    OpenSees::Matrix3D RI;       // nodal triad for node 1
+    OpenSees::Matrix3D RJ;       // nodal triad for node 2
+    OpenSees::Matrix3D Rbar;     // mean nodal triad 
+    OpenSees::Matrix3D e;        // base vectors
+    OpenSees::Matrix3D A;        // auxiliary matrices
+    OpenSees::MatrixND<12,3> Lr2, Lr3;
+    OpenSees::MatrixND<7,12> T;  // transformation matrix from basic to global system
+
     static Matrix Tp;           // transformation matrix to renumber dofs
-    static Matrix T;            // transformation matrix from basic to global system
     static Matrix Tlg;          // transformation matrix from global to local system
     static Matrix TlgInv;       // inverse of transformation matrix from global to local system
     static Matrix Tbl;          // transformation matrix from local to basic system
     static Matrix kg;           // global stiffness matrix
-    static Matrix Lr2, Lr3, A;  // auxiliary matrices
     
     double *nodeIInitialDisp, *nodeJInitialDisp;
     bool initialDispChecked;
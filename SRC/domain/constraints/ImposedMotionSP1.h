@@ -53,6 +53,7 @@ class ImposedMotionSP1 : public SP_Constraint
     int applyConstraint(double loadFactor);    
     double getValue(void);
     bool isHomogeneous(void) const;
+    int getGroundMotionTag(void) const {return groundMotionTag;}
     
     int sendSelf(int commitTag, Channel &theChannel);
     int recvSelf(int commitTag, Channel &theChannel, 
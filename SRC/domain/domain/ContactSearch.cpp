@@ -0,0 +1,232 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of ContactSearch.
+//
+#include <ContactSearch.h>
+#include <Domain.h>
+#include <Node.h>
+#include <Element.h>
+#include <Vector.h>
+#include <ID.h>
+#include <OPS_Stream.h>
+#include <cmath>
+#include <iterator>
+
+ContactSearch::ContactSearch(int tag, const ID& primary, const ID& secondary,
+                             double radius, double skin, int firstEleTag, Factory factory)
+	: m_tag(tag)
+	, m_radius(radius)
+	, m_skin(skin)
+	, m_next_tag(firstEleTag)
+	, m_factory(factory)
+	, m_ndm(0)
+	, m_num_builds(0)
+	, m_built(false)
+{
+	for (int i = 0; i < primary.Size(); ++i)
+		m_primary_tags.push_back(primary(i));
+	for (int i = 0; i < secondary.Size(); ++i)
+		m_secondary_tags.push_back(secondary(i));
+}
+
+ContactSearch::~ContactSearch()
+{
+}
+
+int ContactSearch::update(Domain& domain)
+{
+	if (!m_built) {
+		if (setNodes(domain) < 0)
+			return -1;
+	}
+	else if (!needsBuild())
+		return 0;
+
+	return build(domain);
+}
+
+int ContactSearch::setNodes(Domain& domain)
+{
+	auto find = [&domain, this](const std::vector<int>& tags, std::vector<Node*>& nodes) {
+		nodes.clear();
+		for (int tag : tags) {
+			Node* node = domain.getNode(tag);
+			if (node == nullptr) {
+				opserr << "ContactSearch::update() - search " << m_tag
+					<< ": node " << tag << " does not exist\n";
+				return -1;
+			}
+			const int ndm = node->getCrds().Size();
+			if (ndm > m_ndm)
+				m_ndm = ndm < 3 ? ndm : 3;
+			nodes.push_back(node);
+		}
+		return 0;
+	};
+
+	if (find(m_primary_tags, m_primary) < 0 || find(m_secondary_tags, m_secondary) < 0)
+		return -1;
+
+	return 0;
+}
+
+void ContactSearch::position(const Node* node, double x[3]) const
+{
+	const Vector& crd = node->getCrds();
+	const Vector& disp = const_cast<Node*>(node)->getTrialDisp();
+	for (int i = 0; i < 3; ++i) {
+		x[i] = 0.0;
+		if (i < m_ndm && i < crd.Size())
+			x[i] = crd(i);
+		if (i < m_ndm && i < disp.Size())
+			x[i] += disp(i);
+	}
+}
+
+void ContactSearch::cell(const double x[3], long long c[3]) const
+{
+	const double h = m_radius + m_skin;
+	for (int i = 0; i < 3; ++i)
+		c[i] = (long long)std::floor(x[i]/h);
+}
+
+long long ContactSearch::key(const long long c[3]) const
+{
+	// 21 bits per direction, centred on the origin
+	long long key = 0;
+	for (int i = 0; i < 3; ++i)
+		key = (key << 21) | ((c[i] + (1LL << 20)) & ((1LL << 21) - 1));
+	return key;
+}
+
+bool ContactSearch::needsBuild()
+{
+	// rebuild once any node may have moved into the search radius of a
+	// node it was not paired with
+	const double limit = 0.25*m_skin*m_skin;
+	std::size_t k = 0;
+	double x[3];
+	for (const std::vector<Node*>* nodes : {&m_primary, &m_secondary})
+		for (const Node* node : *nodes) {
+			position(node, x);
+			double d2 = 0.0;
+			for (int i = 0; i < 3; ++i, ++k)
+				d2 += (x[i] - m_reference[k])*(x[i] - m_reference[k]);
+			if (d2 > limit)
+				return true;
+		}
+
+	return false;
+}
+
+int ContactSearch::build(Domain& domain)
+{
+	const double cutoff = m_radius + m_skin;
+	const double cutoff2 = cutoff*cutoff;
+
+	m_reference.resize(3*(m_primary.size() + m_secondary.size()));
+
+	// hash the primary nodes
+	m_cells.clear();
+	std::size_t k = 0;
+	long long c[3];
+	for (std::size_t j = 0; j < m_primary.size(); ++j, k += 3) {
+		position(m_primary[j], &m_reference[k]);
+		cell(&m_reference[k], c);
+		m_cells[key(c)].push_back((int)j);
+	}
+
+	// visit the neighbouring cells of each secondary node
+	std::map<std::pair<int, int>, int> pairs;
+	const int span = m_ndm > 2 ? 1 : 0;
+	for (std::size_t j = 0; j < m_secondary.size(); ++j, k += 3) {
+		double* xs = &m_reference[k];
+		position(m_secondary[j], xs);
+		const int secondary = m_secondary[j]->getTag();
+
+		// step between cells by their indices; offsetting the position by
+		// the cell size may round into the same cell twice and miss one
+		cell(xs, c);
+		for (int dx = -1; dx <= 1; ++dx)
+			for (int dy = (m_ndm > 1 ? -1 : 0); dy <= (m_ndm > 1 ? 1 : 0); ++dy)
+				for (int dz = -span; dz <= span; ++dz) {
+					const long long neighbour[3] = {c[0] + dx, c[1] + dy, c[2] + dz};
+					auto found = m_cells.find(key(neighbour));
+					if (found == m_cells.end())
+						continue;
+
+					for (int p : found->second) {
+						const double* xp = &m_reference[3*p];
+						const double d2 = (xs[0] - xp[0])*(xs[0] - xp[0])
+						                + (xs[1] - xp[1])*(xs[1] - xp[1])
+						                + (xs[2] - xp[2])*(xs[2] - xp[2]);
+						const int primary = m_primary[p]->getTag();
+						if (d2 <= cutoff2 && primary != secondary)
+							pairs.emplace(std::make_pair(secondary, primary), -1);
+					}
+				}
+	}
+
+	int changes = 0;
+
+	// retire the elements of pairs that have separated
+	for (const auto& pair : m_pairs) {
+		if (pairs.find(pair.first) != pairs.end())
+			continue;
+		Element* element = domain.removeElement(pair.second);
+		if (element != nullptr)
+			delete element;
+		++changes;
+	}
+
+	// keep the elements of pairs that are still close
+	for (auto& pair : pairs) {
+		auto existing = m_pairs.find(pair.first);
+		if (existing != m_pairs.end())
+			pair.second = existing->second;
+	}
+
+	// and create the rest
+	for (auto& pair : pairs) {
+		if (pair.second >= 0)
+			continue;
+
+		while (domain.getElement(m_next_tag) != nullptr)
+			++m_next_tag;
+
+		const int tag = m_next_tag++;
+		if (m_factory(tag, pair.first.first, pair.first.second) < 0 ||
+		    domain.getElement(tag) == nullptr) {
+			opserr << "ContactSearch::update() - search " << m_tag
+				<< ": failed to create an element between secondary node " << pair.first.first
+				<< " and primary node " << pair.first.second << "\n";
+			// keep track of the elements that do exist
+			for (auto it = pairs.begin(); it != pairs.end(); )
+				it = it->second < 0 ? pairs.erase(it) : std::next(it);
+			m_pairs.swap(pairs);
+			m_built = false;
+			return -1;
+		}
+		pair.second = tag;
+		++changes;
+	}
+
+	m_pairs.swap(pairs);
+	m_built = true;
+	++m_num_builds;
+
+	return changes;
+}
+
+void ContactSearch::Print(OPS_Stream& s, int flag)
+{
+	s << "ContactSearch: " << m_tag << "\n";
+	s << "\tprimary nodes: " << (int)m_primary_tags.size()
+	  << ", secondary nodes: " << (int)m_secondary_tags.size() << "\n";
+	s << "\tradius: " << m_radius << ", skin: " << m_skin << "\n";
+	s << "\tpairs: " << (int)m_pairs.size() << ", builds: " << m_num_builds << "\n";
+}
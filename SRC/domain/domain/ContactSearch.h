@@ -0,0 +1,96 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the class definition for
+// ContactSearch. A ContactSearch owns the contact elements between a set
+// of secondary nodes and a set of primary nodes, and creates them only
+// for the pairs that are close enough to come into contact.
+//
+// The search keeps a Verlet list: every pair closer than the search
+// radius plus a skin distance has an element. The list is built from a
+// uniform spatial hash with cells the size of that cutoff, so only the
+// neighbouring cells of each secondary node are visited. It is rebuilt
+// only when some node has moved more than half the skin since the last
+// build; until then no pair can have come within the search radius
+// without already being in the list. The elements, and therefore the
+// equation numbering of the model, change only at those rebuilds.
+//
+// Elements are created through a factory function that must add an
+// element with the given tag, connecting the given secondary and primary
+// nodes, to the domain. Elements whose pairs have left the cutoff are
+// removed from the domain and deleted.
+//
+#ifndef ContactSearch_h
+#define ContactSearch_h
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+#include <map>
+#include <utility>
+
+class Domain;
+class Node;
+class ID;
+class OPS_Stream;
+
+class ContactSearch
+{
+public:
+	// int factory(int eleTag, int secondaryNode, int primaryNode)
+	typedef std::function<int(int, int, int)> Factory;
+
+	ContactSearch(int tag, const ID& primary, const ID& secondary,
+	              double radius, double skin, int firstEleTag, Factory factory);
+	~ContactSearch();
+
+	int getTag() const { return m_tag; }
+	int getNumPairs() const { return (int)m_pairs.size(); }
+	int getNumBuilds() const { return m_num_builds; }
+
+	// called at the start of each analysis step; returns the number of
+	// elements added or removed, or a negative value on failure
+	int update(Domain& domain);
+
+	void Print(OPS_Stream& s, int flag = 0);
+
+private:
+	int setNodes(Domain& domain);
+	bool needsBuild();
+	int build(Domain& domain);
+	void position(const Node* node, double x[3]) const;
+	void cell(const double x[3], long long c[3]) const;
+	long long key(const long long c[3]) const;
+
+private:
+	int m_tag;
+	std::vector<int> m_primary_tags;
+	std::vector<int> m_secondary_tags;
+	double m_radius;
+	double m_skin;
+	int m_next_tag;
+	Factory m_factory;
+
+	int m_ndm;
+	int m_num_builds;
+	bool m_built;
+
+	std::vector<Node*> m_primary;
+	std::vector<Node*> m_secondary;
+
+	// positions of the primary nodes, then the secondary nodes, at the
+	// last build
+	std::vector<double> m_reference;
+
+	// primary node indices by cell
+	std::unordered_map<long long, std::vector<int>> m_cells;
+
+	// element tags of the current pairs, keyed by (secondary, primary)
+	// node tag
+	std::map<std::pair<int, int>, int> m_pairs;
+};
+
+#endif
@@ -29,6 +29,10 @@
 #include <stdlib.h>
 #include <math.h>
 #include <map>
+#include <set>
+#include <algorithm>
+#include <iterator>
+#include <chrono>
 #include <OPS_Globals.h>
 #include <Domain.h>
 #include <DummyStream.h>
@@ -70,13 +74,15 @@
 #include <FEM_ObjectBroker.h>
 
 #include <DomainModalProperties.h>
+#include <ContactSearch.h>
+#include <Profiler.h>
 
 //
 // global variables
 //
 
-Domain       *ops_TheActiveDomain = nullptr;
-double        ops_Dt = 0.0;
+thread_local Domain *ops_TheActiveDomain = nullptr;
+thread_local double  ops_Dt = 0.0;
 bool          ops_InitialStateAnalysis = false;
 int           ops_Creep = 0;
 
@@ -91,6 +97,8 @@ Domain::Domain()
  initBounds(true), resetBounds(false), theBounds(6), 
  theEigenvalues(0), theEigenvalueSetTime(0), 
  theModalProperties(0), theModalDampingFactors(0), inclModalMatrix(false),
+ measureElementCost(false), recordersHeld(false),
+ modificationDepth(0), changeKinds(0), markingKinds(ChangeAll), lastChangeKinds(ChangeAll),
  lastChannel(0),
  paramIndex(0), paramSize(0), numParameters(0)
 {
@@ -135,6 +143,8 @@ Domain::Domain(int numNodes, int numElements, int numSPs, int numMPs,
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), 
  theModalProperties(0),
  theModalDampingFactors(0), inclModalMatrix(false),
+ measureElementCost(false), recordersHeld(false),
+ modificationDepth(0), changeKinds(0), markingKinds(ChangeAll), lastChangeKinds(ChangeAll),
  lastChannel(0), paramIndex(0), paramSize(0), numParameters(0)
 {
     // init the arrays for storing the domain components
@@ -185,6 +195,8 @@ Domain::Domain(TaggedObjectStorage &theNodesStorage,
  initBounds(true), resetBounds(false),
  theBounds(6), theEigenvalues(nullptr), theEigenvalueSetTime(0), 
  theModalProperties(nullptr), theModalDampingFactors(nullptr), inclModalMatrix(false),
+ measureElementCost(false), recordersHeld(false),
+ modificationDepth(0), changeKinds(0), markingKinds(ChangeAll), lastChangeKinds(ChangeAll),
  lastChannel(0),
  paramIndex(0), paramSize(0), numParameters(0)
 {
@@ -231,6 +243,8 @@ Domain::Domain(TaggedObjectStorage &theStorage)
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), 
  theModalProperties(0),
  theModalDampingFactors(0), inclModalMatrix(false),
+ measureElementCost(false), recordersHeld(false),
+ modificationDepth(0), changeKinds(0), markingKinds(ChangeAll), lastChangeKinds(ChangeAll),
  lastChannel(0),
  paramIndex(0), paramSize(0), numParameters(0)
 {
@@ -394,6 +408,7 @@ Domain::addElement(Element *element)
   if (result == true) {
     element->setDomain(this);
     element->update();
+    addedElements.push_back(element);
 
     // finally check the ele has correct number of dof
 #ifdef _G3DEBUG
@@ -405,7 +420,7 @@ Domain::addElement(Element *element)
 #endif
 
     // mark the Domain as having been changed
-    this->domainChange();
+    this->markChange(ChangeElements);
 
   } else 
     opserr << "Domain::addElement - element " << eleTag << "could not be added to container\n";      
@@ -431,49 +446,10 @@ Domain::addNode(Node * node)
   bool result = theNodes->addComponent(node);
   if (result == true) {
       node->setDomain(this);
-      this->domainChange();
-
-      if (!resetBounds) {
-          // see if the physical bounds are changed
-          // note this assumes 0,0,0,0,0,0 as startup min,max values
-          const Vector& crds = node->getCrds();
-          int dim = crds.Size();
-          if (initBounds) {
-              if (dim >= 1) {
-                  double x = crds(0);
-                  theBounds(0) = x;
-                  theBounds(3) = x;
-              }
-              if (dim >= 2) {
-                  double y = crds(1);
-                  theBounds(1) = y;
-                  theBounds(4) = y;
-              }
-              if (dim == 3) {
-                  double z = crds(2);
-                  theBounds(2) = z;
-                  theBounds(5) = z;
-              }
-              initBounds = false;
-          }
-          else {
-              if (dim >= 1) {
-                  double x = crds(0);
-                  if (x < theBounds(0)) theBounds(0) = x;
-                  if (x > theBounds(3)) theBounds(3) = x;
-              }
-              if (dim >= 2) {
-                  double y = crds(1);
-                  if (y < theBounds(1)) theBounds(1) = y;
-                  if (y > theBounds(4)) theBounds(4) = y;
-              }
-              if (dim == 3) {
-                  double z = crds(2);
-                  if (z < theBounds(2)) theBounds(2) = z;
-                  if (z > theBounds(5)) theBounds(5) = z;
-              }
-          }
-      }
+      this->markChange(ChangeNodes);
+
+      if (!resetBounds)
+          this->updateBounds(node->getCrds());
   } else
     opserr << "Domain::addNode - node with tag " << nodTag << "could not be added to container\n";
 
@@ -545,11 +521,175 @@ Domain::addSP_Constraint(SP_Constraint *spConstraint)
   } 
 
   spConstraint->setDomain(this);
-  this->domainChange();  
+  this->markChange(ChangeConstraints);  
 
   return true;
 }
 
+int
+Domain::addNodes(Node *const *nodes, int numNodes)
+{
+  int numAdded = 0;
+  for (int i=0; i<numNodes; i++) {
+    Node *node = nodes[i];
+    int nodTag = node->getTag();
+    if (theNodes->getComponentPtr(nodTag) != nullptr) {
+      opserr << "Domain::addNodes - node with tag " << nodTag << " already exists in model\n";
+      break;
+    }
+    if (theNodes->addComponent(node) == false) {
+      opserr << "Domain::addNodes - node with tag " << nodTag << " could not be added to container\n";
+      break;
+    }
+    node->setDomain(this);
+    if (!resetBounds)
+      this->updateBounds(node->getCrds());
+    numAdded++;
+  }
+
+  if (numAdded > 0)
+    this->markChange(ChangeNodes);
+
+  return numAdded;
+}
+
+
+int
+Domain::addElements(Element *const *elements, int numElements)
+{
+  int numAdded = 0;
+  for (int i=0; i<numElements; i++) {
+    Element *element = elements[i];
+    int eleTag = element->getTag();
+
+    const ID &nodes = element->getExternalNodes();
+    bool found = true;
+    for (int j=0; j<nodes.Size(); j++)
+      if (this->getNode(nodes(j)) == nullptr) {
+        opserr << "WARNING Domain::addElements - In element " << eleTag;
+        opserr << "\n no Node " << nodes(j) << " exists in the domain\n";
+        found = false;
+        break;
+      }
+    if (!found)
+      break;
+
+    if (theElements->getComponentPtr(eleTag) != nullptr) {
+      opserr << "Domain::addElements - element with tag " << eleTag << " already exists in model\n";
+      break;
+    }
+    if (theElements->addComponent(element) == false) {
+      opserr << "Domain::addElements - element " << eleTag << " could not be added to container\n";
+      break;
+    }
+    element->setDomain(this);
+    element->update();
+    addedElements.push_back(element);
+    numAdded++;
+  }
+
+  if (numAdded > 0)
+    this->markChange(ChangeElements);
+
+  return numAdded;
+}
+
+
+int
+Domain::addSP_Constraints(SP_Constraint *const *sps, int numSPs)
+{
+  // the constrained dofs are looked up once rather than by a scan of
+  // the existing constraints for each new one
+  std::set<std::pair<int,int>> constrained;
+  SP_ConstraintIter &theExistingSPs = this->getSPs();
+  SP_Constraint *theExistingSP;
+  while ((theExistingSP = theExistingSPs()) != nullptr)
+    constrained.insert({theExistingSP->getNodeTag(), theExistingSP->getDOF_Number()});
+
+  int numAdded = 0;
+  for (int i=0; i<numSPs; i++) {
+    SP_Constraint *sp = sps[i];
+    int nodeTag = sp->getNodeTag();
+    int dof = sp->getDOF_Number();
+
+    Node *nodePtr = this->getNode(nodeTag);
+    if (nodePtr == nullptr) {
+      opserr << "Domain::addSP_Constraints - cannot add constraint, node with tag " <<
+        nodeTag << " does not exist in model\n";
+      break;
+    }
+    if (nodePtr->getNumberDOF() < dof) {
+      opserr << "Domain::addSP_Constraints - cannot add as node with tag " <<
+        nodeTag << " does not have associated constrained DOF\n";
+      break;
+    }
+    if (constrained.insert({nodeTag, dof}).second == false) {
+      opserr << "Domain::addSP_Constraints - cannot add as node " << nodeTag
+             << " already constrained in that dof by existing SP_Constraint\n";
+      break;
+    }
+    if (theSPs->getComponentPtr(sp->getTag()) != nullptr
+        || theSPs->addComponent(sp) == false) {
+      opserr << "Domain::addSP_Constraints - cannot add constraint with tag " <<
+        sp->getTag() << " to the container\n";
+      constrained.erase({nodeTag, dof});
+      break;
+    }
+    sp->setDomain(this);
+    numAdded++;
+  }
+
+  if (numAdded > 0)
+    this->markChange(ChangeConstraints);
+
+  return numAdded;
+}
+
+
+void
+Domain::updateBounds(const Vector &crds)
+{
+  // see if the physical bounds are changed
+  // note this assumes 0,0,0,0,0,0 as startup min,max values
+  int dim = crds.Size();
+  if (initBounds) {
+      if (dim >= 1) {
+          double x = crds(0);
+          theBounds(0) = x;
+          theBounds(3) = x;
+      }
+      if (dim >= 2) {
+          double y = crds(1);
+          theBounds(1) = y;
+          theBounds(4) = y;
+      }
+      if (dim == 3) {
+          double z = crds(2);
+          theBounds(2) = z;
+          theBounds(5) = z;
+      }
+      initBounds = false;
+  }
+  else {
+      if (dim >= 1) {
+          double x = crds(0);
+          if (x < theBounds(0)) theBounds(0) = x;
+          if (x > theBounds(3)) theBounds(3) = x;
+      }
+      if (dim >= 2) {
+          double y = crds(1);
+          if (y < theBounds(1)) theBounds(1) = y;
+          if (y > theBounds(4)) theBounds(4) = y;
+      }
+      if (dim == 3) {
+          double z = crds(2);
+          if (z < theBounds(2)) theBounds(2) = z;
+          if (z > theBounds(5)) theBounds(5) = z;
+      }
+  }
+}
+
+
 // void addPressure_Constraint(Pressure_Constraint *);
 //	Method to add a constraint to the model.
 //
@@ -584,7 +724,7 @@ Domain::addPressure_Constraint(Pressure_Constraint *pConstraint)
     } 
 
     pConstraint->setDomain(this);
-    this->domainChange();  
+    this->markChange(ChangeConstraints);  
 
     return true;
 }
@@ -649,7 +789,7 @@ Domain::addSP_Constraint(int axisDirn, double axisValue,
       }
     }
   }
-  this->domainChange();
+  this->markChange(ChangeConstraints);
   return numAddedSPs;
 }
 
@@ -693,7 +833,7 @@ Domain::addMP_Constraint(MP_Constraint *mpConstraint)
   bool result = theMPs->addComponent(mpConstraint);
   if (result == true) {
       mpConstraint->setDomain(this);
-      this->domainChange();
+      this->markChange(ChangeConstraints);
   } else
     opserr << "Domain::addMP_Constraint - cannot add constraint with tag " << 
            tag << " to the container\n";                   
@@ -725,7 +865,7 @@ Domain::addLoadPattern(LoadPattern *load)
     if (result == true) {
 	load->setDomain(this);
 	if (numSPs > 0)
-	  this->domainChange();
+	  this->markChange(ChangeConstraints);
     }
     else 
       opserr << "Domain::addLoadPattern - cannot add LoadPattern with tag " <<
@@ -836,7 +976,7 @@ Domain::addSP_Constraint(SP_Constraint *spConstraint, int pattern)
   }
 
   spConstraint->setDomain(this);
-  this->domainChange();  
+  this->markChange(ChangeConstraints);  
 
   return true;
 }
@@ -901,7 +1041,7 @@ Domain::addElementalLoad(ElementalLoad *load, int pattern)
 
 
     // load->setDomain(this); // done in LoadPattern::addElementalLoad()
-    this->domainChange();
+    this->markChange(ChangeLoads);
     return result;
 }
 
@@ -946,6 +1086,10 @@ Domain::clearAll(void) {
     delete theRegions[i];
   numRegions = 0;
 
+  for (ContactSearch *theSearch : theContactSearches)
+    delete theSearch;
+  theContactSearches.clear();
+
   if (theRegions != 0) {
     delete [] theRegions;
     theRegions = 0;
@@ -974,6 +1118,14 @@ Domain::clearAll(void) {
   hasDomainChangedFlag = false;
   nodeGraphBuiltFlag = false;
   eleGraphBuiltFlag = false;
+
+  // the stamps start over, so nothing may be assumed about the next change
+  changeKinds = ChangeAll;
+  lastChangeKinds = ChangeAll;
+  addedElements.clear();
+  removedElements.clear();
+  lastAddedElements.clear();
+  lastRemovedElements.clear();
   
   dbEle =0; dbNod =0; dbSPs =0; dbPCs = 0; 
   dbMPs =0; dbLPs = 0; dbParam = 0;
@@ -1004,12 +1156,14 @@ Domain::removeElement(int tag)
   if (mc == nullptr)
       return nullptr;
 
-  // otherwise mark the domain as having changed
-  this->domainChange();
-  
   // perform a downward cast to an Element (safe as only Element added to
   // this container, 0 the Elements DomainPtr and return the result of the cast  
   Element *result = (Element *)mc;
+
+  // mark the domain as having changed; a subdomain is linked to its
+  // FE_Element, so its removal is not a plain element change
+  this->markChange(result->isSubdomain() ? ChangeAll : ChangeElements);
+  removedElements.push_back(result);
   //  result->setDomain(0);
   return result;
 }
@@ -1025,7 +1179,7 @@ Domain::removeNode(int tag)
       return nullptr;
 
   // mark the domain has having changed 
-  this->domainChange();
+  this->markChange(ChangeNodes);
 
   // adjust node bounds 
   resetBounds = true;
@@ -1078,7 +1232,7 @@ Domain::removeSP_Constraint(int theNode, int theDOF, int loadPatternTag)
 
   // mark the domain has having changed regardless if SP constraint
   // was there or not
-  this->domainChange();
+  this->markChange(ChangeConstraints);
 
   if (theSP != nullptr) {
     delete theSP;
@@ -1099,7 +1253,7 @@ Domain::removeSP_Constraint(int tag)
 	return nullptr;
 
     // mark the domain as having changed    
-    this->domainChange();
+    this->markChange(ChangeConstraints);
     
     // perform a downward cast, set the objects domain pointer to 0
     // and return the result of the cast    
@@ -1121,7 +1275,7 @@ Domain::removePressure_Constraint(int tag)
 	return nullptr;
 
     // mark the domain as having changed    
-    this->domainChange();
+    this->markChange(ChangeConstraints);
     
     // perform a downward cast, set the objects domain pointer to 0
     // and return the result of the cast    
@@ -1143,7 +1297,7 @@ Domain::removeMP_Constraint(int tag)
 	return nullptr;
 
     // mark the domain as having changed    
-    this->domainChange();
+    this->markChange(ChangeConstraints);
     
     // perform a downward cast, set the objects domain pointer to 0
     // and return the result of the cast        
@@ -1180,7 +1334,7 @@ Domain::removeMP_Constraints(int nodeTag)
   }
     
   // mark the domain as having changed    
-  this->domainChange();
+  this->markChange(ChangeConstraints);
     
   return sizeTags;
 }    
@@ -1224,7 +1378,7 @@ Domain::removeParameter(int tag)
       return 0;
 
   // otherwise mark the domain as having changed
-  this->domainChange();
+  this->markChange(ChangeLoads);
   
   // perform a downward cast to an Element (safe as only Element added to
   // this container, 0 the Elements DomainPtr and return the result of the cast  
@@ -1277,7 +1431,7 @@ Domain::removeLoadPattern(int tag)
     // mark the domain has having changed if numSPs > 0
     // as the constraint handlers have to be redone
     if (numSPs > 0)
-      this->domainChange();
+      this->markChange(ChangeConstraints);
 
     // finally return the load pattern
     return result;    
@@ -1324,7 +1478,7 @@ Domain::removeSP_Constraint(int tag, int loadPattern)
     
   SP_Constraint *theSP = theLoadPattern->removeSP_Constraint(tag);
   if (theSP != 0)
-    this->domainChange();
+    this->markChange(ChangeConstraints);
 
   return theSP;
 }    
@@ -1889,6 +2043,9 @@ Domain::setRayleighDampingFactors(double alphaM, double betaK, double betaK0, do
 int
 Domain::record(bool fromAnalysis)
 {
+  OpenSees::Profiler::Scope scope(OpenSees::Profiler::Record);
+  OpenSees::Profiler::count(OpenSees::Profiler::RecorderWrites, numRecorders);
+
   int res = 0;
 
   // invoke record on all recorders
@@ -1902,9 +2059,17 @@ Domain::record(bool fromAnalysis)
   return res;
 }
 
+void
+Domain::holdRecorders(bool hold)
+{
+  recordersHeld = hold;
+}
+
 int
 Domain::commit(void)
 {
+    OpenSees::Profiler::Scope scope(OpenSees::Profiler::Commit);
+
     // 
     // first invoke commit on all nodes and elements in the domain
     //
@@ -1925,9 +2090,13 @@ Domain::commit(void)
     dT = 0.0;
 
     // invoke record on all recorders
-    for (int i=0; i<numRecorders; i++)
-      if (theRecorders[i] != 0)
-	theRecorders[i]->record(commitTag, currentTime);
+    if (!recordersHeld) {
+      OpenSees::Profiler::Scope record(OpenSees::Profiler::Record);
+      OpenSees::Profiler::count(OpenSees::Profiler::RecorderWrites, numRecorders);
+      for (int i=0; i<numRecorders; i++)
+        if (theRecorders[i] != 0)
+          theRecorders[i]->record(commitTag, currentTime);
+    }
 
     // update the commitTag
     commitTag++;
@@ -2004,12 +2173,26 @@ Domain::update(void)
   ops_Dt = dT;
   ops_TheActiveDomain = this;
 
+  OpenSees::Profiler::Scope scope(OpenSees::Profiler::Update);
+  OpenSees::Profiler::count(OpenSees::Profiler::ElementUpdates, this->getNumElements());
+
   int ok = 0;
 
   // invoke update on all the ele's
   ElementIter &theEles = this->getElements();
   Element *theEle;
 
+  if (measureElementCost) {
+    while ((theEle = theEles()) != nullptr) {
+      ops_TheActiveElement = theEle;
+      auto start = std::chrono::steady_clock::now();
+      ok += theEle->update();
+      std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+      theEle->addMeasuredCost(elapsed.count());
+    }
+    return ok;
+  }
+
   while ((theEle = theEles()) != nullptr) {
     ops_TheActiveElement = theEle;
     ok += theEle->update();
@@ -2019,6 +2202,22 @@ Domain::update(void)
 }
 
 
+void
+Domain::setMeasureElementCost(bool measure)
+{
+  measureElementCost = measure;
+}
+
+void
+Domain::resetElementCost(void)
+{
+  ElementIter &theEles = this->getElements();
+  Element *theEle;
+  while ((theEle = theEles()) != nullptr)
+    theEle->resetMeasuredCost();
+}
+
+
 int
 Domain::update(double newTime, double dT)
 {
@@ -2067,6 +2266,14 @@ Domain::updateParameter(int tag, double value)
 int
 Domain::analysisStep(double dT)
 {
+  // let the contact searches add and remove their elements; the domain
+  // is only marked as changed if one of them did
+  for (ContactSearch *theSearch : theContactSearches)
+    if (theSearch->update(*this) < 0) {
+      opserr << "Domain::analysisStep - contact search " << theSearch->getTag() << " failed\n";
+      return -1;
+    }
+
   return 0;
 }
 
@@ -2194,6 +2401,8 @@ void
 Domain::setDomainChangeStamp(int newStamp)
 {
     currentGeoTag = newStamp;
+    // the next change can not be related to the last one
+    changeKinds = ChangeAll;
 }
 
 
@@ -2201,6 +2410,64 @@ void
 Domain::domainChange(void)
 {
     hasDomainChangedFlag = true;
+    changeKinds |= markingKinds;
+}
+
+
+void
+Domain::markChange(int kinds)
+{
+    // domainChange() may be overridden, so it is still invoked
+    markingKinds = kinds;
+    this->domainChange();
+    markingKinds = ChangeAll;
+}
+
+
+void
+Domain::beginModification(void)
+{
+    modificationDepth++;
+}
+
+
+int
+Domain::commitModification(void)
+{
+    if (modificationDepth == 0) {
+      opserr << "Domain::commitModification - no modification has been started\n";
+      return -1;
+    }
+    modificationDepth--;
+    return 0;
+}
+
+
+bool
+Domain::isModifying(void) const
+{
+    return modificationDepth > 0;
+}
+
+
+int
+Domain::getLastChangeKinds(void) const
+{
+    return lastChangeKinds;
+}
+
+
+const std::vector<Element*> &
+Domain::getLastAddedElements(void) const
+{
+    return lastAddedElements;
+}
+
+
+const std::vector<Element*> &
+Domain::getLastRemovedElements(void) const
+{
+    return lastRemovedElements;
 }
 
 
@@ -2217,13 +2484,36 @@ Domain::hasDomainChanged(void)
     // if the flag indicating the domain has changed since the
     // last call to this method has changed, increment the integer
     // and reset the flag
+    // changes made within a modification are held back until it is
+    // committed
+    if (modificationDepth > 0)
+      return currentGeoTag;
+
     bool result = hasDomainChangedFlag;
     hasDomainChangedFlag = false;
     if (result == true) {
 	currentGeoTag++;
 	nodeGraphBuiltFlag = false;
 	eleGraphBuiltFlag = false;
-    }
+
+	// an element that was both added and removed can not be
+	// accounted for by the lists
+	std::vector<Element*> added(addedElements), removed(removedElements);
+	std::sort(added.begin(), added.end());
+	std::sort(removed.begin(), removed.end());
+	std::vector<Element*> both;
+	std::set_intersection(added.begin(), added.end(),
+			      removed.begin(), removed.end(), std::back_inserter(both));
+	if (!both.empty())
+	  changeKinds = ChangeAll;
+
+	lastChangeKinds = changeKinds;
+	lastAddedElements.swap(addedElements);
+	lastRemovedElements.swap(removedElements);
+	changeKinds = 0;
+    }
+    addedElements.clear();
+    removedElements.clear();
 
     // return the integer so user can determine if domain has changed 
     // since their last call to this method
@@ -2400,6 +2690,22 @@ Domain::flushRecorders()
   return 0;
 }
 
+//
+// Forget all recorders without invoking their destructors. This is
+// used by a forked child process, which must not write to (or close)
+// the streams it inherited from its parent.
+//
+int
+Domain::detachRecorders(void)
+{
+    if (theRecorders != nullptr)
+      delete [] theRecorders;
+
+    theRecorders = nullptr;
+    numRecorders = 0;
+    return 0;
+}
+
 int
 Domain::removeRecorder(int tag)
 {
@@ -2456,6 +2762,45 @@ Domain::getRegionTags(ID& rtags) const
 
 }
 
+int
+Domain::addContactSearch(ContactSearch *theSearch)
+{
+  if (theSearch == nullptr)
+    return -1;
+
+  if (this->getContactSearch(theSearch->getTag()) != nullptr) {
+    opserr << "Domain::addContactSearch - a search with tag " << theSearch->getTag()
+           << " already exists\n";
+    return -1;
+  }
+
+  theContactSearches.push_back(theSearch);
+  return 0;
+}
+
+ContactSearch *
+Domain::getContactSearch(int tag)
+{
+  for (ContactSearch *theSearch : theContactSearches)
+    if (theSearch->getTag() == tag)
+      return theSearch;
+
+  return nullptr;
+}
+
+int
+Domain::removeContactSearch(int tag)
+{
+  for (auto it = theContactSearches.begin(); it != theContactSearches.end(); ++it)
+    if ((*it)->getTag() == tag) {
+      delete *it;
+      theContactSearches.erase(it);
+      return 0;
+    }
+
+  return -1;
+}
+
 typedef std::map<int, int>    MAP_INT;
 typedef MAP_INT::value_type   MAP_INT_TYPE;
 typedef MAP_INT::iterator     MAP_INT_ITERATOR;
@@ -2486,7 +2831,9 @@ Domain::buildEleGraph(Graph *theEleGraph)
   int count = START_VERTEX_NUM;
   while ((theEle = theElements()) != nullptr) {
     int eleTag = theEle->getTag();
-    Vertex *vertexPtr = new Vertex(count, eleTag);
+    // weight the vertex by the measured cost of the element, zero if
+    // the cost has not been measured
+    Vertex *vertexPtr = new Vertex(count, eleTag, theEle->getMeasuredCost());
 
     theEleGraph->addVertex(vertexPtr);
     theEleToVertexMapEle = theEleToVertexMap.find(eleTag);
@@ -3420,6 +3767,10 @@ Domain::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 
     lastGeoSendTag = currentGeoTag;
     hasDomainChangedFlag = false;
+    changeKinds = 0;
+    lastChangeKinds = ChangeAll;
+    addedElements.clear();
+    removedElements.clear();
 
   } else {
 
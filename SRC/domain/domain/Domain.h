@@ -32,6 +32,7 @@
 
 #include <OPS_Stream.h>
 #include <Vector.h>
+#include <vector>
 
 enum class NodeData: int;
 class Element;
@@ -61,6 +62,7 @@ class SingleDomAllSP_Iter;
 class SingleDomParamIter;
 
 class MeshRegion;
+class ContactSearch;
 class Recorder;
 class Graph;
 class NodeGraph;
@@ -101,6 +103,13 @@ class Domain
     virtual  bool addMP_Constraint(MP_Constraint *); 
     virtual  bool addLoadPattern(LoadPattern *);            
     virtual  bool addParameter(Parameter *);            
+
+    // methods to add components created in bulk; each returns the number
+    // of components added, stopping at the first one that is rejected,
+    // and marks the domain as changed only once
+    virtual  int  addNodes(Node *const *nodes, int numNodes);
+    virtual  int  addElements(Element *const *elements, int numElements);
+    virtual  int  addSP_Constraints(SP_Constraint *const *sps, int numSPs);
     
     // methods to add components to a LoadPattern object
     virtual  bool addSP_Constraint(SP_Constraint *, int loadPatternTag); 
@@ -189,6 +198,12 @@ class Domain
     virtual  int  updateParameter(int tag, double value);    
     
     virtual  int  analysisStep(double dT);
+
+    // methods for measuring the time each element spends in update(), which
+    // buildEleGraph() then uses as the weight of the element's vertex
+    void setMeasureElementCost(bool measure);
+    bool getMeasureElementCost(void) const {return measureElementCost;}
+    void resetElementCost(void);
     virtual  int  eigenAnalysis(int numMode, bool generalized, bool findSmallest);
     
     // methods for eigenvalue analysis
@@ -208,6 +223,28 @@ class Domain
     virtual void domainChange(void);
     virtual void setDomainChangeStamp(int newStamp);
 
+    // changes made between beginModification() and the matching
+    // commitModification() are reported by hasDomainChanged() as one
+    // change once the outermost modification has been committed
+    virtual void beginModification(void);
+    virtual int  commitModification(void);
+    bool isModifying(void) const;
+
+    // kinds of change reported by hasDomainChanged(); a change the domain
+    // can not classify, e.g. one marked by domainChange(), is of all kinds
+    enum ChangeKind {
+      ChangeNodes       = 1,
+      ChangeElements    = 2,
+      ChangeConstraints = 4,
+      ChangeLoads       = 8,   // loads and parameters, not the dofs
+      ChangeAll         = 15
+    };
+    // the kinds of the last change reported by hasDomainChanged(),
+    // and the elements it added to and removed from the domain
+    int getLastChangeKinds(void) const;
+    const std::vector<Element*> &getLastAddedElements(void) const;
+    const std::vector<Element*> &getLastRemovedElements(void) const;
+
 
     // methods for output
     virtual int  addRecorder(Recorder &theRecorder);    	
@@ -215,11 +252,20 @@ class Domain
     virtual int  removeRecorder(int tag);
     virtual int  record(bool fromAnalysis=true);
     virtual int flushRecorders();
+    virtual int  detachRecorders(void);
+    // while held, commit() does not invoke the recorders
+    void holdRecorders(bool hold);
 
     virtual int  addRegion(MeshRegion &theRegion);    	
     virtual MeshRegion *getRegion(int region);    	
     virtual void getRegionTags(ID& rtags) const;
 
+    // methods for contact searches, which add and remove contact
+    // elements at the start of each analysis step
+    virtual int  addContactSearch(ContactSearch *theSearch);
+    virtual ContactSearch *getContactSearch(int tag);
+    virtual int  removeContactSearch(int tag);
+
     virtual void Print(OPS_Stream &s, int flag =0);
     virtual void Print(OPS_Stream &s, ID *nodeTags, ID *eleTags, int flag =0);
 
@@ -246,6 +292,9 @@ class Domain
     virtual int buildEleGraph(Graph *theEleGraph);
     virtual int buildNodeGraph(Graph *theNodeGraph);
 
+    void updateBounds(const Vector &crds);
+    void markChange(int kinds);
+
     Recorder **theRecorders;
     int numRecorders;    
 
@@ -285,6 +334,8 @@ class Domain
     MeshRegion **theRegions;
     int numRegions;    
 
+    std::vector<ContactSearch *> theContactSearches;
+
     int commitTag;
     
     Vector theBounds;
@@ -297,6 +348,16 @@ class Domain
     Vector *theModalDampingFactors;
     bool inclModalMatrix;
 
+    bool measureElementCost;
+    bool recordersHeld;
+
+    int modificationDepth;
+    int changeKinds;                  // kinds of the change not yet reported
+    int markingKinds;                 // kinds recorded by domainChange()
+    int lastChangeKinds;
+    std::vector<Element*> addedElements, removedElements;
+    std::vector<Element*> lastAddedElements, lastRemovedElements;
+
     int lastChannel;
 
     // Integer array: index[i] = tag of component i
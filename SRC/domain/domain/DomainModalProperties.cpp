@@ -267,7 +267,7 @@ namespace
     };
 }
 
-void
+int
 OPS_ADD_RUNTIME_VXV(OPS_DomainModalProperties)
 {
     // modalProperties <-print> <-file $fileName> <-unorm>
@@ -283,7 +283,7 @@ OPS_ADD_RUNTIME_VXV(OPS_DomainModalProperties)
     AnalysisModel* theAnalysisModel = *OPS_GetAnalysisModel();
     if (theAnalysisModel == nullptr) {
         opserr << "modalProperties Error: no AnalysisModel available.\n";
-        exit(-1);
+        return -1;
     }
 
     // init default values
@@ -312,7 +312,7 @@ OPS_ADD_RUNTIME_VXV(OPS_DomainModalProperties)
             else {
                 opserr << "Error in modalProperties <-print> <-file $fileName> <-unorm>.\n"
                     "After the keyword -file you should specify the file name.\n";
-                exit(-1);
+                return -1;
             }
         }
         ++loc;
@@ -329,6 +329,8 @@ OPS_ADD_RUNTIME_VXV(OPS_DomainModalProperties)
         modal_props.print();
     if (print_on_file)
         modal_props.print(fname);
+
+    return 0;
 }
 
 DomainModalProperties::DomainModalProperties(bool unorm)
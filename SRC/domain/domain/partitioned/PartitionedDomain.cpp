@@ -243,6 +243,19 @@ PartitionedDomain::addElement(Element *elePtr)
 
 
 
+int
+PartitionedDomain::addElements(Element *const *elements, int numElements)
+{
+  // elements are kept apart from those of the Domain, and may be
+  // subdomains, so each goes through addElement()
+  int numAdded = 0;
+  while (numAdded < numElements && this->addElement(elements[numAdded]))
+    numAdded++;
+
+  return numAdded;
+}
+
+
 bool
 PartitionedDomain::addNode(Node *nodePtr)
 {
@@ -306,6 +319,18 @@ PartitionedDomain::addSP_Constraint(SP_Constraint *load)
 
 
 
+int
+PartitionedDomain::addSP_Constraints(SP_Constraint *const *sps, int numSPs)
+{
+  // constraints may have to be passed on to the subdomains
+  int numAdded = 0;
+  while (numAdded < numSPs && this->addSP_Constraint(sps[numAdded]))
+    numAdded++;
+
+  return numAdded;
+}
+
+
 int
 PartitionedDomain::addSP_Constraint(int axisDirn, double axisValue,
                                     const ID &fixityCodes, double tol)
@@ -1641,6 +1666,15 @@ PartitionedDomain::buildEleGraph(Graph *theEleGraph)
 
 
   TaggedObject *theTagged;
+
+  // the elements are weighted by their measured cost if it has been
+  // measured and otherwise by their number of DOF
+  bool costMeasured = false;
+  TaggedObjectIter &theCostElements = elements->getComponents();
+  while (costMeasured == false && (theTagged = theCostElements()) != 0)
+    if (static_cast<Element *>(theTagged)->getMeasuredCost() > 0.0)
+      costMeasured = true;
+
   TaggedObjectIter &theElements = elements->getComponents();
   int count = START_VERTEX_NUM;
   while ((theTagged = theElements()) != 0) {
@@ -1654,7 +1688,8 @@ PartitionedDomain::buildEleGraph(Graph *theEleGraph)
 
     // Get the compute cost and communications cost.
     Element * theElement =  static_cast<Element *>(theTagged);
-    double eleWeight = (double) theElement->getNumDOF(); //theElement->getTime();
+    double eleWeight = costMeasured ? theElement->getMeasuredCost()
+                                    : (double) theElement->getNumDOF();
     int eleCommCost = 0;//theElement->getMoveCost();
     vertexPtr->setWeight(eleWeight);
     // vertexPtr->setTmp(eleCommCost);
@@ -1827,16 +1862,19 @@ PartitionedDomain::getSubdomainGraph(void)
   //Mapping element tags to vertex corresponding vertex
   MAP_INT subDTagToVtxTag;
 
-  //Add P0 to the graph
+  //Add P0 to the graph; it takes the first tag not used by a subdomain,
+  //i.e. the tag of the main partition when the main domain is used
   SubdomainIter &theSubdomains = this->getSubdomains();
   Subdomain *subDPtr = 0;
-  int subDTag = 1;
+  int selfTag = 1;
+  while (this->getSubdomainPtr(selfTag) != 0)
+    selfTag++;
   double myCostP0 = 0.0;//this->getUpdateTime();
 
-  Vertex *selfvertexPtr = new Vertex(subDTag, subDTag, myCostP0);
+  Vertex *selfvertexPtr = new Vertex(selfTag, selfTag, myCostP0);
   mySubdomainGraph->addVertex(selfvertexPtr);
   
-  subDTagToVtxTag.insert(MAP_INT_TYPE(subDTag, subDTag));
+  subDTagToVtxTag.insert(MAP_INT_TYPE(selfTag, selfTag));
 
   while ((subDPtr = theSubdomains()) != 0) {    
     int subDTag = subDPtr->getTag();
@@ -1867,7 +1905,7 @@ PartitionedDomain::getSubdomainGraph(void)
   while ((nodPtr = niter()) != 0) {
     int nodeTag = nodPtr->getTag();
     Vertex *vertexPtr = new Vertex(count++, nodeTag);
-    vertexPtr->addEdge(1);
+    vertexPtr->addEdge(selfTag);
 
     nodeTagToVtx.insert(MAP_VERTEX_TYPE(nodeTag, vertexPtr));
   }
@@ -1984,7 +2022,7 @@ PartitionedDomain::setMass(const Matrix &mass, int nodeTag)
 }
 
 const Vector *
-PartitionedDomain::getNodeResponse(int nodeTag, NodeResponseType response)
+PartitionedDomain::getNodeResponse(int nodeTag, NodeData response)
 {
   const Vector *res = this->Domain::getNodeResponse(nodeTag, response);
   if (res != 0)
@@ -2151,6 +2189,7 @@ GraphPartitioner* PartitionedDomain::getGraphPartitioner(void)
 
 
 
+#if 0
 int
 PartitionedDomain::activateElements(const ID& elementList)
 {
@@ -2200,3 +2239,4 @@ PartitionedDomain::deactivateElements(const ID& elementList)
 
   return res;
 }
+#endif
@@ -68,12 +68,14 @@ class PartitionedDomain: public Domain
     // public methods to populate a domain	
     virtual  bool addElement(Element *elePtr);
     virtual  bool addNode(Node *nodePtr);
+    virtual  int  addElements(Element *const *elements, int numElements);
 
     virtual  bool addLoadPattern(LoadPattern *);            
     virtual  bool addSP_Constraint(SP_Constraint *); 
     virtual  int  addSP_Constraint(int axisDirn, double axisValue, 
 				   const ID &fixityCodes, double tol=1e-10);
     virtual  bool addSP_Constraint(SP_Constraint *, int loadPatternTag); 
+    virtual  int  addSP_Constraints(SP_Constraint *const *sps, int numSPs);
     virtual  bool addMP_Constraint(MP_Constraint *); 
 
     virtual  bool addNodalLoad(NodalLoad *, int loadPatternTag);
@@ -141,7 +143,7 @@ class PartitionedDomain: public Domain
     virtual Graph &getSubdomainGraph(void);
 
     // nodal methods required in domain interface for parallel interprter
-    virtual const Vector *getNodeResponse(int nodeTag, NodeResponseType); 
+    virtual const Vector *getNodeResponse(int nodeTag, NodeData); 
     virtual const Vector *getElementResponse(int eleTag, const char **argv, int argc); 
 
     virtual double getNodeDisp(int nodeTag, int dof, int &errorFlag);
@@ -149,8 +151,10 @@ class PartitionedDomain: public Domain
 
     virtual int calculateNodalReactions(bool inclInertia);
     
+#if 0
     virtual int activateElements(const ID& elementList);
     virtual int deactivateElements(const ID& elementList);
+#endif
 
     // friend classes
     friend class PartitionedDomainEleIter;
@@ -136,6 +136,18 @@ NodalLoad::applyLoad(double loadFactor)
     //    opserr << "loadFactor: " << loadFactor << *myNodePtr;
 }
 
+// Overwrite the reference load in place; used by drivers that update
+// loads every step (e.g., co-simulation) without rebuilding the pattern.
+int
+NodalLoad::setLoad(const Vector &newLoad)
+{
+    if (load == nullptr || load->Size() != newLoad.Size())
+      return -1;
+
+    *load = newLoad;
+    return 0;
+}
+
 void
 NodalLoad::applyLoadSensitivity(double loadFactor)
 {
@@ -49,6 +49,7 @@ class NodalLoad : public Load
     virtual int getNodeTag(void) const;
     virtual void applyLoad(double loadFactor);
     virtual void applyLoadSensitivity(double loadFactor);
+    virtual int  setLoad(const Vector &newLoad);
     
     virtual int sendSelf(int commitTag, Channel &theChannel);
     virtual int recvSelf(int commitTag, Channel &theChannel, 
@@ -62,7 +62,7 @@ Node::Node(int theClassTag)
  trialDisp(0), trialVel(0), trialAccel(0), unbalLoad(0), incrDisp(0),
  incrDeltaDisp(0),
  disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
- R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0),
+ R(0), sourceR(nullptr), stampR(-1), savedR(nullptr), numSavedR(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0),
  index(-1), reaction(0)//, displayLocation(0)
 {
   // for FEM_ObjectBroker, recvSelf() must be invoked on object
@@ -85,7 +85,7 @@ Node::Node(int tag, int theClassTag)
  trialDisp(0), trialVel(0), trialAccel(0), unbalLoad(0), incrDisp(0),
  incrDeltaDisp(0),
  disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
-  R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0),
+  R(0), sourceR(nullptr), stampR(-1), savedR(nullptr), numSavedR(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0),
  index(-1), reaction(0)//, displayLocation(0)
 {
   // for subclasses - they must implement all the methods with
@@ -108,7 +108,7 @@ Node::Node(int tag, int ndof, double Crd1, Vector *dLoc)
  trialDisp(0), trialVel(0), trialAccel(0), unbalLoad(0), incrDisp(0),
  incrDeltaDisp(0),
  disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
- R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0),
+ R(0), sourceR(nullptr), stampR(-1), savedR(nullptr), numSavedR(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0),
  index(-1), reaction(0)//, displayLocation(0)
 {
   this->createDisp();
@@ -135,7 +135,7 @@ Node::Node(int tag, int ndof, double Crd1, double Crd2, Vector *dLoc)
  trialDisp(0), trialVel(0), trialAccel(0), unbalLoad(0), incrDisp(0),
  incrDeltaDisp(0),
  disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
- R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0),
+ R(0), sourceR(nullptr), stampR(-1), savedR(nullptr), numSavedR(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0),
  reaction(0)//, displayLocation(0)
 {
   this->createDisp();
@@ -166,7 +166,7 @@ Node::Node(int tag, int ndof, double Crd1, double Crd2, Vector *dLoc)
  trialDisp(0), trialVel(0), trialAccel(0), unbalLoad(0), incrDisp(0),
  incrDeltaDisp(0),
  disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
- R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0),
+ R(0), sourceR(nullptr), stampR(-1), savedR(nullptr), numSavedR(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0),
  reaction(0)//, displayLocation(0)
 {
   this->createDisp();
@@ -198,7 +198,7 @@ Node::Node(const Node &otherNode, bool copyMass)
  trialDisp(0), trialVel(0), trialAccel(0), unbalLoad(0), incrDisp(0),
  incrDeltaDisp(0),
  disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
- R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0),
+ R(0), sourceR(nullptr), stampR(-1), savedR(nullptr), numSavedR(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0),
    reaction(0)//, displayLocation(0)
 {
   this->createDisp();
@@ -214,10 +214,10 @@ Node::Node(const Node &otherNode, bool copyMass)
   Crd = new Vector(otherNode.getCrds());
 
   if (otherNode.commitDisp != nullptr) {
-    // this->createDisp();
-    *commitDisp = *otherNode.commitDisp;
-//  for (int i=0; i<4*numberDOF; i++)
-//    disp[i] = otherNode.disp[i];
+    // the trial state too, as boundary nodes can be copied
+    // between steps when subdomains are rebalanced
+    for (int i=0; i<4*numberDOF; i++)
+      disp[i] = otherNode.disp[i];
   }
 
   if (otherNode.commitVel != nullptr) {
@@ -302,6 +302,8 @@ Node::~Node()
     if (R != 0)
       delete R;
 
+    this->setR_Source(nullptr, -1);
+
     if (unbalLoadWithInertia != 0)
       delete unbalLoadWithInertia;
 
@@ -661,9 +663,21 @@ Node::addInertiaLoadToUnbalance(const Vector &accelG, double fact)
   // form - fact * M*R*accelG and add it to the unbalanced load
   //(*unbalLoad) -= ((*mass) * (*R) * accelG)*fact;
 
-  Matrix MR(mass->noRows(), R->noCols());
-  MR.addMatrixProduct(0.0, *mass, *R, 1.0);
-  unbalLoad->addMatrixVector(1.0, MR, accelG, -fact);
+  // R is mostly zero, so form R*accelG a term at a time and skip the
+  // columns of M it does not reach
+  const int numCol = R->noCols();
+  for (int j = 0; j < numberDOF; j++) {
+    double ra = 0.0;
+    for (int k = 0; k < numCol; k++)
+      ra += (*R)(j, k) * accelG(k);
+
+    if (ra == 0.0)
+      continue;
+
+    ra *= fact;
+    for (int i = 0; i < numberDOF; i++)
+      (*unbalLoad)(i) -= (*mass)(i, j) * ra;
+  }
 
   return 0;
 }
@@ -939,9 +953,76 @@ Node::setNumColR(int numCol)
     R = new Matrix(numberDOF, numCol);
 
   R->Zero();
+  sourceR = nullptr;
+  stampR  = -1;
   return 0;
 }
 
+// the directions of a uniform excitation in 3d
+static constexpr int MaxSavedR = 5;
+
+void
+Node::setR_Source(const void *source, int stamp)
+{
+  sourceR = source;
+  stampR  = stamp;
+
+  if (source == nullptr && savedR != nullptr) {
+    for (int i=0; i<numSavedR; i++)
+      delete savedR[i].R;
+    delete [] savedR;
+    savedR = nullptr;
+    numSavedR = 0;
+  }
+}
+
+bool
+Node::useR_Source(const void *source, int stamp)
+{
+  if (R != nullptr && sourceR == source && stampR == stamp)
+    return true;
+
+  // take the R formed by source out of those kept aside
+  Matrix *theR = nullptr;
+  for (int i=0; i<numSavedR; i++)
+    if (savedR[i].source == source) {
+      if (savedR[i].stamp == stamp)
+        theR = savedR[i].R;
+      else
+        delete savedR[i].R;
+      savedR[i] = savedR[--numSavedR];
+      break;
+    }
+
+  // and keep the current one aside if another object formed it, dropping
+  // the oldest when there are too many
+  if (R != nullptr && sourceR != nullptr && sourceR != source) {
+    if (savedR == nullptr)
+      savedR = new SourceR[MaxSavedR];
+    if (numSavedR == MaxSavedR) {
+      delete savedR[0].R;
+      for (int i=1; i<numSavedR; i++)
+        savedR[i-1] = savedR[i];
+      numSavedR--;
+    }
+    savedR[numSavedR++] = {R, sourceR, stampR};
+    R = nullptr;
+  }
+
+  if (theR != nullptr) {
+    if (R != nullptr)
+      delete R;
+    R = theR;
+    sourceR = source;
+    stampR  = stamp;
+    return true;
+  }
+
+  sourceR = nullptr;
+  stampR  = -1;
+  return false;
+}
+
 int
 Node::setR(int row, int col, double Value)
 {
@@ -959,6 +1040,7 @@ Node::setR(int row, int col, double Value)
 
   // do the assignment
   (*R)(row,col) = Value;
+  sourceR = nullptr;
 
   /*
   // to test uniform excitation pattern with consistent mass matrices:
@@ -1278,6 +1360,7 @@ Node::recvSelf(int cTag, Channel &theChannel,
         R = new Matrix(numberDOF, noCols);
       }
       // now recv the R matrix
+      sourceR = nullptr;
       if (theChannel.recvMatrix(dbTag2, cTag, *R) < 0) {
         opserr << "Node::recvSelf() - failed to receive R data\n";
         return res;
@@ -1775,6 +1858,9 @@ Node::setCrds(double Crd1)
   if (Crd != 0 && Crd->Size() >= 1)
     (*Crd)(0) = Crd1;
 
+  // the influence matrices formed for the old coordinates
+  this->setR_Source(nullptr, -1);
+
   // Need to "setDomain" to make the change take effect.
   Domain *theDomain = this->getDomain();
   ElementIter &theElements = theDomain->getElements();
@@ -1791,6 +1877,9 @@ Node::setCrds(double Crd1, double Crd2)
     (*Crd)(0) = Crd1;
     (*Crd)(1) = Crd2;
 
+    // the influence matrices formed for the old coordinates
+    this->setR_Source(nullptr, -1);
+
     // Need to "setDomain" to make the change take effect.
     Domain *theDomain = this->getDomain();
     ElementIter &theElements = theDomain->getElements();
@@ -1808,6 +1897,9 @@ Node::setCrds(double Crd1, double Crd2, double Crd3)
     (*Crd)(1) = Crd2;
     (*Crd)(2) = Crd3;
 
+    // the influence matrices formed for the old coordinates
+    this->setR_Source(nullptr, -1);
+
     // Need to "setDomain" to make the change take effect.
     Domain *theDomain = this->getDomain();
     ElementIter &theElements = theDomain->getElements();
@@ -1823,6 +1915,9 @@ Node::setCrds(const Vector &newCrds)
   if (Crd != 0 && Crd->Size() == newCrds.Size()) {
     (*Crd) = newCrds;
 
+    // the influence matrices formed for the old coordinates
+    this->setR_Source(nullptr, -1);
+
       return;
 
     // Need to "setDomain" to make the change take effect.
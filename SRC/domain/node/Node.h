@@ -122,6 +122,12 @@ class Node :
     VIRTUAL int setNumColR(int numCol);
     VIRTUAL int setR(int row, int col, double Value);
     VIRTUAL const Vector &getRV(const Vector &V);
+    // the object that formed R, and the domain stamp when it did; a load
+    // pattern uses these to keep its R between steps (setNumColR() clears
+    // them). useR_Source() makes the R the object formed current again,
+    // keeping aside that of another; setR_Source(nullptr, -1) forgets all
+    void setR_Source(const void *source, int stamp);
+    bool useR_Source(const void *source, int stamp);
     VIRTUAL int setRayleighDampingFactor(double alphaM);
 
     // Eigen vectors
@@ -234,6 +240,14 @@ class Node :
     
 
     Matrix *R;                          // nodal participation matrix
+    const void *sourceR;                // object that formed R, and the
+    int stampR;                         // domain stamp when it did
+    struct SourceR {
+      Matrix *R;
+      const void *source;
+      int stamp;
+    } *savedR;                          // R formed by other objects
+    int numSavedR;
     Matrix *mass;                       // pointer to mass matrix
     Vector *unbalLoadWithInertia;
     double alphaM;                      // rayleigh damping factor 
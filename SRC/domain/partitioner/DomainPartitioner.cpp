@@ -43,6 +43,7 @@
 #include <SP_Constraint.h>
 #include <MP_Constraint.h>
 #include <NodeIter.h>
+#include <DOF_Group.h>
 #include <ElementIter.h>
 #include <MP_ConstraintIter.h>
 #include <SP_ConstraintIter.h>
@@ -76,8 +77,12 @@ public:
   NodeLocations(int tag);
   void Print(OPS_Stream &s, int flag =0);  
   int addPartition(int partition);
+  int addElement(int partition);
+  int removeElement(int partition);
   ID nodePartitions;
   int numPartitions;
+  std::map<int, int> numElements; // elements connected to the node in each partition
+  bool fixed;                     // constraints or loads were placed by the node's partitions
 };
 
 
@@ -85,7 +90,8 @@ public:
 NodeLocations::NodeLocations(int tag)
 :TaggedObject(tag), 
  nodePartitions(0,1), 
- numPartitions(0)
+ numPartitions(0),
+ fixed(false)
 {
 
 }
@@ -104,16 +110,34 @@ NodeLocations::addPartition(int partition)
   return 0;
 }
 
+int
+NodeLocations::addElement(int partition)
+{
+  numElements[partition]++;
+  return this->addPartition(partition);
+}
+
+// returns the number of elements connected to the node still in the
+// partition; the node stays in the partition even if there are none
+int
+NodeLocations::removeElement(int partition)
+{
+  std::map<int, int>::iterator count = numElements.find(partition);
+  if (count == numElements.end() || count->second == 0)
+    return 0;
+  return --(count->second);
+}
+
 
 //==================================================================================================
 // Some maps that help handling graphs
 //==================================================================================================
 
-typedef map<int, int> MAP_INT;
+typedef std::map<int, int> MAP_INT;
 typedef MAP_INT::value_type   MAP_INT_TYPE;
 typedef MAP_INT::iterator     MAP_INT_ITERATOR;
 
-typedef map<int, ID *> MAP_ID;
+typedef std::map<int, ID *> MAP_ID;
 typedef MAP_ID::value_type   MAP_ID_TYPE;
 typedef MAP_ID::iterator     MAP_ID_ITERATOR;
 
@@ -126,7 +150,8 @@ typedef MAP_ID::iterator     MAP_ID_ITERATOR;
 DomainPartitioner::DomainPartitioner(GraphPartitioner &theGraphPartitioner)
   :  myDomain(0), thePartitioner(theGraphPartitioner), theBalancer(0),
  theElementGraph(0), theBoundaryElements(0), 
- theNodeLocations(0),elementPlace(0), numPartitions(0), partitionFlag(false), usingMainDomain(false)
+ theNodeLocations(0),elementPlace(0), numPartitions(0), partitionFlag(false), usingMainDomain(false),
+ imbalanceThreshold(1.1), numSwapped(0), partitionSizes(0,1), loadedElements(0,16)
 {
 
 }    
@@ -135,7 +160,8 @@ DomainPartitioner::DomainPartitioner(GraphPartitioner &theGraphPartitioner,
 				     LoadBalancer &theLoadBalancer)
   :  myDomain(0), thePartitioner(theGraphPartitioner), theBalancer(&theLoadBalancer),
  theElementGraph(0), theBoundaryElements(0),
- theNodeLocations(0),elementPlace(0), numPartitions(0), partitionFlag(false), usingMainDomain(false)
+ theNodeLocations(0),elementPlace(0), numPartitions(0), partitionFlag(false), usingMainDomain(false),
+ imbalanceThreshold(1.1), numSwapped(0), partitionSizes(0,1), loadedElements(0,16)
 {
     // set the links the loadBalancer needs
     theLoadBalancer.setLinks(*this);
@@ -144,12 +170,44 @@ DomainPartitioner::DomainPartitioner(GraphPartitioner &theGraphPartitioner,
 
 DomainPartitioner::~DomainPartitioner()
 {
-  if (theBoundaryElements != 0) {
-    for (int i=0; i<numPartitions; i++)
-      if (theBoundaryElements[i] != 0)
-	delete theBoundaryElements[i];
-    delete []theBoundaryElements;
+  this->clearBoundaryElements();
+
+  if (theNodeLocations != 0)
+    delete theNodeLocations;
+
+  // the element graph is ours only if it was kept for the balancer
+  if (theBalancer != 0 && theElementGraph != 0)
+    delete theElementGraph;
+}
+
+
+// the boundary graphs share their vertices with the element graph, so
+// the vertices are taken out of them before they are deleted
+void
+DomainPartitioner::clearBoundaryElements(void)
+{
+  if (theBoundaryElements == 0)
+    return;
+
+  for (int i=0; i<numPartitions; i++) {
+    Graph *theBoundary = theBoundaryElements[i];
+    if (theBoundary == 0)
+      continue;
+
+    ID vertexTags(theBoundary->getNumVertex());
+    int numVertex = 0;
+    VertexIter &theVertices = theBoundary->getVertices();
+    Vertex *vertexPtr;
+    while ((vertexPtr = theVertices()) != 0)
+      vertexTags[numVertex++] = vertexPtr->getTag();
+
+    for (int j=0; j<numVertex; j++)
+      theBoundary->removeVertex(vertexTags(j), false);
+
+    delete theBoundary;
   }
+  delete [] theBoundaryElements;
+  theBoundaryElements = 0;
 }
 
 
@@ -186,9 +244,20 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag,
   //    Graph &theEleGraph = myDomain->getElementGraph();
   //    theElementGraph = new Graph(myDomain->getElementGraph());
 
-  theElementGraph = &(myDomain->getElementGraph());
+  // if partitioned before, start again
+  this->clearBoundaryElements();
+  if (theBalancer != 0 && theElementGraph != 0)
+    delete theElementGraph;
+  theElementGraph = 0;
+  if (theNodeLocations != 0)
+    delete theNodeLocations;
+  theNodeLocations = 0;
+  elementNodes.clear();
+  loadedElements = ID(0,16);
+
+  Graph &theDomainGraph = myDomain->getElementGraph();
 
-  int theError = thePartitioner.partition(*theElementGraph, numParts);
+  int theError = thePartitioner.partition(theDomainGraph, numParts);
 
   if (theError < 0) {
     opserr << "DomainPartitioner::partition";
@@ -199,6 +268,20 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag,
     opserr << "DomainPartitioner::partition - Succesfull partition. Now redistributing data accordingly.\n";
   }
 
+  // the domain rebuilds its element graph whenever it changes, so if the
+  // balancer is to move elements later we keep our own colored copy
+  if (theBalancer != 0) {
+    theElementGraph = new Graph(theDomainGraph);
+    VertexIter &theDomainVertices = theDomainGraph.getVertices();
+    Vertex *domainVertexPtr;
+    while ((domainVertexPtr = theDomainVertices()) != 0) {
+      Vertex *copyPtr = theElementGraph->getVertexPtr(domainVertexPtr->getTag());
+      copyPtr->setColor(domainVertexPtr->getColor());
+      copyPtr->setWeight(domainVertexPtr->getWeight());
+    }
+  } else
+    theElementGraph = &theDomainGraph;
+
   /* print graph */
   opserr << "  * Identifying components to transfer.\n";
   
@@ -247,9 +330,6 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag,
   // we do not invoke the destructor on the individual graphs as 
   // this would invoke the destructor on the individual vertices
 
-  if (theBoundaryElements != 0)
-    delete [] theBoundaryElements;
-  
   theBoundaryElements = new Graph * [numParts];
   if (theBoundaryElements == 0) {
     opserr << "DomainPartitioner::partition(int numParts)";
@@ -271,6 +351,8 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag,
   
   numPartitions = numParts;
 
+  partitionSizes = ID(numParts+1);
+
   //  opserr << "DomainPartitioner::partition() - nodes \n";  
   
   // we now create a MapOfTaggedObjectStorage to store the NodeLocations
@@ -332,6 +414,12 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag,
     Element *elePtr = myDomain->getElement(eleTag);
     const ID &nodes = elePtr->getExternalNodes();
     size = nodes.Size();
+    partitionSizes(vertexColor)++;
+
+    // the connectivity is needed to move the element once it has been sent
+    if (theBalancer != 0)
+      elementNodes[eleTag] = nodes;
+
     for (int j=0; j<size; j++) {
       int nodeTag = nodes(j);
       TaggedObject *theTaggedObject = theNodeLocations->getComponentPtr(nodeTag);
@@ -344,7 +432,7 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag,
 
       // Add current partition as a location into current node's location map...
       NodeLocations *theNodeLocation = (NodeLocations *)theTaggedObject;
-      theNodeLocation->addPartition(vertexColor);
+      theNodeLocation->addElement(vertexColor);
     }
   }
 
@@ -372,6 +460,8 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag,
     
     NodeLocations *theRetainedLocation = (NodeLocations *)theRetainedObject;
     NodeLocations *theConstrainedLocation = (NodeLocations *)theConstrainedObject;
+    theRetainedLocation->fixed = true;
+    theConstrainedLocation->fixed = true;
 
     ID &theConstrainedNodesPartitions = theConstrainedLocation->nodePartitions;
     int numPartitions = theConstrainedNodesPartitions.Size();
@@ -534,6 +624,7 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag,
       }
     
       NodeLocations *theNodeLocation = (NodeLocations *)theTaggedObject;
+      theNodeLocation->fixed = true;
       ID &nodePartitions = theNodeLocation->nodePartitions;
       int numPartitions = theNodeLocation->numPartitions;
       for (int i=0; i<numPartitions; i++) {
@@ -564,17 +655,21 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag,
       }
       
       NodeLocations *theNodeLocation = (NodeLocations *)theTaggedObject;
+      theNodeLocation->fixed = true;
       ID &nodePartitions = theNodeLocation->nodePartitions;
       int numPartitions = theNodeLocation->numPartitions;
       for (int i=0; i<numPartitions; i++) {
 	int partition = nodePartitions(i);	  
 	if (partition != mainPartition) {      
-	  Subdomain *theSubdomain = myDomain->getSubdomainPtr(partition); 
-	  if (numPartitions == 1) 
+	  // a boundary node keeps its constraint here, the subdomains
+	  // condense every dof of their external nodes
+	  if (numPartitions == 1) {
+	    Subdomain *theSubdomain = myDomain->getSubdomainPtr(partition); 
 	    theLoadPattern->removeSP_Constraint(spPtr->getTag());
-	  int res = theSubdomain->addSP_Constraint(spPtr, loadPatternTag);
-	  if (res < 0)
-	    opserr << "DomainPartitioner::partition() - failed to add SP Constraint\n";
+	    int res = theSubdomain->addSP_Constraint(spPtr, loadPatternTag);
+	    if (res < 0)
+	      opserr << "DomainPartitioner::partition() - failed to add SP Constraint\n";
+	  }
 	}
       }    
     }  
@@ -583,6 +678,7 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag,
     ElementalLoad *theLoad;
     while ((theLoad = theLoads()) != 0) {
       int loadEleTag = theLoad->getElementTag();
+      loadedElements.insert(loadEleTag);
 
       SubdomainIter &theSubdomains = myDomain->getSubdomains();
       Subdomain *theSub;
@@ -617,19 +713,21 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag,
     }
     
     NodeLocations *theNodeLocation = (NodeLocations *)theTaggedObject;
+    theNodeLocation->fixed = true;
     ID &nodePartitions = theNodeLocation->nodePartitions;
     int numPartitions = theNodeLocation->numPartitions;
     for (int i=0; i<numPartitions; i++) {
       int partition = nodePartitions(i);	  
 
       if (partition != mainPartition) {      
-	Subdomain *theSubdomain = myDomain->getSubdomainPtr(partition); 
+	// as for those of the load patterns, a boundary node keeps it here
 	if (numPartitions == 1) {
+	  Subdomain *theSubdomain = myDomain->getSubdomainPtr(partition); 
 	  myDomain->removeSP_Constraint(spPtr->getTag());
+	  int res = theSubdomain->addSP_Constraint(spPtr);
+	  if (res < 0)
+	    opserr << "DomainPartitioner::partition() - failed to add SP Constraint\n";
 	}
-	int res = theSubdomain->addSP_Constraint(spPtr);
-	if (res < 0)
-	  opserr << "DomainPartitioner::partition() - failed to add SP Constraint\n";
       }
     }    
   }  
@@ -678,6 +776,11 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag,
   // we invoke change on the PartitionedDomain
   myDomain->domainChange();
 
+  // without a balancer nothing is moved later on
+  if (theBalancer == 0) {
+    this->clearBoundaryElements();
+    theElementGraph = 0;
+  }
   myDomain->clearElementGraph();
     
   // we are done
@@ -703,6 +806,24 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag,
     else opserr
 
 
+void
+DomainPartitioner::setImbalanceThreshold(double threshold)
+{
+  imbalanceThreshold = threshold;
+}
+
+double
+DomainPartitioner::getImbalanceThreshold(void) const
+{
+  return imbalanceThreshold;
+}
+
+
+// The weights of the vertices of theWeightedPGraph are the costs the
+// subdomains measured since the last call. The balancer is only invoked
+// when the heaviest subdomain exceeds the mean by more than the
+// imbalance threshold, and the subdomains are only told of a change if
+// the balancer did move elements.
 int
 DomainPartitioner::balance(Graph &theWeightedPGraph)
 {
@@ -715,40 +836,48 @@ DomainPartitioner::balance(Graph &theWeightedPGraph)
   return -1;
     }
 
+    if (theBalancer == 0)
+      // If there is no balancer.... we cant balance... continue with a static domain decomposition
+      return 0;
 
-    if (theBalancer != 0) {
+    // determine the measured imbalance of the subdomains
+    double maxCost = 0.0;
+    double sumCost = 0.0;
+    int numCosts = 0;
+    VertexIter &theVertices = theWeightedPGraph.getVertices();
+    Vertex *vertexPtr;
+    while ((vertexPtr = theVertices()) != 0) {
+      if (myDomain->getSubdomainPtr(vertexPtr->getTag()) == 0)
+	continue;
+      double cost = vertexPtr->getWeight();
+      if (cost > maxCost)
+	maxCost = cost;
+      sumCost += cost;
+      numCosts++;
+    }
 
-	// call on the LoadBalancer to partition		
+    if (numCosts == 0 || sumCost <= 0.0)
+      return 0;
 
-    // timer.start();
-    // If we have a balancer, then call the balance function
-	res = theBalancer->balance(theWeightedPGraph);
-	    
-	// now invoke domainChanged on Subdomains and PartitionedDomain
-    // { 
+    if (maxCost*numCosts/sumCost <= imbalanceThreshold)
+      return 0;
 
+    // If we have a balancer, then call the balance function
+    numSwapped = 0;
+    res = theBalancer->balance(theWeightedPGraph);
 
+    // now invoke domainChanged on Subdomains and PartitionedDomain
+    if (numSwapped > 0) {
       // All domains are informed that there has been a domain change
-	SubdomainIter &theSubDomains = myDomain->getSubdomains();
-	Subdomain *theSubDomain;
-
-	while ((theSubDomain = theSubDomains()) != 0) 
-	  theSubDomain->domainChange();
-        myDomain->domainChange();
-	
-	// we invoke change on the PartitionedDomain
-
-      // if(res > 0)
-      // {
-        // fid << myDomain->getCurrentTime() << " " << timer.getReal() << endln;
-      // }
-    // }
-    }
-  else
-  {
-    // If there is no balancer.... we cant balance... continue with a static domain decomposition
-  }
+      SubdomainIter &theSubDomains = myDomain->getSubdomains();
+      Subdomain *theSubDomain;
 
+      while ((theSubDomain = theSubDomains()) != 0) 
+	theSubDomain->domainChange();
+
+      // we invoke change on the PartitionedDomain
+      myDomain->domainChange();
+    }
 
     return res;
 }
@@ -787,20 +916,33 @@ DomainPartitioner::getColoredGraph(void)
 }
 
 
+// Move the element of vertex vertexTag from subdomain from to subdomain
+// to. The element, with its state, travels through removeElement() and
+// addElement(), i.e. through its sendSelf() and recvSelf(). Nodes of the
+// element that to does not hold yet become boundary nodes of the
+// PartitionedDomain; a node left without elements in from is kept there
+// as a boundary node.
+//
+// The constraints and loads were placed in the subdomains according to
+// the partitions of their nodes and elements at partition(); those are
+// not moved, so an element is not moved if it carries elemental loads or
+// if to does not yet hold one of its nodes that carry any. In that case,
+// and if adjacentVertexNotInOther is true and the vertex is adjacent to a
+// partition other than from and to, or to none of to, -5 is returned.
 int 
 DomainPartitioner::swapVertex(int from, int to, int vertexTag,
 			      bool adjacentVertexNotInOther)
 {
-  opserr << "DomainPartitioner::swapVertex() " << from << " " << to << " " << vertexTag << endln;
-
-  /*
-  // check that the object did the partitioning
-  if (partitionFlag == false) {
-    opserr << "DomainPartitioner::balance(const Vector &load)";
-    opserr << " - not partitioned or DomainPartitioner did not partition\n";
+  // check that the object did the partitioning & kept what it needs
+  if (partitionFlag == false || theElementGraph == 0) {
+    opserr << "DomainPartitioner::swapVertex";
+    opserr << " - not partitioned or no LoadBalancer at partition()\n";
     return -1;
   }
-  
+
+  if (from == to)
+    return 0;
+
   // check that the subdomain exist in partitioned domain
   Subdomain *fromSubdomain = myDomain->getSubdomainPtr(from);
   if (fromSubdomain == 0) {
@@ -814,33 +956,16 @@ DomainPartitioner::swapVertex(int from, int to, int vertexTag,
     opserr << to << " exists\n";
     return -3;
   }    
-  
-  // remove the vertex from the boundary if there
-  // if not there we have to get a pointer to it from the ele graph.
-  
-  //    Graph &theEleGraph = myDomain->getElementGraph();    
-  Graph *fromBoundary = theBoundaryElements[from-1];
-  Graph *toBoundary = theBoundaryElements[to-1];    
-  Vertex *vertexPtr;
-  
-  // get a pointer to the vertex in the element graph
-  if (adjacentVertexNotInOther  == false) {
-    vertexPtr = fromBoundary->removeVertex(vertexTag,false);    
-    if (vertexPtr == 0) 
-      vertexPtr = theElementGraph->getVertexPtr(vertexTag);
-
-    if (vertexPtr == 0)  // if still 0 no vertex given by tag exists
-      return -4;
-  } else { // get a pointer and check vertex not adjacent to another partition
-    vertexPtr = fromBoundary->getVertexPtr(vertexTag);    
-    if (vertexPtr == 0) 
-      vertexPtr = theElementGraph->getVertexPtr(vertexTag);
-    if (vertexPtr == 0)  // if still 0 no vertex given by tag exists
-      return -4;	
-    const ID &adjacent = vertexPtr->getAdjacency();
+
+  Vertex *vertexPtr = theElementGraph->getVertexPtr(vertexTag);
+  if (vertexPtr == 0 || vertexPtr->getColor() != from)
+    return -4;
+
+  const ID &adjacent = vertexPtr->getAdjacency();
+  int adjacentSize = adjacent.Size();
+  if (adjacentVertexNotInOther == true) {
     bool inTo = false;
     bool inOther = false;
-    int adjacentSize = adjacent.Size();
     for (int i=0; i<adjacentSize; i++) {
       Vertex *other = theElementGraph->getVertexPtr(adjacent(i));
       if (other->getColor() == to) 
@@ -852,655 +977,152 @@ DomainPartitioner::swapVertex(int from, int to, int vertexTag,
     }
     if (inTo != true || inOther == true) // we cannot remove the vertex
       return -5;
-    // if can remove the vertex from the fromBoundary
-    Vertex *theVertex = fromBoundary->removeVertex(vertexTag,false);
   }
-  
-  int eleTag = vertexPtr->getRef();
-  
-  //
-  // in the FROM subdomain we:
-  //  1. remove the element
-  //  2. remove all nodes connected to the element divide color by prime
-  //  3. see if have to add nodes back as external
-  //  4. remove from the PartitionedDomain if node was external
-  //  5. add new elements to the boundary vertices for from
-  
-  //  1. remove the element from the fromSubdomain
-    //          this gives us a pointer to the element as well.
-
-    Element *elePtr = fromSubdomain->removeElement(eleTag);
-    if (elePtr == 0) // if ele not there we can just return but ERROR it should be
-  return -6;
-
-    //  2. remove all nodes connected to the element divide color by prime    
-    //  3. add back if still in subdomain
-    //  4. if node external remove from PartitionedDomains external nodes
-    int primeFrom = primes(from);
-    const ID  &nodes1 = elePtr->getExternalNodes(); // create a copy, need after send ele
-    ID  nodes(nodes1);
-
-    int nodesSize = nodes.Size();
-    Node **nodesArray = new Node *[nodesSize];
-    for (int i=0; i<nodesSize; i++) {
-  int nodeTag = nodes(i);
-
-  // remove the node
-  Node *nodePtr = fromSubdomain->removeNode(nodeTag);
-
-  (*nodePlace)(nodeTag) /= primeFrom;
-  nodesArray[i] = nodePtr;
-        // opserr << "DomainPartitioner::swapVertex -NODE " << *nodePtr;
-  // add back as external if still needed
-  if ((*nodePlace)(nodeTag)%primeFrom == 0)
-      fromSubdomain->addExternalNode(nodePtr);
-
-  // if it was external remove from PartitionedDomains external nodes
-  int partition = (*nodePlace)(nodeTag);
-  for (int j=1; j<=numPartitions; j++) 
-      if (j != from) {
-    int prime = primes(j);
-    if (partition%prime == 0) {
-        myDomain->removeExternalNode(nodeTag);
-        j = numPartitions+1;
-    }
-      }
-    }
 
-    // 5. add new elements to boundary vertices of from if connected to
-    //    vertex we just removed and of color of from and not already in boundary
-
-    const ID &eleAdjacent = vertexPtr->getAdjacency();
-    int eleAdjacentSize = eleAdjacent.Size();
-
-    for (int a=0; a<eleAdjacentSize; a++) {
-	int otherEleVertexTag = eleAdjacent(a);
-	Vertex *other = fromBoundary->getVertexPtr(otherEleVertexTag);
-	if (other == 0) {
-	    other = theElementGraph->getVertexPtr(otherEleVertexTag);
-	    if (other->getColor() == from)
-		fromBoundary->addVertex(other,false);
-	}
-    }
-
-
-    
-    // in the TO subdomain we:
-    //  1. remove all nodes connected to the element, may or may not be there
-    //     if there don't divide by primeTo. 
-    //  2. mark all connecting nodes of elements as belonging to To
-    //  3. add the nodes, checking if external or internal
-    //  3. add the element
-    //  4. change the vertex color to be to and add vertex to boundary
-    //     also see if we can reduce the size of boundary
-    //     of boundary of to vertices
-
-    //  1. remove all nodes connected to the element, may or may not be there
-    //      if there divide by primeTo, do this as may have been added as extnl
-    int primeTo = primes(to);
-    for (int l=0; l<nodesSize; l++) {    
-  int nodeTag = nodesArray[l]->getTag();
-  int nodeColor = (*nodePlace)(nodeTag);
-  if (nodeColor % primeTo == 0) {
-      Node *nodePtr;
-      nodePtr = toSubdomain->removeNode(nodes(l));
-  }
-    }
+  int eleTag = vertexPtr->getRef();
+  if (loadedElements.getLocation(eleTag) >= 0)
+    return -5;
 
+  std::map<int, ID>::iterator theEleNodes = elementNodes.find(eleTag);
+  if (theEleNodes == elementNodes.end())
+    return -6;
 
-    for (int m=0; m<nodesSize; m++) {
-  Node *nodePtr = nodesArray[m];
-  int nodeTag = nodePtr->getTag();
-  
-  //  2. mark all connecting nodes of elements as belonging to To      
-  (*nodePlace)(nodeTag) *= primeTo;
-
-  //  3. add the nodes, checking if external or internal  
-  int internal = 0;
-  for (int n=1; n<=numPartitions; n++) 
-      if (n != to) {
-    int prime = primes(n);
-    if ((*nodePlace)(nodeTag)%prime == 0) { // its external
-        internal = 1;
-        n = numPartitions+1;
-    }
-      }
-  
-  if (internal == 0)
-      toSubdomain->addNode(nodePtr);
-  else {
-      toSubdomain->addExternalNode(nodePtr);
-      myDomain->addNode(nodePtr);
+  const ID &nodes = theEleNodes->second;
+  int nodesSize = nodes.Size();
+  for (int i=0; i<nodesSize; i++) {
+    NodeLocations *theNodeLocation = 
+      (NodeLocations *)theNodeLocations->getComponentPtr(nodes(i));
+    if (theNodeLocation == 0)
+      return -6;
+    if (theNodeLocation->fixed == true && 
+	theNodeLocation->nodePartitions.getLocation(to) < 0)
+      return -5;
   }
-    }
-
-    delete [] nodesArray; // DELETE nodesArray here should not use nodePtrs
-                          // after here as node objects deleted if parallel    
-    
-    //  3. add the element
-    
-    toSubdomain->addElement(elePtr);
-    
-    //  4. change the vertex color to be to and add vertex to boundary
-    //     also see if we can reduce the size of to's boundary vertices
-
-
-    vertexPtr->setColor(to);
-    toBoundary->addVertex(vertexPtr,false);
-
-    for (int n=0; n<eleAdjacentSize; n++) {
-	int otherEleVertexTag = eleAdjacent(n);
-	Vertex *other = toBoundary->removeVertex(otherEleVertexTag,false);
-	if (other != 0) {
-	    const ID &othersAdjacency = other->getAdjacency();
-	    int otherSize = othersAdjacency.Size();
-	    for (int b=0; b<otherSize; b++) {
-		int anotherEleVertexTag = othersAdjacency(b);
-		Vertex *otherOther = theElementGraph->getVertexPtr(anotherEleVertexTag);
-		if (otherOther->getColor() != to) {
-		    toBoundary->addVertex(other,false);
-		    b=otherSize;
-		}
-	    }
-	}
-    }
 
+  //  1. remove the element from the fromSubdomain
+  Element *elePtr = fromSubdomain->removeElement(eleTag);
+  if (elePtr == 0) // if ele not there we can just return but ERROR it should be
+    return -6;
 
-    // now remove any SP_Constraints that may have been external to 
-    // PartitionedDomain and are now internal to toSubdomain
-    SP_ConstraintIter &theSPs = myDomain->getSPs();
-    SP_Constraint *spPtr;
-    while ((spPtr = theSPs()) != 0) {
-  int nodeTag = spPtr->getNodeTag();
+  //  2. make sure to holds all the nodes of the element; nodes only in
+  //     from are brought out to the PartitionedDomain first
   for (int i=0; i<nodesSize; i++) {
-      if (nodeTag == nodes(i)) {
-    int internal = 0;
-    for (int j=1; j<=numPartitions; j++) 
-        if (j != to) {
-      int prime = primes(j);
-      if ((*nodePlace)(nodeTag)%prime == 0) {
-          internal = 1;
-          j = numPartitions+1;
-      }
-        }
-    if (internal == 0) { // add to toSubdomain if inteernal
-        myDomain->removeSP_Constraint(spPtr->getTag());
-        toSubdomain->addSP_Constraint(spPtr);
-    }
+    int nodeTag = nodes(i);
+    NodeLocations *theNodeLocation = 
+      (NodeLocations *)theNodeLocations->getComponentPtr(nodeTag);
+
+    theNodeLocation->removeElement(from);
+
+    if (theNodeLocation->nodePartitions.getLocation(to) < 0) {
+      if (theNodeLocation->numPartitions == 1) {
+	Node *nodePtr = fromSubdomain->removeNode(nodeTag);
+	if (nodePtr == 0) {
+	  opserr << "DomainPartitioner::swapVertex - node " << nodeTag;
+	  opserr << " not in Subdomain " << from << endln;
+	  return -7;
+	}
+	// the DOF_Group the analysis of from made for the node goes
+	// when that analysis is next brought up to date
+	DOF_Group *theDOF = nodePtr->getDOF_GroupPtr();
+	if (theDOF != 0) {
+	  theDOF->resetNodePtr();
+	  nodePtr->setDOF_GroupPtr(0);
+	}
+	myDomain->addNode(nodePtr);
+	fromSubdomain->addExternalNode(nodePtr);
       }
-  }
+      toSubdomain->addExternalNode(myDomain->getNode(nodeTag));
     }
 
-    
-    
-    // now remove any SP_Constraints that may have been internal to fromSubdomain
-    // and are now external to PartitionedDomain or internal to toSubdomain 
-    SP_ConstraintIter &theSPs2 = fromSubdomain->getSPs();
-    while ((spPtr = theSPs2()) != 0) {
-  int nodeTag = spPtr->getNodeTag();
-  for (int i=0; i<nodesSize; i++) {
-      if (nodeTag == nodes(i)) {
-    fromSubdomain->removeSP_Constraint(spPtr->getTag());
-    int internal = 0;
-    for (int j=1; j<=numPartitions; j++) 
-        if (j != to) {
-      int prime = primes(j);
-      if ((*nodePlace)(nodeTag)%prime == 0) {
-          internal = 1;
-          j = numPartitions+1;
-      }
-        }
-    if (internal == 0) 
-        toSubdomain->addSP_Constraint(spPtr);
-    else
-        myDomain->addSP_Constraint(spPtr);
-      }
+    theNodeLocation->addElement(to);
   }
-    }
 
+  //  3. add the element
+  toSubdomain->addElement(elePtr);
 
+  //  4. change the vertex color to be to and bring the boundaries of the
+  //     partitions up to date around the vertex
+  vertexPtr->setColor(to);
+  partitionSizes(from)--;
+  partitionSizes(to)++;
 
-  */
-    /*
-    // now remove any NodalLoads that may have been external to 
-    // PartitionedDomain and are now internal to toSubdomain
-    NodalLoadIter &theNodalLoads = myDomain->getNodalLoads();
-    NodalLoad *loadPtr;
-    while ((loadPtr = theNodalLoads()) != 0) {
-  int nodeTag = loadPtr->getNodeTag();
-  for (int i=0; i<nodesSize; i++) {
-      if (nodeTag == nodes(i)) {
-    int internal = 0;
-    for (int j=1; j<=numPartitions; j++) 
-        if (j != to) {
-      int prime = primes(j);
-      if ((*nodePlace)(nodeTag)%prime == 0) {
-          internal = 1;
-          j = numPartitions+1;
-      }
-        }
-    if (internal == 0) { // add to toSubdomain if inteernal
-        myDomain->removeNodalLoad(loadPtr->getTag());
-        toSubdomain->addNodalLoad(loadPtr);
-    }
-      }
-  }
-    }
+  this->updateBoundary(vertexPtr);
+  for (int i=0; i<adjacentSize; i++)
+    this->updateBoundary(theElementGraph->getVertexPtr(adjacent(i)));
 
+  numSwapped++;
 
-    // now remove any NodalLoads that may have been internal to fromSubdomain
-    // and are now external to PartitionedDomain or internal to toSubdomain 
+  return 0;
+}
 
-    NodalLoadIter &theNodalLoads2 = myDomain->getNodalLoads();
-    while ((loadPtr = theNodalLoads2()) != 0) {
-  int nodeTag = loadPtr->getNodeTag();
-  for (int i=0; i<nodesSize; i++) {
-      if (nodeTag == nodes(i)) {
-    fromSubdomain->removeNodalLoad(loadPtr->getTag());
-    int internal = 0;
-    for (int j=1; j<=numPartitions; j++) 
-        if (j != to) {
-      int prime = primes(j);
-      if ((*nodePlace)(nodeTag)%prime == 0) {
-          internal = 1;
-          j = numPartitions+1;
-      }
-        }
-    if (internal == 0) 
-        toSubdomain->addNodalLoad(loadPtr);
-    else
-        myDomain->addNodalLoad(loadPtr);
-      }  
-  }
-    }
-    */
 
-    return 0;
+// a vertex is on the boundary of its partition if it is adjacent to a
+// vertex of another partition
+void
+DomainPartitioner::updateBoundary(Vertex *vertexPtr)
+{
+  int vertexTag = vertexPtr->getTag();
+  int color = vertexPtr->getColor();
 
+  bool onBoundary = false;
+  const ID &adjacent = vertexPtr->getAdjacency();
+  for (int i=0; i<adjacent.Size() && onBoundary == false; i++)
+    if (theElementGraph->getVertexPtr(adjacent(i))->getColor() != color)
+      onBoundary = true;
+
+  for (int j=1; j<=numPartitions; j++) {
+    Graph *theBoundary = theBoundaryElements[j-1];
+    bool inBoundary = theBoundary->getVertexPtr(vertexTag) != 0;
+    if (j == color && onBoundary == true && inBoundary == false)
+      theBoundary->addVertex(vertexPtr, false);
+    else if ((j != color || onBoundary == false) && inBoundary == true)
+      theBoundary->removeVertex(vertexTag, false);
+  }
 }
 
 
-
 // method to move from from to to, all elements on the interface of 
 // from that are adjacent with to.
 
 int 
 DomainPartitioner::swapBoundary(int from, int to, bool adjacentVertexNotInOther)
-          
 {
-  opserr << "DomainPartitioner::swapBoundary: from "  << from << " to " << to << endln;
-  /***********************************************************************************
-    opserr << "DomainPartitioner::swapBoundary from " << from << "  to " << to << endln;
-    Timer timer;
-    timer.start();
-
     // check that the object did the partitioning
-    if (partitionFlag == false) {
-  opserr << "DomainPartitioner::balance(const Vector &load)";
-  opserr << " - not partitioned or DomainPartitioner did not partition\n";
-  return -1;
-    }
-
-    // check that the subdomains exist in partitioned domain
-    Subdomain *fromSubdomain = myDomain->getSubdomainPtr(from);
-    if (fromSubdomain == 0) {
-  opserr << "DomainPartitioner::swapBoundary - No from Subdomain: ";
-  opserr << from << " exists\n";
-  return -2;
+    if (partitionFlag == false || theElementGraph == 0) {
+      opserr << "DomainPartitioner::swapBoundary";
+      opserr << " - not partitioned or no LoadBalancer at partition()\n";
+      return -1;
     }
 
-    Subdomain *toSubdomain = myDomain->getSubdomainPtr(to);
-    if (toSubdomain == 0) {
-  opserr << "DomainPartitioner::swapBoundary - No to Subdomain: ";
-  opserr << to << " exists\n";
-  return -3;
-    }    
+    if (from < 1 || from > numPartitions)
+      return -2;
 
-    // get the element graph
-    //    Graph &theEleGraph = myDomain->getElementGraph();    
+    // determine the vertices on the fromBoundary adjacent to to; they are
+    // collected first as swapVertex() changes the boundary
     Graph *fromBoundary = theBoundaryElements[from-1];
-    Graph *toBoundary = theBoundaryElements[to-1];
-
-    // into a new graph place the vertices that are to be swapped
-    Graph *swapVertices = new Graph(fromBoundary->getNumVertex());
+    ID swapVertices(0, fromBoundary->getNumVertex()+1);
+    int numSwap = 0;
 
     VertexIter &swappableVertices = fromBoundary->getVertices();
     Vertex *vertexPtr;
-
     while ((vertexPtr = swappableVertices()) != 0) {
-	if (adjacentVertexNotInOther == false) {   
-	    const ID &adjacency=vertexPtr->getAdjacency();
-	    int size = adjacency.Size();
-	    for (int i=0; i<size; i++) {
-		int otherTag = adjacency(i);
-		Vertex *otherVertex = toBoundary->getVertexPtr(otherTag);
-		if (otherVertex != 0) {
-		    swapVertices->addVertex(vertexPtr,false);
-		    i = size;
-		}
-	    }
+      const ID &adjacency = vertexPtr->getAdjacency();
+      int size = adjacency.Size();
+      for (int i=0; i<size; i++) {
+	Vertex *otherVertex = theElementGraph->getVertexPtr(adjacency(i));
+	if (otherVertex->getColor() == to) {
+	  swapVertices[numSwap++] = vertexPtr->getTag();
+	  i = size;
 	}
-	else {
-	    const ID &adjacent = vertexPtr->getAdjacency();
-	    bool inTo = false;
-	    bool inOther = false;
-	    int adjacentSize = adjacent.Size();
-	    for (int i=0; i<adjacentSize; i++) {
-		Vertex *other = theElementGraph->getVertexPtr(adjacent(i));
-		if (other->getColor() == to) 
-		    inTo = true;
-		else if (other->getColor() != from) {
-		    inOther = true;
-		    i = adjacentSize;
-		}
-	    }
-	    if (inTo == true && inOther == false) { // we remove the vertex
-		swapVertices->addVertex(vertexPtr,false);
-		vertexPtr->setColor(to);
-	    }
-	}
-    }
-
-    //
-    // in the FROM subdomain we:
-    //  1. remove the elements corresponding to the vertices
-    //  2. remove all nodes connected to the elements divide color by prime
-    //  3. see if have to add nodes back as external
-    //  4. remove from the PartitionedDomain if node was external
-    //  5. add new elements to the boundary vertices for from
-
-    // 1. first remove all the elements from from subdomain
-    VertexIter &verticesToSwap = swapVertices->getVertices();
-
-    int numEleToSwap = swapVertices->getNumVertex();
-    Element **elementsArray = new Element *[numEleToSwap];
-
-    int count =0; 
-    int numCannotRemove =0;
-    for (int i=0; i<numEleToSwap; i++) {
-      vertexPtr = verticesToSwap();
-  if (vertexPtr == 0) 
-      return -1;
-
-  int vertexTag = vertexPtr->getTag();
-  int eleTag = vertexPtr->getRef();
-
-  // remove the vertex from fromBoundary, set color to to
-  // and add to toBoundary
-  bool inFrom = true;
-  vertexPtr = fromBoundary->removeVertex(vertexTag,false);
-
-
-  if (inFrom == true) {
-      vertexPtr->setColor(to);
-      toBoundary->addVertex(vertexPtr,false);
-      Element *elePtr = fromSubdomain->removeElement(eleTag);
-      if (elePtr == 0) // if ele not there we can just return IT SHOULD BE
-    return -4;
-      elementsArray[count] = elePtr;
-      count++;
-  }
-  else  // we cannot remove the element
-      numCannotRemove++;
-    }
-    numEleToSwap -= numCannotRemove;
-
-    //  2. remove all nodes connected to the elements divide color by prime    
-    //     for each element and add back if still in subdomain
-    //  3. add back if still in subdomain
-    //  4. if node external remove from PartitionedDomains external nodes
-
-    // first determine which nodes to remove
-    int primeFrom = primes(from);
-    int primeTo = primes(to);
-    int numNodToSwap = 0;
-    ID nodesToRemove(0,128);
-    for (int j=0; j<numEleToSwap; j++) {
-  Element *elePtr = elementsArray[j];
-  const ID  &nodes = elePtr->getExternalNodes(); 
-  
-  int nodesSize = nodes.Size();
-
-  for (int k=0; k<nodesSize; k++) {
-      int nodeTag = nodes(k);
-      int loc = nodesToRemove.getLocation(nodeTag);
-      if (loc < 0) {
-    nodesToRemove[numNodToSwap] = nodeTag;
-    numNodToSwap++;
       }
-      (*nodePlace)(nodeTag) /= primeFrom;    
-      (*nodePlace)(nodeTag) *= primeTo;        
-  }
     }
 
-    // remove the nodes
-    Node **nodesArray = new Node *[numNodToSwap];  
-    for (int k=0; k<numNodToSwap; k++) {
-  int nodeTag = nodesToRemove(k); 
-  Node *nodePtr = fromSubdomain->removeNode(nodeTag);
-  nodesArray[k] = nodePtr;
-
-  // add the node back to from if still external
-  if ((*nodePlace)(nodeTag)%primeFrom == 0)
-      fromSubdomain->addExternalNode(nodePtr);
-
-  // if it was external remove from PartitionedDomains external nodes
-  int partition = (*nodePlace)(nodeTag);
-  for (int j=1; j<=numPartitions; j++) 
-      if (j != from) {
-    int prime = primes(j);
-    if (partition%prime == 0) {
-        myDomain->removeExternalNode(nodeTag);
-        j = numPartitions+1;
+    for (int i=0; i<numSwap; i++) {
+      int res = this->swapVertex(from, to, swapVertices(i), adjacentVertexNotInOther);
+      if (res < 0 && res > -4)
+	return res;
     }
-      }
-    }
-
-    // 5. add new vertices to boundary vertices of from if connected to
-    //    vertex we just removed and of color of from and not already in boundary
-
-    VertexIter &verticesToSwap2 = swapVertices->getVertices();
-    while ((vertexPtr = verticesToSwap2()) != 0) {
-  const ID &vertexAdjacent = vertexPtr->getAdjacency();
-  int vertexAdjacentSize = vertexAdjacent.Size();
-
-	for (int a=0; a<vertexAdjacentSize; a++) {
-	    int otherEleVertexTag = vertexAdjacent(a);
-	    Vertex *other = fromBoundary->getVertexPtr(otherEleVertexTag);
-	    if (other == 0) {
-		other = theElementGraph->getVertexPtr(otherEleVertexTag);
-		if (other->getColor() == from)
-		    fromBoundary->addVertex(other,false);
-	    }
-	}	
-    }
-
-
-    // in the TO subdomain we:
-    //  1. remove all nodes connected to the element, may or may not be there
-    //     if there don't divide by primeTo. 
-    //  2. mark all connecting nodes of elements as belonging to To
-    //  3. add the nodes, checking if external or internal
-    //  3. add the element
-    //  4. change the vertex color to be to and add vertex to boundary
-    //     also see if we can reduce the size of boundary
-    //     of boundary of to vertices
-
-    //  1. remove all nodes connected to the element, may or may not be there
-    //      if there divide by primeTo, do this as may have been added as extnl
-
-    for (int l=0; l<numNodToSwap; l++) {    
-  int nodeTag = nodesArray[l]->getTag();
-  Node *nodePtr;
-  nodePtr = toSubdomain->removeNode(nodesToRemove(l));
-    }
-
-
-    for (int m=0; m<numNodToSwap; m++) {
-  Node *nodePtr = nodesArray[m];
-  int nodeTag = nodePtr->getTag();
-  
-  //  3. add the nodes, checking if external or internal  
-  int internal = 0;
-  for (int n=1; n<=numPartitions; n++) 
-      if (n != to) {
-    int prime = primes(n);
-    if ((*nodePlace)(nodeTag)%prime == 0) { // its external
-        internal = 1;
-        n = numPartitions+1;
-    }
-      }
-  
-  if (internal == 0)
-      toSubdomain->addNode(nodePtr);
-  else {
-      toSubdomain->addExternalNode(nodePtr);
-      myDomain->addNode(nodePtr);
-  }
-    }
-
-
-    delete [] nodesArray; // DELETE nodesArray here should not use nodePtrs
-                          // after here as node objects deleted if parallel    
-    
-    //  3. add the elements
-    for (int a=0; a<numEleToSwap; a++)
-  toSubdomain->addElement(elementsArray[a]);
-
-
-    //  4. change the vertex color to be to and add vertex to boundary
-    //     also see if we can reduce the size of to's boundary vertices
-
-    VertexIter &verticesToSwap3 = swapVertices->getVertices();
-    while ((vertexPtr = verticesToSwap3()) != 0) {
-	const ID &vertexAdjacent = vertexPtr->getAdjacency();
-	int vertexAdjacentSize = vertexAdjacent.Size();
-	for (int n=0; n<vertexAdjacentSize; n++) {
-	    int otherEleVertexTag = vertexAdjacent(n);
-	    Vertex *other = toBoundary->removeVertex(otherEleVertexTag,false);
-	    if (other != 0) {
-		const ID &othersAdjacency = other->getAdjacency();
-		int otherSize = othersAdjacency.Size();
-		for (int b=0; b<otherSize; b++) {
-		    int anotherEleVertexTag = othersAdjacency(b);
-		    Vertex *otherOther 
-			= theElementGraph->getVertexPtr(anotherEleVertexTag);
-		    if (otherOther->getColor() != to) {
-			toBoundary->addVertex(other,false);
-			b=otherSize;
-		    }
-		}
-	    }
-	}
-    }
-
-    // now remove any SP_Constraints that may have been external to 
-    // PartitionedDomain and are now internal to toSubdomain
-    SP_ConstraintIter &theSPs = myDomain->getSPs();
-    SP_Constraint *spPtr;
-    while ((spPtr = theSPs()) != 0) {
-  int nodeTag = spPtr->getNodeTag();
-  int loc = nodesToRemove.getLocation(nodeTag);
-  if (loc >= 0) {
-      int internal = 0;
-      for (int j=1; j<=numPartitions; j++) 
-    if (j != to) {
-        int prime = primes(j);
-        if ((*nodePlace)(nodeTag)%prime == 0) {
-      internal = 1;
-      j = numPartitions+1;
-        }
-    }
-      if (internal == 0) { // add to toSubdomain if inteernal
-    myDomain->removeSP_Constraint(spPtr->getTag());
-    toSubdomain->addSP_Constraint(spPtr);
-      }
-  }
-    }
-
-    
-    // now remove any SP_Constraints that may have been internal to fromSubdomain
-    // and are now external to PartitionedDomain or internal to toSubdomain 
-    SP_ConstraintIter &theSPs2 = fromSubdomain->getSPs();
-    while ((spPtr = theSPs2()) != 0) {
-  int nodeTag = spPtr->getNodeTag();
-  int loc = nodesToRemove.getLocation(nodeTag);
-  if (loc >= 0) {
-      fromSubdomain->removeSP_Constraint(spPtr->getTag());
-      int internal = 0;
-      for (int j=1; j<=numPartitions; j++) 
-    if (j != to) {
-        int prime = primes(j);
-        if ((*nodePlace)(nodeTag)%prime == 0) {
-      internal = 1;
-      j = numPartitions+1;
-        }
-    }
-      if (internal == 0) 
-    toSubdomain->addSP_Constraint(spPtr);
-      else
-    myDomain->addSP_Constraint(spPtr);
-  }  
-    }
-
-    // now remove any NodalLoads that may have been external to 
-    // PartitionedDomain and are now internal to toSubdomain
-    NodalLoadIter &theNodalLoads = myDomain->getNodalLoads();
-    NodalLoad *loadPtr;
-    while ((loadPtr = theNodalLoads()) != 0) {
-  int nodeTag = loadPtr->getNodeTag();
-  int loc = nodesToRemove.getLocation(nodeTag);
-  if (loc >= 0) {
-
-      int internal = 0;
-      for (int j=1; j<=numPartitions; j++) 
-    if (j != to) {
-        int prime = primes(j);
-        if ((*nodePlace)(nodeTag)%prime == 0) {
-      internal = 1;
-      j = numPartitions+1;
-        }
-    }
-      if (internal == 0) { // add to toSubdomain if inteernal
-    myDomain->removeNodalLoad(loadPtr->getTag());
-    toSubdomain->addNodalLoad(loadPtr);
-      }
-  }
-    }
-
-
-    // now remove any NodalLoads that may have been internal to fromSubdomain
-    // and are now external to PartitionedDomain or internal to toSubdomain 
-
-    NodalLoadIter &theNodalLoads2 = myDomain->getNodalLoads();
-    while ((loadPtr = theNodalLoads2()) != 0) {
-  int nodeTag = loadPtr->getNodeTag();
-  int loc = nodesToRemove.getLocation(nodeTag);
-  if (loc >= 0) {
-      fromSubdomain->removeNodalLoad(loadPtr->getTag());
-      int internal = 0;
-      for (int j=1; j<=numPartitions; j++) 
-    if (j != to) {
-        int prime = primes(j);
-        if ((*nodePlace)(nodeTag)%prime == 0) {
-      internal = 1;
-      j = numPartitions+1;
-        }
-    }
-      if (internal == 0) 
-    toSubdomain->addNodalLoad(loadPtr);
-      else
-    myDomain->addNodalLoad(loadPtr);
-  }  
-    }
-
 
-    delete swapVertices;
-
-    timer.pause();
-    opserr << "DomainPartitioner::swapBoundary DONE" << timer.getReal() << endln;
-
-  ***************************************************************************/
     return 0;
 }
 
@@ -1514,9 +1136,9 @@ DomainPartitioner::releaseVertex(int from,
 				 bool adjacentVertexNotInOther)
 {
   // check that the object did the partitioning
-  if (partitionFlag == false) {
-    opserr << "DomainPartitioner::balance(const Vector &load)";
-    opserr << " - not partitioned or DomainPartitioner did not partition\n";
+  if (partitionFlag == false || theElementGraph == 0) {
+    opserr << "DomainPartitioner::releaseVertex";
+    opserr << " - not partitioned or no LoadBalancer at partition()\n";
     return -1;
   }
   
@@ -1562,6 +1184,10 @@ DomainPartitioner::releaseVertex(int from,
       maxAttraction = attraction(j);
     }
 
+  // an interior vertex is not attracted to any other partition
+  if (maxAttraction == 0)
+    return 0;
+
   // swap the vertex
   if (mustReleaseToLighter == false)
     return swapVertex(from, partition, vertexTag, adjacentVertexNotInOther);
@@ -1569,18 +1195,25 @@ DomainPartitioner::releaseVertex(int from,
   else { // check the other partition has a lighter load
     Vertex *fromVertex = theWeightedPartitionGraph.getVertexPtr(from);
     Vertex *toVertex = theWeightedPartitionGraph.getVertexPtr(partition);	    
+    if (fromVertex == 0 || toVertex == 0)
+      return 0;
     
     double fromWeight = fromVertex->getWeight();
     double toWeight  = toVertex->getWeight();
-    
-    if (fromWeight == toWeight)
-      opserr << "DomainPartitioner::releaseVertex - TO CHANGE >= to >\n";
-
-    if (fromWeight >= toWeight) {
-      if (toWeight == 0.0) 
-	return swapVertex(from,partition,vertexTag,adjacentVertexNotInOther);	    
-      if (fromWeight/toWeight > factorGreater)        
-	return swapVertex(from,partition,vertexTag,adjacentVertexNotInOther);	    
+
+    if (fromWeight > toWeight && 
+	(toWeight == 0.0 || fromWeight/toWeight > factorGreater)) {
+      int numFrom = partitionSizes(from);
+      int res = swapVertex(from,partition,vertexTag,adjacentVertexNotInOther);
+
+      // the element takes the mean cost of the elements of from along, so
+      // that the following releases see the loads as they will be
+      if (res == 0 && numFrom > 0) {
+	double eleWeight = fromWeight/numFrom;
+	fromVertex->setWeight(fromWeight - eleWeight);
+	toVertex->setWeight(toWeight + eleWeight);
+      }
+      return res;
     }
   }
   
@@ -1597,9 +1230,9 @@ DomainPartitioner::releaseBoundary(int from,
            bool adjacentVertexNotInOther)
 {
     // check that the object did the partitioning
-    if (partitionFlag == false) {
-      opserr << "DomainPartitioner::balance(const Vector &load)";
-      opserr << " - not partitioned or DomainPartitioner did not partition\n";
+    if (partitionFlag == false || theElementGraph == 0) {
+      opserr << "DomainPartitioner::releaseBoundary";
+      opserr << " - not partitioned or no LoadBalancer at partition()\n";
       return -1;
     }
 
@@ -1614,29 +1247,26 @@ DomainPartitioner::releaseBoundary(int from,
     //    Graph &theEleGraph = myDomain->getElementGraph();    
     Graph *fromBoundary = theBoundaryElements[from-1];
 
-    // into a new graph place the vertices on the fromBoundary
+    // collect the tags of the vertices on the fromBoundary
     // we cannot use fromBoundary as this would empty all the nodes
     // as fromBoundary changes in called methods
-
-    Graph *swapVertices = new Graph(fromBoundary->getNumVertex());
+    ID swapVertices(0, fromBoundary->getNumVertex()+1);
+    int numSwap = 0;
 
     VertexIter &swappableVertices = fromBoundary->getVertices();
     Vertex *vertexPtr;
 
     while ((vertexPtr = swappableVertices()) != 0) 
-      swapVertices->addVertex(vertexPtr,false);
+      swapVertices[numSwap++] = vertexPtr->getTag();
 
     // release all the vertices in the swapVertices
-    VertexIter &verticesToSwap = swapVertices->getVertices();
-    while ((vertexPtr = verticesToSwap()) != 0)
+    for (int i=0; i<numSwap; i++)
       releaseVertex(from,
-		    vertexPtr->getTag(),
+		    swapVertices(i),
 		    theWeightedPartitionGraph,
 		    mustReleaseToLighter,
 		    factorGreater,
 		    adjacentVertexNotInOther);
-    
-    delete swapVertices;    
 
     return 0;
 }
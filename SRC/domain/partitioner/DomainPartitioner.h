@@ -39,12 +39,14 @@
 #endif
 
 #include <ID.h>
+#include <map>
 
 class GraphPartitioner;
 class LoadBalancer;
 class PartitionedDomain;
 class Vector;
 class Graph;
+class Vertex;
 class TaggedObjectStorage;
 
 class DomainPartitioner
@@ -62,6 +64,11 @@ class DomainPartitioner
 
     virtual int balance(Graph &theWeightedSubdomainGraph);
 
+    // balance() invokes the LoadBalancer only if the measured cost of the
+    // heaviest subdomain exceeds threshold times the mean cost
+    void   setImbalanceThreshold(double threshold);
+    double getImbalanceThreshold(void) const;
+
     // public member functions needed by the load balancer
     virtual int getNumPartitions(void) const;
     virtual Graph &getPartitionGraph(void);
@@ -94,6 +101,9 @@ class DomainPartitioner
   protected:    
     
   private:
+    void clearBoundaryElements(void);
+    void updateBoundary(Vertex *theVertex);
+
     PartitionedDomain *myDomain; 
     GraphPartitioner  &thePartitioner;
     LoadBalancer      *theBalancer;    
@@ -109,6 +119,12 @@ class DomainPartitioner
     
     bool usingMainDomain;
     int mainPartition;
+
+    double imbalanceThreshold;
+    int numSwapped;                     // elements moved in the current balance()
+    ID partitionSizes;                  // number of elements in each partition
+    std::map<int, ID> elementNodes;     // nodes of the elements, by element tag
+    ID loadedElements;                  // elements with elemental loads
 };
 
 #endif
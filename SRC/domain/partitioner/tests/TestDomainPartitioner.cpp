@@ -0,0 +1,217 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Purpose: This file is a driver to test the DomainPartitioner. A planar
+// truss girder is analysed in a plain Domain and in a PartitionedDomain
+// split by Metis into two Subdomains, which are condensed onto their
+// boundary by a SubstructuringAnalysis. After every step the Subdomains
+// are rebalanced by a ShedHeaviest balancer, which moves elements between
+// them. The displacements of the partitioned model must be those of the
+// unpartitioned one after the partitioning and after every rebalance.
+//
+// Returns 0 when the test passes.
+//
+#include <stdio.h>
+#include <math.h>
+
+#include <Domain.h>
+#include <PartitionedDomain.h>
+#include <Subdomain.h>
+#include <SubdomainIter.h>
+#include <Node.h>
+#include <Truss.h>
+#include <ElasticMaterial.h>
+#include <SP_Constraint.h>
+#include <NodalLoad.h>
+#include <LoadPattern.h>
+#include <LinearSeries.h>
+#include <Vector.h>
+
+#include <DomainPartitioner.h>
+#include <Metis.h>
+#include <ShedHeaviest.h>
+
+#include <AnalysisModel.h>
+#include <PlainHandler.h>
+#include <DOF_Numberer.h>
+#include <RCM.h>
+#include <Linear.h>
+#include <DomainDecompAlgo.h>
+#include <LoadControl.h>
+#include <ProfileSPDLinSOE.h>
+#include <ProfileSPDLinDirectSolver.h>
+#include <ProfileSPDLinSubstrSolver.h>
+#include <StaticAnalysis.h>
+#include <SubstructuringAnalysis.h>
+
+static const int    numPanels = 24;
+static const int    numSteps  = 4;
+static const double tol       = 1.0e-10;
+
+//
+// Girder with nodes 1..numPanels+1 along the bottom chord and
+// 1001..1001+numPanels along the top chord, pinned at both ends of
+// the bottom chord and loaded down at the top chord. The support at
+// midspan ends up on the boundary between the Subdomains.
+//
+static void
+buildModel(Domain &theDomain)
+{
+  ElasticMaterial theMaterial(1, 1000.0);
+
+  for (int i=0; i<=numPanels; i++) {
+    theDomain.addNode(new Node(i+1,    2, i*1.0, 0.0));
+    theDomain.addNode(new Node(i+1001, 2, i*1.0, 1.0));
+  }
+
+  int eleTag = 1;
+  for (int i=1; i<=numPanels; i++) {
+    theDomain.addElement(new Truss(eleTag++, 2, i,      i+1,    theMaterial, 1.0));
+    theDomain.addElement(new Truss(eleTag++, 2, i+1000, i+1001, theMaterial, 1.0));
+    theDomain.addElement(new Truss(eleTag++, 2, i+1,    i+1001, theMaterial, 1.0));
+    theDomain.addElement(new Truss(eleTag++, 2, i,      i+1001, theMaterial, 1.0));
+  }
+  theDomain.addElement(new Truss(eleTag++, 2, 1, 1001, theMaterial, 1.0));
+
+  theDomain.addSP_Constraint(new SP_Constraint(1, 0, 0.0, true));
+  theDomain.addSP_Constraint(new SP_Constraint(1, 1, 0.0, true));
+  theDomain.addSP_Constraint(new SP_Constraint(numPanels+1, 1, 0.0, true));
+  theDomain.addSP_Constraint(new SP_Constraint(numPanels/2+1, 1, 0.0, true));
+
+  LoadPattern *thePattern = new LoadPattern(1);
+  thePattern->setTimeSeries(new LinearSeries());
+  theDomain.addLoadPattern(thePattern);
+
+  Vector load(2);
+  load(1) = -1.0;
+  int loadTag = 1;
+  for (int i=0; i<=numPanels; i++)
+    theDomain.addNodalLoad(new NodalLoad(loadTag++, i+1001, load), 1);
+}
+
+static StaticAnalysis *
+createAnalysis(Domain &theDomain)
+{
+  ProfileSPDLinSolver *theSolver = new ProfileSPDLinDirectSolver();
+  return new StaticAnalysis(theDomain,
+                            *new PlainHandler(),
+                            *new DOF_Numberer(*new RCM()),
+                            *new AnalysisModel(),
+                            *new Linear(),
+                            *new ProfileSPDLinSOE(*theSolver),
+                            *new LoadControl(1.0/numSteps, 1, 1.0/numSteps, 1.0/numSteps));
+}
+
+//
+// Condense each Subdomain onto its boundary nodes
+//
+static void
+createSubstructuringAnalyses(PartitionedDomain &theDomain)
+{
+  SubdomainIter &theSubdomains = theDomain.getSubdomains();
+  Subdomain *theSub;
+  while ((theSub = theSubdomains()) != 0) {
+    ProfileSPDLinSubstrSolver *theSolver = new ProfileSPDLinSubstrSolver();
+    new SubstructuringAnalysis(*theSub,
+                               *new PlainHandler(),
+                               *new DOF_Numberer(*new RCM()),
+                               *new AnalysisModel(),
+                               *new DomainDecompAlgo(),
+                               *new LoadControl(1.0/numSteps, 1, 1.0/numSteps, 1.0/numSteps),
+                               *new ProfileSPDLinSOE(*theSolver),
+                               *theSolver,
+                               nullptr);
+  }
+}
+
+//
+// Largest difference between the nodal displacements of the two
+// domains, relative to the largest displacement of the first
+//
+static double
+compare(Domain &theDomain, PartitionedDomain &thePartitionedDomain)
+{
+  double scale = 0.0;
+  double error = 0.0;
+  for (int i=0; i<=numPanels; i++) {
+    const int nodes[2] = {i+1, i+1001};
+    for (int node : nodes)
+      for (int dof=1; dof<=2; dof++) {
+        int flag;
+        double exact = theDomain.getNodeDisp(node, dof, flag);
+        double value = thePartitionedDomain.getNodeDisp(node, dof, flag);
+        if (flag != 0)
+          return -1.0;
+        scale = fmax(scale, fabs(exact));
+        error = fmax(error, fabs(value - exact));
+      }
+  }
+  return scale > 0.0 ? error/scale : -1.0;
+}
+
+int
+main(int argc, char **argv)
+{
+  int result = 0;
+
+  // unpartitioned model
+  Domain theDomain;
+  buildModel(theDomain);
+  StaticAnalysis *theAnalysis = createAnalysis(theDomain);
+
+  // partitioned model, rebalanced whenever the subdomains are
+  // measured to be out of balance at all
+  Metis theMetis;
+  ShedHeaviest theBalancer;
+  DomainPartitioner thePartitioner(theMetis, theBalancer);
+  thePartitioner.setImbalanceThreshold(1.0);
+
+  PartitionedDomain thePartitionedDomain(thePartitioner);
+  buildModel(thePartitionedDomain);
+  thePartitionedDomain.addSubdomain(new Subdomain(1));
+  thePartitionedDomain.addSubdomain(new Subdomain(2));
+  if (thePartitionedDomain.partition(2) < 0) {
+    fprintf(stderr, "FAILED - the domain could not be partitioned\n");
+    return -1;
+  }
+  createSubstructuringAnalyses(thePartitionedDomain);
+  StaticAnalysis *thePartitionedAnalysis = createAnalysis(thePartitionedDomain);
+
+  int moved = 0;
+  for (int step=1; step<=numSteps; step++) {
+    int numElements[2];
+    for (int i=0; i<2; i++)
+      numElements[i] = thePartitionedDomain.getSubdomainPtr(i+1)->getNumElements();
+
+    if (theAnalysis->analyze(1) < 0 || thePartitionedAnalysis->analyze(1) < 0) {
+      fprintf(stderr, "FAILED - the analysis failed in step %d\n", step);
+      return -1;
+    }
+
+    // the analysis of this step was done on the partitions its
+    // predecessor left; commit() has since rebalanced them
+    double error = compare(theDomain, thePartitionedDomain);
+    printf("%5d %10d %10d %15.3e\n", step, numElements[0], numElements[1], error);
+    if (error < 0.0 || error > tol) {
+      fprintf(stderr, "FAILED - step %d differs from the unpartitioned model by %e\n", step, error);
+      result = -1;
+    }
+
+    for (int i=0; i<2; i++)
+      if (thePartitionedDomain.getSubdomainPtr(i+1)->getNumElements() != numElements[i])
+        moved++;
+  }
+
+  if (moved == 0) {
+    fprintf(stderr, "FAILED - no elements were moved between the subdomains\n");
+    result = -1;
+  }
+
+  if (result == 0)
+    printf("PASSED - partitioned and rebalanced results match\n");
+
+  return result;
+}
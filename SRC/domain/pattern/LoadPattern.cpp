@@ -875,7 +875,9 @@ LoadPattern *LoadPattern::getCopy(void)
   theCopy->loadFactor  = loadFactor;
   theCopy->scaleFactor = scaleFactor;
   theCopy->isConstant  = isConstant;
-  theCopy->theSeries   = theSeries;
+  // the copy deletes its series, so it gets one of its own
+  if (theSeries != 0)
+    theCopy->theSeries = theSeries->getCopy();
   return theCopy;
 }
 
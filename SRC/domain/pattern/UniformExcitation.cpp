@@ -39,7 +39,6 @@
 
 // void* OPS_ADD_RUNTIME_VPV(OPS_TimeSeriesIntegrator);
 
-
 UniformExcitation::UniformExcitation()
 :EarthquakePattern(0, PATTERN_TAG_UniformExcitation), 
  theMotion(0), theDof(0), vel0(0.0), fact(0.0)
@@ -60,7 +59,6 @@ UniformExcitation::UniformExcitation(GroundMotion &_theMotion,
 
 UniformExcitation::~UniformExcitation()
 {
-
 }
 
 
@@ -95,6 +93,18 @@ UniformExcitation::setDomain(Domain *theDomain)
 {
   this->LoadPattern::setDomain(theDomain);
 
+  if (theDomain == nullptr)
+    return;
+
+  // a pattern that was deleted may have had the same address; the
+  // influence matrices it left on the nodes are not ours
+  {
+    NodeIter &theNodes = theDomain->getNodes();
+    Node *theNode;
+    while ((theNode = theNodes()) != nullptr)
+      theNode->setR_Source(nullptr, -1);
+  }
+
   // now we go through and set all the node velocities to be vel0 
   // for those nodes not fixed in the dirn!
   if (vel0 != 0.0) {
@@ -137,61 +147,70 @@ UniformExcitation::applyLoad(double time)
     Domain *theDomain = this->getDomain();
     if (theDomain == nullptr)
         return;
-    
+
+    // the influence matrix of a node depends only on the node, so it is
+    // formed again only if the model or the node has changed; the nodes
+    // keep the matrices of the patterns acting in other directions
+    const int stamp = theDomain->hasDomainChanged();
     NodeIter &theNodes = theDomain->getNodes();
     Node *theNode;
     while ((theNode = theNodes()) != nullptr) {
-        theNode->setNumColR(1);
-
-        const Vector &crds=theNode->getCrds();
-        int ndm = crds.Size();
-        
-        if (ndm == 1) {
-          if (theDof < 1) {
-            theNode->setR(theDof, 0, fact);
-          }
-        }
-        else if (ndm == 2) {
-            if (theDof < 2) {
-                theNode->setR(theDof, 0, fact);
-            }
-            else if (theDof == 2) {
-                double xCrd = crds(0);
-                double yCrd = crds(1);
-                theNode->setR(0, 0, -fact*yCrd);
-                theNode->setR(1, 0,  fact*xCrd);
-                theNode->setR(2, 0,  fact);
-            }
-        }
-        else if (ndm == 3) {
-            // Translational DOF
-            if (theDof < 3) {
-                theNode->setR(theDof, 0, fact);
-            }
-
-            // Rotational DOFs
-            else if (theDof == 3) {
-                double yCrd = crds(1);
-                double zCrd = crds(2);
-                theNode->setR(1, 0, -fact*zCrd);
-                theNode->setR(2, 0,  fact*yCrd);
-                theNode->setR(3, 0,  fact);
-            }
-            else if (theDof == 4) {
-                double xCrd = crds(0);
-                double zCrd = crds(2);
-                theNode->setR(0, 0,  fact*zCrd);
-                theNode->setR(2, 0, -fact*xCrd);
-                theNode->setR(4, 0,  fact);
-            }
-            else if (theDof == 5) {
-                double xCrd = crds(0);
-                double yCrd = crds(1);
-                theNode->setR(0, 0, -fact*yCrd);
-                theNode->setR(1, 0,  fact*xCrd);
-                theNode->setR(5, 0,  fact);
-            }
+      if (theNode->useR_Source(this, stamp))
+        continue;
+
+      theNode->setNumColR(1);
+
+      const Vector &crds=theNode->getCrds();
+      int ndm = crds.Size();
+    
+      if (ndm == 1) {
+        if (theDof < 1) {
+          theNode->setR(theDof, 0, fact);
         }
+      }
+      else if (ndm == 2) {
+          if (theDof < 2) {
+              theNode->setR(theDof, 0, fact);
+          }
+          else if (theDof == 2) {
+              double xCrd = crds(0);
+              double yCrd = crds(1);
+              theNode->setR(0, 0, -fact*yCrd);
+              theNode->setR(1, 0,  fact*xCrd);
+              theNode->setR(2, 0,  fact);
+          }
+      }
+      else if (ndm == 3) {
+          // Translational DOF
+          if (theDof < 3) {
+              theNode->setR(theDof, 0, fact);
+          }
+
+          // Rotational DOFs
+          else if (theDof == 3) {
+              double yCrd = crds(1);
+              double zCrd = crds(2);
+              theNode->setR(1, 0, -fact*zCrd);
+              theNode->setR(2, 0,  fact*yCrd);
+              theNode->setR(3, 0,  fact);
+          }
+          else if (theDof == 4) {
+              double xCrd = crds(0);
+              double zCrd = crds(2);
+              theNode->setR(0, 0,  fact*zCrd);
+              theNode->setR(2, 0, -fact*xCrd);
+              theNode->setR(4, 0,  fact);
+          }
+          else if (theDof == 5) {
+              double xCrd = crds(0);
+              double yCrd = crds(1);
+              theNode->setR(0, 0, -fact*yCrd);
+              theNode->setR(1, 0,  fact*xCrd);
+              theNode->setR(5, 0,  fact);
+          }
+      }
+
+      theNode->setR_Source(this, stamp);
     }
     
     this->EarthquakePattern::applyLoad(time);
@@ -49,6 +49,7 @@ class UniformExcitation : public EarthquakePattern
     void applyLoad(double time);
     void Print(OPS_Stream &s, int flag =0);
     int getDirection(void) {return theDof;}
+    double getFactor(void) const {return fact;}
     int sendSelf(int commitTag, Channel &theChannel);
     int recvSelf(int commitTag, Channel &theChannel, 
 		 FEM_ObjectBroker &theBroker);    
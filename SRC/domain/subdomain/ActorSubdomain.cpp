@@ -166,9 +166,11 @@ ActorSubdomain::run(void)
 	    msgData(0) = theID->Size();
 	    msgData(1) = this->getNumDOF();
 
+	    this->startBatch();
 	    this->sendID(msgData);
 	    if (theID->Size() != 0)
 	      this->sendID(*theID);
+	    this->endBatch();
 	    break;
 
 	  case ShadowActorSubdomain_getCost:
@@ -632,6 +634,8 @@ ActorSubdomain::run(void)
 
 	  case ShadowActorSubdomain_update:
 	    this->update();
+	    // finish the replies still in flight before the tangent is formed
+	    this->progress();
 	    break;
 
 	  case ShadowActorSubdomain_updateTimeDt:
@@ -846,6 +850,7 @@ ActorSubdomain::run(void)
 	    dbTag = msgData(2); // dof
 	    doubleRes = this->getNodeDisp(tag, dbTag, intRes);
 	    msgData(0) = intRes;
+	    this->startBatch();
 	    this->sendID(msgData);
 	    if (intRes == 0) {
 	      theV = new Vector(1);
@@ -853,6 +858,7 @@ ActorSubdomain::run(void)
 	      this->sendVector(*theV);
 	      delete theV;
 	    }
+	    this->endBatch();
 	    break;
 
 	  case ShadowActorSubdomain_setMass:
@@ -880,10 +886,12 @@ ActorSubdomain::run(void)
 	      msgData(0) = 1;
 	      msgData(1) = theVector->Size();
 	    }
+	    this->startBatch();
 	    this->sendID(msgData);
 
 	    if (theVector != 0)
 	      this->sendVector(*theVector);
+	    this->endBatch();
 
 	    break;
 
@@ -937,10 +945,12 @@ ActorSubdomain::run(void)
 	      msgData(0) = 1;
 	      msgData(1) = theVector->Size();
 	    }
+	    this->startBatch();
 	    this->sendID(msgData);
 
 	    if (theVector != 0)
 	      this->sendVector(*theVector);
+	    this->endBatch();
       
 	    break;
 
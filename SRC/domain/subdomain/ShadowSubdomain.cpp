@@ -1205,9 +1205,11 @@ int ShadowSubdomain::computeNodalResponse(void)
         opserr << msgData(1) << "do not agree?\n";
         numDOF = msgData(1);
       }
-      this->sendID(msgData);
       Vector theChange(lastChange);
+      this->startBatch();
+      this->sendID(msgData);
       this->sendVector(theChange);
+      this->endBatch();
     }
   }
 
@@ -1217,12 +1219,14 @@ int ShadowSubdomain::computeNodalResponse(void)
 int ShadowSubdomain::analysisStep(double dT)
 {
   msgData(0) = ShadowActorSubdomain_analysisStep;
-  this->sendID(msgData);
 
   static Vector timeStep(4);
   timeStep(0) = dT;
 
+  this->startBatch();
+  this->sendID(msgData);
   this->sendVector(timeStep);
+  this->endBatch();
 
   return 0;
 }
@@ -1493,11 +1497,13 @@ int ShadowSubdomain::updateParameter(int tag, double value)
   msgData(0) = ShadowActorSubdomain_updateParameterDOUBLE;
   msgData(1) = tag;
 
-  this->sendID(msgData);
-
   static Vector data(1);
   data(0) = value;
+
+  this->startBatch();
+  this->sendID(msgData);
   this->sendVector(data);
+  this->endBatch();
 
   if (this->recvID(msgData) != 0) {
     opserr << "ShadowSubdomain::updateParameterD ERROR 4\n";
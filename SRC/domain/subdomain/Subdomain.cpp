@@ -35,6 +35,7 @@
 
 #include <Subdomain.h>
 #include <stdlib.h>
+#include <chrono>
 
 #include <Element.h>
 #include <TaggedObject.h>
@@ -357,10 +358,18 @@ Subdomain::revertToStart(void)
     return 0;
 }
 
+// the time spent updating the elements is accumulated as the cost
+// of the subdomain returned by getCost(), which starts it again from
+// zero, so that each rebalance sees the cost since the last one;
+// update(newTime, dT) reaches it through Domain::update(newTime, dT)
 int
 Subdomain::update(void)
 {
-  return this->Domain::update();
+  auto start = std::chrono::steady_clock::now();
+  int res = this->Domain::update();
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  realCost += elapsed.count();
+  return res;
 }
 
 int
@@ -750,6 +759,10 @@ void
 Subdomain::setFE_ElementPtr(FE_Element *theFE_Ele)
 {
     theFEele = theFE_Ele;
+
+    // a new FE_Element follows a change in the domain, after which
+    // the external equations of the analysis may have been renumbered
+    mapBuilt = false;
 }
 
 
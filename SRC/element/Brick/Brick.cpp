@@ -645,6 +645,35 @@ const Vector&  Brick::getResistingForceIncInertia( )
 }
 
 
+//get tangent and residual from one pass over the gauss points
+int
+Brick::getTangentAndResistingForce(const Matrix *&tangent, const Vector *&force, bool inertia)
+{
+  static Vector res(24);
+
+  int tang_flag = 1 ; //get the tangent
+
+  formResidAndTangent( tang_flag ) ;
+
+  //formInertiaTerms adds to resid, so it is copied once complete
+  if (inertia)
+    formInertiaTerms( 0 ) ;
+
+  res = resid;
+
+  // add the damping forces if rayleigh damping
+  if (inertia && (alphaM != 0.0 || betaK != 0.0 || betaK0 != 0.0 || betaKc != 0.0))
+    res += this->getRayleighDampingForces();
+
+  if (load != 0)
+    res -= *load;
+
+  tangent = &stiff;
+  force   = &res;
+  return 0;
+}
+
+
 //*********************************************************************
 //form inertia terms
 
@@ -112,6 +112,10 @@ class Brick : public Element {
     //get residual with inertia terms
     const Vector &getResistingForceIncInertia( ) ;
 
+    //get tangent and residual from one pass over the gauss points
+    int getTangentAndResistingForce(const Matrix *&tangent,
+                                    const Vector *&force, bool inertia) ;
+
     // public methods for element output
     int sendSelf (int commitTag, Channel &theChannel);
     int recvSelf (int commitTag, Channel &theChannel, FEM_ObjectBroker 
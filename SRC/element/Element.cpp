@@ -39,7 +39,7 @@
 #include <Node.h>
 #include <Domain.h>
 
-Element  *ops_TheActiveElement = 0;
+thread_local Element *ops_TheActiveElement = 0;
 
 Matrix **Element::theMatrices; 
 Vector **Element::theVectors1; 
@@ -53,7 +53,8 @@ int  Element::numMatrices(0);
 Element::Element(int tag, int cTag) 
   :DomainComponent(tag, cTag), alphaM(0.0), 
   betaK(0.0), betaK0(0.0), betaKc(0.0), 
-      Kc(0), previousK(0), numPreviousK(0), index(-1), nodeIndex(-1)
+      Kc(0), previousK(0), numPreviousK(0), index(-1), nodeIndex(-1),
+      measuredCost(0.0)
       /* is_this_element_active(true) */
 {
   // does nothing
@@ -93,6 +94,19 @@ Element::revertToStart(void)
   return 0;
 }
 
+// the latest update weighs a tenth, so a change in the cost of the element,
+// as when it yields, shows after a few tens of updates; a cost that has
+// not been measured yet takes the first time in full
+void
+Element::addMeasuredCost(double seconds)
+{
+  const double decay = 0.9;
+  if (measuredCost == 0.0)
+    measuredCost = seconds;
+  else
+    measuredCost = decay*measuredCost + (1.0 - decay)*seconds;
+}
+
 
 void 
 Element::zeroLoad(void)
@@ -285,6 +299,17 @@ Element::getResistingForceIncInertia(void)
 }
 
 
+int
+Element::getTangentAndResistingForce(const Matrix *&tangent, const Vector *&force, bool inertia)
+{
+  // not formed together; the caller falls back on getTangentStiff()
+  // and getResistingForce()
+  tangent = nullptr;
+  force   = nullptr;
+  return 0;
+}
+
+
 const Vector &
 Element::getRayleighDampingForces(void) 
 {
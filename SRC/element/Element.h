@@ -60,6 +60,13 @@ class Element : public DomainComponent
     virtual int  revertToStart();
     virtual int  update();
     virtual bool isSubdomain();
+
+    // time spent in update(), kept by the Domain while it measures the
+    // cost of its elements (see Domain::setMeasureElementCost) as a
+    // decaying average, so that the cost follows the recent updates
+    void   addMeasuredCost(double seconds);
+    double getMeasuredCost() const {return measuredCost;}
+    void   resetMeasuredCost() {measuredCost = 0.0;}
     
     // methods to return the current linearized stiffness,
     // damping and mass matrices
@@ -81,6 +88,17 @@ class Element : public DomainComponent
     virtual const Vector &getResistingForce() =0;
     virtual const Vector &getResistingForceIncInertia();
 
+    // method for obtaining the tangent and the resisting force at the
+    // current trial state together; the force includes the inertia and
+    // damping terms when inertia is true. Elements that form both in the
+    // same pass over their integration points may override this; the
+    // references must stay valid while the damping and mass matrices are
+    // requested. The default leaves both null, and callers then use
+    // getTangentStiff() and getResistingForce() separately.
+    virtual int getTangentAndResistingForce(const Matrix *&tangent,
+                                            const Vector *&force,
+                                            bool inertia = false);
+
     // method for obtaining information specific to an element
     virtual Response *setResponse(const char **argv, int argc, 
 				  OPS_Stream &theHandler);
@@ -119,6 +137,7 @@ private:
     bool is_this_element_active;
 
     int index, nodeIndex;
+    double measuredCost;
     static Matrix ** theMatrices; 
     static Vector ** theVectors1; 
     static Vector ** theVectors2; 
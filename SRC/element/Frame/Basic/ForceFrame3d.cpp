@@ -59,6 +59,9 @@
 #include <ElementResponse.h>
 #include <CompositeResponse.h>
 #include <ElementalLoad.h>
+#ifdef _OPENMP
+#  include <omp.h>
+#endif
 
 #define ELE_TAG_ForceFrame3d 0 // TODO
 
@@ -71,7 +74,7 @@
 ForceFrame3d::ForceFrame3d()
  : BasicFrame3d(0, ELE_TAG_ForceFrame3d),
    stencil(nullptr),
-   max_iter(0), tol(0.0),
+   max_iter(0), tol(0.0), parallel_sections(false),
    state_flag(0),
    density(0.0), mass_flag(0), use_density(false),
    mass_initialized(false),
@@ -89,7 +92,8 @@ ForceFrame3d::ForceFrame3d(int tag, std::array<int, 2>& nodes,
                            BeamIntegration& bi,
                            FrameTransform3d& coordTransf, 
                            double dens, int mass_flag_, bool use_density_,
-                           int max_iter_, double tolerance
+                           int max_iter_, double tolerance,
+                           bool parallel
                            )
  : BasicFrame3d(tag, ELE_TAG_ForceFrame3d, nodes, coordTransf),
    stencil(nullptr),
@@ -97,7 +101,7 @@ ForceFrame3d::ForceFrame3d(int tag, std::array<int, 2>& nodes,
    Ki(nullptr),
    density(dens), mass_flag(mass_flag_), use_density(use_density_),
    mass_initialized(false),
-   max_iter(max_iter_), tol(tolerance),
+   max_iter(max_iter_), tol(tolerance), parallel_sections(parallel),
    parameterID(0)
 {
   K_pres.zero();
@@ -436,6 +440,7 @@ ForceFrame3d::update()
   THREAD_LOCAL VectorND<nsr>     es_trial[maxNumSections]; //  strain
   THREAD_LOCAL VectorND<nsr>     sr_trial[maxNumSections]; //  stress resultant
   THREAD_LOCAL MatrixND<nsr,nsr> Fs_trial[maxNumSections]; //  flexibility
+  THREAD_LOCAL VectorND<nsr>     si_trial[maxNumSections]; //  interpolated force
 
 
   // If we have completed a recvSelf() do a revertToLastCommit()
@@ -550,16 +555,19 @@ ForceFrame3d::update()
         vr[4] += v0[4];
 
         //
-        // Gauss Loop
+        // Section state determination
+        //
+        // The sections are independent within an iteration, so their
+        // states are determined first, and their contributions to F and
+        // vr are then summed in section order so the result does not
+        // depend on the number of threads. The states are determined in
+        // parallel only when requested with -parallel and built with
+        // OpenMP, since the materials of some sections (e.g. the
+        // BeamFiber wrappers of nD materials) keep class-static scratch.
         //
         for (int i = 0; i < points.size(); i++) {
             double xL = points[i].point;
             double xL1 = xL - 1.0;
-            double wtL = points[i].weight * L;
-
-            auto& Fs = Fs_trial[i];
-            auto& sr = sr_trial[i];
-            FrameSection& section = *points[i].material;
 
             //
             // a. Calculate interpolated section force
@@ -569,7 +577,7 @@ ForceFrame3d::update()
             // Interpolation of q_trial
             //    b*q_trial
             //
-            VectorND<nsr> si {  // use layout declared in this::scheme
+            si_trial[i] = VectorND<nsr> {  // use layout declared in this::scheme
                  q_trial[0],                           // N
                  (q_trial[1] + q_trial[2])/L,          // VY
                  (q_trial[3] + q_trial[4])/L,          // VZ
@@ -580,8 +588,28 @@ ForceFrame3d::update()
             // Add the effects of element loads
             // si += bp*w
             if (eleLoads.size() != 0)
-              this->addLoadAtSection(si, points[i].point * L);
+              this->addLoadAtSection(si_trial[i], points[i].point * L);
+        }
 
+        {
+          // Refer to the scratch arrays through pointers so that worker
+          // threads see the arrays of the calling thread
+          VectorND<nsr>*     const es_i = es_trial;
+          VectorND<nsr>*     const sr_i = sr_trial;
+          VectorND<nsr>*     const si_i = si_trial;
+          MatrixND<nsr,nsr>* const Fs_i = Fs_trial;
+          const int numSections = points.size();
+          int failed = 0;
+
+#ifdef _OPENMP
+          // Sections are only shared out when this element is not itself
+          // being updated in a parallel region, so the two levels do not
+          // compete for the same cores
+          const bool shared = parallel_sections && numSections > 1 && !omp_in_parallel();
+#pragma omp parallel for schedule(static) if(shared) reduction(+:failed)
+#endif
+          for (int i = 0; i < numSections; i++) {
+            FrameSection& section = *points[i].material;
 
             //
             // b. Compute section strain es_trial
@@ -594,15 +622,15 @@ ForceFrame3d::update()
 
               // Form stress increment ds
               // ds = si - sr(e);
-              ds = si;
-              ds.addVector(1.0, sr, -1.0);
+              ds = si_i[i];
+              ds.addVector(1.0, sr_i[i], -1.0);
 
               // Add strain correction
               //    es += Fs * ds;
               switch (strategy) {
                 case Strategy::Newton:
                   //  regular Newton
-                  es_trial[i].addMatrixVector(1.0, Fs, ds, 1.0);
+                  es_i[i].addMatrixVector(1.0, Fs_i[i], ds, 1.0);
                   break;
 
                 case Strategy::InitialThenNewton:
@@ -610,15 +638,15 @@ ForceFrame3d::update()
                   //  otherwise regular Newton
                   if (j == 0) {
                     MatrixND<nsr,nsr> Fs0 = section.getFlexibility<nsr,scheme>(State::Init);
-                    es_trial[i].addMatrixVector(1.0, Fs0, ds, 1.0);
+                    es_i[i].addMatrixVector(1.0, Fs0, ds, 1.0);
                   } else
-                    es_trial[i].addMatrixVector(1.0, Fs, ds, 1.0);
+                    es_i[i].addMatrixVector(1.0, Fs_i[i], ds, 1.0);
                   break;
 
                 case Strategy::InitialIterations:
                   //  Newton with initial tangent
                   MatrixND<nsr,nsr> Fs0 = section.getFlexibility<nsr,scheme>(State::Init);
-                  es_trial[i].addMatrixVector(1.0, Fs0, ds, 1.0);
+                  es_i[i].addMatrixVector(1.0, Fs0, ds, 1.0);
                   break;
               }
             }
@@ -627,14 +655,32 @@ ForceFrame3d::update()
             //
             // c. Set trial section state and get response
             //
-            if (section.setTrialState<nsr,scheme>(es_trial[i]) < 0) {
-              opserr << "ForceFrame3d::update - section failed in setTrial\n";
-              return -1;
+            if (section.setTrialState<nsr,scheme>(es_i[i]) < 0) {
+              failed++;
+              continue;
             }
 
-            sr_trial[i] = section.getResultant<nsr, scheme>();
-            Fs_trial[i] = section.getFlexibility<nsr, scheme>();
+            sr_i[i] = section.getResultant<nsr, scheme>();
+            Fs_i[i] = section.getFlexibility<nsr, scheme>();
+          }
+
+          if (failed != 0) {
+            opserr << "ForceFrame3d::update - section failed in setTrial\n";
+            return -1;
+          }
+        }
+
+        //
+        // Gauss Loop
+        //
+        for (int i = 0; i < points.size(); i++) {
+            double xL = points[i].point;
+            double xL1 = xL - 1.0;
+            double wtL = points[i].weight * L;
 
+            auto& Fs = Fs_trial[i];
+            auto& sr = sr_trial[i];
+            const VectorND<nsr>& si = si_trial[i];
             //
             // d. Integrate element flexibility matrix
             //
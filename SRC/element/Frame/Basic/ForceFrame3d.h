@@ -31,7 +31,8 @@ class ForceFrame3d: public BasicFrame3d
                BeamIntegration &beamIntegr,
                FrameTransform3d &coordTransf, 
                double density, int mass_flag, bool use_density,
-               int max_iter, double tolerance
+               int max_iter, double tolerance,
+               bool parallel = false
   );
 
   ForceFrame3d();
@@ -163,6 +164,7 @@ class ForceFrame3d: public BasicFrame3d
 
   int    max_iter;               // maximum number of local iterations
   double tol;	                   // tolerance for relative energy norm for local iterations
+  bool   parallel_sections;      // share the section state determination out between threads
 
 
   // Element state
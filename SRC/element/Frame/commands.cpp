@@ -187,6 +187,7 @@ struct Options {
   int mass_flag;
   int shear_flag;
   int geom_flag;
+  bool parallel;
 };
 
 
@@ -255,6 +256,7 @@ CreatePrismaticFrame(std::string);
 //      "-mass-form" $form
 //
 //      "-iter" $iter $tol, 
+//      "-parallel"
 //      
 //      "-integration" $Integration
 //        - first try parsing $Integration as integer ($itag, form (iii))
@@ -380,6 +382,7 @@ TclBasicBuilder_addForceBeamColumn(ClientData clientData, Tcl_Interp *interp,
   options.mass_flag  = 0;
   options.shear_flag = 1;
   options.geom_flag  = 0;
+  options.parallel   = false;
 
   int max_iter = 10;
   double tol  = 1.0e-12;
@@ -476,6 +479,12 @@ TclBasicBuilder_addForceBeamColumn(ClientData clientData, Tcl_Interp *interp,
 
       }
 
+      // share the section state determination out between threads
+      else if (strcmp(argv[argi], "-parallel") == 0) {
+        options.parallel = true;
+        argi++;
+      }
+
       // Quadrature
       else if (strcmp(argv[argi], "-integration") == 0) {
         if (argc < argi + 2) {
@@ -815,7 +824,7 @@ TclBasicBuilder_addForceBeamColumn(ClientData clientData, Tcl_Interp *interp,
           theElement = new ForceFrame3d(tag, nodes, sections,
                                         *beamIntegr, *theTransf3d,
                                         mass, options.mass_flag, use_mass,
-                                        max_iter, tol
+                                        max_iter, tol, options.parallel
                                         );
         }
       }
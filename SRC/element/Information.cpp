@@ -259,3 +259,46 @@ Information::getData(void)
   
   return *theVector;
 }
+
+
+int
+Information::bindData(double *data, int size)
+{
+  if (data == nullptr || size <= 0)
+    return -1;
+
+  if (theType == UnknownType
+      || (theType == VectorType && theVector == nullptr)
+      || (theType == IdType && theID == nullptr)
+      || (theType == MatrixType && theMatrix == nullptr))
+    return -1;
+
+  const Vector &current = this->getData();
+  if (current.Size() != size)
+    return -1;
+
+  for (int i=0; i<size; i++)
+    data[i] = current(i);
+
+  // theVector now refers to the caller's storage
+  theVector->setData(data, size);
+
+  return 0;
+}
+
+
+int
+Information::copyData(Vector &V, int loc)
+{
+  const Vector &values = this->getData();
+  int size = values.Size();
+
+  // nothing to do if bound to V at loc
+  if (size == 0 || &V(loc) == &(*theVector)(0))
+    return size;
+
+  for (int i=0; i<size; i++)
+    V(loc+i) = values(i);
+
+  return size;
+}
@@ -71,6 +71,13 @@ class Information
     VIRTUAL void Print(ofstream &s, int flag = 0);
     VIRTUAL const Vector &getData(void);
 
+    // Keep the values returned by getData() in data[0:size], storage
+    // owned by the caller, so that they are written there in place
+    VIRTUAL int bindData(double *data, int size);
+    // Copy the values returned by getData() into V starting at loc,
+    // unless they are already stored there; returns the number of values
+    VIRTUAL int copyData(Vector &V, int loc);
+
     // data that is stored in the information object
     InfoType	theType;    // information about data type
     int		theInt;     // an integer value
@@ -406,11 +406,11 @@ Truss::setDomain(Domain *theDomain)
       if (useInitialDisp && initialDisp == 0) {
 	double iDisp = end2Disp(0)-end1Disp(0);
 
-	if (iDisp != 0) {
-	  initialDisp = new double[1];
-	  initialDisp[0] = iDisp;
-	  dx += iDisp;
-	}
+	// kept even when zero, so that setting the domain again when the
+	// truss is moved to another (sub)domain does not measure it anew
+	initialDisp = new double[1];
+	initialDisp[0] = iDisp;
+	dx += iDisp;
       }
       L = sqrt(dx*dx);
       
@@ -428,13 +428,11 @@ Truss::setDomain(Domain *theDomain)
       if (useInitialDisp && initialDisp == 0) {
 	double iDispX = end2Disp(0)-end1Disp(0);
 	double iDispY = end2Disp(1)-end1Disp(1);
-	if (iDispX != 0 || iDispY != 0) {
-	  initialDisp = new double[2];
-	  initialDisp[0] = iDispX;
-	  initialDisp[1] = iDispY;
-	  dx += iDispX;
-	  dy += iDispY;
-	}
+	initialDisp = new double[2];
+	initialDisp[0] = iDispX;
+	initialDisp[1] = iDispY;
+	dx += iDispX;
+	dy += iDispY;
       }
       
       L = sqrt(dx*dx + dy*dy);
@@ -457,15 +455,13 @@ Truss::setDomain(Domain *theDomain)
 	double iDispX = end2Disp(0)-end1Disp(0);
 	double iDispY = end2Disp(1)-end1Disp(1);      
 	double iDispZ = end2Disp(2)-end1Disp(2);      
-	if (iDispX != 0 || iDispY != 0 || iDispZ != 0) {
-	  initialDisp = new double[3];
-	  initialDisp[0] = iDispX;
-	  initialDisp[1] = iDispY;
-	  initialDisp[2] = iDispZ;
-	  dx += iDispX;
-	  dy += iDispY;
-	  dz += iDispZ;
-	}
+	initialDisp = new double[3];
+	initialDisp[0] = iDispX;
+	initialDisp[1] = iDispY;
+	initialDisp[2] = iDispZ;
+	dx += iDispX;
+	dy += iDispY;
+	dz += iDispZ;
       }
       
       L = sqrt(dx*dx + dy*dy + dz*dz);
@@ -0,0 +1,93 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: Minimal timing harness shared by the micro-benchmarks.
+//
+#ifndef OpenSees_Benchmark_h
+#define OpenSees_Benchmark_h
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <functional>
+
+struct BenchmarkResult {
+  std::string name;
+  std::string unit;
+  long        iterations;
+  double      seconds;
+  double      work;       // units of work done per iteration
+};
+
+struct BenchmarkOptions {
+  const char *filter = nullptr;
+  double      min_time = 0.5;
+  int         size = 40;
+};
+
+//
+// Repeat kernel until at least min_time seconds have elapsed; the
+// iteration count is grown geometrically so that the clock is read
+// rarely for cheap kernels.
+//
+inline void
+run(std::vector<BenchmarkResult>& results, const BenchmarkOptions& options,
+    const std::string& name, const char* unit, double work,
+    const std::function<void()>& kernel)
+{
+  using clock = std::chrono::steady_clock;
+
+  if (options.filter != nullptr && name.find(options.filter) == std::string::npos)
+    return;
+
+  kernel(); // warm up
+
+  long total = 0;
+  long batch = 1;
+  double elapsed = 0.0;
+  while (elapsed < options.min_time) {
+    auto start = clock::now();
+    for (long i=0; i<batch; i++)
+      kernel();
+    elapsed += std::chrono::duration<double>(clock::now() - start).count();
+    total += batch;
+    if (batch < (1L << 20))
+      batch *= 2;
+  }
+  results.push_back(BenchmarkResult{name, unit, total, elapsed, work});
+}
+
+//
+// As above, for kernels that consume their input (a direct solver
+// factors A in place); setup restores it before every call and is not
+// timed.
+//
+inline void
+run(std::vector<BenchmarkResult>& results, const BenchmarkOptions& options,
+    const std::string& name, const char* unit, double work,
+    const std::function<void()>& setup, const std::function<void()>& kernel)
+{
+  using clock = std::chrono::steady_clock;
+
+  if (options.filter != nullptr && name.find(options.filter) == std::string::npos)
+    return;
+
+  setup();
+  kernel(); // warm up
+
+  long total = 0;
+  double elapsed = 0.0;
+  while (elapsed < options.min_time) {
+    setup();
+    auto start = clock::now();
+    kernel();
+    elapsed += std::chrono::duration<double>(clock::now() - start).count();
+    total++;
+  }
+  results.push_back(BenchmarkResult{name, unit, total, elapsed, work});
+}
+
+#endif // OpenSees_Benchmark_h
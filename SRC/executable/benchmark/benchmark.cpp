@@ -0,0 +1,266 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: Micro-benchmarks for element, material and solver kernels.
+// Each kernel is timed in isolation on a small synthetic model and the
+// results are written to stdout as JSON so that they can be compared
+// across builds and releases.
+//
+//   OpenSeesBenchmark [-filter text] [-time seconds] [-size n]
+//
+// -filter  only run benchmarks whose name contains text
+// -time    minimum wall time spent in each kernel (default 0.5)
+// -size    number of elements along each side of the synthetic
+//          meshes used by the solver benchmarks (default 40)
+//
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <array>
+#include <string>
+#include <vector>
+#include <memory>
+
+#include <Vector.h>
+#include <Matrix.h>
+#include <ID.h>
+#include <Domain.h>
+#include <Node.h>
+#include <Element.h>
+
+// materials
+#include <ElasticMaterial.h>
+#include <Steel02.h>
+#include <Concrete02.h>
+#include <FiberSection3d.h>
+#include <ElasticIsotropicThreeDimensional.h>
+#include <ElasticMembranePlateSection.h>
+
+// elements
+#include <Brick.h>
+#include <ShellMITC4.h>
+#include <ASDShellQ4.h>
+#include <LobattoBeamIntegration.h>
+#include <LinearFrameTransf3d.h>
+#include <element/Frame/Basic/ForceFrame3d.h>
+
+#include "Benchmark.h"
+
+//
+// Cyclic strain history with growing amplitude
+//
+static std::vector<double>
+strain_history(double peak, int n)
+{
+  std::vector<double> history(n);
+  for (int i=0; i<n; i++) {
+    double t = double(i)/double(n);
+    history[i] = peak*t*sin(8.0*M_PI*t);
+  }
+  return history;
+}
+
+static void
+bench_uniaxial(const char* name, UniaxialMaterial& material, double peak,
+               const BenchmarkOptions& options, std::vector<BenchmarkResult>& results)
+{
+  const std::vector<double> history = strain_history(peak, 1000);
+  run(results, options, name, "calls", (double)history.size(), [&]() {
+    for (double strain : history) {
+      material.setTrialStrain(strain);
+      material.getStress();
+      material.getTangent();
+      material.commitState();
+    }
+    material.revertToStart();
+  });
+}
+
+//
+// 10x10 concrete core with 8 bars
+//
+static FiberSection3d*
+new_fiber_section(int tag, UniaxialMaterial& concrete, UniaxialMaterial& steel, UniaxialMaterial& torsion)
+{
+  const int nc = 10;
+  const double b = 12.0, h = 24.0;
+  FiberSection3d *section = new FiberSection3d(tag, nc*nc + 8, torsion, true);
+  for (int i=0; i<nc; i++)
+    for (int j=0; j<nc; j++)
+      section->addFiber(concrete, b*h/(nc*nc), h*((i + 0.5)/nc - 0.5), b*((j + 0.5)/nc - 0.5));
+
+  for (int i=0; i<4; i++) {
+    section->addFiber(steel, 0.79,  0.4*h, b*(i/3.0 - 0.5)*0.8);
+    section->addFiber(steel, 0.79, -0.4*h, b*(i/3.0 - 0.5)*0.8);
+  }
+  return section;
+}
+
+static void
+bench_section(const BenchmarkOptions& options, std::vector<BenchmarkResult>& results,
+              UniaxialMaterial& concrete, UniaxialMaterial& steel, UniaxialMaterial& torsion)
+{
+  std::unique_ptr<FiberSection3d> section(new_fiber_section(1, concrete, steel, torsion));
+  const int order = section->getOrder();
+  const std::vector<double> history = strain_history(1.0, 200);
+  Vector e(order);
+
+  run(results, options, "section/FiberSection3d/setTrialSectionDeformation", "calls",
+      (double)history.size(), [&]() {
+    for (double t : history) {
+      e(0) = -0.0005*fabs(t);
+      e(1) =  0.0002*t;
+      if (order > 2)
+        e(2) = 0.0001*t;
+      section->setTrialSectionDeformation(e);
+      section->getStressResultant();
+      section->getSectionTangent();
+      section->commitState();
+    }
+    section->revertToStart();
+  });
+}
+
+static void
+bench_frame(const BenchmarkOptions& options, std::vector<BenchmarkResult>& results,
+            UniaxialMaterial& concrete, UniaxialMaterial& steel, UniaxialMaterial& torsion)
+{
+  Domain domain;
+  domain.addNode(new Node(1, 6, 0.0, 0.0,   0.0));
+  domain.addNode(new Node(2, 6, 0.0, 0.0, 144.0));
+
+  const int nip = 5;
+  std::vector<FrameSection*> sections(nip);
+  for (int i=0; i<nip; i++)
+    sections[i] = new_fiber_section(i+1, concrete, steel, torsion);
+
+  Vector vecxz(3);
+  vecxz(0) = 1.0;
+  LinearFrameTransf3d transform(1, vecxz);
+  LobattoBeamIntegration integration;
+  std::array<int,2> nodes {1, 2};
+
+  Element *element = new ForceFrame3d(1, nodes, sections, integration, transform,
+                                      0.0, 0, false, 20, 1e-12);
+  domain.addElement(element);
+  for (FrameSection* section : sections)
+    delete section;
+
+  Node *node = domain.getNode(2);
+  const std::vector<double> history = strain_history(1.0, 100);
+  Vector u(6);
+  run(results, options, "element/ForceFrame3d/update", "calls", (double)history.size(), [&]() {
+    for (double t : history) {
+      u(0) = 0.5*t;
+      u(1) = 0.2*t;
+      u(2) = -0.01*fabs(t);
+      node->setTrialDisp(u);
+      element->update();
+      element->getResistingForce();
+      element->getTangentStiff();
+      element->commitState();
+      node->commitState();
+    }
+    element->revertToStart();
+    node->revertToStart();
+  });
+}
+
+// Unit cube / square nodes
+static const double xyz[8][3] = {
+  {0,0,0}, {1,0,0}, {1,1,0}, {0,1,0},
+  {0,0,1}, {1,0,1}, {1,1,1}, {0,1,1}
+};
+
+static void
+bench_tangent(const char* name, Element* element, Domain& domain,
+              const BenchmarkOptions& options, std::vector<BenchmarkResult>& results)
+{
+  domain.addElement(element);
+  element->update();
+  run(results, options, name, "calls", 1.0, [&]() {
+    element->getTangentStiff();
+  });
+}
+
+static void
+bench_continuum(const BenchmarkOptions& options, std::vector<BenchmarkResult>& results)
+{
+  {
+    Domain domain;
+    for (int i=0; i<8; i++)
+      domain.addNode(new Node(i+1, 3, xyz[i][0], xyz[i][1], xyz[i][2]));
+    ElasticIsotropicThreeDimensional material(1, 29000.0, 0.3, 0.0);
+    bench_tangent("element/Brick/getTangentStiff",
+                  new Brick(1, 1, 2, 3, 4, 5, 6, 7, 8, material), domain, options, results);
+  }
+  {
+    Domain domain;
+    for (int i=0; i<4; i++)
+      domain.addNode(new Node(i+1, 6, xyz[i][0], xyz[i][1], xyz[i][2]));
+    ElasticMembranePlateSection section(1, 29000.0, 0.3, 0.1);
+    bench_tangent("element/ShellMITC4/getTangentStiff",
+                  new ShellMITC4(1, 1, 2, 3, 4, section), domain, options, results);
+  }
+  {
+    Domain domain;
+    for (int i=0; i<4; i++)
+      domain.addNode(new Node(i+1, 6, xyz[i][0], xyz[i][1], xyz[i][2]));
+    ElasticMembranePlateSection section(1, 29000.0, 0.3, 0.1);
+    bench_tangent("element/ASDShellQ4/getTangentStiff",
+                  new ASDShellQ4(1, 1, 2, 3, 4, &section, Vector(3)), domain, options, results);
+  }
+}
+
+// solvers.cpp
+void bench_solvers(const BenchmarkOptions&, std::vector<BenchmarkResult>&);
+
+int
+main(int argc, char **argv)
+{
+  BenchmarkOptions options;
+  for (int i=1; i<argc; i++) {
+    if (strcmp(argv[i], "-filter") == 0 && i+1 < argc)
+      options.filter = argv[++i];
+    else if (strcmp(argv[i], "-time") == 0 && i+1 < argc)
+      options.min_time = atof(argv[++i]);
+    else if (strcmp(argv[i], "-size") == 0 && i+1 < argc)
+      options.size = atoi(argv[++i]);
+    else {
+      fprintf(stderr, "usage: %s [-filter text] [-time seconds] [-size n]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  std::vector<BenchmarkResult> results;
+
+  ElasticMaterial torsion(0, 1.0e6);
+  Steel02    steel(1, 60.0, 29000.0, 0.02, 20.0, 0.925, 0.15);
+  Concrete02 concrete(2, -5.0, -0.002, -1.0, -0.006, 0.1, 0.5, 250.0);
+
+  bench_uniaxial("material/Steel02/setTrialStrain",    steel,    0.02,  options, results);
+  bench_uniaxial("material/Concrete02/setTrialStrain", concrete, 0.004, options, results);
+  bench_section(options, results, concrete, steel, torsion);
+  bench_frame(options, results, concrete, steel, torsion);
+  bench_continuum(options, results);
+  bench_solvers(options, results);
+
+  printf("{\n  \"benchmarks\": [");
+  bool first = true;
+  for (const BenchmarkResult& result : results) {
+    const double per_call = result.seconds/result.iterations;
+    printf("%s\n    {\"name\": \"%s\", \"iterations\": %ld, \"seconds\": %.6e, "
+           "\"time_per_iteration\": %.6e, \"throughput\": %.6e, \"unit\": \"%s/s\"}",
+           first ? "" : ",",
+           result.name.c_str(), result.iterations, result.seconds,
+           per_call, result.work/per_call, result.unit.c_str());
+    first = false;
+  }
+  printf("\n  ],\n  \"options\": {\"time\": %g, \"size\": %d}\n}\n", options.min_time, options.size);
+
+  return 0;
+}
@@ -0,0 +1,121 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: Assembly and solve benchmarks for the LinearSOE classes.
+// These are kept apart from the element benchmarks because the SuperLU
+// headers declare BLAS with different prototypes than matrix/blasdecl.h.
+//
+#include <stdio.h>
+#include <memory>
+
+#include <Vector.h>
+#include <Matrix.h>
+#include <ID.h>
+#include <Graph.h>
+#include <Vertex.h>
+#include <MapOfTaggedObjects.h>
+#include <BandSPDLinSOE.h>
+#include <BandSPDLinLapackSolver.h>
+#include <BandGenLinSOE.h>
+#include <BandGenLinLapackSolver.h>
+#include <ProfileSPDLinSOE.h>
+#include <ProfileSPDLinDirectSolver.h>
+#include <SparseGenColLinSOE.h>
+#include <SuperLU.h>
+
+#include "Benchmark.h"
+
+//
+// Scalar Laplacian on an n x n grid of bilinear quadrilaterals with a
+// small mass-like shift so the system is positive definite.
+//
+struct SyntheticMesh {
+  int n;
+  int numEqn;
+  Matrix ke;
+  std::vector<ID> elements;
+
+  SyntheticMesh(int n) : n(n), numEqn((n+1)*(n+1)), ke(4,4) {
+    static const double k[4][4] = {
+      { 2./3, -1./6, -1./3, -1./6},
+      {-1./6,  2./3, -1./6, -1./3},
+      {-1./3, -1./6,  2./3, -1./6},
+      {-1./6, -1./3, -1./6,  2./3}
+    };
+    for (int i=0; i<4; i++)
+      for (int j=0; j<4; j++)
+        ke(i,j) = k[i][j] + (i == j ? 1.0e-3 : 0.0);
+
+    for (int i=0; i<n; i++)
+      for (int j=0; j<n; j++) {
+        ID id(4);
+        id(0) =  i   *(n+1) + j;
+        id(1) =  i   *(n+1) + j + 1;
+        id(2) = (i+1)*(n+1) + j + 1;
+        id(3) = (i+1)*(n+1) + j;
+        elements.push_back(id);
+      }
+  }
+
+  Graph* graph() const {
+    Graph *graph = new Graph(*new MapOfTaggedObjects());
+    for (int i=0; i<numEqn; i++)
+      graph->addVertex(new Vertex(i, i), false);
+
+    graph->startAddEdge();
+    for (const ID& id : elements)
+      for (int i=0; i<4; i++)
+        for (int j=i+1; j<4; j++)
+          graph->addEdgeFast(id(i), id(j));
+    return graph;
+  }
+
+  void assemble(LinearSOE& soe) const {
+    soe.zeroA();
+    for (const ID& id : elements)
+      soe.addA(ke, id);
+  }
+};
+
+static void
+bench_soe(const char* name, LinearSOE* soe, const SyntheticMesh& mesh,
+          const BenchmarkOptions& options, std::vector<BenchmarkResult>& results)
+{
+  std::unique_ptr<LinearSOE> owner(soe);
+  std::unique_ptr<Graph> graph(mesh.graph());
+  if (soe->setSize(*graph) < 0) {
+    fprintf(stderr, "%s: setSize failed\n", name);
+    return;
+  }
+
+  Vector b(mesh.numEqn);
+  for (int i=0; i<mesh.numEqn; i++)
+    b(i) = 1.0;
+
+  run(results, options, std::string(name) + "/addA", "elements", (double)mesh.elements.size(), [&]() {
+    mesh.assemble(*soe);
+  });
+
+  // the factorization overwrites A, so it is assembled again before
+  // every solve but only the solve is timed
+  run(results, options, std::string(name) + "/solve", "equations", (double)mesh.numEqn, [&]() {
+    mesh.assemble(*soe);
+    soe->setB(b);
+  }, [&]() {
+    soe->solve();
+  });
+}
+
+void
+bench_solvers(const BenchmarkOptions& options, std::vector<BenchmarkResult>& results)
+{
+  SyntheticMesh mesh(options.size);
+  bench_soe("soe/BandSPDLinSOE",      new BandSPDLinSOE(*new BandSPDLinLapackSolver()),    mesh, options, results);
+  bench_soe("soe/BandGenLinSOE",      new BandGenLinSOE(*new BandGenLinLapackSolver()),    mesh, options, results);
+  bench_soe("soe/ProfileSPDLinSOE",   new ProfileSPDLinSOE(*new ProfileSPDLinDirectSolver()), mesh, options, results);
+  bench_soe("soe/SparseGenColLinSOE", new SparseGenColLinSOE(*new SuperLU()),              mesh, options, results);
+}
+
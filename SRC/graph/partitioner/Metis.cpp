@@ -209,7 +209,7 @@ Metis::partition(Graph &theGraph, int numPart)
   int *vwgts = 0;
   int *ewgts = 0;
   int numbering = 0;
-  int weightflag = 0; // no weights on our graphs yet
+  int weightflag = 0;
 
   if (START_VERTEX_NUM == 0)
     numbering = 0;
@@ -262,6 +262,31 @@ Metis::partition(Graph &theGraph, int numPart)
     xadj[vertex + 1] = indexEdge;
   }
 
+  // if the vertices carry weights, e.g. the measured cost of the elements,
+  // they are scaled to the positive integers metis balances the parts by
+  double maxWeight = 0.0;
+  double sumWeight = 0.0;
+  for (int vertex = 0; vertex < numVertex; vertex++) {
+    double weight = theGraph.getVertexPtr(vertex + START_VERTEX_NUM)->getWeight();
+    if (weight > maxWeight)
+      maxWeight = weight;
+    if (weight > 0.0)
+      sumWeight += weight;
+  }
+
+  if (maxWeight > 0.0) {
+    double scale = 1000.0/maxWeight;
+    if (sumWeight*scale > 1.0e9)
+      scale = 1.0e9/sumWeight;
+
+    vwgts = new int [numVertex];
+    for (int vertex = 0; vertex < numVertex; vertex++) {
+      double weight = theGraph.getVertexPtr(vertex + START_VERTEX_NUM)->getWeight();
+      vwgts[vertex] = weight > 0.0 ? 1 + (int)(weight*scale) : 1;
+    }
+    weightflag = 2; // weights on the vertices only
+  }
+
 
   if (defaultOptions == true)
     options[0] = 0;
@@ -335,6 +360,8 @@ Metis::partition(Graph &theGraph, int numPart)
   delete [] partition;
   delete [] xadj;
   delete [] adjncy;
+  if (vwgts != 0)
+    delete [] vwgts;
 
   return 0;
 }
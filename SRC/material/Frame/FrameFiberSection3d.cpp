@@ -45,7 +45,7 @@ FrameFiberSection3d::FrameFiberSection3d(int tag, int num, UniaxialMaterial &tor
 #ifdef N_FIBER_THREADS
     pool((void*)new OpenSees::thread_pool{N_FIBER_THREADS}),
 #endif
-    e(es), s(sr)
+    e(es), s(sr), k(&ks.values[0][0], 4, 4), k0(&ki.values[0][0], 4, 4)
 {
     if (sizeFibers != 0) {
       theMaterials = new UniaxialMaterial *[sizeFibers]{};
@@ -78,7 +78,7 @@ FrameFiberSection3d::FrameFiberSection3d():
 #ifdef N_FIBER_THREADS
   pool((void*)new OpenSees::thread_pool{N_FIBER_THREADS}),
 #endif
-  e(es), s(sr), theTorsion(nullptr)
+  e(es), s(sr), k(&ks.values[0][0], 4, 4), k0(&ki.values[0][0], 4, 4), theTorsion(nullptr)
 {
   es.zero();
   sr.zero();
@@ -369,10 +369,8 @@ FrameFiberSection3d::setTrialSectionDeformation(const Vector &deforms)
 const Matrix&
 FrameFiberSection3d::getInitialTangent()
 {
-  static double kInitialData[16];
-  static Matrix kInitial(kInitialData, 4, 4);
-  
-  kInitial.Zero();
+  double *kInitialData = &ki.values[0][0];
+  ki.zero();
 
   for (int i = 0; i < numFibers; i++) {
     const double y = matData[3*i]   - yBar;
@@ -403,7 +401,7 @@ FrameFiberSection3d::getInitialTangent()
   if (theTorsion != nullptr)
     kInitialData[15] = theTorsion->getInitialTangent();
 
-  return kInitial;
+  return k0;
 }
 
 const Vector&
@@ -415,8 +413,7 @@ FrameFiberSection3d::getSectionDeformation()
 const Matrix&
 FrameFiberSection3d::getSectionTangent()
 {
-  static Matrix wrapper(ks);
-  return wrapper;
+  return k;
 }
 
 const Vector&
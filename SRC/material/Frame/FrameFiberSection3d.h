@@ -100,6 +100,7 @@ class FrameFiberSection3d : public FrameSection
     UniaxialMaterial **theMaterials;   // array of pointers to materials
     std::shared_ptr<double[]> matData; // data for the materials [yloc, zloc, and area]
     OpenSees::MatrixND<4,4> ks;
+    OpenSees::MatrixND<4,4> ki;        // initial tangent
 
     double QzBar, QyBar, Abar;
     double yBar;                       // Section centroid
@@ -110,6 +111,8 @@ class FrameFiberSection3d : public FrameSection
 
     Vector  e;         // trial section deformations 
     Vector  s;         // section resisting forces  (axial force, bending moment)
+    Matrix  k;         // wraps ks
+    Matrix  k0;        // wraps ki
 
     OpenSees::VectorND<4> es, sr;
     UniaxialMaterial *theTorsion;
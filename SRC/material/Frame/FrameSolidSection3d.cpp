@@ -42,7 +42,7 @@ FrameSolidSection3d::FrameSolidSection3d(int tag, int num, double a, bool compCe
     FrameSection(tag, SEC_TAG_FrameSolidSection3d),
     numFibers(0), sizeFibers(num), theMaterials(0), matData(0),
     Abar(0.0), QyBar(0.0), QzBar(0.0), yBar(0.0), zBar(0.0), computeCentroid(compCentroid),
-    alpha(a), e(6), s(0), ks(0), 
+    alpha(a), e(6), s(0), ks(0), ki(kiData, 6, 6),
     parameterID(0), dedh(6)
 {
     if (sizeFibers != 0) {
@@ -72,7 +72,7 @@ FrameSolidSection3d::FrameSolidSection3d():
   FrameSection(0, SEC_TAG_FrameSolidSection3d),
   numFibers(0), sizeFibers(0), theMaterials(0), matData(0),
   Abar(0.0), QyBar(0.0), QzBar(0.0), yBar(0.0), zBar(0.0), computeCentroid(true),
-  alpha(1.0), e(6), s(0), ks(0),
+  alpha(1.0), e(6), s(0), ks(0), ki(kiData, 6, 6),
   parameterID(0), dedh(6)
 {
   s = new Vector(sData, 6);
@@ -320,31 +320,17 @@ FrameSolidSection3d::getSectionDeformation()
 const Matrix&
 FrameSolidSection3d::getInitialTangent()
 {
-  static double kInitial[36];
-  static Matrix ki(kInitial, 6, 6);
   ki.Zero();
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
-
-  {
-    for (int i = 0; i < numFibers; i++) {
-      yLocs[i] = matData[3*i];
-      zLocs[i] = matData[3*i+1];
-      fiberArea[i] = matData[3*i+2];
-    }
-  }
-
   double rootAlpha = 1.0;
   if (alpha != 1.0)
     rootAlpha = sqrt(alpha);
 
   for (int i = 0; i < numFibers; i++) {
     NDMaterial *theMat = theMaterials[i];
-    double y = yLocs[i] - yBar;
-    double z = zLocs[i] - zBar;
-    double A = fiberArea[i];
+    double y = matData[3*i]   - yBar;
+    double z = matData[3*i+1] - zBar;
+    double A = matData[3*i+2];
 
     double y2 = y*y;
     double z2 = z*z;
@@ -96,6 +96,7 @@ class FrameSolidSection3d : public FrameSection
 //  MatrixND<6,6> ks;
     double   kData[36];               // data for ks matrix 
     double   sData[6];                // data for s vector 
+    double   kiData[36];              // data for ki matrix
 
     double Abar,QyBar, QzBar;
     double yBar;                      // Section centroid
@@ -109,6 +110,7 @@ class FrameSolidSection3d : public FrameSection
     Vector e;          // trial section deformations 
     Vector *s;         // section resisting forces  (axial force, bending moment)
     Matrix *ks;        // section stiffness
+    Matrix  ki;        // initial section stiffness
 
 // AddingSensitivity:BEGIN //////////////////////////////////////////
     int parameterID;
@@ -24,12 +24,16 @@
 // Revision: A
 //
 #include "ID.h"
+#include "MemoryPool.h"
 #include <map>
 #include <list>
 #include <assert.h>
 
 #include <iostream>
 
+using OpenSees::MemoryPool::allocate;
+using OpenSees::MemoryPool::release;
+
 int ID::ID_NOT_VALID_ENTRY = 0;
 
 // ID():
@@ -59,7 +63,7 @@ ID::ID(int size)
 
   // create the (zero-initialized) space for the data
   if (size > 0)
-    data = new int[size]{};
+    data = allocate<int>(size, true);
     
 }
 
@@ -88,8 +92,8 @@ ID::ID(int size, int arraySz)
   }
 #endif    
 
-  // create the space; braces used to zero-initialize.
-  data = new int[arraySize]{};
+  // create the zero-initialized space
+  data = allocate<int>(arraySize, true);
 
 }
 
@@ -103,9 +107,8 @@ ID::ID(int *d, int size, bool cleanIt)
     arraySize = size;
     fromFree = 0;
 
-    // create the space; braces used to zero-initialize.
-    if (arraySize != 0)
-      data = new int[arraySize]{};
+    // create the zero-initialized space
+    data = allocate<int>(arraySize, true);
 
   }
   
@@ -120,7 +123,7 @@ ID::ID(const ID &other)
   :sz(other.sz), data(0), arraySize(other.arraySize), fromFree(0)
 {
   // create the space
-  data = new int[arraySize]; 
+  data = allocate<int>(arraySize);
   
   // copy the data 
   for (int i=0; i<sz; i++)
@@ -134,17 +137,18 @@ ID::ID(const ID &other)
 
 ID::~ID()
 {
-  if (data != nullptr && fromFree == 0) 
-    delete [] data;
+  if (fromFree == 0)
+    release(data, arraySize);
 }
 
 int 
 ID::setData(int *newData, int size, bool cleanIt){
 	
-  if (data != nullptr && fromFree == 0) 
-    delete [] data;
+  if (fromFree == 0)
+    release(data, arraySize);
 
   sz = size;
+  arraySize = size;
   data = newData;
   
   if (cleanIt == false)
@@ -237,11 +241,13 @@ ID::unique(void)
     }
 
     sz = int(uniquesl.size());
-    int* newdata = new int[sz];
+    int* newdata = allocate<int>(sz);
     for (std::list<int>::iterator pos=uniquesl.begin(); pos!=uniquesl.end(); pos++)
         newdata[count++] = *pos;
 
-    delete [] data;
+    if (fromFree == 0)
+      release(data, arraySize);
+    fromFree = 0;
     arraySize = sz;
     data = newdata;
 
@@ -284,7 +290,7 @@ ID::operator[](int x)
     if (newArraySize <= x) 
       newArraySize = x+1;
 
-    int *newData = new int[newArraySize];
+    int *newData = allocate<int>(newArraySize);
 
     // copy the old
     for (int i=0; i<sz; i++)
@@ -297,9 +303,10 @@ ID::operator[](int x)
     sz = x+1;
 
     // release the memory held by the old
-    if (fromFree == 0 && data != nullptr)
-      delete [] data;
+    if (fromFree == 0)
+      release(data, arraySize);
 
+    fromFree = 0;
     data = newData;
     arraySize = newArraySize;
     
@@ -333,7 +340,7 @@ ID::resize(int newSize, int fill_value){
 
     // otherwise we go get more space
     
-    int *newData = new int[newSize];
+    int *newData = allocate<int>(newSize);
 
     // copy the old
     for (int i=0; i<sz; i++)
@@ -345,7 +352,9 @@ ID::resize(int newSize, int fill_value){
     
     sz = newSize;
     // release the memory held by the old
-    delete [] data;
+    if (fromFree == 0)
+      release(data, arraySize);
+    fromFree = 0;
     data = newData;
     arraySize = newSize;
   }
@@ -378,10 +387,11 @@ ID::operator=(const ID &V)
       // old and make room for new.
       if (sz != V.sz) {
           if (arraySize < V.sz) {
+            if (fromFree == 0)
+              release(data, arraySize);
+            fromFree = 0;
             arraySize = V.sz;
-            if (data != nullptr)
-              delete [] data;
-            data = new int[arraySize];
+            data = allocate<int>(arraySize);
           }
           sz = V.sz;
       }
@@ -552,7 +562,7 @@ ID::insert(int x)
 
   } else {
     int newArraySize = (sz+1) * 2;
-    int *newData = new int[newArraySize];
+    int *newData = allocate<int>(newArraySize);
       
     // copy the old
     for (int ii=0; ii<middle; ii++)
@@ -565,9 +575,10 @@ ID::insert(int x)
     
     sz++;
     
-    if (data != 0 && fromFree == 0)
-      delete [] data;
+    if (fromFree == 0)
+      release(data, arraySize);
 
+    fromFree = 0;
     data = newData;
     arraySize = newArraySize;
     
@@ -30,6 +30,7 @@
 #include "routines/cmx.h"
 #include "blasdecl.h"
 #include "ID.h"
+#include "MemoryPool.h"
 
 #include <stdlib.h>
 #include <OPS_Stream.h>
@@ -42,15 +43,19 @@
 #ifndef NO_STATIC_WORK
 # define MATRIX_WORK_AREA 400
 # define INT_WORK_AREA 20
-  int Matrix::sizeDoubleWork = MATRIX_WORK_AREA;
-  int Matrix::sizeIntWork = INT_WORK_AREA;
-  double *Matrix::matrixWork = nullptr;
-  int    *Matrix::intWork    = nullptr;
+  // allocated by each thread before its first use of the work area
+  thread_local int Matrix::sizeDoubleWork = MATRIX_WORK_AREA;
+  thread_local int Matrix::sizeIntWork = INT_WORK_AREA;
+  thread_local double *Matrix::matrixWork = new double[MATRIX_WORK_AREA];
+  thread_local int    *Matrix::intWork    = new int[INT_WORK_AREA];
 #endif
 
 //#define MATRIX_BLAS
 //#define NO_WORK
 
+using OpenSees::MemoryPool::allocate;
+using OpenSees::MemoryPool::release;
+
 
 //
 // CONSTRUCTORS
@@ -59,11 +64,11 @@
 Matrix::Matrix()
 :numRows(0), numCols(0), dataSize(0), data(0), fromFree(0)
 {
-  // allocate work areas if the first
-  if (matrixWork == nullptr) {
-    matrixWork = new double[sizeDoubleWork];
-    intWork    = new int[sizeIntWork];
-  }
+#ifdef NO_STATIC_WORK
+  // allocate the work areas of this matrix
+  matrixWork = new double[sizeDoubleWork];
+  intWork    = new int[sizeIntWork];
+#endif
 }
 
 
@@ -72,18 +77,17 @@ Matrix::Matrix(int nRows,int nCols)
 {
 //assert(nRows > 0);
 //assert(nCols > 0);
-
-  // allocate work areas if the first matrix
-  if (matrixWork == nullptr) {
-    matrixWork = new double[sizeDoubleWork];
-    intWork    = new int[sizeIntWork];
-  }
+#ifdef NO_STATIC_WORK
+  // allocate the work areas of this matrix
+  matrixWork = new double[sizeDoubleWork];
+  intWork    = new int[sizeIntWork];
+#endif
 
   dataSize = numRows * numCols;
   data = nullptr;
 
   if (dataSize > 0)
-    data = new double[dataSize]{};
+    data = allocate<double>(dataSize, true);
 }
 
 Matrix::Matrix(double *theData, int row, int col) 
@@ -91,31 +95,29 @@ Matrix::Matrix(double *theData, int row, int col)
 {
 //assert(row > 0);
 //assert(col > 0);
-
-  // allocate work areas if the first matrix
-  if (matrixWork == nullptr) {
-    matrixWork = new double[sizeDoubleWork];
-    intWork    = new int[sizeIntWork];
-  }
-
+#ifdef NO_STATIC_WORK
+  // allocate the work areas of this matrix
+  matrixWork = new double[sizeDoubleWork];
+  intWork    = new int[sizeIntWork];
+#endif
 }
 
 
 Matrix::Matrix(const Matrix &other)
 : numRows(0), numCols(0), dataSize(0), data(0), fromFree(0)
 {
-  // allocate work areas if the first matrix
-  if (matrixWork == nullptr) {
-    matrixWork = new double[sizeDoubleWork];
-    intWork    = new int[sizeIntWork];
-  }
+#ifdef NO_STATIC_WORK
+  // allocate the work areas of this matrix
+  matrixWork = new double[sizeDoubleWork];
+  intWork    = new int[sizeIntWork];
+#endif
 
   numRows  = other.numRows;
   numCols  = other.numCols;
   dataSize = other.dataSize;
 
   if (dataSize != 0) {
-    data = new double[dataSize];
+    data = allocate<double>(dataSize);
     // copy the data
     double *dataPtr = data;
     double *otherDataPtr = other.data;
@@ -146,12 +148,9 @@ Matrix::Matrix(Matrix &&other)
 
 Matrix::~Matrix()
 {
-  if (data != nullptr) {
-    if (fromFree == 0 && dataSize > 0){
-      delete [] data; 
-      data = nullptr;
-    }
-  }
+  if (fromFree == 0)
+    release(data, dataSize);
+  data = nullptr;
 #ifdef NO_STATIC_WORK
   if (matrixWork != nullptr)
     delete [] matrixWork;
@@ -172,11 +171,9 @@ Matrix::setData(double *theData, int row, int col)
 //assert(col > 0);
 
   // delete the old if allocated
-  if (data != nullptr)
-    if (fromFree == 0) {
-      delete [] data; 
-      data = 0;
-    }
+  if (fromFree == 0)
+    release(data, dataSize);
+
   numRows  = row;
   numCols  = col;
   dataSize = row*col;
@@ -204,15 +201,12 @@ Matrix::resize(int rows, int cols) {
   if (newSize > dataSize) {
 
     // free the old space
-    if (data != nullptr)
-      if (fromFree == 0){
-        delete [] data; 
-        data = 0;
-      }
+    if (fromFree == 0)
+      release(data, dataSize);
 
     fromFree = 0;
     // create new space
-    data = new double[newSize];
+    data = allocate<double>(newSize);
     dataSize = newSize;
     numRows = rows;
     numCols = cols;
@@ -1194,14 +1188,15 @@ Matrix::operator=(const Matrix &other)
       opserr << "Matrix::operator=() - matrix dimensions do not match\n";
 #endif
 
-      if (this->data != 0) {
-          delete [] this->data;
-          this->data = 0;
-      }
-
       int theSize = other.numCols*other.numRows;
 
-      data = new double[theSize];
+      // keep the old space if it is already the right size
+      if (theSize != dataSize || fromFree != 0) {
+        if (fromFree == 0)
+          release(this->data, dataSize);
+        fromFree = 0;
+        data = allocate<double>(theSize);
+      }
 
       this->dataSize = theSize;
       this->numCols  = other.numCols;
@@ -1228,10 +1223,8 @@ Matrix::operator=( Matrix &&other)
   if (this == &other) 
     return *this;
 
-  if (this->data != 0 && fromFree == 0){
-    delete [] this->data;
-    this->data = 0;
-  }
+  if (fromFree == 0)
+    release(this->data, dataSize);
         
   this->data = other.data;
   this->dataSize = other.numCols*other.numRows;
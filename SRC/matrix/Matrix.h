@@ -201,10 +201,12 @@ class Matrix
     int sizeDoubleWork = 400;
     int sizeIntWork = 20;
 #else
-    static double *matrixWork;
-    static int *intWork;
-    static int sizeDoubleWork;
-    static int sizeIntWork;
+    // one work area per thread, so matrices can be solved and inverted
+    // from several threads at once
+    static thread_local double *matrixWork;
+    static thread_local int *intWork;
+    static thread_local int sizeDoubleWork;
+    static thread_local int sizeIntWork;
 #endif
 
     int numRows;
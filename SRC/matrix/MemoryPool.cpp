@@ -0,0 +1,140 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of the allocator
+// used for the storage of Vector, Matrix and ID objects.
+//
+#include "MemoryPool.h"
+#include <atomic>
+#include <vector>
+
+namespace OpenSees {
+namespace MemoryPool {
+
+static std::atomic<long long> numAllocations{0};
+static std::atomic<long long> numDeallocations{0};
+
+template <typename T>
+struct FreeLists {
+  FreeLists(bool &closed) : closed(closed) {}
+
+  ~FreeLists() {
+    closed = true;
+    this->clear();
+  }
+
+  void clear() {
+    for (std::vector<T*> &list : lists) {
+      for (T *data : list) {
+        delete [] data;
+        numDeallocations.fetch_add(1, std::memory_order_relaxed);
+      }
+      list.clear();
+    }
+  }
+
+  std::vector<T*> lists[MaxPooled+1];
+  bool &closed;
+};
+
+// storage held on the free lists of this thread, of both types
+static thread_local long long pooledBytes = 0;
+
+template <typename T>
+static FreeLists<T> *
+getFreeLists()
+{
+  // The flag is trivially destructible and outlives the lists, so that
+  // arrays released by objects destroyed after the lists of their thread
+  // (e.g. function-local statics) go straight back to the heap.
+  static thread_local bool closed = false;
+  if (closed)
+    return nullptr;
+
+  static thread_local FreeLists<T> theLists(closed);
+  return &theLists;
+}
+
+template <typename T>
+T *
+allocate(int n, bool zero)
+{
+  if (n <= 0)
+    return nullptr;
+
+  if (n <= MaxPooled) {
+    FreeLists<T> *theLists = getFreeLists<T>();
+    if (theLists != nullptr && !theLists->lists[n].empty()) {
+      T *data = theLists->lists[n].back();
+      theLists->lists[n].pop_back();
+      pooledBytes -= n*(long long)sizeof(T);
+      if (zero)
+        for (int i=0; i<n; i++)
+          data[i] = T(0);
+      return data;
+    }
+  }
+
+  numAllocations.fetch_add(1, std::memory_order_relaxed);
+  return zero ? new T[n]{} : new T[n];
+}
+
+template <typename T>
+void
+release(T *data, int n)
+{
+  if (data == nullptr)
+    return;
+
+  if (n > 0 && n <= MaxPooled) {
+    FreeLists<T> *theLists = getFreeLists<T>();
+    const long long bytes = n*(long long)sizeof(T);
+    if (theLists != nullptr && pooledBytes + bytes <= MaxPooledBytes) {
+      theLists->lists[n].push_back(data);
+      pooledBytes += bytes;
+      return;
+    }
+  }
+
+  numDeallocations.fetch_add(1, std::memory_order_relaxed);
+  delete [] data;
+}
+
+void
+trim()
+{
+  FreeLists<double> *theDoubles = getFreeLists<double>();
+  if (theDoubles != nullptr)
+    theDoubles->clear();
+
+  FreeLists<int> *theInts = getFreeLists<int>();
+  if (theInts != nullptr)
+    theInts->clear();
+
+  pooledBytes = 0;
+}
+
+Statistics
+getStatistics()
+{
+  return {numAllocations.load(std::memory_order_relaxed),
+          numDeallocations.load(std::memory_order_relaxed)};
+}
+
+void
+resetStatistics()
+{
+  numAllocations.store(0, std::memory_order_relaxed);
+  numDeallocations.store(0, std::memory_order_relaxed);
+}
+
+template double *allocate<double>(int, bool);
+template int    *allocate<int>(int, bool);
+template void    release<double>(double *, int);
+template void    release<int>(int *, int);
+
+} // namespace MemoryPool
+} // namespace OpenSees
@@ -0,0 +1,62 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the interface to the allocator used
+// for the storage of Vector, Matrix and ID objects.
+//
+// Most of these objects are small, short-lived temporaries (element
+// vectors, element matrices, DOF and connectivity IDs) that are created
+// and destroyed at every state determination. Arrays of up to MaxPooled
+// entries are therefore kept on per-thread free lists, one list for each
+// exact length, and a released array is handed out again to the next
+// request for the same length on the same thread; only larger arrays and
+// requests that find an empty list go to the heap. The arrays kept by a
+// thread take at most MaxPooledBytes, beyond which released arrays go
+// back to the heap, and trim() gives them all back, e.g. when the model
+// is wiped.
+//
+// Every block is obtained with new T[n] for the length n it was first
+// requested for, so a block may still be freed with delete [], and an
+// array of some other origin that was obtained with new T[m] may be
+// released with any length n <= m.
+//
+// The number of arrays taken from and returned to the heap by this
+// allocator is counted, so the absence of allocations in a loop can be
+// checked by comparing getStatistics() before and after it.
+//
+#ifndef MemoryPool_h
+#define MemoryPool_h
+
+namespace OpenSees {
+namespace MemoryPool {
+
+  // longest array kept on the free lists
+  constexpr int MaxPooled = 1024;
+
+  // most storage kept on the free lists of a thread
+  constexpr long long MaxPooledBytes = 16*1024*1024;
+
+  // array of n entries, zeroed if zero is true
+  template <typename T> T   *allocate(int n, bool zero = false);
+
+  // return an array holding at least n entries
+  template <typename T> void release(T *data, int n);
+
+  // return the arrays kept on the free lists of the calling thread
+  void trim();
+
+  struct Statistics {
+    long long allocations;   // arrays obtained from the heap
+    long long deallocations; // arrays returned to the heap
+  };
+
+  Statistics getStatistics();
+  void       resetStatistics();
+
+} // namespace MemoryPool
+} // namespace OpenSees
+
+#endif
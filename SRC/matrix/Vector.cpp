@@ -27,6 +27,7 @@
 #include "Vector.h"
 #include "Matrix.h"
 #include "ID.h"
+#include "MemoryPool.h"
 #include <OPS_Stream.h>
 
 #include <math.h>
@@ -37,6 +38,9 @@
 #define VECTOR_BLAS
 #endif
 
+using OpenSees::MemoryPool::allocate;
+using OpenSees::MemoryPool::release;
+
 // Vector():
 //        Standard constructor, sets size = 0;
 
@@ -56,14 +60,14 @@ Vector::Vector(int size)
 
   // get some space for the vector
   if (size > 0)
-    theData = new double [size]{};
+    theData = allocate<double>(size, true);
 }
 
 Vector::Vector(std::shared_ptr<double[]> data, int size)
 : sz(size), theData(nullptr), fromFree(0)
 {
   if (size > 0) {
-    theData = new double [size];
+    theData = allocate<double>(size);
 
     for (int i=0; i<sz; i++)
       theData[i] = data[i];
@@ -85,7 +89,7 @@ Vector::Vector(const Vector &other)
 : sz(other.sz),theData(0),fromFree(0)
 {
   if (sz != 0) {
-    theData = new double [other.sz];    
+    theData = allocate<double>(other.sz);
   }
   // copy the component data
   for (int i=0; i<sz; i++)
@@ -96,10 +100,11 @@ Vector::Vector(const Vector &other)
 //  Move constructor
 #if !defined(NO_CXX11_MOVE)   
 Vector::Vector(Vector &&other)
-: sz(other.sz),theData(other.theData),fromFree(0)
+: sz(other.sz),theData(other.theData),fromFree(other.fromFree)
 {
   other.theData = nullptr;
   other.sz = 0;
+  other.fromFree = 0;
 } 
 #endif
 
@@ -107,8 +112,8 @@ Vector::Vector(Vector &&other)
 
 Vector::~Vector()
 {
-  if (fromFree == 0 && theData != nullptr)
-    delete [] theData;
+  if (fromFree == 0)
+    release(theData, sz);
   theData = nullptr;
 }
 
@@ -118,10 +123,9 @@ Vector::setData(double *newData, int size)
 {
   assert(size >  0);
 
-  if (theData != nullptr && fromFree == 0) {
-    delete [] theData;
-    theData = nullptr;
-  }
+  if (fromFree == 0)
+    release(theData, sz);
+
   sz = size;
   theData = newData;
   fromFree = 1;
@@ -150,16 +154,14 @@ Vector::resize(int newSize)
   if (newSize > sz) {
 
     // delete the old array
-    if (theData != 0 && fromFree == 0) {
-      delete [] theData;
-      theData = nullptr;
-    }
+    if (fromFree == 0)
+      release(theData, sz);
+    theData = nullptr;
     sz = 0;
     fromFree = 0;
     
     // create new memory
-    // theData = (double *)malloc(newSize*sizeof(double));    
-    theData = new double[newSize];
+    theData = allocate<double>(newSize);
 
     sz = newSize;
   }  
@@ -671,17 +673,15 @@ Vector::operator[](int x)
   
   if (x >= sz) {
     // TODO: Is this expected?
-    double *dataNew = new double[x+1];
+    double *dataNew = allocate<double>(x+1);
     for (int i=0; i<sz; i++)
       dataNew[i] = theData[i];
     for (int j=sz; j<x; j++)
       dataNew[j] = 0.0;
     
     if (fromFree == 0)
-      if (theData != 0){
-        delete [] theData;
-      theData = 0;
-    }
+      release(theData, sz);
+    fromFree = 0;
     theData = dataNew;
     sz = x+1;
   }
@@ -725,15 +725,13 @@ Vector::operator=(const Vector &V)
   if (this != &V) {
 
       if (sz != V.sz)  {
-          // Check that we are not deleting an empty Vector
-          if (this->theData != nullptr){
-            delete [] this->theData;
-            this->theData = nullptr;
-          }
+          // only free the old data if this Vector owns it
+          if (fromFree == 0)
+            release(this->theData, sz);
           this->sz = V.sz;
+          this->fromFree = 0;
           
-          // Check that we are not creating an empty Vector
-          this->theData = (sz != 0) ? new double[sz] : nullptr;
+          this->theData = allocate<double>(sz);
       }
 
       // copy the data
@@ -751,14 +749,14 @@ Vector::operator=(Vector &&V)
 {
   // first check we are not trying v = v
   if (this != &V) {
-    if (this->theData != nullptr) { 
-      delete [] this->theData;
-      this->theData = 0;
-    }
+    if (fromFree == 0)
+      release(this->theData, sz);
     theData = V.theData;
     this->sz = V.sz;
+    this->fromFree = V.fromFree;
     V.theData = 0;
     V.sz = 0;
+    V.fromFree = 0;
   }
   return *this;
 }
@@ -35,6 +35,9 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <Logging.h>
+#ifdef _OPENMP
+#  include <omp.h>
+#endif
 
 DriftRecorder::DriftRecorder()
   :Recorder(RECORDER_TAGS_DriftRecorder),
@@ -149,6 +152,10 @@ DriftRecorder::record(int commitTag, double timeStamp)
       timeOffset = 1;
     }
     
+    // each drift only writes to its own column
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if(numNodes > 4096 && !omp_in_parallel())
+#endif
     for (int i=0; i<numNodes; i++) {
       Node *nodeI = theNodes[2*i];
       Node *nodeJ = theNodes[2*i+1];
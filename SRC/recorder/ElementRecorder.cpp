@@ -52,6 +52,9 @@
 #include <elementAPI.h>
 
 #include <string.h>
+#ifdef _OPENMP
+#  include <omp.h>
+#endif
 
 void *
 OPS_ADD_RUNTIME_VPV(OPS_ElementRecorder)
@@ -82,6 +85,7 @@ OPS_ADD_RUNTIME_VPV(OPS_ElementRecorder)
     double dT = 0.0;
     double rTolDt = 0.00001;
     bool doScientific = false;
+    bool parallel = false;
 
     int precision = 6;
 
@@ -106,6 +110,9 @@ OPS_ADD_RUNTIME_VPV(OPS_ElementRecorder)
         else if (strcmp(option, "-scientific") == 0) {
             doScientific = true;
         }
+        else if (strcmp(option, "-parallel") == 0) {
+            parallel = true;
+        }
         else if (strcmp(option, "-file") == 0) {
             if (OPS_GetNumRemainingInputArgs() > 0) {
                 filename = OPS_GetString();
@@ -292,6 +299,7 @@ OPS_ADD_RUNTIME_VPV(OPS_ElementRecorder)
     ElementRecorder* recorder = new ElementRecorder(&elements,
         data, nargrem, echoTimeFlag, *domain, *theOutputStream,
         dT, rTolDt, &dofs);
+    recorder->setParallel(parallel);
 
     if (data != 0) {
       for (int i=1; i<nargrem; ++i) {
@@ -309,7 +317,8 @@ ElementRecorder::ElementRecorder()
  numEle(0), numDOF(0), eleID(0), dof(0), theResponses(0), 
  theDomain(0), theOutputHandler(0),
  echoTimeFlag(true), deltaT(0.0), relDeltaTTol(0.00001), nextTimeStampToRecord(0.0), data(0),
- initializationDone(false), responseArgs(0), numArgs(0), addColumnInfo(0)
+ initializationDone(false), responseArgs(0), numArgs(0), addColumnInfo(0),
+ offsets(0), parallel(false)
 {
 
 }
@@ -327,7 +336,8 @@ ElementRecorder::ElementRecorder(const ID *ele,
  numEle(0), numDOF(0), eleID(0), dof(0), theResponses(0), 
  theDomain(&theDom), theOutputHandler(&theOutput),
  echoTimeFlag(echoTime), deltaT(dT), relDeltaTTol(rTolDt), nextTimeStampToRecord(0.0), data(0),
- initializationDone(false), responseArgs(0), numArgs(0), addColumnInfo(0)
+ initializationDone(false), responseArgs(0), numArgs(0), addColumnInfo(0),
+ offsets(0), parallel(false)
 {
 
   if (ele != 0) {
@@ -380,6 +390,9 @@ ElementRecorder::~ElementRecorder()
 
   if (data != 0)
     delete data;
+
+  if (offsets != 0)
+    delete offsets;
   
   // 
   // invoke destructor on response args
@@ -392,6 +405,13 @@ ElementRecorder::~ElementRecorder()
 }
 
 
+void
+ElementRecorder::setParallel(bool flag)
+{
+  parallel = flag;
+}
+
+
 int 
 ElementRecorder::record(int commitTag, double timeStamp)
 {
@@ -414,26 +434,30 @@ ElementRecorder::record(int commitTag, double timeStamp)
     if (deltaT != 0.0)
       nextTimeStampToRecord = timeStamp + deltaT;
 
-    int loc = 0;
     if (echoTimeFlag == true) 
-      (*data)(loc++) = timeStamp;
+      (*data)(0) = timeStamp;
     
     //
-    // for each element if responses exist, put them in response vector
+    // for each element if responses exist, put them in response vector;
+    // each response only writes to its own columns, so they may be
+    // gathered in any order
     //
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 64) if(parallel && numEle > 1 && !omp_in_parallel()) reduction(+:result)
+#endif
     for (int i=0; i< numEle; i++) {
       if (theResponses[i] != 0) {
+	int loc = (*offsets)(i);
 	// ask the element for the response
 	int res;
 	if (( res = theResponses[i]->getResponse()) < 0)
 	  result += res;
 	else {
 	  Information &eleInfo = theResponses[i]->getInformation();
-	  const Vector &eleData = eleInfo.getData();
 	  if (numDOF == 0) {
-	    for (int j=0; j<eleData.Size(); j++)
-	      (*data)(loc++) = eleData(j);
+	    eleInfo.copyData(*data, loc);
 	  } else {
+	    const Vector &eleData = eleInfo.getData();
 	    int dataSize = data->Size();
 	    for (int j=0; j<numDOF; j++) {
 	      int index = (*dof)(j);
@@ -927,6 +951,27 @@ ElementRecorder::initialize(void)
     opserr << "ElementRecorder::initialize() - out of memory\n";
     return -1;
   }
+
+  // find the first column of each response, and have the responses
+  // store their values directly in data
+  if (offsets != 0)
+    delete offsets;
+  offsets = new ID(numEle);
+
+  int loc = echoTimeFlag ? 1 : 0;
+  for (int i=0; i<numEle; i++) {
+    (*offsets)(i) = loc;
+    if (theResponses[i] != 0) {
+      Information &eleInfo = theResponses[i]->getInformation();
+      int dataSize = eleInfo.getData().Size();
+      if (numDOF == 0) {
+        if (dataSize > 0 && loc + dataSize <= numDbColumns)
+          eleInfo.bindData(&(*data)(loc), dataSize);
+        loc += dataSize;
+      } else
+        loc += numDOF;
+    }
+  }
   
   theOutputHandler->tag("Data");
   initializationDone = true;
@@ -64,6 +64,10 @@ class ElementRecorder: public Recorder
 
     ~ElementRecorder();
 
+    // Gather the responses of the elements in parallel (when built
+    // with OpenMP); only for elements whose getResponse() is thread safe
+    void setParallel(bool flag);
+
     int record(int commitTag, double timeStamp);
     int restart(void);    
     int flush(void);    
@@ -103,6 +107,9 @@ class ElementRecorder: public Recorder
     int numArgs;
 
     int addColumnInfo;
+
+    ID *offsets;                   // first column of each response in data
+    bool parallel;
 };
 
 
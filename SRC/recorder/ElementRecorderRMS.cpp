@@ -294,7 +294,7 @@ ElementRecorderRMS::ElementRecorderRMS()
 :Recorder(RECORDER_TAGS_ElementRecorderRMS),
  numEle(0), numDOF(0), eleID(0), dof(0), theResponses(0), theDomain(0),
  theHandler(0), deltaT(0.0), relDeltaTTol(0.00001), nextTimeStampToRecord(0.0),
- runningTotal(0), currentData(0), count(0), 
+ currentData(0), 
  initializationDone(false), responseArgs(0), numArgs(0), addColumnInfo(0)
 {
 
@@ -312,7 +312,7 @@ ElementRecorderRMS::ElementRecorderRMS(const ID *ele,
   :Recorder(RECORDER_TAGS_ElementRecorderRMS),
   numEle(0), eleID(0), numDOF(0), dof(0), theResponses(0), theDomain(&theDom),
   theHandler(&theOutputHandler), deltaT(dT), relDeltaTTol(rTolDt), nextTimeStampToRecord(0.0),
-   runningTotal(0), currentData(0), count(0),
+   currentData(0),
   initializationDone(false), responseArgs(0), numArgs(0), addColumnInfo(0)
 {
   opserr << "ElementRMS:: constructor\n";
@@ -367,17 +367,8 @@ ElementRecorderRMS::~ElementRecorderRMS()
 
     theHandler->tag("Data"); // Data
 
-    if (runningTotal != 0) {
-
-      opserr << "ElementRMS DESTRUCTOR - runin\n" << runningTotal->Size() << "\n";
-
-      for (int j=0; j<runningTotal->Size(); j++)
-	if (count != 0) {
-	  double value = (*runningTotal)(j);
-	  (*runningTotal)(j) = sqrt(value/(count));
-	}
-      theHandler->write(*runningTotal);
-    }
+    runningTotal.getRMS(*currentData);
+    theHandler->write(*currentData);
 
     theHandler->endTag(); // Data
   }
@@ -385,9 +376,6 @@ ElementRecorderRMS::~ElementRecorderRMS()
   if (theHandler != 0)
     delete theHandler;
 
-  if (runningTotal != 0)
-    delete runningTotal;
-  
   if (currentData != 0)
     delete currentData;
 
@@ -469,12 +457,8 @@ ElementRecorderRMS::record(int commitTag, double timeStamp)
     }
 
     // add data contribution to runningTotal
-    count++;
-    int sizeData = currentData->Size();
-    for (int i=0; i<sizeData; i++) {
-      double value = (*currentData)(i);
-      (*runningTotal)(i) += value*value;
-    } 
+    if (currentData->Size() > 0)
+      runningTotal.update(&(*currentData)(0));
   }    
 
   // successful completion - return 0
@@ -484,8 +468,7 @@ ElementRecorderRMS::record(int commitTag, double timeStamp)
 int
 ElementRecorderRMS::restart(void)
 {
-  runningTotal->Zero();
-  count = 0;
+  runningTotal.zero();
   return 0;
 }
 
@@ -920,15 +903,12 @@ ElementRecorderRMS::initialize(void)
   // create the matrix & vector that holds the data
   //
 
-  opserr << numEle << " " << numDbColumns << "\n";
-
-  runningTotal = new Vector(numDbColumns);
+  runningTotal.setSize(numDbColumns);
   currentData = new Vector(numDbColumns);
-  if (runningTotal == 0 || currentData == 0) {
+  if (currentData == 0) {
     opserr << "ElementRecorderRMS::ElementRecorderRMS() - out of memory\n";
     exit(-1);
   }
-  runningTotal->Zero();
   currentData->Zero();
 
   initializationDone = true;  
@@ -941,13 +921,14 @@ double ElementRecorderRMS::getRecordedValue(int clmnId, int rowOffset, bool rese
 	double res = 0;
 	if (!initializationDone)
 		return res;
-	if (clmnId >= runningTotal->Size())
+	if (clmnId >= runningTotal.getSize())
 		return res;
-	res = (*runningTotal)(clmnId);
-	if (count != 0)
-	  res = sqrt(res/count);
+	int count = runningTotal.getCount();
+	if (count == 0)
+	  return res;
+	res = runningTotal.getRMS(clmnId);
 	if (reset)
-	  count = 0;
+	  runningTotal.zero();
 	return (res*res)/count;
 }
 
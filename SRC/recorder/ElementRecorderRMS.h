@@ -33,6 +33,7 @@
 #include <Information.h>
 #include <OPS_Globals.h>
 #include <ID.h>
+#include <StreamingReduction.h>
 
 
 class Domain;
@@ -87,9 +88,8 @@ class ElementRecorderRMS: public Recorder
     double relDeltaTTol;
     double nextTimeStampToRecord;
 
-    Vector *runningTotal;
+    RMSReduction runningTotal;
     Vector *currentData;
-    int count;
 
     bool initializationDone;
     char **responseArgs;
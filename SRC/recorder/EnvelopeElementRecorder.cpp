@@ -53,6 +53,9 @@
 #include <string.h>
 #include <stdlib.h>
 #include <math.h>
+#ifdef _OPENMP
+#  include <omp.h>
+#endif
 
 void *
 OPS_ADD_RUNTIME_VPV(OPS_EnvelopeElementRecorder)
@@ -83,6 +86,7 @@ OPS_ADD_RUNTIME_VPV(OPS_EnvelopeElementRecorder)
     double dT = 0.0;
     double rTolDt = 0.00001;
     bool doScientific = false;
+    bool parallel = false;
 
     int precision = 6;
 
@@ -107,6 +111,9 @@ OPS_ADD_RUNTIME_VPV(OPS_EnvelopeElementRecorder)
         else if (strcmp(option, "-scientific") == 0) {
             doScientific = true;
         }
+        else if (strcmp(option, "-parallel") == 0) {
+            parallel = true;
+        }
         else if (strcmp(option, "-file") == 0) {
             if (OPS_GetNumRemainingInputArgs() > 0) {
                 filename = OPS_GetString();
@@ -291,6 +298,7 @@ OPS_ADD_RUNTIME_VPV(OPS_EnvelopeElementRecorder)
         return 0;
     EnvelopeElementRecorder* recorder = new EnvelopeElementRecorder(&elements,
         data, nargrem, *domain, *theOutputStream, dT, rTolDt, echoTimeFlag, &dofs);
+    recorder->setParallel(parallel);
 
     return recorder;
 }
@@ -300,8 +308,9 @@ EnvelopeElementRecorder::EnvelopeElementRecorder()
 :Recorder(RECORDER_TAGS_EnvelopeElementRecorder),
  numEle(0), numDOF(0), eleID(0), dof(0), theResponses(0), theDomain(0),
  theHandler(0), deltaT(0.0), relDeltaTTol(0.00001), nextTimeStampToRecord(0.0),
- data(0), currentData(0), first(true),
- initializationDone(false), responseArgs(0), numArgs(0), echoTimeFlag(false), addColumnInfo(0)
+ currentData(0),
+ initializationDone(false), responseArgs(0), numArgs(0), echoTimeFlag(false), addColumnInfo(0),
+ offsets(0), parallel(false)
 {
 
 }
@@ -319,8 +328,9 @@ EnvelopeElementRecorder::EnvelopeElementRecorder(const ID *ele,
  :Recorder(RECORDER_TAGS_EnvelopeElementRecorder),
   numEle(0), eleID(0), numDOF(0), dof(0), theResponses(0), theDomain(&theDom),
   theHandler(&theOutputHandler), deltaT(dT), relDeltaTTol(rTolDt), nextTimeStampToRecord(0.0),
-  data(0), currentData(0), first(true),
-  initializationDone(false), responseArgs(0), numArgs(0), echoTimeFlag(echoTime), addColumnInfo(0)
+  currentData(0),
+  initializationDone(false), responseArgs(0), numArgs(0), echoTimeFlag(echoTime), addColumnInfo(0),
+  offsets(0), parallel(false)
 {
 
   if (ele != 0) {
@@ -372,9 +382,7 @@ EnvelopeElementRecorder::~EnvelopeElementRecorder()
     theHandler->tag("Data"); // Data
 
     for (int i=0; i<3; i++) {
-      int numResponse = currentData->Size();
-      for (int j=0; j<numResponse; j++)
-	(*currentData)(j) = (*data)(i,j);
+      envelope.getRow(i, *currentData);
       theHandler->write(*currentData);
     }
 
@@ -384,12 +392,12 @@ EnvelopeElementRecorder::~EnvelopeElementRecorder()
   if (theHandler != 0)
     delete theHandler;
 
-  if (data != 0)
-    delete data;
-  
   if (currentData != 0)
     delete currentData;
 
+  if (offsets != 0)
+    delete offsets;
+
   //
   // clean up the memory
   //
@@ -414,6 +422,13 @@ EnvelopeElementRecorder::~EnvelopeElementRecorder()
 }
 
 
+void
+EnvelopeElementRecorder::setParallel(bool flag)
+{
+  parallel = flag;
+}
+
+
 int 
 EnvelopeElementRecorder::record(int commitTag, double timeStamp)
 {
@@ -436,10 +451,14 @@ EnvelopeElementRecorder::record(int commitTag, double timeStamp)
     if (deltaT != 0.0) 
       nextTimeStampToRecord = timeStamp + deltaT;
     
-    int loc = 0;
-    // for each element do a getResponse() & put the result in current data
+    // for each element do a getResponse() & put the result in current
+    // data; each response only writes to its own columns
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 64) if(parallel && numEle > 1 && !omp_in_parallel()) reduction(+:result)
+#endif
     for (int i=0; i< numEle; i++) {
       if (theResponses[i] != 0) {
+	int loc = (*offsets)(i);
 	// ask the element for the response
 	int res;
 	if (( res = theResponses[i]->getResponse()) < 0)
@@ -447,13 +466,10 @@ EnvelopeElementRecorder::record(int commitTag, double timeStamp)
 	else {
 	  // from the response determine no of cols for each
 	  Information &eleInfo = theResponses[i]->getInformation();
-	  const Vector &eleData = eleInfo.getData();
-	  //	  for (int j=0; j<eleData.Size(); j++) 
-	  //	    (*currentData)(loc++) = eleData(j);
 	  if (numDOF == 0) {
-	    for (int j=0; j<eleData.Size(); j++)
-	      (*currentData)(loc++) = eleData(j);
+	    eleInfo.copyData(*currentData, loc);
 	  } else {
+	    const Vector &eleData = eleInfo.getData();
 	    int dataSize = eleData.Size();
 	    for (int j=0; j<numDOF; j++) {
 	      int index = (*dof)(j);
@@ -467,76 +483,11 @@ EnvelopeElementRecorder::record(int commitTag, double timeStamp)
       }
     }
 
-    int sizeData = currentData->Size();
-    if (echoTimeFlag == false) {
-
-      // bool writeIt = false;
-      if (first == true) {
-	for (int i=0; i<sizeData; i++) {
-	  (*data)(0,i) = (*currentData)(i);
-	  (*data)(1,i) = (*currentData)(i);
-	  (*data)(2,i) = fabs((*currentData)(i));
-	  first = false;
-	  // writeIt = true;
-	} 
-      } else {
-	for (int i=0; i<sizeData; i++) {
-	  double value = (*currentData)(i);
-	  if ((*data)(0,i) > value) {
-	    (*data)(0,i) = value;
-	    double absValue = fabs(value);
-	    if ((*data)(2,i) < absValue) 
-	      (*data)(2,i) = absValue;
-	    // writeIt = true;
-	  } else if ((*data)(1,i) < value) {
-	    (*data)(1,i) = value;
-	    double absValue = fabs(value);
-	    if ((*data)(2,i) < absValue) 
-	      (*data)(2,i) = absValue;
-	    // writeIt = true;
-	  }
-	}
-      }
-    } else {
-      sizeData /= 2;
-      // bool writeIt = false;
-      if (first == true) {
-	for (int i=0; i<sizeData; i++) {
-	  
-	  (*data)(0,i*2) = timeStamp;
-	  (*data)(1,i*2) = timeStamp;
-	  (*data)(2,i*2) = timeStamp;
-	  (*data)(0,i*2+1) = (*currentData)(i);
-	  (*data)(1,i*2+1) = (*currentData)(i);
-	  (*data)(2,i*2+1) = fabs((*currentData)(i));
-	  first = false;
-	  // writeIt = true;
-	} 
-      } else {
-	for (int i=0; i<sizeData; i++) {
-	  double value = (*currentData)(i);
-	  if ((*data)(0,2*i+1) > value) {
-	    (*data)(0,i*2) = timeStamp;
-	    (*data)(0,i*2+1) = value;
-	    double absValue = fabs(value);
-	    if ((*data)(2,i*2+1) < absValue) {
-	      (*data)(2,i*2+1) = absValue;
-	      (*data)(2,i*2) = timeStamp;
-	    }
-	    // writeIt = true;
-	  } else if ((*data)(1,i*2+1) < value) {
-	    (*data)(1,i*2) = timeStamp;
-	    (*data)(1,i*2+1) = value;
-	    double absValue = fabs(value);
-	    if ((*data)(2,i*2+1) < absValue) { 
-	      (*data)(2,i*2) = timeStamp;
-	      (*data)(2,i*2+1) = absValue;
-	    }
-	    // writeIt = true;
-	  }
-	}
-      }
-    }
+    // update the envelope; when echoTimeFlag is set only the first half
+    // of currentData holds responses, the envelope keeps the times
+    if (currentData->Size() > 0)
+      envelope.update(&(*currentData)(0), timeStamp);
+
   }    
   // successful completion - return 0
   return result;
@@ -545,8 +496,8 @@ EnvelopeElementRecorder::record(int commitTag, double timeStamp)
 int
 EnvelopeElementRecorder::restart(void)
 {
-  data->Zero();
-  first = true;
+  envelope.zero();
+  envelope.reset();
   return 0;
 }
 
@@ -1005,20 +956,42 @@ EnvelopeElementRecorder::initialize(void)
   }
 
   //
-  // create the matrix & vector that holds the data
+  // size the envelope & create the vector that holds the data
   //
 
+  envelope.setSize(numDbColumns, echoTimeFlag);
+
   if (echoTimeFlag == true) {
     numDbColumns *= 2;
   }
 
-  data = new Matrix(3, numDbColumns);
   currentData = new Vector(numDbColumns);
-  if (data == 0 || currentData == 0) {
+  if (currentData == 0) {
     opserr << "EnvelopeElementRecorder::EnvelopeElementRecorder() - out of memory\n";
     exit(-1);
   }
 
+  // find the first column of each response, and have the responses
+  // store their values directly in currentData
+  if (offsets != 0)
+    delete offsets;
+  offsets = new ID(numEle);
+
+  int loc = 0;
+  for (int i=0; i<numEle; i++) {
+    (*offsets)(i) = loc;
+    if (theResponses[i] != 0) {
+      Information &eleInfo = theResponses[i]->getInformation();
+      int dataSize = eleInfo.getData().Size();
+      if (numDOF == 0) {
+        if (dataSize > 0 && loc + dataSize <= currentData->Size())
+          eleInfo.bindData(&(*currentData)(loc), dataSize);
+        loc += dataSize;
+      } else
+        loc += numDOF;
+    }
+  }
+
   initializationDone = true;  
   return 0;
 }
@@ -1029,11 +1002,11 @@ double EnvelopeElementRecorder::getRecordedValue(int clmnId, int rowOffset, bool
 	double res = 0;
 	if (!initializationDone)
 		return res;
-	if (clmnId >= data->noCols())
+	if (clmnId >= envelope.getNumColumns())
 		return res;
-	res = (*data)(2 - rowOffset, clmnId);
+	res = envelope.getValue(2 - rowOffset, clmnId);
 	if (reset)
-		first = true;
+		envelope.reset();
 	return res;
 }
 
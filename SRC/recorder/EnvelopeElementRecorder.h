@@ -33,6 +33,7 @@
 #include <Information.h>
 #include <OPS_Globals.h>
 #include <ID.h>
+#include <StreamingReduction.h>
 
 
 class Domain;
@@ -59,6 +60,10 @@ class EnvelopeElementRecorder: public Recorder
 
     ~EnvelopeElementRecorder();
 
+    // Gather the responses of the elements in parallel (when built
+    // with OpenMP); only for elements whose getResponse() is thread safe
+    void setParallel(bool flag);
+
     int record(int commitTag, double timeStamp);
     int restart(void);    
     int flush(void);    
@@ -89,9 +94,8 @@ class EnvelopeElementRecorder: public Recorder
     double relDeltaTTol;
     double nextTimeStampToRecord;
 
-    Matrix *data;
+    EnvelopeReduction envelope;
     Vector *currentData;
-    bool first;
 
     bool initializationDone;
     char **responseArgs;
@@ -100,6 +104,9 @@ class EnvelopeElementRecorder: public Recorder
     bool echoTimeFlag; 
 
     int addColumnInfo;
+
+    ID *offsets;                   // first column of each response in currentData
+    bool parallel;
 };
 
 
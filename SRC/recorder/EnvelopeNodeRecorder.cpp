@@ -309,10 +309,10 @@ OPS_ADD_RUNTIME_VPV(OPS_EnvelopeNodeRecorder)
 EnvelopeNodeRecorder::EnvelopeNodeRecorder()
 :Recorder(RECORDER_TAGS_EnvelopeNodeRecorder),
  theDofs(0), theNodalTags(0), theNodes(0),
- currentData(0), data(0), 
+ currentData(0),
  theDomain(0), theHandler(0),
  deltaT(0.0), relDeltaTTol(0.00001), nextTimeStampToRecord(0.0),
- first(true), initializationDone(false), 
+ initializationDone(false), 
  numValidNodes(0), addColumnInfo(0), theTimeSeries(0), timeSeriesValues(0),
  dataFlag(NodeData::Disp), dataIndex(-1)
 {
@@ -331,10 +331,10 @@ EnvelopeNodeRecorder::EnvelopeNodeRecorder(const ID &dofs,
 					   TimeSeries **theSeries)
 :Recorder(RECORDER_TAGS_EnvelopeNodeRecorder),
  theDofs(0), theNodalTags(0), theNodes(0),
- currentData(0), data(0), 
+ currentData(0),
  theDomain(&theDom), theHandler(&theOutputHandler),
  deltaT(dT), relDeltaTTol(rTolDt), nextTimeStampToRecord(0.0),
- first(true), initializationDone(false), numValidNodes(0), echoTimeFlag(echoTime), 
+ initializationDone(false), numValidNodes(0), echoTimeFlag(echoTime), 
  addColumnInfo(0), theTimeSeries(theSeries), timeSeriesValues(0),
  dataFlag(_dataFlag), dataIndex(_dataIndex)
 {
@@ -390,15 +390,12 @@ EnvelopeNodeRecorder::~EnvelopeNodeRecorder()
   //
   // write the data
   //
-  if (theHandler != 0 && data != 0) {
+  if (theHandler != 0 && currentData != 0) {
     
     theHandler->tag("Data"); // Data
     
-    int numResponse = data->noCols();
-    
     for (int i=0; i<3; i++) {
-      for (int j=0; j<numResponse; j++)
-	(*currentData)(j) = (*data)(i,j);
+      envelope.getRow(i, *currentData);
       theHandler->write(*currentData);
     }
       
@@ -422,9 +419,6 @@ EnvelopeNodeRecorder::~EnvelopeNodeRecorder()
   if (currentData != 0)
     delete currentData;
 
-  if (data != 0)
-    delete data;
-
   if (theNodes != 0)
     delete [] theNodes;
 
@@ -649,77 +643,10 @@ EnvelopeNodeRecorder::record(int commitTag, double timeStamp)
     }
   }
 
-  // check if currentData modifies the saved data
-  int sizeData = currentData->Size();
-  if (echoTimeFlag == false) {
-
-    // bool writeIt = false;
-    if (first == true) {
-      for (int i=0; i<sizeData; i++) {
-	(*data)(0,i) = (*currentData)(i);
-	(*data)(1,i) = (*currentData)(i);
-	(*data)(2,i) = fabs((*currentData)(i));
-	first = false;
-	// writeIt = true;
-      } 
-    } else {
-      for (int i=0; i<sizeData; i++) {
-	double value = (*currentData)(i);
-	if ((*data)(0,i) > value) {
-	  (*data)(0,i) = value;
-	  double absValue = fabs(value);
-	  if ((*data)(2,i) < absValue) 
-	    (*data)(2,i) = absValue;
-	  // writeIt = true;
-	} else if ((*data)(1,i) < value) {
-	  (*data)(1,i) = value;
-	  double absValue = fabs(value);
-	  if ((*data)(2,i) < absValue) 
-	    (*data)(2,i) = absValue;
-	  // writeIt = true;
-	}
-      }
-    }
-  } else {
-    sizeData /= 2;
-    // bool writeIt = false;
-    if (first == true) {
-      for (int i=0; i<sizeData; i++) {
-
-	(*data)(0,i*2) = timeStamp;
-	(*data)(1,i*2) = timeStamp;
-	(*data)(2,i*2) = timeStamp;
-	(*data)(0,i*2+1) = (*currentData)(i);
-	(*data)(1,i*2+1) = (*currentData)(i);
-	(*data)(2,i*2+1) = fabs((*currentData)(i));
-	first = false;
-	// writeIt = true;
-      } 
-    } else {
-      for (int i=0; i<sizeData; i++) {
-	double value = (*currentData)(i);
-	if ((*data)(0,2*i+1) > value) {
-	  (*data)(0,i*2) = timeStamp;
-	  (*data)(0,i*2+1) = value;
-	  double absValue = fabs(value);
-	  if ((*data)(2,i*2+1) < absValue) {
-	    (*data)(2,i*2+1) = absValue;
-	    (*data)(2,i*2) = timeStamp;
-	  }
-	  // writeIt = true;
-	} else if ((*data)(1,i*2+1) < value) {
-	  (*data)(1,i*2) = timeStamp;
-	  (*data)(1,i*2+1) = value;
-	  double absValue = fabs(value);
-	  if ((*data)(2,i*2+1) < absValue) { 
-	    (*data)(2,i*2) = timeStamp;
-	    (*data)(2,i*2+1) = absValue;
-	  }
-	  // writeIt = true;
-	}
-      }
-    }
-  }
+  // update the envelope; when echoTimeFlag is set only the first half
+  // of currentData holds responses, the envelope keeps the times
+  if (currentData->Size() > 0)
+    envelope.update(&(*currentData)(0), timeStamp);
 
   return 0;
 }
@@ -728,8 +655,8 @@ EnvelopeNodeRecorder::record(int commitTag, double timeStamp)
 int
 EnvelopeNodeRecorder::restart(void)
 {
-  data->Zero();
-  first = true;
+  envelope.zero();
+  envelope.reset();
   return 0;
 }
 
@@ -1053,7 +980,7 @@ EnvelopeNodeRecorder::initialize(void)
 
 
   //
-  // resize the output matrix
+  // size the envelope & the output vector
   //
 
   int numDOF = theDofs->Size();
@@ -1062,13 +989,13 @@ EnvelopeNodeRecorder::initialize(void)
   if (dataFlag == NodeData::DisplNorm)
     numValidResponse = numValidNodes;  
 
+  envelope.setSize(numValidResponse, echoTimeFlag);
+
   if (echoTimeFlag == true) {
     numValidResponse *= 2;
   }
 
   currentData = new Vector(numValidResponse);
-  data = new Matrix(3, numValidResponse);
-  data->Zero();
 
   ID dataOrder(numValidResponse);
   ID xmlOrder(numValidNodes);
@@ -1132,11 +1059,11 @@ double EnvelopeNodeRecorder::getRecordedValue(int clmnId, int rowOffset, bool re
 	double res = 0;
 	if (!initializationDone)
 		return res;
-	if (clmnId >= data->noCols())
+	if (clmnId >= envelope.getNumColumns())
 		return res;
-	res = (*data)(2 - rowOffset, clmnId);
+	res = envelope.getValue(2 - rowOffset, clmnId);
 	if (reset)
-		first = true;
+		envelope.reset();
 	return res;
 }
 
@@ -43,6 +43,7 @@
 #include <Vector.h>
 #include <Matrix.h>
 #include <TimeSeries.h>
+#include <StreamingReduction.h>
 
 class Domain;
 class FE_Datastore;
@@ -86,7 +87,7 @@ class EnvelopeNodeRecorder: public Recorder
     Node **theNodes;
 
     Vector *currentData;
-    Matrix *data;
+    EnvelopeReduction envelope;
 
     Domain *theDomain;
     OPS_Stream *theHandler;
@@ -98,7 +99,6 @@ class EnvelopeNodeRecorder: public Recorder
     double relDeltaTTol;
     double nextTimeStampToRecord;
 
-    bool first;
     bool initializationDone;
     int numValidNodes;
 
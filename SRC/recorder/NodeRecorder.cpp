@@ -50,6 +50,9 @@
 #include <string.h>
 #include <assert.h>
 #include <math.h>
+#ifdef _OPENMP
+#  include <omp.h>
+#endif
 
 NodeRecorder::NodeRecorder()
 : Recorder(RECORDER_TAGS_NodeRecorder),
@@ -223,8 +226,6 @@ NodeRecorder::record(int commitTag, double timeStamp)
       response(0) = timeStamp;
     }
 
-    double timeSeriesTerm = 0.0;
-
     if (theTimeSeries != nullptr) {
       for (int i=0; i<numDOF; i++) { 
 	if (theTimeSeries[i] != nullptr) 
@@ -233,12 +234,23 @@ NodeRecorder::record(int commitTag, double timeStamp)
     }
 
     //
-    // now we go get the responses from the nodes & place them in disp vector
+    // now we go get the responses from the nodes & place them in disp vector;
+    // each node only writes to its own columns, so large recorders share
+    // the nodes out between threads. The unbalance with inertia and the
+    // Rayleigh forces are formed in storage of the node, which a node
+    // listed twice would share, so those stay serial.
     //
     if (dataFlag != NodeData::Empty) { // != 10
 
+#ifdef _OPENMP
+      const bool shared = numValidNodes > 4096 && !omp_in_parallel()
+                       && dataFlag != NodeData::UnbalanceInclInertia
+                       && dataFlag != NodeData::RayleighForces;
+#pragma omp parallel for schedule(static) if(shared)
+#endif
       for (int i=0; i<numValidNodes; i++) {
 
+	double timeSeriesTerm = 0.0;
 	int cnt = i*numDOF + timeOffset; 
 	if (dataFlag == NodeData::DisplNorm 
          || dataFlag == NodeData::Pressure)
@@ -806,6 +818,15 @@ NodeRecorder::initialize(void)
     }
   }
 
+  // the nodes create their velocities and accelerations on first use;
+  // create them now so that record() only reads them
+  if (dataFlag == NodeData::VelocTrial || dataFlag == NodeData::AccelTrial) {
+    for (int i=0; i<numValidNodes; i++) {
+      theNodes[i]->getTrialVel();
+      theNodes[i]->getTrialAccel();
+    }
+  }
+
   //
   // resize the response vector
   //
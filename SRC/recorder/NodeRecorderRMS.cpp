@@ -53,7 +53,7 @@
 NodeRecorderRMS::NodeRecorderRMS()
 :Recorder(RECORDER_TAGS_NodeRecorderRMS),
  theDofs(0), theNodalTags(0), theNodes(0),
- currentData(0), runningTotal(0), count(0),
+ currentData(0),
  theDomain(0), theHandler(0),
  deltaT(0.0), relDeltaTTol(0.00001), nextTimeStampToRecord(0.0),
  initializationDone(false), 
@@ -74,7 +74,7 @@ NodeRecorderRMS::NodeRecorderRMS(const ID &dofs,
                                  TimeSeries **theSeries)
 :Recorder(RECORDER_TAGS_NodeRecorderRMS),
  theDofs(0), theNodalTags(0), theNodes(0),
- currentData(0), runningTotal(0), count(0),
+ currentData(0),
  theDomain(&theDom), theHandler(&theOutputHandler),
  deltaT(dT), relDeltaTTol(rTolDt), nextTimeStampToRecord(0.0),
  initializationDone(false), numValidNodes(0), 
@@ -130,21 +130,13 @@ NodeRecorderRMS::~NodeRecorderRMS()
   //
   // write the data
   //
-  if (theHandler != 0 && runningTotal != 0) {
+  if (theHandler != 0 && currentData != 0) {
     
     theHandler->tag("Data"); // Data
     
-    int numResponse = runningTotal->Size();
-    
-    if (runningTotal != 0) {
-      for (int j=0; j<numResponse; j++)
-	if (count != 0) {
-	  double value = (*runningTotal)(j);
-	  (*runningTotal)(j) = sqrt(value/(count));
-	}
-    }
+    runningTotal.getRMS(*currentData);
 
-    theHandler->write(*runningTotal);
+    theHandler->write(*currentData);
       
     theHandler->endTag(); // Data
   }
@@ -167,9 +159,6 @@ NodeRecorderRMS::~NodeRecorderRMS()
   if (currentData != 0)
     delete currentData;
 
-  if (runningTotal != 0)
-    delete runningTotal;
-
   if (theNodes != 0)
     delete [] theNodes;
 
@@ -395,12 +384,8 @@ NodeRecorderRMS::record(int commitTag, double timeStamp)
   }
  
  // add data contribution to runningTotal
-  count++;
-  int sizeData = currentData->Size();
-  for (int i=0; i<sizeData; i++) {
-    double value = (*currentData)(i);
-    (*runningTotal)(i) += value*value;;
-  }
+  if (currentData->Size() > 0)
+    runningTotal.update(&(*currentData)(0));
   return 0;
 }
 
@@ -408,8 +393,7 @@ NodeRecorderRMS::record(int commitTag, double timeStamp)
 int
 NodeRecorderRMS::restart(void)
 {
-  runningTotal->Zero();
-  count = 0;
+  runningTotal.zero();
   return 0;
 }
 
@@ -733,8 +717,7 @@ NodeRecorderRMS::initialize(void)
     numValidResponse = numValidNodes;  
 
   currentData = new Vector(numValidResponse);
-  runningTotal = new Vector(numValidResponse);
-  runningTotal->Zero();
+  runningTotal.setSize(numValidResponse);
 
   ID dataOrder(numValidResponse);
   ID xmlOrder(numValidNodes);
@@ -787,12 +770,13 @@ double NodeRecorderRMS::getRecordedValue(int clmnId, int rowOffset, bool reset)
 	double res = 0;
 	if (!initializationDone)
 		return res;
-	if (clmnId >= runningTotal->Size() && count == 0)
+	if (clmnId >= runningTotal.getSize())
 	  return res;
+	int count = runningTotal.getCount();
 	if (count != 0)
-	  res = sqrt(((*runningTotal)(clmnId)*(*runningTotal)(clmnId))/count);
+	  res = sqrt((runningTotal.getSumOfSquares(clmnId)*runningTotal.getSumOfSquares(clmnId))/count);
 	if (reset)
-	  count = 0;
+	  runningTotal.zero();
 	return res;
 }
 
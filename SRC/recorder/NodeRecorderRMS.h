@@ -29,6 +29,7 @@
 #include <Vector.h>
 #include <Matrix.h>
 #include <TimeSeries.h>
+#include <StreamingReduction.h>
 
 class Domain;
 class FE_Datastore;
@@ -72,8 +73,7 @@ class NodeRecorderRMS: public Recorder
     Node **theNodes;
 
     Vector *currentData;
-    Vector *runningTotal;
-    int count;
+    RMSReduction runningTotal;
 
     Domain *theDomain;
     OPS_Stream *theHandler;
@@ -50,7 +50,7 @@ NormEnvelopeElementRecorder::NormEnvelopeElementRecorder()
 :Recorder(RECORDER_TAGS_NormEnvelopeElementRecorder),
  numEle(0), numDOF(0), eleID(0), dof(0), theResponses(0), theDomain(0),
  theHandler(0), deltaT(0.0), relDeltaTTol(0.00001), nextTimeStampToRecord(0.0),
- data(0), currentData(0), first(true),
+ currentData(0),
  initializationDone(false), responseArgs(0), numArgs(0), echoTimeFlag(false), addColumnInfo(0)
 {
 
@@ -69,7 +69,7 @@ NormEnvelopeElementRecorder::NormEnvelopeElementRecorder(const ID *ele,
 :Recorder(RECORDER_TAGS_NormEnvelopeElementRecorder),
  numEle(0), eleID(0), numDOF(0), dof(0), theResponses(0), theDomain(&theDom),
  theHandler(&theOutputHandler), deltaT(dT), relDeltaTTol(rTolDt), nextTimeStampToRecord(0.0),
- data(0), currentData(0), first(true),
+ currentData(0),
  initializationDone(false), responseArgs(0), numArgs(0), echoTimeFlag(echoTime), addColumnInfo(0)
 {
 
@@ -124,9 +124,7 @@ NormEnvelopeElementRecorder::~NormEnvelopeElementRecorder()
     theHandler->tag("Data"); // Data
 
     for (int i=0; i<3; i++) {
-      int numResponse = currentData->Size();
-      for (int j=0; j<numResponse; j++)
-	(*currentData)(j) = (*data)(i,j);
+      envelope.getRow(i, *currentData);
       theHandler->write(*currentData);
     }
 
@@ -136,9 +134,6 @@ NormEnvelopeElementRecorder::~NormEnvelopeElementRecorder()
   if (theHandler != 0)
     delete theHandler;
 
-  if (data != 0)
-    delete data;
-  
   if (currentData != 0)
     delete currentData;
 
@@ -222,46 +217,11 @@ NormEnvelopeElementRecorder::record(int commitTag, double timeStamp)
     }
 
 
-    int sizeData = currentData->Size();
-    if (echoTimeFlag == false) {
+    // update the envelope of the norms; when echoTimeFlag is set only the
+    // first half of currentData holds norms, the envelope keeps the times
+    if (currentData->Size() > 0)
+      envelope.update(&(*currentData)(0), timeStamp);
 
-      // bool writeIt = false;
-      if (first == true) {
-	for (int i=0; i<sizeData; i++) {
-	  (*data)(0,i) = (*currentData)(i);
-	  first = false;
-	  // writeIt = true;
-	} 
-      } else {
-	for (int i=0; i<sizeData; i++) {
-	  double value = (*currentData)(i);
-	  if ((*data)(0,i) > value) {
-	    (*data)(0,i) = value;
-	    // writeIt = true;
-	  }
-	}
-      }
-    } else {
-      sizeData /= 2;
-      // bool writeIt = false;
-      if (first == true) {
-	for (int i=0; i<sizeData; i++) {
-	  (*data)(0,i*2) = timeStamp;
-	  (*data)(0,i*2+1) = (*currentData)(i);
-	  first = false;
-	  // writeIt = true;
-	} 
-      } else {
-	for (int i=0; i<sizeData; i++) {
-	  double value = (*currentData)(i);
-	  if ((*data)(0,2*i+1) > value) {
-	    (*data)(0,i*2) = timeStamp;
-	    (*data)(0,i*2+1) = value;
-	    // writeIt = true;
-	  }
-	}
-      }
-    }
   }    
   // successful completion - return 0
   return result;
@@ -270,8 +230,8 @@ NormEnvelopeElementRecorder::record(int commitTag, double timeStamp)
 int
 NormEnvelopeElementRecorder::restart(void)
 {
-  data->Zero();
-  first = true;
+  envelope.zero();
+  envelope.reset();
   return 0;
 }
 
@@ -715,16 +675,17 @@ NormEnvelopeElementRecorder::initialize(void)
   }
 
   //
-  // create the matrix & vector that holds the data
+  // size the envelope & create the vector that holds the data
   //
 
+  envelope.setSize(numDbColumns, echoTimeFlag);
+
   if (echoTimeFlag == true) {
     numDbColumns *= 2;
   }
 
-  data = new Matrix(1, numDbColumns);
   currentData = new Vector(numDbColumns);
-  if (data == 0 || currentData == 0) {
+  if (currentData == 0) {
     opserr << "NormEnvelopeElementRecorder::NormEnvelopeElementRecorder() - out of memory\n";
     exit(-1);
   }
@@ -33,11 +33,11 @@
 #include <Information.h>
 #include <OPS_Globals.h>
 #include <ID.h>
+#include <StreamingReduction.h>
 
 
 class Domain;
 class Vector;
-class Matrix;
 class Element;
 class Response;
 class FE_Datastore;
@@ -88,9 +88,8 @@ class NormEnvelopeElementRecorder: public Recorder
     double relDeltaTTol;
     double nextTimeStampToRecord;
 
-    Matrix *data;
+    EnvelopeReduction envelope;
     Vector *currentData;
-    bool first;
 
     bool initializationDone;
     char **responseArgs;
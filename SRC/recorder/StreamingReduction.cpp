@@ -0,0 +1,157 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of EnvelopeReduction
+// and RMSReduction.
+//
+#include <StreamingReduction.h>
+#include <Vector.h>
+#include <math.h>
+
+EnvelopeReduction::EnvelopeReduction()
+  : size(0), withTime(false), first(true)
+{
+
+}
+
+void
+EnvelopeReduction::setSize(int n, bool time)
+{
+  size = n;
+  withTime = time;
+  store.assign(6*(std::size_t)n, 0.0);
+  first = true;
+}
+
+void
+EnvelopeReduction::reset(void)
+{
+  first = true;
+}
+
+void
+EnvelopeReduction::zero(void)
+{
+  store.assign(store.size(), 0.0);
+}
+
+void
+EnvelopeReduction::update(const double *x, double time)
+{
+  const int n = size;
+  double *__restrict lo  = store.data();
+  double *__restrict hi  = lo + n;
+  double *__restrict am  = hi + n;
+  double *__restrict tlo = am + n;
+  double *__restrict thi = tlo + n;
+  double *__restrict tam = thi + n;
+
+  if (first) {
+    for (int i=0; i<n; i++) {
+      lo[i] = hi[i] = x[i];
+      am[i] = fabs(x[i]);
+      tlo[i] = thi[i] = tam[i] = time;
+    }
+    first = false;
+    return;
+  }
+
+  // NaN responses compare false and leave the envelope unchanged
+  if (!withTime) {
+    for (int i=0; i<n; i++) {
+      const double v = x[i];
+      const double a = fabs(v);
+      lo[i] = v < lo[i] ? v : lo[i];
+      hi[i] = v > hi[i] ? v : hi[i];
+      am[i] = a > am[i] ? a : am[i];
+    }
+  } else {
+    for (int i=0; i<n; i++) {
+      const double v = x[i];
+      const double a = fabs(v);
+      const bool newLo = v < lo[i];
+      const bool newHi = v > hi[i];
+      const bool newAm = a > am[i];
+      lo[i]  = newLo ? v : lo[i];
+      tlo[i] = newLo ? time : tlo[i];
+      hi[i]  = newHi ? v : hi[i];
+      thi[i] = newHi ? time : thi[i];
+      am[i]  = newAm ? a : am[i];
+      tam[i] = newAm ? time : tam[i];
+    }
+  }
+}
+
+double
+EnvelopeReduction::getValue(int row, int column) const
+{
+  if (row < 0 || row > 2 || column < 0 || column >= this->getNumColumns())
+    return 0.0;
+
+  if (!withTime)
+    return store[row*(std::size_t)size + column];
+
+  // (time, value) pairs
+  const int i = column/2;
+  if (column % 2 == 0)
+    return store[(3 + row)*(std::size_t)size + i];
+  return store[row*(std::size_t)size + i];
+}
+
+void
+EnvelopeReduction::getRow(int row, Vector &V) const
+{
+  const int numColumns = this->getNumColumns();
+  for (int j=0; j<numColumns && j<V.Size(); j++)
+    V(j) = this->getValue(row, j);
+}
+
+
+RMSReduction::RMSReduction()
+  : count(0)
+{
+
+}
+
+void
+RMSReduction::setSize(int n)
+{
+  sum.assign(n, 0.0);
+  count = 0;
+}
+
+void
+RMSReduction::zero(void)
+{
+  sum.assign(sum.size(), 0.0);
+  count = 0;
+}
+
+void
+RMSReduction::update(const double *x)
+{
+  const int n = (int)sum.size();
+  double *__restrict s = sum.data();
+  for (int i=0; i<n; i++)
+    s[i] += x[i]*x[i];
+  count++;
+}
+
+double
+RMSReduction::getRMS(int i) const
+{
+  if (count == 0)
+    return sum[i];
+  return sqrt(sum[i]/count);
+}
+
+void
+RMSReduction::getRMS(Vector &V) const
+{
+  const int n = (int)sum.size();
+  for (int i=0; i<n && i<V.Size(); i++)
+    V(i) = this->getRMS(i);
+}
@@ -0,0 +1,79 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the class definitions for
+// EnvelopeReduction and RMSReduction, the running reductions shared by
+// the envelope and RMS recorders.
+//
+// Both take the responses of a step as one contiguous array and keep
+// their accumulators in separate contiguous arrays, one per quantity, so
+// that each update is a single branch-free pass that the compiler can
+// vectorize.
+//
+// EnvelopeReduction keeps the minimum, maximum and absolute maximum of
+// each response and, optionally, the time at which each was reached. Its
+// values are read back in the layout the envelope recorders write: row 0
+// holds the minima, row 1 the maxima and row 2 the absolute maxima and,
+// when times are kept, each value is preceded by its time.
+//
+#ifndef StreamingReduction_h
+#define StreamingReduction_h
+
+#include <vector>
+
+class Vector;
+
+class EnvelopeReduction
+{
+  public:
+    EnvelopeReduction();
+
+    void setSize(int size, bool withTime);
+    int  getSize(void) const {return size;}
+
+    // the next update starts a new envelope
+    void reset(void);
+    // set all values (and times) to zero, keeping the envelope started
+    void zero(void);
+
+    void update(const double *values, double time);
+
+    int    getNumColumns(void) const {return withTime ? 2*size : size;}
+    double getValue(int row, int column) const;
+    void   getRow(int row, Vector &V) const;
+
+  private:
+    int size;
+    bool withTime;
+    bool first;
+
+    // min, max, abs max, then the times of each
+    std::vector<double> store;
+};
+
+
+class RMSReduction
+{
+  public:
+    RMSReduction();
+
+    void setSize(int size);
+    int  getSize(void) const {return (int)sum.size();}
+
+    void zero(void);
+    void update(const double *values);
+
+    int    getCount(void) const {return count;}
+    double getSumOfSquares(int i) const {return sum[i];}
+    double getRMS(int i) const;
+    void   getRMS(Vector &V) const;
+
+  private:
+    std::vector<double> sum;
+    int count;
+};
+
+#endif
@@ -26,6 +26,7 @@
 #include <Broyden.h>
 #include <BFGS.h>
 #include <KrylovNewton.h>
+#include <JacobianFreeNewton.h>
 #include <PeriodicNewton.h>
 #include <AcceleratedNewton.h>
 #include <ExpressNewton.h>
@@ -64,6 +65,7 @@ TclEquiSolnAlgo G3Parse_newEquiSolnAlgo;
 TclEquiSolnAlgo G3Parse_newSecantNewtonAlgorithm;
 TclEquiSolnAlgo G3_newNewtonLineSearch;
 static TclEquiSolnAlgo G3_newKrylovNewton;
+static TclEquiSolnAlgo G3_newJacobianFreeNewton;
 static TclEquiSolnAlgo G3_newBroyden;
 static TclEquiSolnAlgo G3_newBFGS;
 
@@ -139,6 +141,10 @@ G3Parse_newEquiSolnAlgo(ClientData clientData, Tcl_Interp *interp, int argc,
   else if (strcmp(argv[1], "KrylovNewton") == 0)
     return G3_newKrylovNewton(clientData, interp, argc, argv);
 
+  else if ((strcmp(argv[1], "JFNK") == 0) ||
+           (strcmp(argv[1], "JacobianFreeNewton") == 0))
+    return G3_newJacobianFreeNewton(clientData, interp, argc, argv);
+
 
   EquiSolnAlgo *theNewAlgo = nullptr;
   G3_Runtime *rt = G3_getRuntime(interp);
@@ -211,9 +217,13 @@ TclCommand_newNewtonRaphson(ClientData clientData, Tcl_Interp* interp, int argc,
   int formTangent = CURRENT_TANGENT;
   double iFactor = 0;
   double cFactor = 1;
+  bool fused = false;
 
   for (int i=2; i<argc; i++) {
-    if (strcmp(argv[i],"-secant")==0 || 
+    if (strcmp(argv[i],"-fused")==0) {
+      fused = true;
+
+    } else if (strcmp(argv[i],"-secant")==0 || 
         strcmp(argv[i],"-Secant")==0) {
       formTangent = CURRENT_SECANT;
       iFactor = 0;
@@ -251,7 +261,7 @@ TclCommand_newNewtonRaphson(ClientData clientData, Tcl_Interp* interp, int argc,
     }
   }
 
-  builder->set(new NewtonRaphson(formTangent, iFactor, cFactor));
+  builder->set(new NewtonRaphson(formTangent, iFactor, cFactor, fused));
 
   return TCL_OK;
 }
@@ -594,6 +604,88 @@ G3_newKrylovNewton(ClientData clientData, Tcl_Interp *interp, int argc,
   return theNewAlgo;
 }
 
+//
+// algorithm JFNK <-maxDim m> <-maxRestart k> <-eta tol>
+//                <-pc none|diagonal|factor> <-product difference|element>
+//                <-perturbation delta>
+//
+static EquiSolnAlgo *
+G3_newJacobianFreeNewton(ClientData clientData, Tcl_Interp *interp, int argc,
+                         TCL_Char ** const argv)
+{
+  assert(clientData != nullptr);
+  BasicAnalysisBuilder *builder = (BasicAnalysisBuilder *)clientData;
+  ConvergenceTest *theTest = builder->getConvergenceTest();
+
+  if (theTest == nullptr) {
+    opserr << G3_ERROR_PROMPT << "No ConvergenceTest yet specified\n";
+    return nullptr;
+  }
+
+  int maxDim = 30;
+  int maxRestart = 5;
+  double eta = 1.0e-3;
+  double perturbation = 1.0e-7;
+  int pc = JacobianFreeNewton::DiagonalPreconditioner;
+  int product = JacobianFreeNewton::DifferenceProduct;
+
+  for (int i = 2; i < argc; ++i) {
+    if (strcmp(argv[i], "-maxDim") == 0 && i + 1 < argc) {
+      if (Tcl_GetInt(interp, argv[++i], &maxDim) != TCL_OK) {
+        opserr << G3_ERROR_PROMPT << "invalid value for -maxDim\n";
+        return nullptr;
+      }
+
+    } else if (strcmp(argv[i], "-maxRestart") == 0 && i + 1 < argc) {
+      if (Tcl_GetInt(interp, argv[++i], &maxRestart) != TCL_OK) {
+        opserr << G3_ERROR_PROMPT << "invalid value for -maxRestart\n";
+        return nullptr;
+      }
+
+    } else if (strcmp(argv[i], "-eta") == 0 && i + 1 < argc) {
+      if (Tcl_GetDouble(interp, argv[++i], &eta) != TCL_OK) {
+        opserr << G3_ERROR_PROMPT << "invalid value for -eta\n";
+        return nullptr;
+      }
+
+    } else if (strcmp(argv[i], "-perturbation") == 0 && i + 1 < argc) {
+      if (Tcl_GetDouble(interp, argv[++i], &perturbation) != TCL_OK) {
+        opserr << G3_ERROR_PROMPT << "invalid value for -perturbation\n";
+        return nullptr;
+      }
+
+    } else if (strcmp(argv[i], "-pc") == 0 && i + 1 < argc) {
+      i++;
+      if (strcmp(argv[i], "none") == 0)
+        pc = JacobianFreeNewton::NoPreconditioner;
+      else if (strcmp(argv[i], "diagonal") == 0 || strcmp(argv[i], "Jacobi") == 0)
+        pc = JacobianFreeNewton::DiagonalPreconditioner;
+      else if (strcmp(argv[i], "factor") == 0)
+        pc = JacobianFreeNewton::FactorPreconditioner;
+      else {
+        opserr << G3_ERROR_PROMPT << "unknown preconditioner '" << argv[i] << "'\n";
+        return nullptr;
+      }
+
+    } else if (strcmp(argv[i], "-product") == 0 && i + 1 < argc) {
+      i++;
+      if (strcmp(argv[i], "difference") == 0)
+        product = JacobianFreeNewton::DifferenceProduct;
+      else if (strcmp(argv[i], "element") == 0)
+        product = JacobianFreeNewton::ElementProduct;
+      else {
+        opserr << G3_ERROR_PROMPT << "unknown product '" << argv[i] << "'\n";
+        return nullptr;
+      }
+    }
+  }
+
+  EquiSolnAlgo *theNewAlgo = new JacobianFreeNewton(maxDim, maxRestart, eta,
+                                                    pc, product, perturbation);
+  theNewAlgo->setConvergenceTest(theTest);
+  return theNewAlgo;
+}
+
 EquiSolnAlgo *
 G3_newRaphsonNewton(ClientData clientData, Tcl_Interp *interp, int argc,
                     TCL_Char ** const argv)
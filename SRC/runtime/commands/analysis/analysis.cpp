@@ -9,10 +9,17 @@
 //
 #include <tcl.h>
 #include <assert.h>
+#include <string>
+#include <vector>
+#include <sstream>
+#ifndef _WIN32
+#  include <unistd.h>
+#endif
 #include <runtimeAPI.h>
 #include <G3_Logging.h>
 #include <StandardStream.h>
 #include <FileStream.h>
+#include <Profiler.h>
 
 #include <Matrix.h>
 #include <Domain.h> // for modal damping
@@ -23,6 +30,11 @@
 #include <StaticAnalysis.h>
 #include <DirectIntegrationAnalysis.h>
 #include <VariableTimeStepDirectIntegrationAnalysis.h>
+#include <BatchTransientAnalysis.h>
+#include <UniformExcitation.h>
+#include <Recorder.h>
+#include <Newmark.h>
+#include <classTags.h>
 
 #include <EigenSOE.h>
 #include <LinearSOE.h>
@@ -50,8 +62,9 @@
 
 
 // for response spectrum analysis
-extern void OPS_DomainModalProperties(G3_Runtime*);
+extern int OPS_DomainModalProperties(G3_Runtime*);
 extern int OPS_ResponseSpectrumAnalysis(G3_Runtime*);
+extern int OPS_ModalTransientAnalysis(G3_Runtime*);
 extern "C" int OPS_ResetInputNoBuilder(ClientData clientData,
                                        Tcl_Interp *interp, int cArg, int mArg,
                                        TCL_Char ** const argv, Domain *domain);
@@ -176,7 +189,46 @@ analyzeModel(ClientData clientData, Tcl_Interp *interp, int argc,
       if (Tcl_GetDouble(interp, argv[2], &dT) != TCL_OK)
         return TCL_ERROR;
 
-      if (argc == 6) {
+      if (argc > 3 && strcmp(argv[3], "-adaptive") == 0) {
+        //
+        // analyze numIncr dT -adaptive <-tol relTol> <-absTol absTol>
+        //         <-dtMin dtMin> <-dtMax dtMax> <-output dtOut>
+        //
+        double relTol = 1.0e-3;
+        double absTol = 1.0e-6;
+        double dtMin  = 1.0e-6*dT;
+        double dtMax  = 0.0;
+        double dtOut  = 0.0;
+        for (int i=4; i<argc; i++) {
+          double *value = nullptr;
+          if (strcmp(argv[i], "-tol") == 0)
+            value = &relTol;
+          else if (strcmp(argv[i], "-absTol") == 0)
+            value = &absTol;
+          else if (strcmp(argv[i], "-dtMin") == 0)
+            value = &dtMin;
+          else if (strcmp(argv[i], "-dtMax") == 0)
+            value = &dtMax;
+          else if (strcmp(argv[i], "-output") == 0)
+            value = &dtOut;
+          else {
+            opserr << G3_ERROR_PROMPT << "analyze -adaptive - unknown option " << argv[i] << "\n";
+            return TCL_ERROR;
+          }
+          if (i+1 == argc || Tcl_GetDouble(interp, argv[i+1], value) != TCL_OK) {
+            opserr << G3_ERROR_PROMPT << "analyze -adaptive - invalid value for " << argv[i] << "\n";
+            return TCL_ERROR;
+          }
+          i++;
+        }
+        if (relTol <= 0.0 && absTol <= 0.0) {
+          opserr << G3_ERROR_PROMPT << "analyze -adaptive - a positive tolerance is required\n";
+          return TCL_ERROR;
+        }
+
+        result = builder->analyzeAdaptive(numIncr*dT, dT, dtMin, dtMax, absTol, relTol, dtOut);
+
+      } else if (argc == 6) {
         int Jd;
         double dtMin, dtMax;
         if (Tcl_GetDouble(interp, argv[3], &dtMin) != TCL_OK)
@@ -213,6 +265,244 @@ analyzeModel(ClientData clientData, Tcl_Interp *interp, int argc,
   return TCL_OK;
 }
 
+//
+// branch ?-jobs n? varName values body
+//
+// Evaluate body once for every element of the list values, each time in
+// a forked copy of the process that starts from the current committed
+// state. This is typically used after a gravity analysis and loadConst
+// to run a suite of ground motions. At most n branches run at once;
+// by default n is the number of online processors. Returns a list
+// holding the exit code of each branch (0 for success).
+//
+static int
+branchAnalysis(ClientData clientData, Tcl_Interp *interp, int argc,
+               TCL_Char ** const argv)
+{
+  assert(clientData != nullptr);
+  BasicAnalysisBuilder *builder = (BasicAnalysisBuilder*)clientData;
+
+  int maxJobs = 1;
+#ifndef _WIN32
+  maxJobs = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+
+  int argi = 1;
+  if (argc > 2 && strcmp(argv[argi], "-jobs") == 0) {
+    if (Tcl_GetInt(interp, argv[argi+1], &maxJobs) != TCL_OK || maxJobs < 1) {
+      opserr << G3_ERROR_PROMPT << "branch -jobs requires a positive integer\n";
+      return TCL_ERROR;
+    }
+    argi += 2;
+  }
+
+  if (argc - argi != 3) {
+    opserr << G3_ERROR_PROMPT << "branch ?-jobs n? varName values body\n";
+    return TCL_ERROR;
+  }
+
+  const char *name = argv[argi];
+  const char *body = argv[argi+2];
+
+  int numValues;
+  TCL_Char **values;
+  if (Tcl_SplitList(interp, argv[argi+1], &numValues, &values) != TCL_OK)
+    return TCL_ERROR;
+
+  std::vector<std::string> items(values, values + numValues);
+  Tcl_Free((char *)values);
+
+  std::vector<int> status;
+  int result = builder->branch(numValues, maxJobs, [&](int i) -> int {
+    if (Tcl_SetVar(interp, name, items[i].c_str(), TCL_LEAVE_ERR_MSG) == nullptr)
+      return -1;
+
+    if (Tcl_Eval(interp, body) != TCL_OK) {
+      opserr << G3_ERROR_PROMPT << "branch " << i << " failed; "
+             << Tcl_GetStringResult(interp) << "\n";
+      return -1;
+    }
+    return 0;
+  }, status);
+
+  if (result < 0)
+    return TCL_ERROR;
+
+  Tcl_Obj* list = Tcl_NewListObj(numValues, nullptr);
+  for (int code : status)
+    Tcl_ListObjAppendElement(interp, list, Tcl_NewIntObj(code));
+  Tcl_SetObjResult(interp, list);
+
+  return TCL_OK;
+}
+
+//
+// batchTransient numSteps dT ?-gamma g? ?-beta b? -record pattern ?recorders...? ...
+//
+// Run the linear response to several ground motions in lockstep. Each
+// -record names a UniformExcitation pattern and the recorders that
+// receive its response. The Newmark parameters default to those of the
+// current integrator when it is a Newmark integrator. The effective
+// stiffness is factored once, and every step solves all the records as
+// one block. Returns 0 on success.
+//
+static int
+batchTransient(ClientData clientData, Tcl_Interp *interp, int argc,
+               TCL_Char ** const argv)
+{
+  assert(clientData != nullptr);
+  BasicAnalysisBuilder *builder = (BasicAnalysisBuilder*)clientData;
+  Domain *domain = builder->getDomain();
+
+  if (argc < 5) {
+    opserr << G3_ERROR_PROMPT << "batchTransient numSteps dT ?-gamma g? ?-beta b? "
+              "-record pattern ?recorders...? ...\n";
+    return TCL_ERROR;
+  }
+
+  int numSteps;
+  double dT;
+  if (Tcl_GetInt(interp, argv[1], &numSteps) != TCL_OK)
+    return TCL_ERROR;
+  if (Tcl_GetDouble(interp, argv[2], &dT) != TCL_OK)
+    return TCL_ERROR;
+
+  double gamma = 0.5, beta = 0.25;
+  TransientIntegrator *integrator = builder->getTransientIntegrator();
+  if (integrator != nullptr && integrator->getClassTag() == INTEGRATOR_TAGS_Newmark) {
+    gamma = ((Newmark*)integrator)->getGamma();
+    beta  = ((Newmark*)integrator)->getBeta();
+  }
+
+  std::vector<std::pair<UniformExcitation*, std::vector<Recorder*>>> records;
+
+  for (int argi = 3; argi < argc; argi++) {
+    if (strcmp(argv[argi], "-gamma") == 0 && argi+1 < argc) {
+      if (Tcl_GetDouble(interp, argv[++argi], &gamma) != TCL_OK)
+        return TCL_ERROR;
+    }
+    else if (strcmp(argv[argi], "-beta") == 0 && argi+1 < argc) {
+      if (Tcl_GetDouble(interp, argv[++argi], &beta) != TCL_OK)
+        return TCL_ERROR;
+    }
+    else if (strcmp(argv[argi], "-record") == 0 && argi+1 < argc) {
+      int tag;
+      if (Tcl_GetInt(interp, argv[++argi], &tag) != TCL_OK)
+        return TCL_ERROR;
+      LoadPattern *pattern = domain->getLoadPattern(tag);
+      if (pattern == nullptr || pattern->getClassTag() != PATTERN_TAG_UniformExcitation) {
+        opserr << G3_ERROR_PROMPT << "batchTransient - pattern " << tag
+               << " is not a UniformExcitation\n";
+        return TCL_ERROR;
+      }
+
+      std::vector<Recorder*> recorders;
+      while (argi+1 < argc && argv[argi+1][0] != '-' &&
+             Tcl_GetInt(nullptr, argv[argi+1], &tag) == TCL_OK) {
+        Recorder *recorder = domain->getRecorder(tag);
+        if (recorder == nullptr) {
+          opserr << G3_ERROR_PROMPT << "batchTransient - no recorder with tag " << tag << "\n";
+          return TCL_ERROR;
+        }
+        recorders.push_back(recorder);
+        argi++;
+      }
+      records.emplace_back((UniformExcitation*)pattern, recorders);
+    }
+    else {
+      opserr << G3_ERROR_PROMPT << "batchTransient - unexpected argument " << argv[argi] << "\n";
+      return TCL_ERROR;
+    }
+  }
+
+  BatchTransientAnalysis batch(gamma, beta);
+  for (auto& record : records)
+    if (batch.addRecord(*record.first, record.second) < 0)
+      return TCL_ERROR;
+
+  int result = builder->analyzeBatch(batch, numSteps, dT);
+
+  Tcl_SetObjResult(interp, Tcl_NewIntObj(result));
+  return TCL_OK;
+}
+
+//
+// profile start ?-trace? ?-elements?
+// profile stop
+// profile reset
+// profile report ?-json?
+// profile trace fileName
+//
+// Collect the time spent in each phase of the analysis (step, element
+// update, tangent and residual assembly, linear solve, commit, record)
+// and the number of iterations, factorizations, element updates and
+// recorder writes. With -trace, every timed phase is also kept as an
+// event that can be written in the Chrome trace format. With -elements,
+// the time each element spends in its update is measured as well; a
+// later partition of the model then weights the elements by it.
+//
+static int
+profileAnalysis(ClientData clientData, Tcl_Interp *interp, int argc,
+                TCL_Char ** const argv)
+{
+  OpenSees::Profiler &profiler = OpenSees::Profiler::get();
+
+  if (argc < 2) {
+    opserr << G3_ERROR_PROMPT << "profile start|stop|reset|report|trace\n";
+    return TCL_ERROR;
+  }
+
+  BasicAnalysisBuilder *builder = (BasicAnalysisBuilder*)clientData;
+  Domain *domain = builder != nullptr ? builder->getDomain() : nullptr;
+
+  if (strcmp(argv[1], "start") == 0) {
+    bool trace = false;
+    for (int i=2; i<argc; i++) {
+      if (strcmp(argv[i], "-trace") == 0)
+        trace = true;
+      else if (strcmp(argv[i], "-elements") == 0 && domain != nullptr)
+        domain->setMeasureElementCost(true);
+    }
+    profiler.start(trace);
+  }
+
+  else if (strcmp(argv[1], "stop") == 0) {
+    profiler.stop();
+    if (domain != nullptr)
+      domain->setMeasureElementCost(false);
+  }
+
+  else if (strcmp(argv[1], "reset") == 0) {
+    profiler.reset();
+    if (domain != nullptr)
+      domain->resetElementCost();
+  }
+
+  else if (strcmp(argv[1], "report") == 0) {
+    bool json = argc > 2 && strcmp(argv[2], "-json") == 0;
+    std::ostringstream report;
+    profiler.report(report, json);
+    Tcl_SetObjResult(interp, Tcl_NewStringObj(report.str().c_str(), -1));
+  }
+
+  else if (strcmp(argv[1], "trace") == 0) {
+    if (argc < 3) {
+      opserr << G3_ERROR_PROMPT << "profile trace fileName\n";
+      return TCL_ERROR;
+    }
+    if (profiler.writeTrace(argv[2]) < 0) {
+      opserr << G3_ERROR_PROMPT << "failed to write trace to " << argv[2] << "\n";
+      return TCL_ERROR;
+    }
+  }
+
+  else {
+    opserr << G3_ERROR_PROMPT << "unknown profile option " << argv[1] << "\n";
+    return TCL_ERROR;
+  }
+
+  return TCL_OK;
+}
 
 static int
 initializeAnalysis(ClientData clientData, Tcl_Interp *interp, int argc,
@@ -227,6 +517,18 @@ initializeAnalysis(ClientData clientData, Tcl_Interp *interp, int argc,
 
 
 
+LinearSOE*
+G3Parse_newLinearSOE(ClientData, Tcl_Interp*, int, G3_Char **const);
+
+//
+// eigen <-generalized|-standard> <-findLargest>
+//       <-genBandArpack|-symmBandLapack|-fullGenLapack>
+//       <-shift shift> <-solver system> numModes
+//
+// With -solver, the shift-invert solves of ARPACK are performed by a
+// separate system of the given type (e.g. UmfPack, SuperLU, SparseSPD)
+// rather than by the system of the current analysis.
+//
 static int
 eigenAnalysis(ClientData clientData, Tcl_Interp *interp, int argc,
               TCL_Char ** const argv)
@@ -254,6 +556,7 @@ eigenAnalysis(ClientData clientData, Tcl_Interp *interp, int argc,
   double shift = 0.0;
   bool findSmallest = true;
   int numEigen = 0;
+  const char *linearSystem = nullptr;
 
   // Check type of eigenvalue analysis
   while (loc < (argc - 1)) {
@@ -290,6 +593,17 @@ eigenAnalysis(ClientData clientData, Tcl_Interp *interp, int argc,
              (strcmp(argv[loc], "-fullGenLapackEigen") == 0))
       typeSolver = EigenSOE_TAGS_FullGenEigenSOE;
 
+    else if ((strcmp(argv[loc], "-shift") == 0) && loc + 2 < argc) {
+      if (Tcl_GetDouble(interp, argv[++loc], &shift) != TCL_OK) {
+        opserr << G3_ERROR_PROMPT << "eigen - invalid value for -shift\n";
+        return TCL_ERROR;
+      }
+    }
+
+    else if ((strcmp(argv[loc], "-solver") == 0 ||
+              strcmp(argv[loc], "-system") == 0) && loc + 2 < argc)
+      linearSystem = argv[++loc];
+
     else {
       opserr << "eigen - unknown option: " << argv[loc] << endln;
     }
@@ -315,10 +629,37 @@ eigenAnalysis(ClientData clientData, Tcl_Interp *interp, int argc,
   for (int i = 0; i < requiredDataSize; ++i)
     resDataPtr[i] = '\n';
 
+  if (builder->checkModification() < 0)
+    return TCL_ERROR;
+
   //
   // create a transient analysis if no analysis exists
   // 
-  builder->newEigenAnalysis(typeSolver, shift);
+  LinearSOE *theLinearSOE = nullptr;
+  if (linearSystem != nullptr) {
+    if (typeSolver != EigenSOE_TAGS_ArpackSOE) {
+      opserr << G3_WARN_PROMPT << "eigen - -solver is only used by the ARPACK solver\n";
+
+    } else {
+      const char *args[] = {"system", linearSystem};
+      theLinearSOE = G3Parse_newLinearSOE(clientData, interp, 2, args);
+      if (theLinearSOE == nullptr) {
+        opserr << G3_ERROR_PROMPT << "eigen - failed to create system '" << linearSystem << "'\n";
+        return TCL_ERROR;
+      }
+      // a diagonal system keeps only the diagonal of the stiffness
+      const int tag = theLinearSOE->getClassTag();
+      if (tag == LinSOE_TAGS_DiagonalSOE || tag == LinSOE_TAGS_DistributedDiagonalSOE
+          || tag == LinSOE_TAGS_MPIDiagonalSOE) {
+        opserr << G3_ERROR_PROMPT << "eigen - system '" << linearSystem
+               << "' can not be used for the shift-invert solves\n";
+        delete theLinearSOE;
+        return TCL_ERROR;
+      }
+    }
+  }
+
+  builder->newEigenAnalysis(typeSolver, shift, theLinearSOE);
 
   int result = builder->eigen(numEigen,generalizedAlgo,findSmallest);
 
@@ -339,19 +680,53 @@ static int
 modalProperties(ClientData clientData, Tcl_Interp *interp, int argc,
                 TCL_Char ** const argv)
 {
+  assert(clientData != nullptr);
+  BasicAnalysisBuilder *builder = (BasicAnalysisBuilder*)clientData;
+  if (builder->checkModification() < 0)
+    return TCL_ERROR;
+
   G3_Runtime *rt = G3_getRuntime(interp);
   OPS_ResetInputNoBuilder(clientData, interp, 1, argc, argv, nullptr);
-  OPS_DomainModalProperties(rt);
-  return TCL_OK;
+
+  // the modal properties are found from the analysis model of this builder
+  G3_setAnalysisModel(rt, builder->getAnalysisModel());
+  int status = OPS_DomainModalProperties(rt);
+  G3_setAnalysisModel(rt, nullptr);
+
+  return status < 0 ? TCL_ERROR : TCL_OK;
 }
 
 static int
 responseSpectrum(ClientData clientData, Tcl_Interp *interp, int argc,
                  TCL_Char ** const argv)
 {
+  assert(clientData != nullptr);
+  BasicAnalysisBuilder *builder = (BasicAnalysisBuilder*)clientData;
+  if (builder->checkModification() < 0)
+    return TCL_ERROR;
+
   OPS_ResetInputNoBuilder(clientData, interp, 1, argc, argv, nullptr);
   G3_Runtime *rt = G3_getRuntime(interp);
-  OPS_ResponseSpectrumAnalysis(rt);
+
+  G3_setAnalysisModel(rt, builder->getAnalysisModel());
+  int status = OPS_ResponseSpectrumAnalysis(rt);
+  G3_setAnalysisModel(rt, nullptr);
+
+  return status < 0 ? TCL_ERROR : TCL_OK;
+}
+
+static int
+modalTransient(ClientData clientData, Tcl_Interp *interp, int argc,
+               TCL_Char ** const argv)
+{
+  assert(clientData != nullptr);
+  if (((BasicAnalysisBuilder*)clientData)->checkModification() < 0)
+    return TCL_ERROR;
+
+  OPS_ResetInputNoBuilder(clientData, interp, 1, argc, argv, nullptr);
+  G3_Runtime *rt = G3_getRuntime(interp);
+  if (OPS_ModalTransientAnalysis(rt) < 0)
+    return TCL_ERROR;
   return TCL_OK;
 }
 
@@ -506,6 +881,8 @@ printA(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const ar
   FileStream outputFile;
   OPS_Stream *output = &opserr;
   LinearSOE  *oldSOE = builder->getLinearSOE();
+  if (builder->checkModification() < 0)
+    return TCL_ERROR;
 
 
   // Cant allocate theSolver on stack because theSOE is going to 
@@ -681,6 +1058,9 @@ printB(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const ar
   LinearSOE  *theSOE = builder->getLinearSOE();
   if (theSOE != nullptr) {
 
+    if (builder->checkModification() < 0)
+      return TCL_ERROR;
+
     // TODO
     builder->formUnbalance();
 
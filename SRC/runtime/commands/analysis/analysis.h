@@ -15,11 +15,15 @@ static Tcl_CmdProc specifyAnalysis;
 static Tcl_CmdProc eigenAnalysis;
 static Tcl_CmdProc modalProperties;
 static Tcl_CmdProc responseSpectrum;
+static Tcl_CmdProc modalTransient;
 static Tcl_CmdProc printA;
 static Tcl_CmdProc printB;
 static Tcl_CmdProc initializeAnalysis;
 static Tcl_CmdProc resetModel;
 static Tcl_CmdProc analyzeModel;
+static Tcl_CmdProc branchAnalysis;
+static Tcl_CmdProc batchTransient;
+static Tcl_CmdProc profileAnalysis;
 static Tcl_CmdProc specifyConstraintHandler;
 static Tcl_CmdProc modalDamping;
 
@@ -60,11 +64,15 @@ struct char_cmd {
     {"analysis",            &specifyAnalysis},
 
     {"analyze",             &analyzeModel},
+    {"branch",              &branchAnalysis},
+    {"batchTransient",      &batchTransient},
+    {"profile",             &profileAnalysis},
     {"initialize",          &initializeAnalysis},
     {"modalProperties",     &modalProperties},
     {"modalDamping",        &modalDamping},
     {"modalDampingQ",       &modalDamping},
     {"responseSpectrum",    &responseSpectrum},
+    {"modalTransient",      &modalTransient},
     {"printA",              &printA},
     {"printB",              &printB},
     {"reset",               &resetModel},
@@ -138,6 +138,10 @@ G3Parse_newLinearSOE(ClientData clientData, Tcl_Interp* interp, int argc, G3_Cha
   auto ctor = soe_table.find(sys_name);
 
   if (ctor != soe_table.end()) {
+    if (ctor->second.ss == nullptr) {
+      opserr << G3_ERROR_PROMPT << " system '" << argv[1] << "' is only available in a parallel interpreter\n";
+      return nullptr;
+    }
     return ctor->second.ss(rt, argc, argv);
 
   } else if (strcasecmp(argv[1], "Umfpack")==0) {
@@ -92,6 +92,7 @@ G3_AddTclDomainCommands(Tcl_Interp *interp, Domain* the_domain)
   Tcl_CreateCommand(interp, "loadConst",           &TclCommand_setLoadConst,  domain, nullptr);
   Tcl_CreateCommand(interp, "recorder",            &TclAddRecorder,  domain,  nullptr);
   Tcl_CreateCommand(interp, "region",              &TclCommand_addMeshRegion, domain, nullptr);
+  Tcl_CreateCommand(interp, "contactSearch",       &TclCommand_addContactSearch, domain, nullptr);
 
   Tcl_CreateCommand(interp, "printGID",            &printModelGID, domain, nullptr);
 
@@ -19,6 +19,9 @@ Tcl_CmdProc setNodeCoord;
 // domain/region.cpp
 Tcl_CmdProc TclCommand_addMeshRegion;
 
+// domain/contact.cpp
+Tcl_CmdProc TclCommand_addContactSearch;
+
 
 // domain/element.cpp
 Tcl_CmdProc TclCommand_addElementRayleigh;
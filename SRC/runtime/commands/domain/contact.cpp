@@ -0,0 +1,158 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the function that is invoked
+// by the interpreter when the command 'contactSearch' is invoked by the
+// user.
+//
+//   contactSearch $tag -primary $nodes... -secondary $nodes...
+//                 -radius $r <-skin $s> <-eleTag $start>
+//                 -element $type $args...
+//
+// Contact elements are created between each secondary node and the
+// primary nodes near it with the command
+//
+//   element $type $eleTag $secondaryNode $primaryNode $args...
+//
+// so the element type must take its two nodes in that order (e.g.
+// zeroLengthContact2D, zeroLengthContact3D, zeroLengthContactASDimplex).
+//
+#include <string.h>
+#include <string>
+#include <vector>
+#include <tcl.h>
+#include <Domain.h>
+#include <ContactSearch.h>
+#include <ElementIter.h>
+#include <Element.h>
+#include <ID.h>
+
+int
+TclCommand_addContactSearch(ClientData clientData, Tcl_Interp *interp, int argc,
+                            TCL_Char ** const argv)
+{
+  Domain& theDomain = *static_cast<Domain*>(clientData);
+
+  if (argc < 2) {
+    opserr << "WARNING contactSearch tag? - no tag specified\n";
+    return TCL_ERROR;
+  }
+
+  int tag;
+  if (Tcl_GetInt(interp, argv[1], &tag) != TCL_OK) {
+    opserr << "WARNING contactSearch tag? .. - invalid tag " << argv[1] << "\n";
+    return TCL_ERROR;
+  }
+
+  ID primary(0, 32);
+  ID secondary(0, 32);
+  double radius = 0.0;
+  double skin = -1.0;
+  int eleTag = -1;
+  std::vector<std::string> element;
+
+  int loc = 2;
+  while (loc < argc) {
+
+    if (strcmp(argv[loc], "-primary") == 0 ||
+        strcmp(argv[loc], "-secondary") == 0) {
+
+      ID& nodes = strcmp(argv[loc], "-primary") == 0 ? primary : secondary;
+      loc++;
+      int node;
+      while (loc < argc && Tcl_GetInt(interp, argv[loc], &node) == TCL_OK) {
+        nodes[nodes.Size()] = node;
+        loc++;
+      }
+      Tcl_ResetResult(interp);
+
+    } else if (strcmp(argv[loc], "-radius") == 0 && loc + 1 < argc) {
+      if (Tcl_GetDouble(interp, argv[loc + 1], &radius) != TCL_OK || radius <= 0.0) {
+        opserr << "WARNING contactSearch " << tag << " - invalid radius " << argv[loc + 1] << "\n";
+        return TCL_ERROR;
+      }
+      loc += 2;
+
+    } else if (strcmp(argv[loc], "-skin") == 0 && loc + 1 < argc) {
+      if (Tcl_GetDouble(interp, argv[loc + 1], &skin) != TCL_OK || skin < 0.0) {
+        opserr << "WARNING contactSearch " << tag << " - invalid skin " << argv[loc + 1] << "\n";
+        return TCL_ERROR;
+      }
+      loc += 2;
+
+    } else if (strcmp(argv[loc], "-eleTag") == 0 && loc + 1 < argc) {
+      if (Tcl_GetInt(interp, argv[loc + 1], &eleTag) != TCL_OK) {
+        opserr << "WARNING contactSearch " << tag << " - invalid element tag " << argv[loc + 1] << "\n";
+        return TCL_ERROR;
+      }
+      loc += 2;
+
+    } else if (strcmp(argv[loc], "-element") == 0 && loc + 1 < argc) {
+      // the rest of the command describes the element
+      for (loc++; loc < argc; loc++)
+        element.push_back(argv[loc]);
+
+    } else {
+      opserr << "WARNING contactSearch " << tag << " - unknown option " << argv[loc] << "\n";
+      return TCL_ERROR;
+    }
+  }
+
+  if (primary.Size() == 0 || secondary.Size() == 0) {
+    opserr << "WARNING contactSearch " << tag << " - primary and secondary nodes are required\n";
+    return TCL_ERROR;
+  }
+  if (radius <= 0.0) {
+    opserr << "WARNING contactSearch " << tag << " - a positive -radius is required\n";
+    return TCL_ERROR;
+  }
+  if (element.empty()) {
+    opserr << "WARNING contactSearch " << tag << " - an -element type is required\n";
+    return TCL_ERROR;
+  }
+
+  // by default, rebuild once a node has moved a tenth of the radius
+  if (skin < 0.0)
+    skin = 0.2*radius;
+
+  // by default, number the contact elements after those of the model
+  if (eleTag < 0) {
+    eleTag = 0;
+    Element *theEle;
+    ElementIter &theElements = theDomain.getElements();
+    while ((theEle = theElements()) != nullptr)
+      if (theEle->getTag() >= eleTag)
+        eleTag = theEle->getTag() + 1;
+  }
+
+  auto factory = [interp, element](int tag, int secondaryNode, int primaryNode) -> int {
+    std::vector<std::string> words;
+    words.reserve(element.size() + 4);
+    words.push_back("element");
+    words.push_back(element[0]);
+    words.push_back(std::to_string(tag));
+    words.push_back(std::to_string(secondaryNode));
+    words.push_back(std::to_string(primaryNode));
+    words.insert(words.end(), element.begin() + 1, element.end());
+
+    std::vector<const char*> args;
+    for (const std::string& word : words)
+      args.push_back(word.c_str());
+
+    char *command = Tcl_Merge((int)args.size(), args.data());
+    const int status = Tcl_Eval(interp, command);
+    Tcl_Free(command);
+    return status == TCL_OK ? 0 : -1;
+  };
+
+  ContactSearch *theSearch = new ContactSearch(tag, primary, secondary, radius, skin, eleTag, factory);
+  if (theDomain.addContactSearch(theSearch) < 0) {
+    delete theSearch;
+    return TCL_ERROR;
+  }
+
+  return TCL_OK;
+}
@@ -36,12 +36,38 @@
 
 #define MAX_NDF 6
 
+//
+// domainChange <begin | commit>
+//
+// With no argument the domain is marked as changed. The changes made
+// between "domainChange begin" and "domainChange commit" are taken up by
+// the next analysis as a single change.
+//
 int
 domainChange(ClientData clientData, Tcl_Interp *interp, int argc,
              Tcl_Obj *const *objv)
 {
   assert(clientData != nullptr);
-  ((Domain*)clientData)->domainChange();
+  Domain *the_domain = (Domain*)clientData;
+
+  if (argc < 2) {
+    the_domain->domainChange();
+    return TCL_OK;
+  }
+
+  const char *action = Tcl_GetString(objv[1]);
+  if (strcmp(action, "begin") == 0)
+    the_domain->beginModification();
+
+  else if (strcmp(action, "commit") == 0) {
+    if (the_domain->commitModification() != 0)
+      return TCL_ERROR;
+  }
+
+  else {
+    opserr << G3_ERROR_PROMPT << "want - domainChange <begin | commit>\n";
+    return TCL_ERROR;
+  }
   return TCL_OK;
 }
 
@@ -398,6 +398,7 @@ TclCreateRecorder(ClientData clientData, Tcl_Interp *interp, int argc,
     int flags   = 0;
     int eleData = 0;
     ID *eleIDs  = 0;
+    bool parallel = false;
 
     ID *specificIndices = nullptr;
 
@@ -556,6 +557,12 @@ TclCreateRecorder(ClientData clientData, Tcl_Interp *interp, int argc,
         loc++;
       }
 
+      else if (strcmp(argv[loc], "-parallel") == 0) {
+        // gather the element responses in parallel
+        parallel = true;
+        loc++;
+      }
+
       else {
         // TODO: handle the same as Node recorder; see Example1.1.py
         // first unknown string then is assumed to start
@@ -578,14 +585,22 @@ TclCreateRecorder(ClientData clientData, Tcl_Interp *interp, int argc,
     // construct the DataHandler
     theOutputStream = createOutputStream(options);
 
-    if (strcmp(argv[1], "Element") == 0)
-      (*theRecorder) = new ElementRecorder(eleIDs, data, argc - eleData, echoTime, *domain,
-                                           *theOutputStream, dT, rTolDt, specificIndices);
+    if (strcmp(argv[1], "Element") == 0) {
+      ElementRecorder *theElementRecorder =
+        new ElementRecorder(eleIDs, data, argc - eleData, echoTime, *domain,
+                            *theOutputStream, dT, rTolDt, specificIndices);
+      theElementRecorder->setParallel(parallel);
+      (*theRecorder) = theElementRecorder;
+    }
 
-    else if (strcmp(argv[1], "EnvelopeElement") == 0)
-      (*theRecorder) = new EnvelopeElementRecorder(eleIDs, data, argc - eleData,
-                                                   *domain, *theOutputStream, dT, rTolDt,
-                                                   echoTime, specificIndices);
+    else if (strcmp(argv[1], "EnvelopeElement") == 0) {
+      EnvelopeElementRecorder *theEnvelopeRecorder =
+        new EnvelopeElementRecorder(eleIDs, data, argc - eleData,
+                                    *domain, *theOutputStream, dT, rTolDt,
+                                    echoTime, specificIndices);
+      theEnvelopeRecorder->setParallel(parallel);
+      (*theRecorder) = theEnvelopeRecorder;
+    }
 
     else if (strcmp(argv[1], "NormElement") == 0)
       (*theRecorder) = new NormElementRecorder(eleIDs, data, argc - eleData, 
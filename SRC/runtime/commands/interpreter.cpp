@@ -14,6 +14,7 @@
 #include <G3_Runtime.h>
 #include <OPS_Globals.h>
 #include <Timer.h>
+#include <MemoryPool.h>
 
 static Tcl_ObjCmdProc *Tcl_putsCommand = nullptr;
 static Timer *theTimer = nullptr;
@@ -75,6 +76,37 @@ timer(ClientData clientData, Tcl_Interp* interp, int argc, TCL_Char** const argv
   return TCL_ERROR;
 }
 
+//
+// Report the number of arrays that Vector, Matrix and ID have taken
+// from and returned to the heap, e.g. to check that an analysis step
+// does not allocate:
+//
+//   memoryStatistics reset
+//   analyze 1
+//   memoryStatistics  ;# -> allocations 0 deallocations 0
+//
+static int
+memoryStatistics(ClientData clientData, Tcl_Interp* interp, int argc, TCL_Char** const argv)
+{
+  if (argc > 1) {
+    if (strcmp(argv[1], "reset") != 0) {
+      opserr << "Unknown argument '" << argv[1] << "'\n";
+      return TCL_ERROR;
+    }
+    OpenSees::MemoryPool::resetStatistics();
+    return TCL_OK;
+  }
+
+  const OpenSees::MemoryPool::Statistics stats = OpenSees::MemoryPool::getStatistics();
+  Tcl_Obj *result = Tcl_NewListObj(0, nullptr);
+  Tcl_ListObjAppendElement(interp, result, Tcl_NewStringObj("allocations", -1));
+  Tcl_ListObjAppendElement(interp, result, Tcl_NewWideIntObj(stats.allocations));
+  Tcl_ListObjAppendElement(interp, result, Tcl_NewStringObj("deallocations", -1));
+  Tcl_ListObjAppendElement(interp, result, Tcl_NewWideIntObj(stats.deallocations));
+  Tcl_SetObjResult(interp, result);
+  return TCL_OK;
+}
+
 //
 // revised puts command to send to stderr
 //
@@ -386,6 +418,7 @@ OpenSeesAppInit(Tcl_Interp *interp)
   Tcl_CreateCommand(interp, "start",               startTimer,   nullptr, nullptr);
   Tcl_CreateCommand(interp, "stop",                stopTimer,    nullptr, nullptr);
   Tcl_CreateCommand(interp, "timer",               timer,        nullptr, nullptr);
+  Tcl_CreateCommand(interp, "memoryStatistics",    memoryStatistics, nullptr, nullptr);
 
   // File utilities
   Tcl_CreateCommand(interp, "stripXML",            stripOpenSeesXML,    nullptr, NULL);
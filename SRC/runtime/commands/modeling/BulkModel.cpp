@@ -0,0 +1,254 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the implementation of the functions
+// that define nodes, fixities and elements of a model from arrays.
+//
+#include <string.h>
+#include <vector>
+#include <functional>
+#ifdef _OPENMP
+#  include <omp.h>
+#endif
+#include <G3_Logging.h>
+#include <BasicModelBuilder.h>
+#include <Domain.h>
+#include <Node.h>
+#include <SP_Constraint.h>
+#include <UniaxialMaterial.h>
+#include <NDMaterial.h>
+#include <FrameSection.h>
+#include <FrameTransform.h>
+#include <LegendreBeamIntegration.h>
+#include <LobattoBeamIntegration.h>
+#include <Truss.h>
+#include <FourNodeQuad.h>
+#include <Brick.h>
+#include <DispBeamColumn2d.h>
+#include <DispBeamColumn3d.h>
+#include <ForceBeamColumn2d.h>
+#include <ForceBeamColumn3d.h>
+#include "BulkModel.h"
+
+namespace OpenSees {
+namespace BulkModel {
+
+// objects are constructed in parallel only for batches large enough to
+// pay for starting the threads
+static constexpr int MinParallel = 1024;
+
+template <typename T>
+static void
+construct(std::vector<T*> &objects, int n, const std::function<T*(int)> &create)
+{
+  objects.assign(n, nullptr);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 256) if(n >= MinParallel && !omp_in_parallel())
+#endif
+  for (int i=0; i<n; i++)
+    objects[i] = create(i);
+}
+
+// delete the objects that the domain did not take
+template <typename T>
+static int
+finish(std::vector<T*> &objects, int numAdded)
+{
+  const int n = (int)objects.size();
+  for (int i=numAdded; i<n; i++)
+    delete objects[i];
+
+  return numAdded == n ? 0 : -1;
+}
+
+
+int
+addNodes(BasicModelBuilder &builder, int numNodes,
+         const int *tags, const double *crds, int ndm)
+{
+  if (ndm != builder.getNDM()) {
+    opserr << G3_ERROR_PROMPT << "nodes have " << ndm
+           << " coordinates, the model has " << builder.getNDM() << "\n";
+    return -1;
+  }
+  const int ndf = builder.getNDF();
+
+  std::vector<Node*> nodes;
+  construct<Node>(nodes, numNodes, [&](int i) -> Node* {
+    const double *x = crds + (std::size_t)i*ndm;
+    switch (ndm) {
+      case 1:  return new Node(tags[i], ndf, x[0]);
+      case 2:  return new Node(tags[i], ndf, x[0], x[1]);
+      default: return new Node(tags[i], ndf, x[0], x[1], x[2]);
+    }
+  });
+
+  Domain *domain = builder.getDomain();
+  return finish(nodes, domain->addNodes(nodes.data(), numNodes));
+}
+
+
+int
+addFixities(BasicModelBuilder &builder, int numNodes,
+            const int *tags, const int *codes, int ndf)
+{
+  // constraint tags are drawn from a shared counter, so these are
+  // created in order
+  std::vector<SP_Constraint*> sps;
+  for (int i=0; i<numNodes; i++)
+    for (int j=0; j<ndf; j++)
+      if (codes[(std::size_t)i*ndf + j] != 0)
+        sps.push_back(new SP_Constraint(tags[i], j, 0.0, true));
+
+  Domain *domain = builder.getDomain();
+  return finish(sps, domain->addSP_Constraints(sps.data(), (int)sps.size()));
+}
+
+
+int
+addElements(BasicModelBuilder &builder, const ElementGroup &group)
+{
+  const int ndm = builder.getNDM();
+  const int ndf = builder.getNDF();
+  const int n   = group.numElements;
+  const int  *tags  = group.tags;
+  const int  *nodes = group.nodes;
+  const int   nen   = group.numNodes;
+  const double *params = group.params;
+  const int numParams  = group.numParams;
+
+  auto param = [&](int i, double value) {
+    return i < numParams ? params[i] : value;
+  };
+
+  std::vector<Element*> elements;
+
+  if (strcmp(group.type, "truss") == 0) {
+    if (nen != 2 || numParams < 1) {
+      opserr << G3_ERROR_PROMPT << "truss elements need 2 nodes and A\n";
+      return -1;
+    }
+    UniaxialMaterial *material = builder.getTypedObject<UniaxialMaterial>(group.objectTag);
+    if (material == nullptr)
+      return -1;
+
+    const double A = params[0], rho = param(1, 0.0);
+    construct<Element>(elements, n, [&](int i) -> Element* {
+      const int *nd = nodes + (std::size_t)i*nen;
+      return new Truss(tags[i], ndm, nd[0], nd[1], *material, A, rho);
+    });
+  }
+
+  else if (strcmp(group.type, "quad") == 0) {
+    if (ndm != 2 || ndf != 2) {
+      opserr << G3_ERROR_PROMPT << "model dimensions and/or nodal DOF not compatible "
+                "with quad element\n";
+      return -1;
+    }
+    if (nen != 4 || numParams < 1) {
+      opserr << G3_ERROR_PROMPT << "quad elements need 4 nodes and thk\n";
+      return -1;
+    }
+    NDMaterial *material = builder.getTypedObject<NDMaterial>(group.objectTag);
+    if (material == nullptr)
+      return -1;
+
+    const char *type = group.option != nullptr ? group.option : "PlaneStrain";
+    const double thk = params[0], p = param(1, 0.0), rho = param(2, 0.0),
+                 b1  = param(3, 0.0), b2 = param(4, 0.0);
+    construct<Element>(elements, n, [&](int i) -> Element* {
+      const int *nd = nodes + (std::size_t)i*nen;
+      return new FourNodeQuad(tags[i], nd[0], nd[1], nd[2], nd[3], *material,
+                              type, thk, p, rho, b1, b2);
+    });
+  }
+
+  else if (strcmp(group.type, "stdBrick") == 0) {
+    if (ndm != 3 || ndf != 3) {
+      opserr << G3_ERROR_PROMPT << "model dimensions and/or nodal DOF not compatible "
+                "with stdBrick element\n";
+      return -1;
+    }
+    if (nen != 8) {
+      opserr << G3_ERROR_PROMPT << "stdBrick elements need 8 nodes\n";
+      return -1;
+    }
+    NDMaterial *material = builder.getTypedObject<NDMaterial>(group.objectTag);
+    if (material == nullptr)
+      return -1;
+
+    const double b1 = param(0, 0.0), b2 = param(1, 0.0), b3 = param(2, 0.0);
+    construct<Element>(elements, n, [&](int i) -> Element* {
+      const int *nd = nodes + (std::size_t)i*nen;
+      return new Brick(tags[i], nd[0], nd[1], nd[2], nd[3],
+                       nd[4], nd[5], nd[6], nd[7], *material, b1, b2, b3);
+    });
+  }
+
+  else if (strcmp(group.type, "dispBeamColumn") == 0 ||
+           strcmp(group.type, "forceBeamColumn") == 0) {
+    if (nen != 2 || (ndm != 2 && ndm != 3)) {
+      opserr << G3_ERROR_PROMPT << group.type << " elements need 2 nodes in 2 or 3 dimensions\n";
+      return -1;
+    }
+    const bool force = strcmp(group.type, "forceBeamColumn") == 0;
+    const int nIP = (int)param(0, 5);
+    const double rho = param(1, 0.0);
+    if (nIP <= 0) {
+      opserr << G3_ERROR_PROMPT << "invalid nIP, must be > 0\n";
+      return -1;
+    }
+
+    FrameSection *section = builder.getTypedObject<FrameSection>(group.objectTag);
+    if (section == nullptr)
+      return -1;
+    std::vector<FrameSection*> sections(nIP, section);
+    SectionForceDeformation **secptrs = (SectionForceDeformation**)(sections.data());
+
+    LobattoBeamIntegration  lobatto;
+    LegendreBeamIntegration legendre;
+    BeamIntegration &integration = force ? (BeamIntegration&)lobatto
+                                         : (BeamIntegration&)legendre;
+
+    if (ndm == 2) {
+      FrameTransform2d *transf = builder.getTypedObject<FrameTransform2d>(group.transfTag);
+      if (transf == nullptr)
+        return -1;
+      construct<Element>(elements, n, [&](int i) -> Element* {
+        const int *nd = nodes + (std::size_t)i*nen;
+        if (force)
+          return new ForceBeamColumn2d(tags[i], nd[0], nd[1], nIP, secptrs,
+                                       integration, *transf, rho);
+        return new DispBeamColumn2d(tags[i], nd[0], nd[1], nIP, secptrs,
+                                    integration, *transf, rho);
+      });
+    } else {
+      FrameTransform3d *transf = builder.getTypedObject<FrameTransform3d>(group.transfTag);
+      if (transf == nullptr)
+        return -1;
+      construct<Element>(elements, n, [&](int i) -> Element* {
+        const int *nd = nodes + (std::size_t)i*nen;
+        if (force)
+          return new ForceBeamColumn3d(tags[i], nd[0], nd[1], nIP, secptrs,
+                                       integration, *transf, rho);
+        return new DispBeamColumn3d(tags[i], nd[0], nd[1], nIP, secptrs,
+                                    integration, *transf, rho);
+      });
+    }
+  }
+
+  else {
+    opserr << G3_ERROR_PROMPT << "element type " << group.type
+           << " can not be defined in bulk\n";
+    return -1;
+  }
+
+  Domain *domain = builder.getDomain();
+  return finish(elements, domain->addElements(elements.data(), n));
+}
+
+} // namespace BulkModel
+} // namespace OpenSees
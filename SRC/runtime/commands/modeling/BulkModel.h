@@ -0,0 +1,66 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file contains the interface for defining nodes,
+// fixities and elements of a model from arrays, as an alternative to
+// issuing one node, fix or element command for each of them.
+//
+// The arrays are read directly, without being converted to and parsed
+// from strings. Elements are given in groups that share their type,
+// material or section, transformation and parameters, so that these are
+// looked up once per group. The objects of a call are constructed in
+// parallel when OpenMP is enabled, and are then handed to the Domain in
+// a single batch.
+//
+// Each function returns 0 on success. If any object is rejected, an
+// error is printed, the objects of the call that were not added to the
+// domain are deleted, and a negative value is returned.
+//
+#ifndef BulkModel_h
+#define BulkModel_h
+
+class BasicModelBuilder;
+
+namespace OpenSees {
+namespace BulkModel {
+
+  //
+  // Elements of one group; the supported types and their parameters are
+  //
+  //   truss            uniaxial material;  A? <rho?>
+  //   quad             nD material;        thk? <p? rho? b1? b2?>
+  //                    (option is the plane type, PlaneStrain by default)
+  //   stdBrick         nD material;        <b1? b2? b3?>
+  //   dispBeamColumn   section, transform; <nIP? rho?>
+  //   forceBeamColumn  section, transform; <nIP? rho?>
+  //
+  struct ElementGroup {
+    const char   *type;
+    const char   *option;       // may be null
+    int           objectTag;    // material or section
+    int           transfTag;    // frame elements only
+    int           numParams;
+    const double *params;
+    int           numElements;
+    int           numNodes;     // nodes per element
+    const int    *tags;         // numElements
+    const int    *nodes;        // numElements x numNodes, by element
+  };
+
+  // coordinates are numNodes x ndm, by node; ndm must be that of the model
+  int addNodes(BasicModelBuilder &builder, int numNodes,
+               const int *tags, const double *crds, int ndm);
+
+  // codes are numNodes x ndf, by node; a nonzero code fixes the dof
+  int addFixities(BasicModelBuilder &builder, int numNodes,
+                  const int *tags, const int *codes, int ndf);
+
+  int addElements(BasicModelBuilder &builder, const ElementGroup &group);
+
+} // namespace BulkModel
+} // namespace OpenSees
+
+#endif
@@ -0,0 +1,181 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file implements the bulkImport command, which defines
+// nodes, fixities and elements from a binary file of arrays rather than
+// from one command for each object.
+//
+// The file starts with the 8 characters OPSBULK1 and is followed by any
+// number of records, which are applied in order. All integers are 32 bit,
+// all reals are 64 bit, and both are in the byte order of the machine
+// reading the file; arrays with two indices are stored by row.
+//
+//   nodes      int 1, int n, int ndm, int tags[n], double crds[n][ndm]
+//   fixities   int 2, int n, int ndf, int tags[n], int codes[n][ndf]
+//   elements   int 3, char type[32], char option[32], int objectTag,
+//              int transfTag, int numParams, double params[numParams],
+//              int n, int numNodes, int tags[n], int nodes[n][numNodes]
+//
+// The strings of an element record are padded with NUL characters; the
+// element types and their parameters are listed in BulkModel.h.
+//
+// With -threads the objects are constructed by that many threads rather
+// than by the number OpenMP would use otherwise.
+//
+#include <tcl.h>
+#include <assert.h>
+#include <string.h>
+#include <fstream>
+#include <vector>
+#ifdef _OPENMP
+#  include <omp.h>
+#endif
+#include <Logging.h>
+#include <Parsing.h>
+#include <BasicModelBuilder.h>
+#include "BulkModel.h"
+
+using namespace OpenSees;
+
+namespace {
+  enum RecordKind : int { Nodes = 1, Fixities = 2, Elements = 3 };
+
+  template <typename T>
+  bool read(std::ifstream &input, T *data, std::size_t n)
+  {
+    input.read(reinterpret_cast<char*>(data), n*sizeof(T));
+    return !input.fail();
+  }
+
+  template <typename T>
+  bool read(std::ifstream &input, std::vector<T> &data, std::size_t n)
+  {
+    data.resize(n);
+    return n == 0 || read(input, data.data(), n);
+  }
+
+  // number of threads for the duration of the command
+  class ThreadCount {
+  public:
+    ThreadCount(int numThreads) {
+#ifdef _OPENMP
+      previous = omp_get_max_threads();
+      if (numThreads > 0)
+        omp_set_num_threads(numThreads);
+#endif
+    }
+    ~ThreadCount() {
+#ifdef _OPENMP
+      omp_set_num_threads(previous);
+#endif
+    }
+  private:
+    int previous = 1;
+  };
+}
+
+//
+// bulkImport fileName? <-threads numThreads?>
+//
+int
+TclCommand_bulkImport(ClientData clientData, Tcl_Interp *interp, int argc,
+                      TCL_Char ** const argv)
+{
+  assert(clientData != nullptr);
+  BasicModelBuilder *builder = static_cast<BasicModelBuilder*>(clientData);
+
+  int numThreads = 0;
+  if (argc == 4 && strcmp(argv[2], "-threads") == 0) {
+    if (Tcl_GetInt(interp, argv[3], &numThreads) != TCL_OK || numThreads < 1) {
+      opserr << G3_ERROR_PROMPT << "invalid number of threads " << argv[3] << "\n";
+      return TCL_ERROR;
+    }
+  }
+  else if (argc != 2) {
+    opserr << G3_ERROR_PROMPT << "want: bulkImport fileName? <-threads numThreads?>\n";
+    return TCL_ERROR;
+  }
+  ThreadCount threads(numThreads);
+
+  std::ifstream input(argv[1], std::ios::in | std::ios::binary);
+  if (!input.is_open()) {
+    opserr << G3_ERROR_PROMPT << "could not open file " << argv[1] << "\n";
+    return TCL_ERROR;
+  }
+
+  char magic[8];
+  if (!read(input, magic, 8) || strncmp(magic, "OPSBULK1", 8) != 0) {
+    opserr << G3_ERROR_PROMPT << "file " << argv[1] << " is not a bulk model file\n";
+    return TCL_ERROR;
+  }
+
+  std::vector<int>    tags, codes;
+  std::vector<double> reals, params;
+
+  int kind;
+  while (read(input, &kind, 1)) {
+    int header[2];
+    switch (kind) {
+      case Nodes:
+      case Fixities: {
+        if (!read(input, header, 2) || header[0] < 0 || header[1] < 1) {
+          opserr << G3_ERROR_PROMPT << "invalid record header in " << argv[1] << "\n";
+          return TCL_ERROR;
+        }
+        const std::size_t n = header[0], m = header[1];
+        bool ok = read(input, tags, n)
+               && (kind == Nodes ? read(input, reals, n*m) : read(input, codes, n*m));
+        if (!ok) {
+          opserr << G3_ERROR_PROMPT << "unexpected end of file " << argv[1] << "\n";
+          return TCL_ERROR;
+        }
+        int status = kind == Nodes
+                   ? BulkModel::addNodes(*builder, (int)n, tags.data(), reals.data(), (int)m)
+                   : BulkModel::addFixities(*builder, (int)n, tags.data(), codes.data(), (int)m);
+        if (status != 0)
+          return TCL_ERROR;
+        break;
+      }
+
+      case Elements: {
+        char type[33] = {}, option[33] = {};
+        int  objects[3];
+        if (!read(input, type, 32) || !read(input, option, 32) || !read(input, objects, 3)
+            || objects[2] < 0 || !read(input, params, objects[2])
+            || !read(input, header, 2) || header[0] < 0 || header[1] < 1) {
+          opserr << G3_ERROR_PROMPT << "invalid element record in " << argv[1] << "\n";
+          return TCL_ERROR;
+        }
+        const std::size_t n = header[0], nen = header[1];
+        if (!read(input, tags, n) || !read(input, codes, n*nen)) {
+          opserr << G3_ERROR_PROMPT << "unexpected end of file " << argv[1] << "\n";
+          return TCL_ERROR;
+        }
+
+        BulkModel::ElementGroup group;
+        group.type        = type;
+        group.option      = option[0] != '\0' ? option : nullptr;
+        group.objectTag   = objects[0];
+        group.transfTag   = objects[1];
+        group.numParams   = objects[2];
+        group.params      = params.data();
+        group.numElements = (int)n;
+        group.numNodes    = (int)nen;
+        group.tags        = tags.data();
+        group.nodes       = codes.data();
+        if (BulkModel::addElements(*builder, group) != 0)
+          return TCL_ERROR;
+        break;
+      }
+
+      default:
+        opserr << G3_ERROR_PROMPT << "unknown record " << kind << " in " << argv[1] << "\n";
+        return TCL_ERROR;
+    }
+  }
+
+  return TCL_OK;
+}
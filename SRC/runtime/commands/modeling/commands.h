@@ -27,6 +27,9 @@ extern Tcl_CmdProc  TclCommand_addGeomTransf;
 // element.cpp
 extern Tcl_CmdProc  TclCommand_addElement;
 
+// bulk.cpp
+extern Tcl_CmdProc  TclCommand_bulkImport;
+
 // blockND.cpp
 extern Tcl_CmdProc  TclCommand_doBlock2D;
 extern Tcl_CmdProc  TclCommand_doBlock3D;
@@ -96,6 +99,7 @@ struct char_cmd {
   {"node",                 TclCommand_addNode},
   {"mass",                 TclCommand_addNodalMass},
   {"element",              TclCommand_addElement},
+  {"bulkImport",           TclCommand_bulkImport},
 
   {"print",                TclCommand_print},
   {"classType",            TclCommand_classType},
@@ -255,6 +255,10 @@ TclCommand_addGeomTransf(ClientData clientData, Tcl_Interp *interp, int argc,
       else
         crdTransf3d = new CorotCrdTransf3d(crdTransfTag, vecxzPlane, jntOffsetI, jntOffsetJ);
 
+    // the original formulation, also selected by setting CRD
+    else if (strcmp(argv[1], "CorotationalCrd") == 0)
+      crdTransf3d = new CorotCrdTransf3d(crdTransfTag, vecxzPlane, jntOffsetI, jntOffsetJ);
+
     else {
       opserr << G3_ERROR_PROMPT << "invalid Type\n";
       return TCL_ERROR;
@@ -18,6 +18,7 @@
 #include <runtimeAPI.h>
 #include <Domain.h>
 #include <FE_Datastore.h>
+#include <MemoryPool.h>
 
 #include "BasicModelBuilder.h"
 
@@ -248,6 +249,10 @@ TclCommand_wipeModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Ch
     delete builder;
     builtModel = false;
   }
+
+  // give back the arrays the objects of the old model left for reuse
+  OpenSees::MemoryPool::trim();
+
   Tcl_CreateCommand(interp, "model", &TclCommand_specifyModel, nullptr, nullptr);
   Tcl_CreateCommand(interp, "wipe",  &TclCommand_wipeModel,    nullptr, nullptr);
 
@@ -10,6 +10,8 @@
 #include <mpi.h>
 #include <MachineBroker.h>
 #include <MPI_MachineBroker.h>
+#include <MPI_Channel.h>
+#include <string.h>
 
 #define _PARALLEL_MP
 
@@ -65,6 +67,7 @@ int opsSend(ClientData, Tcl_Interp *, int, TCL_Char ** const argv);
 int opsRecv(ClientData, Tcl_Interp *, int,TCL_Char ** const argv);
 int opsPartition(ClientData, Tcl_Interp *, int, TCL_Char ** const argv);
 int wipePP(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+int channelStatistics(ClientData, Tcl_Interp *, int, TCL_Char ** const argv);
 
 void Init_Parallel(Tcl_Interp* interp)
 {
@@ -75,6 +78,41 @@ void Init_Parallel(Tcl_Interp* interp)
   Tcl_CreateCommand(interp, "recv",      &opsRecv, (ClientData)theMachineBroker, (Tcl_CmdDeleteProc *)NULL);
   Tcl_CreateCommand(interp, "barrier",   &opsBarrier, (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
   Tcl_CreateCommand(interp, "partition", &opsPartition, (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
+  Tcl_CreateCommand(interp, "channelStatistics", &channelStatistics, (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
+}
+
+//
+// Report the number of messages and bytes this process has passed to
+// and taken from MPI through its channels, e.g.
+//
+//   channelStatistics reset
+//   analyze 1
+//   channelStatistics  ;# -> messagesSent 4 bytesSent 512 ...
+//
+int
+channelStatistics(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
+{
+  if (argc > 1) {
+    if (strcmp(argv[1], "reset") != 0) {
+      opserr << "Unknown argument '" << argv[1] << "'\n";
+      return TCL_ERROR;
+    }
+    MPI_Channel::resetStatistics();
+    return TCL_OK;
+  }
+
+  const MPI_Channel::Statistics stats = MPI_Channel::getStatistics();
+  Tcl_Obj *result = Tcl_NewListObj(0, nullptr);
+  Tcl_ListObjAppendElement(interp, result, Tcl_NewStringObj("messagesSent", -1));
+  Tcl_ListObjAppendElement(interp, result, Tcl_NewWideIntObj(stats.messagesSent));
+  Tcl_ListObjAppendElement(interp, result, Tcl_NewStringObj("bytesSent", -1));
+  Tcl_ListObjAppendElement(interp, result, Tcl_NewWideIntObj(stats.bytesSent));
+  Tcl_ListObjAppendElement(interp, result, Tcl_NewStringObj("messagesReceived", -1));
+  Tcl_ListObjAppendElement(interp, result, Tcl_NewWideIntObj(stats.messagesReceived));
+  Tcl_ListObjAppendElement(interp, result, Tcl_NewStringObj("bytesReceived", -1));
+  Tcl_ListObjAppendElement(interp, result, Tcl_NewWideIntObj(stats.bytesReceived));
+  Tcl_SetObjResult(interp, result);
+  return TCL_OK;
 }
 
 
@@ -116,7 +154,7 @@ getNP(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const arg
 
 #ifdef _PARALLEL_SP
 static int
-partitionModel(int eleTag)
+partitionModel(int eleTag, double balanceThreshold)
 {
   if (OPS_PARTITIONED == true)
     return 0;
@@ -140,11 +178,14 @@ partitionModel(int eleTag)
 
   // create a partitioner & partition the domain
   if (OPS_DOMAIN_PARTITIONER == nullptr) {
-    //      OPS_BALANCER = new ShedHeaviest();
     OPS_GRAPH_PARTITIONER = new Metis;
-    // OPS_DOMAIN_PARTITIONER = new DomainPartitioner(*OPS_GRAPH_PARTITIONER,
-    // *OPS_BALANCER);
-    OPS_DOMAIN_PARTITIONER = new DomainPartitioner(*OPS_GRAPH_PARTITIONER);
+    if (balanceThreshold > 0.0) {
+      OPS_BALANCER = new ShedHeaviest();
+      OPS_DOMAIN_PARTITIONER = new DomainPartitioner(*OPS_GRAPH_PARTITIONER,
+                                                     *OPS_BALANCER);
+      OPS_DOMAIN_PARTITIONER->setImbalanceThreshold(balanceThreshold);
+    } else
+      OPS_DOMAIN_PARTITIONER = new DomainPartitioner(*OPS_GRAPH_PARTITIONER);
     theDomain.setPartitioner(OPS_DOMAIN_PARTITIONER);
   }
 
@@ -320,18 +361,32 @@ opsRecv(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const a
 }
 
 
+//
+// partition ?-balance threshold? ?eleTag?
+//
+// With -balance, elements are moved between the subdomains at commit
+// whenever the measured cost of the heaviest subdomain exceeds threshold
+// times the mean cost of the subdomains.
+//
 int
 opsPartition(ClientData clientData, Tcl_Interp *interp, int argc,
              TCL_Char ** const argv)
 {
 #ifdef _PARALLEL_SP
-  int eleTag;
-  if (argc == 2) {
-    if (Tcl_GetInt(interp, argv[1], &eleTag) != TCL_OK) {
+  int eleTag = 0;
+  double balanceThreshold = 0.0;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-balance") == 0 && i + 1 < argc) {
+      if (Tcl_GetDouble(interp, argv[++i], &balanceThreshold) != TCL_OK) {
+        opserr << "partition -balance threshold? - invalid threshold " << argv[i] << "\n";
+        return TCL_ERROR;
+      }
+    }
+    else if (Tcl_GetInt(interp, argv[i], &eleTag) != TCL_OK) {
       ;
     }
   }
-  partitionModel(eleTag);
+  partitionModel(eleTag, balanceThreshold);
 #endif
   return TCL_OK;
 }
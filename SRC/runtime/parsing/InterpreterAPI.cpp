@@ -438,6 +438,14 @@ OPS_builtModel(void)
 AnalysisModel **
 G3_getAnalysisModelPtr(G3_Runtime *rt){return rt->m_analysis_model_ptr;}
 
+int
+G3_setAnalysisModel(G3_Runtime *rt, AnalysisModel *model)
+{
+  int exists = rt->m_analysis_model ? 1 : 0;
+  rt->m_analysis_model = model;
+  return exists;
+}
+
 FE_Datastore *
 OPS_GetFEDatastore() {return theDatabase;}
 
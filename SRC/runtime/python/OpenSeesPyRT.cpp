@@ -14,11 +14,24 @@ namespace py = pybind11;
 #include <G3_Runtime.h>
 #include <elementAPI.h> // G3_getRuntime/SafeBuilder
 #include <runtime/runtime/BasicModelBuilder.h>
+#include <runtime/commands/modeling/BulkModel.h>
+
+#include <string.h>
+#include <limits>
+#include <mutex>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
 
 #include <Domain.h>
 #include <Vector.h>
+#include <ID.h>
 #include <Node.h>
+#include <NodeIter.h>
 #include <NodeData.h>
+#include <NodalLoad.h>
+#include <NodalLoadIter.h>
 #include <Element.h>
 #include <SectionForceDeformation.h>
 #include <UniaxialMaterial.h>
@@ -32,6 +45,7 @@ namespace py = pybind11;
 #include <TransientAnalysis.h>
 #include <DirectIntegrationAnalysis.h>
 #include <StaticAnalysis.h>
+#include <AnalysisModel.h>
 
 #include <LoadPattern.h>
 #include <EarthquakePattern.h>
@@ -44,6 +58,31 @@ namespace py = pybind11;
 
 #define ARRAY_FLAGS py::array::c_style|py::array::forcecast
 
+//
+// Elements and materials form their responses in storage shared by all
+// the objects of their class, so the runtimes compute one at a time. The
+// lock is taken with the GIL released: Python materials acquire the GIL
+// while it is held, so it must never be waited for with the GIL held.
+//
+static std::mutex compute_mutex;
+
+//
+// An analysis created from Python, with the components deleted with it
+//
+template <typename T>
+struct PyAnalysis {
+  T *analysis = nullptr;
+  G3_AnalysisParts parts;
+
+  PyAnalysis() = default;
+  PyAnalysis(const PyAnalysis &) = delete;
+  PyAnalysis &operator=(const PyAnalysis &) = delete;
+  ~PyAnalysis() {
+    delete analysis;
+    parts.clear();
+  }
+};
+
 
 #if 0
 std::unique_ptr<G3_Runtime, py::nodelete> 
@@ -140,20 +179,13 @@ public:
       PYBIND11_OVERRIDE_PURE(int, UniaxialMaterial, revertToStart);
   }
   UniaxialMaterial *getCopy() override {
+    // Called from the analysis with the GIL released; only hold it
+    // while the Python object is being cloned.
     py::gil_scoped_acquire acquire;
 
     auto self = py::cast(this);
     auto cloned = self.attr("getCopy")();
-
-    auto keep_python_state_alive = std::make_shared<py::object>(cloned);
-    // auto ptr = cloned.cast<UniaxialMaterial*>();
-    auto ptr = py::cast<PyUniaxialMaterial*>(cloned.release());
-
-    py::gil_scoped_release release;
-    return ptr;
-    // return std::shared_ptr<UniaxialMaterial>(keep_python_state_alive, ptr);
-    // PYBIND11_OVERRIDE_PURE(UniaxialMaterial*, UniaxialMaterial, getCopy);
-    // return this->clone();
+    return py::cast<PyUniaxialMaterial*>(cloned.release());
   }
     
   int setTrialStrain(double strain, double strainRate=0) override {
@@ -188,12 +220,67 @@ public:
 
 
 static py::array_t<double>
-copy_vector(Vector vector)
+copy_vector(const Vector& vector)
 {
   py::array_t<double> array(vector.Size());
-  double *ptr = static_cast<double*>(array.request().ptr);
-  for (int i=0; i<vector.Size(); i++)
-    ptr[i] = vector(i);
+  if (vector.Size() > 0)
+    memcpy(array.mutable_data(), &vector[0], vector.Size()*sizeof(double));
+  return array;
+}
+
+static NodeData
+parse_node_data(const std::string& type)
+{
+  if (type == "displ")  return NodeData::Disp;
+  if (type == "veloc")  return NodeData::Vel;
+  if (type == "accel")  return NodeData::Accel;
+  if (type == "react")  return NodeData::Reaction;
+  if (type == "unbal")  return NodeData::UnbalancedLoad;
+  throw std::invalid_argument("Unknown node response '" + type + "'");
+}
+
+static std::vector<int>
+node_tags(Domain& domain)
+{
+  std::vector<int> tags;
+  tags.reserve(domain.getNumNodes());
+  NodeIter& nodes = domain.getNodes();
+  Node* node;
+  while ((node = nodes()) != nullptr)
+    tags.push_back(node->getTag());
+  return tags;
+}
+
+//
+// Gather a nodal response into a single (nodes x ndf) array. The array
+// is allocated once and each row is filled with one memcpy from the
+// node's own storage; rows of nodes with fewer than ndf DOFs are padded
+// with NaN.
+//
+static py::array_t<double>
+gather_node_response(Domain& domain, NodeData type, const std::vector<int>& tags)
+{
+  std::vector<Node*> nodes(tags.size());
+  py::ssize_t ndf = 0;
+  for (size_t i=0; i<tags.size(); i++) {
+    nodes[i] = domain.getNode(tags[i]);
+    if (nodes[i] == nullptr)
+      throw std::out_of_range("No node with tag " + std::to_string(tags[i]));
+    ndf = std::max<py::ssize_t>(ndf, nodes[i]->getNumberDOF());
+  }
+
+  py::array_t<double> array({(py::ssize_t)tags.size(), ndf});
+  double *data = array.mutable_data();
+
+  for (size_t i=0; i<nodes.size(); i++) {
+    const Vector *response = nodes[i]->getResponse(type);
+    double *row = data + i*ndf;
+    int n = response != nullptr ? response->Size() : 0;
+    if (n > 0)
+      memcpy(row, &(*response)[0], n*sizeof(double));
+    for (py::ssize_t j=n; j<ndf; j++)
+      row[j] = std::numeric_limits<double>::quiet_NaN();
+  }
   return array;
 }
 
@@ -489,47 +576,253 @@ init_obj_module(py::module &m)
     .def ("getHystereticBackbone", [](BasicModelBuilder& builder, int tag){
         return std::unique_ptr<HystereticBackbone, py::nodelete>(builder.getTypedObject<HystereticBackbone>(tag));
     })
+    //
+    // Bulk definition; see BulkModel.h
+    //
+    .def ("addNodes", [](BasicModelBuilder& builder, 
+                         py::array_t<int, ARRAY_FLAGS> tags, 
+                         py::array_t<double, ARRAY_FLAGS> crds) {
+      if (crds.ndim() != 2 || crds.shape(0) != tags.size())
+        throw std::length_error("crds must have one row per node");
+      if (OpenSees::BulkModel::addNodes(builder, (int)tags.size(), tags.data(),
+                                        crds.data(), (int)crds.shape(1)) != 0)
+        throw std::runtime_error("Failed to add nodes");
+    }, py::arg("tags"), py::arg("crds"))
+
+    .def ("addFixities", [](BasicModelBuilder& builder, 
+                            py::array_t<int, ARRAY_FLAGS> tags, 
+                            py::array_t<int, ARRAY_FLAGS> codes) {
+      if (codes.ndim() != 2 || codes.shape(0) != tags.size())
+        throw std::length_error("codes must have one row per node");
+      if (OpenSees::BulkModel::addFixities(builder, (int)tags.size(), tags.data(),
+                                           codes.data(), (int)codes.shape(1)) != 0)
+        throw std::runtime_error("Failed to add fixities");
+    }, py::arg("tags"), py::arg("codes"))
+
+    .def ("addElements", [](BasicModelBuilder& builder, std::string type,
+                            py::array_t<int, ARRAY_FLAGS> tags, 
+                            py::array_t<int, ARRAY_FLAGS> nodes,
+                            int object_tag, int transf_tag,
+                            std::vector<double> params, std::string option) {
+      if (nodes.ndim() != 2 || nodes.shape(0) != tags.size())
+        throw std::length_error("nodes must have one row per element");
+
+      OpenSees::BulkModel::ElementGroup group;
+      group.type        = type.c_str();
+      group.option      = option.empty() ? nullptr : option.c_str();
+      group.objectTag   = object_tag;
+      group.transfTag   = transf_tag;
+      group.numParams   = (int)params.size();
+      group.params      = params.data();
+      group.numElements = (int)tags.size();
+      group.numNodes    = (int)nodes.shape(1);
+      group.tags        = tags.data();
+      group.nodes       = nodes.data();
+      if (OpenSees::BulkModel::addElements(builder, group) != 0)
+        throw std::runtime_error("Failed to add " + type + " elements");
+    }, py::arg("type"), py::arg("tags"), py::arg("nodes"), py::arg("material"),
+       py::arg("transform") = 0, py::arg("params") = std::vector<double>{},
+       py::arg("option") = "")
   ;
 
   py::class_<Domain>(m, "_Domain")
-    // .def ("getElementResponse", &Domain::getElementResponse)
     .def ("getNodeResponse", [](Domain& domain, int node, std::string type) {
-        NodeData typ;
-        if (type == "displ") typ = NodeData::Disp;
-        if (type == "accel") typ = NodeData::Accel;
-        if (type == "veloc") typ = NodeData::Vel;
-        if (type == "react") typ = NodeData::Reaction;
-      return copy_vector(*domain.getNodeResponse(node, typ));
+      const Vector *response = domain.getNodeResponse(node, parse_node_data(type));
+      if (response == nullptr)
+        throw std::out_of_range("No response for node " + std::to_string(node));
+      return copy_vector(*response);
+    })
+    //
+    // Bulk access
+    //
+    .def ("getNodeTags", [](Domain& domain) {
+      std::vector<int> tags = node_tags(domain);
+      return py::array_t<int>((py::ssize_t)tags.size(), tags.data());
     })
+    .def ("getNodeResponses", [](Domain& domain, std::string type) {
+      return gather_node_response(domain, parse_node_data(type), node_tags(domain));
+    }, py::arg("type"))
+    .def ("getNodeResponses", [](Domain& domain, std::string type, 
+                                 py::array_t<int, ARRAY_FLAGS> tags) {
+      std::vector<int> list(tags.data(), tags.data() + tags.size());
+      return gather_node_response(domain, parse_node_data(type), list);
+    }, py::arg("type"), py::arg("tags"))
+
+    .def ("getElementResponses", [](Domain& domain, py::array_t<int, ARRAY_FLAGS> tags, 
+                                    std::vector<std::string> args) {
+      // Responses of all elements must have the same size. They are
+      // formed with the GIL released, as an analysis forms them.
+      std::vector<const char*> argv;
+      for (auto& arg : args)
+        argv.push_back(arg.c_str());
+
+      const py::ssize_t n = tags.size();
+      const int *tag = tags.data();
+      py::ssize_t size = 0;
+      std::vector<double> data;
+      {
+        py::gil_scoped_release release;
+        std::lock_guard<std::mutex> lock(compute_mutex);
+        for (py::ssize_t i=0; i<n; i++) {
+          const Vector *response = domain.getElementResponse(tag[i], argv.data(), (int)argv.size());
+          if (response == nullptr)
+            throw std::out_of_range("No response for element " + std::to_string(tag[i]));
+
+          if (i == 0) {
+            size = response->Size();
+            data.resize(n*size);
+          } else if (size != response->Size())
+            throw std::length_error("Element responses differ in size");
+
+          if (size > 0)
+            memcpy(data.data() + i*size, &(*response)[0], size*sizeof(double));
+        }
+      }
+      py::array_t<double> array({n, size});
+      if (!data.empty())
+        memcpy(array.mutable_data(), data.data(), data.size()*sizeof(double));
+      return array;
+    }, py::arg("tags"), py::arg("args"))
+
+    .def ("setNodeResponses", [](Domain& domain, std::string type,
+                                 py::array_t<int, ARRAY_FLAGS> tags, 
+                                 py::array_t<double, ARRAY_FLAGS> values) {
+      // Impose trial displacements, velocities or accelerations, one row per node
+      if (values.ndim() != 2 || values.shape(0) != tags.size())
+        throw std::length_error("values must have one row per node");
+
+      const NodeData kind = parse_node_data(type);
+      const py::ssize_t ndf = values.shape(1);
+      for (py::ssize_t i=0; i<tags.size(); i++) {
+        Node *node = domain.getNode(tags.data()[i]);
+        if (node == nullptr || node->getNumberDOF() != ndf)
+          throw std::out_of_range("Invalid node " + std::to_string(tags.data()[i]));
+
+        Vector row(const_cast<double*>(values.data() + i*ndf), (int)ndf);
+        switch (kind) {
+          case NodeData::Disp:  node->setTrialDisp(row);  break;
+          case NodeData::Vel:   node->setTrialVel(row);   break;
+          case NodeData::Accel: node->setTrialAccel(row); break;
+          default:
+            throw std::invalid_argument("Only displ, veloc and accel can be imposed");
+        }
+      }
+    }, py::arg("type"), py::arg("tags"), py::arg("values"))
+
+    .def ("setNodalLoads", [](Domain& domain, int pattern_tag,
+                              py::array_t<int, ARRAY_FLAGS> tags, 
+                              py::array_t<double, ARRAY_FLAGS> values) {
+      // Overwrite the reference loads of a pattern, one row per node. Loads
+      // that do not exist yet in the pattern are created; a node listed
+      // more than once is given the load of its last row.
+      LoadPattern *pattern = domain.getLoadPattern(pattern_tag);
+      if (pattern == nullptr)
+        throw std::out_of_range("No load pattern with tag " + std::to_string(pattern_tag));
+      if (values.ndim() != 2 || values.shape(0) != tags.size())
+        throw std::length_error("values must have one row per node");
+
+      std::unordered_map<int, NodalLoad*> loads;
+      int next_tag = 0;
+      NodalLoadIter& iter = pattern->getNodalLoads();
+      NodalLoad *load;
+      while ((load = iter()) != nullptr) {
+        loads[load->getNodeTag()] = load;
+        next_tag = std::max(next_tag, load->getTag() + 1);
+      }
+
+      const py::ssize_t ndf = values.shape(1);
+      for (py::ssize_t i=0; i<tags.size(); i++) {
+        const int tag = tags.data()[i];
+        Vector row(const_cast<double*>(values.data() + i*ndf), (int)ndf);
+        auto found = loads.find(tag);
+        if (found != loads.end()) {
+          if (found->second->setLoad(row) != 0)
+            throw std::length_error("Load size does not match for node " + std::to_string(tag));
+        } else {
+          load = new NodalLoad(next_tag++, tag, row, false);
+          if (!domain.addNodalLoad(load, pattern_tag)) {
+            delete load;
+            throw std::out_of_range("Could not add load to node " + std::to_string(tag));
+          }
+          loads[tag] = load;
+        }
+      }
+    }, py::arg("pattern"), py::arg("tags"), py::arg("values"))
     .def ("getTime", &Domain::getCurrentTime)
   ;
   
-  py::class_<G3_Runtime>(m, "_Runtime")
+  //
+  // Each runtime owns its own Domain, so several can be created in one
+  // interpreter and analyzed from separate Python threads. Runtimes
+  // created here are deleted with their Domain when Python releases
+  // them; those of a Tcl interpreter are only borrowed (see get_runtime).
+  //
+  struct RuntimeDeleter {
+    void operator()(G3_Runtime *rt) const {
+      delete rt->m_analysis_model;
+      delete rt->m_domain;
+      delete rt;
+    }
+  };
+  py::class_<G3_Runtime, std::unique_ptr<G3_Runtime, RuntimeDeleter>>(m, "_Runtime")
+    .def (py::init([]() {
+      G3_Runtime *rt = new G3_Runtime{};
+      rt->m_domain = new Domain();
+      return std::unique_ptr<G3_Runtime, RuntimeDeleter>(rt);
+    }))
   ;
 
-  py::class_<StaticAnalysis>(m, "_StaticAnalysis")
+  //
+  // Analyses release the GIL while they run, so other Python threads
+  // continue; those of different runtimes run one at a time (see
+  // compute_mutex). Python-defined materials re-acquire the GIL only when
+  // they are called. Each analysis has its own AnalysisModel, deleted
+  // with it together with its other components.
+  //
+  using PyStaticAnalysis = PyAnalysis<StaticAnalysis>;
+  py::class_<PyStaticAnalysis>(m, "_StaticAnalysis")
     .def (py::init([](G3_Runtime *runtime, G3_Config  conf) {
-      return *((StaticAnalysis*)runtime->newStaticAnalysis(conf));
-    }))
-    .def ("analyze", &StaticAnalysis::analyze)
+      auto self = new PyStaticAnalysis;
+      self->analysis = (StaticAnalysis*)runtime->newStaticAnalysis(conf, self->parts);
+      return self;
+    }), py::keep_alive<1, 2>())
+    .def ("analyze", [](PyStaticAnalysis &self, int steps) {
+          std::lock_guard<std::mutex> lock(compute_mutex);
+          return self.analysis->analyze(steps);
+        },
+        py::arg("steps") = 1,
+        py::call_guard<py::gil_scoped_release>())
   ;
 
-  py::class_<DirectIntegrationAnalysis//, TransientAnalysis
-                                      >(m, "_DirectIntegrationAnalysis")
+  using PyTransientAnalysis = PyAnalysis<DirectIntegrationAnalysis>;
+  py::class_<PyTransientAnalysis>(m, "_DirectIntegrationAnalysis")
     .def (py::init([](G3_Runtime *runtime, G3_Config  conf) {
-      return *((DirectIntegrationAnalysis*)runtime->newTransientAnalysis(conf));
-   }))
-    .def ("analyze", &DirectIntegrationAnalysis::analyze)
+      auto self = new PyTransientAnalysis;
+      self->analysis = (DirectIntegrationAnalysis*)runtime->newTransientAnalysis(conf, self->parts);
+      return self;
+    }), py::keep_alive<1, 2>())
+    .def ("analyze", [](PyTransientAnalysis &self, int steps, double dt) {
+          std::lock_guard<std::mutex> lock(compute_mutex);
+          return self.analysis->analyze(steps, dt);
+        },
+        py::arg("steps"), py::arg("dt"),
+        py::call_guard<py::gil_scoped_release>())
   ;
 
   //
   // Module-Level Functions
   //
   m.def ("get_builder", &get_builder);
+  m.def ("get_runtime", [](py::object interpaddr)->G3_Runtime* {
+      Tcl_Interp *interp = (Tcl_Interp*)PyLong_AsVoidPtr(interpaddr.ptr());
+      Tcl_InitStubs(interp, "8.6", 0);
+      return (G3_Runtime*)Tcl_GetAssocData(interp, "G3_Runtime", nullptr);
+    }, py::return_value_policy::reference
+  );
   m.def ("get_domain", [](G3_Runtime *rt)->std::unique_ptr<Domain, py::nodelete>{
       Domain *domain_addr = rt->m_domain;
       return std::unique_ptr<Domain, py::nodelete>((Domain*)domain_addr);
-    } // , py::return_value_policy::reference
+    }, py::keep_alive<0, 1>()
   );
 
 }
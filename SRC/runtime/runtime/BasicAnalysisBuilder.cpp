@@ -8,11 +8,21 @@
 //
 #include <assert.h>
 #include <stdio.h>
+#include <math.h>
 #include <unordered_map>
+#include <algorithm>
+#ifndef _WIN32
+#  include <unistd.h>
+#  include <sys/wait.h>
+#endif
+#ifdef _OPENMP
+#  include <omp.h>
+#endif
 
 #include "BasicAnalysisBuilder.h"
 #include <Domain.h>
 #include <G3_Logging.h>
+#include <Profiler.h>
 // Abstract classes
 #include <EquiSolnAlgo.h>
 #include <StaticIntegrator.h>
@@ -20,6 +30,7 @@
 #include <LinearSOE.h>
 #include <StaticAnalysis.h>
 #include <DirectIntegrationAnalysis.h>
+#include <BatchTransientAnalysis.h>
 #include <DOF_Numberer.h>
 #include <ConstraintHandler.h>
 #include <ConvergenceTest.h>
@@ -68,6 +79,7 @@ BasicAnalysisBuilder::BasicAnalysisBuilder(Domain* domain)
   theAlgorithm(nullptr),
   theSOE(nullptr),
   theEigenSOE(nullptr),
+  theEigenLinearSOE(nullptr),
   theStaticIntegrator(nullptr),
   theTransientIntegrator(nullptr),
   theTest(nullptr),
@@ -115,6 +127,7 @@ BasicAnalysisBuilder::wipe()
       delete theHandler;
       theHandler = nullptr;
   }
+  modelStamp = -1;
   if (theTest != nullptr) {
       delete theTest;
       theTest = nullptr;
@@ -123,6 +136,11 @@ BasicAnalysisBuilder::wipe()
       delete theEigenSOE;
       theEigenSOE = nullptr;
   }
+  if (theEigenLinearSOE != nullptr) {
+      delete theEigenLinearSOE;
+      theEigenLinearSOE = nullptr;
+  }
+  eigenStamp = 0;
   if (theAnalysisModel != nullptr) {
     delete theAnalysisModel;
     theAnalysisModel = new AnalysisModel();
@@ -183,9 +201,23 @@ BasicAnalysisBuilder::setLinks(CurrentAnalysis flag)
   }
 }
 
+int
+BasicAnalysisBuilder::checkModification(void) const
+{
+  if (theDomain->isModifying()) {
+    opserr << G3_ERROR_PROMPT << "the domain is being modified, "
+           << "the modification must be committed first\n";
+    return -1;
+  }
+  return 0;
+}
+
 int
 BasicAnalysisBuilder::initialize(void)
 {
+  if (this->checkModification() < 0)
+    return -1;
+
   // check if domain has undergone change
   int stamp = theDomain->hasDomainChanged();
   if (stamp != domainStamp) {
@@ -230,50 +262,59 @@ BasicAnalysisBuilder::domainChanged(void)
 
   opsdbg << G3_DEBUG_PROMPT << "Domain changed\n";
 
-  theAnalysisModel->clearAll();
-  if (theHandler != nullptr) {
-    theHandler->clearAll();
+  // If the model was built for the previous stamp, a change to the loads
+  // alone leaves it as it is, and elements that were added or removed are
+  // patched into it without renumbering the equations.
+  const int kinds = domain->getLastChangeKinds();
+  const bool patch = theHandler != nullptr && stamp == modelStamp + 1;
+  modelStamp = -1;
 
-    // Invoke handle() on the constraint handler which
-    // causes the creation of FE_Element and DOF_Group objects
-    // and their addition to the AnalysisModel.
-    if (theHandler->handle() < 0) {
-      opserr << "BasicAnalysisBuilder::domainChange() - ConstraintHandler::handle() failed\n";
-      return -1;
-    }
-    // Invoke number() on the numberer which causes
-    // equation numbers to be assigned to all the DOFs in the
-    // AnalysisModel.
-    if (theNumberer != nullptr && theNumberer->numberDOF() < 0) {
-      opserr << "BasicAnalysisBuilder::domainChange() - DOF_Numberer::numberDOF() failed\n";
-      return -2;
-    }
+  if (patch && (kinds & ~Domain::ChangeLoads) == 0) {
+    // nothing the analysis model depends on has changed
+  }
 
+  else if (patch && (kinds & ~(Domain::ChangeElements|Domain::ChangeLoads)) == 0
+           && theHandler->handleElements(domain->getLastAddedElements(),
+                                         domain->getLastRemovedElements()) == 0) {
     if (theHandler->doneNumberingDOF() < 0) {
       opserr << "BasicAnalysisBuilder::domainChange() - ConstraintHandler::doneNumberingDOF() failed\n";
       return -2;
     }
+    theAnalysisModel->clearDOFGroupGraph();
+    if (this->setSystemSize(stamp) < 0)
+      return -3;
   }
 
-  // Invoke setSize() on the LinearSOE which
-  // causes that object to determine its size
-  Graph &theGraph = theAnalysisModel->getDOFGraph();
+  else {
+    theAnalysisModel->clearAll();
+    if (theHandler != nullptr) {
+      theHandler->clearAll();
+
+      // Invoke handle() on the constraint handler which
+      // causes the creation of FE_Element and DOF_Group objects
+      // and their addition to the AnalysisModel.
+      if (theHandler->handle() < 0) {
+        opserr << "BasicAnalysisBuilder::domainChange() - ConstraintHandler::handle() failed\n";
+        return -1;
+      }
+      // Invoke number() on the numberer which causes
+      // equation numbers to be assigned to all the DOFs in the
+      // AnalysisModel.
+      if (theNumberer != nullptr && theNumberer->numberDOF() < 0) {
+        opserr << "BasicAnalysisBuilder::domainChange() - DOF_Numberer::numberDOF() failed\n";
+        return -2;
+      }
 
-  if (theSOE != nullptr) {
-    if (theSOE->setSize(theGraph) < 0) {
-      opserr << "BasicAnalysisBuilder::domainChange() - LinearSOE::setSize() failed\n";
-      return -3;
+      if (theHandler->doneNumberingDOF() < 0) {
+        opserr << "BasicAnalysisBuilder::domainChange() - ConstraintHandler::doneNumberingDOF() failed\n";
+        return -2;
+      }
     }
-  }
 
-  if (theEigenSOE != nullptr) {
-    int result = theEigenSOE->setSize(theGraph);
-    if (result < 0) {
+    if (this->setSystemSize(stamp) < 0)
       return -3;
-    }
   }
-
-  theAnalysisModel->clearDOFGraph();
+  modelStamp = stamp;
 
   // finally we invoke domainChanged on the Integrator and Algorithm
   // objects .. informing them that the model has changed
@@ -305,6 +346,39 @@ BasicAnalysisBuilder::domainChanged(void)
   return 0;
 }
 
+int
+BasicAnalysisBuilder::setSystemSize(int stamp)
+{
+  // Invoke setSize() on the LinearSOE which
+  // causes that object to determine its size
+  Graph &theGraph = theAnalysisModel->getDOFGraph();
+
+  if (theSOE != nullptr) {
+    if (theSOE->setSize(theGraph) < 0) {
+      opserr << "BasicAnalysisBuilder::domainChange() - LinearSOE::setSize() failed\n";
+      return -3;
+    }
+  }
+
+  if (theEigenLinearSOE != nullptr) {
+    if (theEigenLinearSOE->setSize(theGraph) < 0) {
+      opserr << "BasicAnalysisBuilder::domainChange() - LinearSOE::setSize() failed for eigen system\n";
+      return -3;
+    }
+  }
+
+  if (theEigenSOE != nullptr) {
+    int result = theEigenSOE->setSize(theGraph);
+    if (result < 0) {
+      return -3;
+    }
+    eigenStamp = stamp;
+  }
+
+  theAnalysisModel->clearDOFGraph();
+  return 0;
+}
+
 int
 BasicAnalysisBuilder::analyze(int num_steps, double size_steps)
 {
@@ -332,9 +406,13 @@ int
 BasicAnalysisBuilder::analyzeStatic(int numSteps)
 {
   int result = 0;
+  if (this->checkModification() < 0)
+    return -1;
 
   for (int i=0; i<numSteps; i++) {
 
+      OpenSees::Profiler::Scope scope(OpenSees::Profiler::Step);
+
       result = theAnalysisModel->analysisStep();
 
       if (result < 0) {
@@ -437,11 +515,48 @@ BasicAnalysisBuilder::analyzeSubLevel(int level, double dT)
   return result;
 }
 
+int
+BasicAnalysisBuilder::analyzeBatch(BatchTransientAnalysis& batch, int numSteps, double dT)
+{
+  if (theSOE == nullptr || theHandler == nullptr || theNumberer == nullptr) {
+    opserr << G3_ERROR_PROMPT << "no analysis has been defined\n";
+    return -1;
+  }
+  if (this->checkModification() < 0)
+    return -1;
+
+  int stamp = theDomain->hasDomainChanged();
+  if (stamp != domainStamp) {
+    domainStamp = stamp;
+    if (this->domainChanged() < 0) {
+      opserr << G3_ERROR_PROMPT << "analyzeBatch - domainChanged() failed\n";
+      return -1;
+    }
+  }
+
+  return batch.analyze(*theDomain, *theAnalysisModel, *theSOE, numSteps, dT);
+}
+
 // analyze a transient step
 int
 BasicAnalysisBuilder::analyzeStep(double dT)
+{
+  OpenSees::Profiler::Scope scope(OpenSees::Profiler::Step);
+
+  int result = this->solveStep(dT);
+  if (result < 0)
+    return result;
+
+  return this->commitStep();
+}
+
+// solve a transient step without committing it
+int
+BasicAnalysisBuilder::solveStep(double dT)
 {
   int result = 0;
+  if (this->checkModification() < 0)
+    return -1;
   if (theAnalysisModel->analysisStep(dT) < 0) {
     opserr << "DirectIntegrationAnalysis::analyze() - the AnalysisModel failed";
     opserr << " at time " << theDomain->getCurrentTime() << "\n";
@@ -477,8 +592,13 @@ BasicAnalysisBuilder::analyzeStep(double dT)
     return -3;
   }
 
+  return result;
+}
 
-  result = theTransientIntegrator->commit();
+int
+BasicAnalysisBuilder::commitStep()
+{
+  int result = theTransientIntegrator->commit();
   if (result < 0) {
     opserr << "DirectIntegrationAnalysis::analyze() - ";
     opserr << "the Integrator failed to commit";
@@ -491,6 +611,220 @@ BasicAnalysisBuilder::analyzeStep(double dT)
   return result;
 }
 
+//
+// Advance the transient analysis by duration with steps chosen to keep
+// the local error estimate of the integrator within the tolerances.
+// After each accepted step the next step size follows the PI controller
+// of Gustafsson (1991),
+//
+//   dt_{n+1} = dt_n s (1/e_n)^{kI} (e_{n-1})^{kP},
+//
+// with exponents for an error estimate of third order. A step whose
+// estimate exceeds one is rejected and retried with a smaller step, as is
+// a step that fails to converge. If dtOut is positive the steps are
+// shortened to land on multiples of dtOut from the start time, and the
+// recorders are invoked only for the steps that end on one of them.
+//
+int
+BasicAnalysisBuilder::analyzeAdaptive(double duration, double dT,
+                                      double dtMin, double dtMax,
+                                      double absTol, double relTol, double dtOut)
+{
+  const double safety = 0.9;
+  const double kI = 0.7/3.0;
+  const double kP = 0.4/3.0;
+  const double minFactor = 0.2;
+  const double maxFactor = 5.0;
+
+  if (duration <= 0.0 || dT <= 0.0) {
+    opserr << G3_ERROR_PROMPT << "analyzeAdaptive - the duration and time step must be positive\n";
+    return -1;
+  }
+  if (dtMax <= 0.0)
+    dtMax = duration;
+  if (dtMin > dtMax)
+    dtMin = dtMax;
+  if (this->checkModification() < 0)
+    return -1;
+
+  const double start = theDomain->getCurrentTime();
+  const double end   = start + duration;
+  const double eps   = 1.0e-10*duration;
+
+  int numOutput = 1;
+  double dt = std::min(std::max(dT, dtMin), dtMax);
+  double errorLast = 1.0;
+
+  double time = start;
+  while (time < end - eps) {
+    OpenSees::Profiler::Scope scope(OpenSees::Profiler::Step);
+
+    // land on the next output time and on the end of the analysis
+    double target = end;
+    const double output = start + numOutput*dtOut;
+    if (dtOut > 0.0)
+      target = std::min(end, output);
+
+    double step = dt;
+    bool clipped = false;
+    if (time + 1.01*step >= target) {
+      step = target - time;
+      clipped = true;
+    }
+
+    ops_Dt = step;
+    int result = this->solveStep(step);
+    if (result < 0) {
+      // the step failed to converge
+      if (step <= dtMin*(1.0 + 1.0e-12))
+        return result;
+      dt = std::max(0.25*step, dtMin);
+      continue;
+    }
+
+    double error = theTransientIntegrator->getErrorEstimate(absTol, relTol);
+    if (error < 0.0) {
+      opserr << G3_ERROR_PROMPT << "analyzeAdaptive - the integrator does not provide an error estimate\n";
+      theDomain->revertToLastCommit();
+      theTransientIntegrator->revertToLastStep();
+      return -1;
+    }
+
+    if (error > 1.0 && step > dtMin*(1.0 + 1.0e-12)) {
+      // reject the step
+      theDomain->revertToLastCommit();
+      theTransientIntegrator->revertToLastStep();
+      dt = std::max(step*std::max(minFactor, safety*std::pow(error, -1.0/3.0)), dtMin);
+      continue;
+    }
+
+    // steps between the output times are committed without recording
+    const bool onOutput = clipped && fabs(target - output) <= eps;
+    theDomain->holdRecorders(dtOut > 0.0 && !onOutput);
+    result = this->commitStep();
+    theDomain->holdRecorders(false);
+    if (result < 0)
+      return result;
+
+    time = clipped ? target : time + step;
+    if (dtOut > 0.0 && time >= output - eps)
+      numOutput++;
+
+    // propose the next step
+    error = std::max(error, 1.0e-10);
+    double factor = safety*std::pow(error, -kI)*std::pow(errorLast, kP);
+    factor = std::min(std::max(factor, minFactor), maxFactor);
+    errorLast = error;
+
+    double next = step*factor;
+    if (clipped && factor >= 1.0)
+      next = std::max(next, dt);
+    dt = std::min(std::max(next, dtMin), dtMax);
+  }
+
+  return 0;
+}
+
+//
+// Run numTasks analyses from the current committed state of the domain.
+// Every task runs in its own child process created with fork(), so the
+// committed state (including the analysis objects and any factorization
+// they hold) is shared copy-on-write and never has to be recomputed or
+// serialized. Recorders that exist when branch() is called are flushed
+// and then detached in the children; each task is expected to create
+// its own recorders, time series and load patterns.
+//
+// The exit code of each child is written to status[i], where 0 indicates
+// that task(i) returned 0.
+//
+int
+BasicAnalysisBuilder::branch(int numTasks, int maxJobs,
+                             const std::function<int(int)>& task,
+                             std::vector<int>& status)
+{
+#ifdef _WIN32
+  opserr << G3_ERROR_PROMPT << "branch is not supported on this platform\n";
+  return -1;
+#else
+  status.assign(numTasks, -1);
+  if (numTasks <= 0)
+    return 0;
+
+  if (maxJobs < 1)
+    maxJobs = 1;
+
+  // Make sure the children start from the committed state, and that
+  // buffered output is not written once by each process
+  theDomain->revertToLastCommit();
+  theDomain->flushRecorders();
+  opserr.flush();
+  fflush(nullptr);
+
+#ifdef _OPENMP
+  // fork() copies only the calling thread, and the first parallel region
+  // of a child would wait on the idle OpenMP threads of the parent
+  // forever; release them, the parent starts new ones when it next needs
+  // them and so does each child
+  omp_pause_resource_all(omp_pause_hard);
+#endif
+
+  std::unordered_map<pid_t, int> running;
+  int next = 0;
+  int result = 0;
+
+  while (next < numTasks || !running.empty()) {
+
+    while (next < numTasks && (int)running.size() < maxJobs) {
+      pid_t pid = fork();
+      if (pid < 0) {
+        opserr << G3_ERROR_PROMPT << "branch - failed to fork task " << next << "\n";
+        result = -1;
+        next = numTasks;
+        break;
+      }
+
+      if (pid == 0) {
+        // Child; never return to the caller
+        theDomain->detachRecorders();
+        int code = task(next) == 0 ? 0 : 1;
+        theDomain->removeRecorders();
+        opserr.flush();
+        fflush(nullptr);
+        _exit(code);
+      }
+
+      running[pid] = next++;
+    }
+
+    if (running.empty())
+      break;
+
+    int wstatus;
+    pid_t pid = waitpid(-1, &wstatus, 0);
+    if (pid < 0) {
+      opserr << G3_ERROR_PROMPT << "branch - failed waiting on child process\n";
+      return -1;
+    }
+
+    auto child = running.find(pid);
+    if (child == running.end())
+      continue;
+
+    if (WIFEXITED(wstatus))
+      status[child->second] = WEXITSTATUS(wstatus);
+    else {
+      if (WIFSIGNALED(wstatus))
+        opserr << G3_ERROR_PROMPT << "branch - task " << child->second
+               << " was killed by signal " << WTERMSIG(wstatus) << "\n";
+      result = -2;
+    }
+
+    running.erase(child);
+  }
+
+  return result;
+#endif
+}
 
 
 void
@@ -500,6 +834,7 @@ BasicAnalysisBuilder::set(ConstraintHandler* obj)
     delete theHandler;
 
   theHandler = obj;
+  modelStamp = -1;
 }
 
 void
@@ -514,6 +849,7 @@ BasicAnalysisBuilder::set(DOF_Numberer* obj)
   theNumberer->setLinks(*theAnalysisModel);
 
   domainStamp = 0;
+  modelStamp = -1;
   return;
 }
 
@@ -547,11 +883,12 @@ BasicAnalysisBuilder::set(LinearSOE* obj, bool free)
 
   this->setLinks(this->CurrentAnalysisFlag);
 
-  if (theEigenSOE != nullptr)
+  if (theEigenSOE != nullptr && theEigenLinearSOE == nullptr)
     theEigenSOE->setLinearSOE(*theSOE);
 
 
   domainStamp = 0;
+  modelStamp = -1;
 }
 
 
@@ -560,6 +897,11 @@ BasicAnalysisBuilder::getLinearSOE() {
   return theSOE;
 }
 
+AnalysisModel*
+BasicAnalysisBuilder::getAnalysisModel() {
+  return theAnalysisModel;
+}
+
 
 void
 BasicAnalysisBuilder::set(StaticIntegrator& obj)
@@ -574,8 +916,10 @@ BasicAnalysisBuilder::set(StaticIntegrator& obj)
   if (domainStamp != 0 && this->CurrentAnalysisFlag != EMPTY_ANALYSIS)
     theStaticIntegrator->domainChanged();
 
-  else
+  else {
     domainStamp = 0;
+    modelStamp = -1;
+  }
 }
 
 void
@@ -594,8 +938,10 @@ BasicAnalysisBuilder::set(TransientIntegrator& obj, bool free)
   if (domainStamp != 0  && this->CurrentAnalysisFlag != EMPTY_ANALYSIS)
     theTransientIntegrator->domainChanged();
 
-  else
+  else {
     domainStamp = 0;
+    modelStamp = -1;
+  }
 }
 
 void
@@ -624,9 +970,11 @@ BasicAnalysisBuilder::set(EigenSOE &theNewSOE)
   if (theEigenSOE == nullptr) {
     theEigenSOE = &theNewSOE;
     theEigenSOE->setLinks(*theAnalysisModel);
-    theEigenSOE->setLinearSOE(*theSOE);
+    theEigenSOE->setLinearSOE(theEigenLinearSOE != nullptr ? *theEigenLinearSOE : *theSOE);
 
     domainStamp = 0;
+    modelStamp = -1;
+    eigenStamp  = 0;
   }
 
 }
@@ -680,6 +1028,7 @@ int
 BasicAnalysisBuilder::setStaticAnalysis()
 {
   domainStamp = 0;
+  modelStamp = -1;
   this->fillDefaults(STATIC_ANALYSIS);
   this->setLinks(STATIC_ANALYSIS);
 
@@ -692,6 +1041,7 @@ int
 BasicAnalysisBuilder::setTransientAnalysis()
 {
   domainStamp = 0;
+  modelStamp = -1;
   this->CurrentAnalysisFlag = TRANSIENT_ANALYSIS;
   this->fillDefaults(TRANSIENT_ANALYSIS);
   this->setLinks(TRANSIENT_ANALYSIS);
@@ -711,7 +1061,7 @@ BasicAnalysisBuilder::newTransientAnalysis()
 
 
 void
-BasicAnalysisBuilder::newEigenAnalysis(int typeSolver, double shift)
+BasicAnalysisBuilder::newEigenAnalysis(int typeSolver, double shift, LinearSOE *theLinearSOE)
 {
   assert(theAnalysisModel != nullptr);
 
@@ -724,16 +1074,41 @@ BasicAnalysisBuilder::newEigenAnalysis(int typeSolver, double shift)
   this->fillDefaults(this->CurrentAnalysisFlag); //TRANSIENT_ANALYSIS);
   this->setLinks(this->CurrentAnalysisFlag); //TRANSIENT_ANALYSIS);
 
+  // keep a dedicated eigen system of the same type, so that its
+  // symbolic factorization carries over to this analysis
+  if (theLinearSOE != nullptr) {
+    if (theEigenLinearSOE != nullptr &&
+        theEigenLinearSOE->getClassTag() == theLinearSOE->getClassTag()) {
+      delete theLinearSOE;
+    } else {
+      if (theEigenLinearSOE != nullptr)
+        delete theEigenLinearSOE;
+      theEigenLinearSOE = theLinearSOE;
+      theEigenLinearSOE->setLinks(*theAnalysisModel);
+      if (theEigenSOE != nullptr)
+        theEigenSOE->setLinearSOE(*theEigenLinearSOE);
+      eigenStamp = 0;
+    }
+  } else if (theEigenLinearSOE != nullptr) {
+    delete theEigenLinearSOE;
+    theEigenLinearSOE = nullptr;
+    if (theEigenSOE != nullptr)
+      theEigenSOE->setLinearSOE(*theSOE);
+    eigenStamp = 0;
+  }
+
   // create a new eigen system and solver
   if (theEigenSOE != nullptr) {
-    if (theEigenSOE->getClassTag() != typeSolver) {
+    if (theEigenSOE->getClassTag() != typeSolver ||
+        (typeSolver == EigenSOE_TAGS_ArpackSOE &&
+         ((ArpackSOE*)theEigenSOE)->getShift() != shift)) {
       delete theEigenSOE;
       theEigenSOE = nullptr;
     }
   }
 
   if (theEigenSOE == nullptr) {
-    domainStamp = 0;
+    eigenStamp = 0;
     if (typeSolver == EigenSOE_TAGS_SymBandEigenSOE) {
       SymBandEigenSolver *theEigenSolver = new SymBandEigenSolver();
       theEigenSOE = new SymBandEigenSOE(*theEigenSolver, *theAnalysisModel);
@@ -750,7 +1125,7 @@ BasicAnalysisBuilder::newEigenAnalysis(int typeSolver, double shift)
     // set the eigen soe in the system
     //
     theEigenSOE->setLinks(*theAnalysisModel);
-    theEigenSOE->setLinearSOE(*theSOE);
+    theEigenSOE->setLinearSOE(theEigenLinearSOE != nullptr ? *theEigenLinearSOE : *theSOE);
   } // theEigenSOE == 0
 }
 
@@ -764,13 +1139,15 @@ BasicAnalysisBuilder::eigen(int numMode, bool generalized, bool findSmallest)
 
   int result = 0;
   Domain *the_Domain = this->getDomain();
+  if (this->checkModification() < 0)
+    return -1;
 
   // for parallel processing, want all analysis doing an eigenvalue analysis
   result = theAnalysisModel->eigenAnalysis(numMode, generalized, findSmallest);
 
   int stamp = the_Domain->hasDomainChanged();
 
-  if (stamp != domainStamp) {
+  if (stamp != domainStamp && stamp != eigenStamp) {
     //domainStamp = stamp; // commented out so domainChanged() gets called with integrator,
                          //  which isnt updated here
 //    result = this->domainChanged();
@@ -794,7 +1171,11 @@ BasicAnalysisBuilder::eigen(int numMode, bool generalized, bool findSmallest)
 
     result = theSOE->setSize(theGraph);
 
-    result = theEigenSOE->setSize(theGraph);
+    if (theEigenLinearSOE != nullptr && result >= 0)
+      result = theEigenLinearSOE->setSize(theGraph);
+
+    if (result >= 0)
+      result = theEigenSOE->setSize(theGraph);
 
     theAnalysisModel->clearDOFGraph();
 
@@ -802,6 +1183,29 @@ BasicAnalysisBuilder::eigen(int numMode, bool generalized, bool findSmallest)
       opserr << "BasicAnalysisBuilder::eigen() - domainChanged failed\n";
       return -1;
     }
+    eigenStamp = stamp;
+    modelStamp = stamp;
+
+  } else if (stamp != eigenStamp) {
+    //
+    // the equations are numbered for the current domain, but the
+    // eigen systems have not been sized for them yet
+    //
+    Graph &theGraph = theAnalysisModel->getDOFGraph();
+
+    if (theEigenLinearSOE != nullptr)
+      result = theEigenLinearSOE->setSize(theGraph);
+
+    if (result >= 0)
+      result = theEigenSOE->setSize(theGraph);
+
+    theAnalysisModel->clearDOFGraph();
+
+    if (result < 0) {
+      opserr << "BasicAnalysisBuilder::eigen() - failed to size the eigen system\n";
+      return -1;
+    }
+    eigenStamp = stamp;
   }
 
   //
@@ -908,6 +1312,8 @@ BasicAnalysisBuilder::getConvergenceTest()
 int
 BasicAnalysisBuilder::formUnbalance()
 {
+    if (this->checkModification() < 0)
+      return -1;
     if (theStaticIntegrator != nullptr)
       return theStaticIntegrator->formUnbalance();
 
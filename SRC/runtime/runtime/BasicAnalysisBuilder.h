@@ -14,6 +14,7 @@
 // - AnalysisModel 	           *theAnalysisModel;
 // - EquiSolnAlgo 	           *theAlgorithm;
 // - EigenSOE 		             *theEigenSOE;
+// - LinearSOE                 *theEigenLinearSOE;
 // - StaticIntegrator          *theStaticIntegrator;
 // - TransientIntegrator       *theTransientIntegrator;
 // - ConvergenceTest           *theTest;
@@ -27,6 +28,9 @@
 #ifndef BasicAnalysisBulider_h
 #define BasicAnalysisBulider_h
 
+#include <vector>
+#include <functional>
+
 class Domain;
 class G3_Table;
 class ConstraintHandler;
@@ -39,6 +43,7 @@ class StaticIntegrator;
 class TransientIntegrator;
 class ConvergenceTest;
 class VariableTimeStepDirectIntegrationAnalysis;
+class BatchTransientAnalysis;
 
 class BasicAnalysisBuilder
 {
@@ -62,6 +67,7 @@ public:
     void set(EigenSOE& obj);
 
     LinearSOE* getLinearSOE();
+    AnalysisModel* getAnalysisModel();
 
     Domain* getDomain();
     int initialize();
@@ -71,7 +77,11 @@ public:
     int  setTransientAnalysis();
 
     //   Eigen
-    void newEigenAnalysis(int typeSolver, double shift);
+    // If a LinearSOE is given, the shift-invert solves of the eigen
+    // analysis use it instead of the analysis system. It is kept between
+    // calls (along with its symbolic factorization) until the domain
+    // changes or a system of another type is requested.
+    void newEigenAnalysis(int typeSolver, double shift, LinearSOE *theLinearSOE = nullptr);
     int  eigen(int numMode, bool generalized, bool findSmallest);
     int  getNumEigen() {return numEigen;};
 
@@ -88,6 +98,10 @@ public:
 
     int domainChanged();
 
+    // the analysis model can not be used while a modification of the
+    // domain is open, as it may refer to elements that were removed
+    int checkModification(void) const;
+
     // Performing analysis
     int analyze(int num_steps, double size_steps=0.0);
     int analyzeStatic(int num_steps);
@@ -96,14 +110,32 @@ public:
     int analyzeStep(double dT);
     int analyzeSubLevel(int level, double dT);
 
+    // Advance a transient analysis by duration with the step size
+    // controlled by the error estimate of the integrator
+    int analyzeAdaptive(double duration, double dT, double dtMin, double dtMax,
+                        double absTol, double relTol, double dtOut = 0.0);
+
+    // Advance the records of a batch in lockstep using the numbering
+    // and system of equations of this builder
+    int analyzeBatch(BatchTransientAnalysis& batch, int numSteps, double dT);
+
+    // Branching from the last committed state; each task is run
+    // in a forked child process with at most maxJobs alive at once.
+    int branch(int numTasks, int maxJobs,
+               const std::function<int(int)>& task,
+               std::vector<int>& status);
+
     void wipe();
 
     
     enum CurrentAnalysis  CurrentAnalysisFlag = EMPTY_ANALYSIS;
 
 private:
+    int solveStep(double dT);
+    int commitStep();
     void setLinks(CurrentAnalysis flag = EMPTY_ANALYSIS);
     void fillDefaults(enum CurrentAnalysis flag);
+    int  setSystemSize(int stamp);
 
     Domain                    *theDomain;
     ConstraintHandler         *theHandler;
@@ -112,12 +144,15 @@ private:
     EquiSolnAlgo              *theAlgorithm;
     LinearSOE                 *theSOE;
     EigenSOE                  *theEigenSOE;
+    LinearSOE                 *theEigenLinearSOE;
     StaticIntegrator          *theStaticIntegrator;
     TransientIntegrator       *theTransientIntegrator;
     ConvergenceTest           *theTest;
     VariableTimeStepDirectIntegrationAnalysis *theVariableTimeStepTransientAnalysis;
 
     int domainStamp;
+    int eigenStamp = 0;
+    int modelStamp = -1;  // stamp the analysis model was last built for
     int numEigen = 0;
 
     int numSubLevels = 0;
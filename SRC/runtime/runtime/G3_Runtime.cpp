@@ -57,8 +57,23 @@ T* G3Object_newParsed(G3_Runtime *rt, G3_Char* command, std::vector<std::string>
 
 
 
+void
+G3_AnalysisParts::clear()
+{
+  // in the order BasicAnalysisBuilder::wipe deletes them
+  delete algorithm;
+  delete integrator;
+  delete soe;
+  delete numberer;
+  delete handler;
+  delete test;
+  delete model;
+  *this = G3_AnalysisParts{};
+}
+
+
 void *
-G3_Runtime::newStaticAnalysis(G3_Config conf)
+G3_Runtime::newStaticAnalysis(G3_Config conf, G3_AnalysisParts &parts)
 {
   StaticIntegrator* sintegrator = new LoadControl(1, 1, 1, 1);
 
@@ -77,14 +92,16 @@ G3_Runtime::newStaticAnalysis(G3_Config conf)
   // LINEAR SYSTEM
   LinearSOE* the_soe = new ProfileSPDLinSOE(*new ProfileSPDLinDirectSolver());
 
+  // ANALYSIS MODEL
+  AnalysisModel *the_model = new AnalysisModel();
 
-  if (m_analysis_model == nullptr)
-    m_analysis_model = new AnalysisModel();
+  parts = G3_AnalysisParts{the_model, the_handler, the_numberer, the_soe,
+                           the_algorithm, test, sintegrator};
 
   return  new StaticAnalysis(*m_domain,
                              *the_handler,
                              *the_numberer,
-                             *m_analysis_model,
+                             *the_model,
                              *the_algorithm,
                              *the_soe,
                              *sintegrator,
@@ -92,7 +109,7 @@ G3_Runtime::newStaticAnalysis(G3_Config conf)
 }
 #if 1
 void *
-G3_Runtime::newTransientAnalysis(G3_Config conf)
+G3_Runtime::newTransientAnalysis(G3_Config conf, G3_AnalysisParts &parts)
 {
   // NUMBERER
   DOF_Numberer* the_numberer = new DOF_Numberer(*(new RCM(false)));
@@ -111,11 +128,13 @@ G3_Runtime::newTransientAnalysis(G3_Config conf)
 
 
   // ANALYSIS MODEL
-  if (m_analysis_model == nullptr)
-    m_analysis_model = new AnalysisModel();
+  AnalysisModel *the_model = new AnalysisModel();
  
   TransientIntegrator* tintegrator = new Newmark(0.5, 0.25);
 
+  parts = G3_AnalysisParts{the_model, the_handler, the_numberer, the_soe,
+                           the_algorithm, test, tintegrator};
+
 
   if (G3Config_keyExists(conf, "analysis")) {
     if (!conf["analysis"].empty() && (conf["analysis"][0] == "Variable"))
@@ -123,7 +142,7 @@ G3_Runtime::newTransientAnalysis(G3_Config conf)
                                        *m_domain,
                                        *the_handler,
                                        *the_numberer,
-                                       *m_analysis_model,
+                                       *the_model,
                                        *the_algorithm,
                                        *the_soe,
                                        *tintegrator,
@@ -133,7 +152,7 @@ G3_Runtime::newTransientAnalysis(G3_Config conf)
                                        *m_domain,
                                        *the_handler,
                                        *the_numberer,
-                                       *m_analysis_model,
+                                       *the_model,
                                        *the_algorithm,
                                        *the_soe,
                                        *tintegrator,
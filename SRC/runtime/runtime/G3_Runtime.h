@@ -27,6 +27,22 @@ class DOF_Numberer;
 class ConvergenceTest;
 class StaticIntegrator;
 class TransientIntegrator;
+class Integrator;
+class EquiSolnAlgo;
+
+// The objects an analysis created by G3_Runtime is formed from. The
+// analysis does not delete them; clear() does, once the analysis is gone.
+struct G3_AnalysisParts {
+  AnalysisModel     *model      = nullptr;
+  ConstraintHandler *handler    = nullptr;
+  DOF_Numberer      *numberer   = nullptr;
+  LinearSOE         *soe        = nullptr;
+  EquiSolnAlgo      *algorithm  = nullptr;
+  ConvergenceTest   *test       = nullptr;
+  Integrator        *integrator = nullptr;
+
+  void clear();
+};
 
 
 class G3_Runtime {
@@ -44,8 +60,10 @@ public:
   AnalysisModel **m_analysis_model_ptr = &m_analysis_model;
 
 
-  void *newStaticAnalysis(G3_Config);
-  void *newTransientAnalysis(G3_Config);
+  // Each analysis is given its own AnalysisModel; it and the other
+  // components are returned in parts.
+  void *newStaticAnalysis(G3_Config, G3_AnalysisParts &parts);
+  void *newTransientAnalysis(G3_Config, G3_AnalysisParts &parts);
 
 // IO
   FILE* streams[3] = {stdin,stdout,stderr};
@@ -403,6 +403,7 @@ using namespace OpenSees::Hash::literals;
 #include "Broyden.h"
 #include "NewtonLineSearch.h"
 #include "KrylovNewton.h"
+#include "JacobianFreeNewton.h"
 #include "AcceleratedNewton.h"
 #include "ModifiedNewton.h"
 
@@ -1755,6 +1756,9 @@ TclPackageClassBroker::getNewEquiSolnAlgo(int classTag)
   case EquiALGORITHM_TAGS_KrylovNewton:
     return new KrylovNewton();
 
+  case EquiALGORITHM_TAGS_JacobianFreeNewton:
+    return new JacobianFreeNewton();
+
   case EquiALGORITHM_TAGS_AcceleratedNewton:
     return new AcceleratedNewton();
 
@@ -34,6 +34,7 @@
 #include <Vertex.h>
 #include <VertexIter.h>
 #include <math.h>
+#include <algorithm>
 // #include <f2c.h>
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
@@ -44,7 +45,7 @@
 
 ArpackSOE::ArpackSOE(double s)
 :EigenSOE(EigenSOE_TAGS_ArpackSOE),
- M(0), Msize(0), mDiagonal(false), shift(s), theModel(0), theSOE(0),
+ M(0), Msize(0), mDiagonal(false), Mp(), Mi(), Mx(), shift(s), theModel(0), theSOE(0),
  processID(-1), numChannels(0), theChannels(0), localCol(0), sizeLocal(0)
 {
   ArpackSolver *theSolvr = new ArpackSolver();
@@ -159,6 +160,37 @@ ArpackSOE::setSize(Graph &theGraph)
       Msize = size;
   }
 
+  //
+  // in a sequential analysis, set up the sparsity pattern of M from the
+  // graph so a consistent mass matrix can be assembled once and applied
+  // by the solver without looping over the elements
+  //
+  Mp.clear();
+  Mi.clear();
+  Mx.clear();
+  if (processID == -1 && size > 0) {
+    Mp.reserve(size+1);
+    Mp.push_back(0);
+    for (int a=0; a<size; a++) {
+      Vertex *theVertex = theGraph.getVertexPtr(a);
+      if (theVertex == nullptr) {
+        Mp.clear();
+        Mi.clear();
+        break;
+      }
+      const ID &theAdjacency = theVertex->getAdjacency();
+      ID col(0, theAdjacency.Size()+1);
+      col.insert(a);
+      for (int i=0; i<theAdjacency.Size(); i++)
+        col.insert(theAdjacency(i));
+
+      for (int i=0; i<col.Size(); i++)
+        Mi.push_back(col(i));
+      Mp.push_back(Mp[a]+col.Size());
+    }
+    Mx.assign(Mi.size(), 0.0);
+  }
+
   //
   // invoke setSize() on the Solver
   //
@@ -217,6 +249,28 @@ ArpackSOE::addM(const Matrix &m, const ID &id, double fact)
   if (res < 0)
     return res;
 
+  //
+  // keep the sparse copy whether or not M turns out to be diagonal
+  //
+  if (!Mx.empty()) {
+    int idSize = id.Size();
+    for (int j=0; j<idSize; j++) {
+      int col = id(j);
+      if (col < 0 || col >= Msize)
+        continue;
+      int *begin = &Mi[Mp[col]];
+      int *end   = &Mi[0] + Mp[col+1];
+      for (int i=0; i<idSize; i++) {
+        int row = id(i);
+        if (row < 0 || row >= Msize || m(i,j) == 0.0)
+          continue;
+        int *pos = std::lower_bound(begin, end, row);
+        if (pos != end && *pos == row)
+          Mx[pos - &Mi[0]] += m(i,j);
+      }
+    }
+  }
+
   if (mDiagonal == false)
     return  res;
 
@@ -255,6 +309,8 @@ ArpackSOE::zeroM(void)
 
   for (int i=0; i<Msize; i++)
     M[i] = 0;
+
+  Mx.assign(Mx.size(), 0.0);
 }
 
 
@@ -33,6 +33,7 @@
 
 #include "eigenSOE/EigenSOE.h"
 #include <Vector.h>
+#include <vector>
 
 class AnalysisModel;
 class ArpackSolver;
@@ -72,6 +73,10 @@ class ArpackSOE : public EigenSOE
     double *M;
     int Msize;
     bool mDiagonal;
+
+    // compressed column copy of M, used when M is not diagonal
+    std::vector<int> Mp, Mi;
+    std::vector<double> Mx;
     double shift;
     AnalysisModel *theModel;
     LinearSOE *theSOE;
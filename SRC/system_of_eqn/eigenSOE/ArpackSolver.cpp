@@ -475,6 +475,20 @@ ArpackSolver::myMv(int n, double *v, double *result)
       return;
     }
 
+  } else if (!theArpackSOE->Mx.empty()) {
+
+    const int    *Mp = &theArpackSOE->Mp[0];
+    const int    *Mi = &theArpackSOE->Mi[0];
+    const double *Mx = &theArpackSOE->Mx[0];
+    for (int i=0; i<n; i++)
+      result[i] = 0.0;
+    for (int j=0; j<n; j++) {
+      const double vj = v[j];
+      if (vj != 0.0)
+        for (int k=Mp[j]; k<Mp[j+1]; k++)
+          result[Mi[k]] += Mx[k]*vj;
+    }
+
   } else {
 
     y.Zero();
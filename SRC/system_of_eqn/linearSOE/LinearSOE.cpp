@@ -32,6 +32,8 @@
 
 #include<LinearSOE.h>
 #include<LinearSOESolver.h>
+#include <Profiler.h>
+#include <Vector.h>
 
 LinearSOE::LinearSOE(LinearSOESolver &theLinearSOESolver, int classtag)
     :MovableObject(classtag), theModel(0), theSolver(&theLinearSOESolver)
@@ -55,12 +57,46 @@ LinearSOE::~LinearSOE()
 int 
 LinearSOE::solve(void)
 {
+  OpenSees::Profiler::Scope scope(OpenSees::Profiler::Solve);
+
   if (theSolver != 0)
     return (theSolver->solve());
   else 
     return -1;
 }
 
+//
+// Solve A X = B for several right-hand sides, stored one after the
+// other in X (each of length getNumEqn()), with a single factorization
+// of A. The solutions overwrite the right-hand sides.
+//
+int
+LinearSOE::solveMultiple(int numRHS, double *X)
+{
+  OpenSees::Profiler::Scope scope(OpenSees::Profiler::Solve);
+
+  if (theSolver == nullptr)
+    return -1;
+
+  int result = theSolver->solveMultiple(numRHS, X);
+  if (result != 1)
+    return result;
+
+  // The solver has no blocked solve; direct solvers keep their
+  // factorization from one column to the next until A changes.
+  const int n = this->getNumEqn();
+  for (int k=0; k<numRHS; k++) {
+    Vector b(X + k*n, n);
+    this->setB(b);
+    if ((result = theSolver->solve()) < 0)
+      return result;
+    const Vector &x = this->getX();
+    for (int i=0; i<n; i++)
+      b(i) = x(i);
+  }
+  return 0;
+}
+
 int
 LinearSOE::formAp(const Vector &p, Vector &Ap)
 {
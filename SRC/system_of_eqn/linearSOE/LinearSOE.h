@@ -51,6 +51,7 @@ class LinearSOE : public MovableObject
     virtual ~LinearSOE();
 
     virtual int solve(void);    
+    virtual int solveMultiple(int numRHS, double *X);
     virtual int setLinks(AnalysisModel &theModel);    
 
     // pure virtual functions
@@ -45,6 +45,12 @@ class LinearSOESolver : public MovableObject
     virtual int solve(void) = 0;
     virtual int setSize(void) = 0;
     virtual double getDeterminant(void) {return 1.0;};
+
+    // Solve for numRHS right-hand sides stored column by column in X,
+    // overwriting them with the solutions. Solvers without a blocked
+    // solve return 1, in which case LinearSOE::solveMultiple() solves
+    // the columns one at a time.
+    virtual int solveMultiple(int numRHS, double *X) {return 1;};
     
   protected:
     
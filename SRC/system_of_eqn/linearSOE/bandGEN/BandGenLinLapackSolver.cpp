@@ -31,6 +31,7 @@
 #include <blasdecl.h>
 #include <BandGenLinLapackSolver.h>
 #include <BandGenLinSOE.h>
+#include <Profiler.h>
 
 
 BandGenLinLapackSolver::BandGenLinLapackSolver(bool doDet_)
@@ -108,29 +109,45 @@ BandGenLinLapackSolver::solve(void)
     //     return -1;
     // }	
 
-    int kl = theSOE->numSubD;
-    int ku = theSOE->numSuperD;
-    int ldA = 2*kl + ku +1;
-    int nrhs = 1;
-    int ldB = n;
-    int info;
-    double *Aptr = theSOE->A;
     double *Xptr = theSOE->X;
     double *Bptr = theSOE->B;
-    int    *iPIV = iPiv;
 
     // first copy B into X
     for (int i=0; i<n; i++) {
 	*(Xptr++) = *(Bptr++);
     }
-    Xptr = theSOE->X;
+
+    return this->solveMultiple(1, theSOE->X);
+}
+
+
+int
+BandGenLinLapackSolver::solveMultiple(int nrhs, double *Xptr)
+{
+    assert(theSOE != nullptr);
+
+    int n = theSOE->size;
+    assert(!(iPivSize < n));
+
+    if (n == 0 || nrhs == 0)
+      return 0;
+
+    int kl = theSOE->numSubD;
+    int ku = theSOE->numSuperD;
+    int ldA = 2*kl + ku +1;
+    int ldB = n;
+    int info;
+    double *Aptr = theSOE->A;
+    int    *iPIV = iPiv;
 
     // now solve AX = B
 
     char type[] = "N";
-    if (theSOE->factored == false)
+    if (theSOE->factored == false) {
       // factor and solve
       DGBSV(&n,&kl,&ku,&nrhs,Aptr,&ldA,iPIV,Xptr,&ldB,&info);
+      OpenSees::Profiler::count(OpenSees::Profiler::Factorizations);
+    }
 
     else  {
       // solve only using factored matrix
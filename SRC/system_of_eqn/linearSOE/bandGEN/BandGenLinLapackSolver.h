@@ -40,6 +40,7 @@ class BandGenLinLapackSolver : public BandGenLinSolver
     ~BandGenLinLapackSolver();
 
     int solve();
+    int solveMultiple(int numRHS, double *X);
     int setSize();
 
     int sendSelf(int commitTag, Channel &theChannel);
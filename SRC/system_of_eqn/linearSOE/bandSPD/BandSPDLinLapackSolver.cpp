@@ -28,6 +28,7 @@
 #include <BandSPDLinLapackSolver.h>
 #include <BandSPDLinSOE.h>
 #include <blasdecl.h>
+#include <Profiler.h>
 
 
 BandSPDLinLapackSolver::BandSPDLinLapackSolver()
@@ -48,25 +49,38 @@ BandSPDLinLapackSolver::solve(void)
   assert(theSOE != nullptr);
 
     int n = theSOE->size;
-    int kd = theSOE->half_band -1;
-    int ldA = kd +1;
-    int nrhs = 1;
-    int ldB = n;
-    int info;
-    double *Aptr = theSOE->A;
     double *Xptr = theSOE->X;
     double *Bptr = theSOE->B;
 
     // first copy B into X
     for (int i=0; i<n; i++)
       *(Xptr++) = *(Bptr++);
-    Xptr = theSOE->X;
+
+    return this->solveMultiple(1, theSOE->X);
+}
+
+
+int
+BandSPDLinLapackSolver::solveMultiple(int nrhs, double *Xptr)
+{
+  assert(theSOE != nullptr);
+
+    int n = theSOE->size;
+    if (n == 0 || nrhs == 0)
+      return 0;
+
+    int kd = theSOE->half_band -1;
+    int ldA = kd +1;
+    int ldB = n;
+    int info;
+    double *Aptr = theSOE->A;
 
     // now solve AX = Y
 
 
     char tflag[] = "U";
     if (theSOE->factored == false) {
+      OpenSees::Profiler::count(OpenSees::Profiler::Factorizations);
       // factor and solve
       DPBSV(tflag, &n,&kd,&nrhs,Aptr,&ldA,Xptr,&ldB,&info);
 
@@ -45,6 +45,7 @@ class BandSPDLinLapackSolver : public BandSPDLinSolver
     ~BandSPDLinLapackSolver();
 
     int solve(void);
+    int solveMultiple(int numRHS, double *X);
     int setSize(void);
     
     int sendSelf(int commitTag, Channel &theChannel);
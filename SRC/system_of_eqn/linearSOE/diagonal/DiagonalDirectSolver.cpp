@@ -33,6 +33,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <assert.h>
+#include <Profiler.h>
 
 void* OPS_DiagonalDirectSolver()
 {
@@ -77,6 +78,7 @@ DiagonalDirectSolver::solve(void)
   int size = theSOE->size;
 
   if (theSOE->isAfactored == false)  {
+    OpenSees::Profiler::count(OpenSees::Profiler::Factorizations);
     
     // FACTOR & SOLVE
     for (int i=0; i<size; i++) {
@@ -33,6 +33,7 @@
 #include <Matrix.h>
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
+#include <Profiler.h>
 
 
 FullGenLinLapackSolver::FullGenLinLapackSolver()
@@ -85,27 +86,46 @@ FullGenLinLapackSolver::solve(void)
     assert(!(sizeIpiv < n));
     //  opserr << " iPiv not large enough - has setSize() been called?\n";
      
-    int ldA = n;
-    int nrhs = 1;
-    int ldB = n;
-    int info;
-    double *Aptr = theSOE->A;
     double *Xptr = theSOE->X;
     double *Bptr = theSOE->B;
-    int *iPIV = iPiv;
     
     // first copy B into X
     for (int i=0; i<n; i++)
      *(Xptr++) = *(Bptr++);
-    Xptr = theSOE->X;
+
+    return this->solveMultiple(1, theSOE->X);
+}
+
+
+int
+FullGenLinLapackSolver::solveMultiple(int nrhs, double *Xptr)
+{
+    assert(theSOE != nullptr);
+    
+    int n = theSOE->size;
+    
+    // check for quick return
+    if (n == 0 || nrhs == 0)
+      return 0;
+    
+    // check iPiv is large enough
+    assert(!(sizeIpiv < n));
+
+    int ldA = n;
+    int ldB = n;
+    int info;
+    double *Aptr = theSOE->A;
+    int *iPIV = iPiv;
 
     //
     // now solve AX = Y
     //
     char tran[] = "N";
-    if (theSOE->factored == false)  
+    if (theSOE->factored == false) {
      // factor and solve 
       DGESV(&n,&nrhs,Aptr,&ldA,iPIV,Xptr,&ldB,&info);
+      OpenSees::Profiler::count(OpenSees::Profiler::Factorizations);
+    }
     else {
      // solve only using factored matrix      
       DGETRS(tran, &n,&nrhs,Aptr,&ldA,iPIV,Xptr,&ldB,&info);      
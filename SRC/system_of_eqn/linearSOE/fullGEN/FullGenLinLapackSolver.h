@@ -38,6 +38,7 @@ class FullGenLinLapackSolver : public FullGenLinSolver
     ~FullGenLinLapackSolver();
 
     int solve(void);
+    int solveMultiple(int numRHS, double *X);
     int setSize(void);
     
     int sendSelf(int commitTag, Channel &theChannel);
@@ -402,6 +402,11 @@ DistributedProfileSPDLinSOE::solve(void)
 {
   static ID result(1);
 
+  // the state determination and assembly are done; let the channels
+  // finish earlier sends and take in what has already arrived
+  for (int j=0; j<numChannels; j++)
+    theChannels[j]->progress();
+
   //
   // if subprocess send B and A and receive back result X, B & result
   //
@@ -410,6 +415,7 @@ DistributedProfileSPDLinSOE::solve(void)
     Channel *theChannel = theChannels[0];
 
     // send B
+    theChannel->startBatch();
     theChannel->sendVector(0, 0, *myVectB);
 
     if (isAfactored == false) {
@@ -417,6 +423,7 @@ DistributedProfileSPDLinSOE::solve(void)
       Vector vectA(A, (*sizeLocal)(0));    
       theChannel->sendVector(0, 0, vectA);
     }
+    theChannel->endBatch();
     // receive X,B and result
     theChannel->recvVector(0, 0, *vectX);
     theChannel->recvVector(0, 0, *vectB);
@@ -474,9 +481,11 @@ DistributedProfileSPDLinSOE::solve(void)
     // send results back
     for (int j=0; j<numChannels; j++) {
       Channel *theChannel = theChannels[j];
+      theChannel->startBatch();
       theChannel->sendVector(0, 0, *vectX);
       theChannel->sendVector(0, 0, *vectB);
       theChannel->sendID(0, 0, result);      
+      theChannel->endBatch();
     }
   } 
 
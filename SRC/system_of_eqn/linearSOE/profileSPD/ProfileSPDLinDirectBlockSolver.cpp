@@ -33,6 +33,7 @@
 #include <assert.h>
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
+#include <Profiler.h>
 
 ProfileSPDLinDirectBlockSolver::ProfileSPDLinDirectBlockSolver(double tol, int blckSize)
 :ProfileSPDLinSolver(SOLVER_TAGS_ProfileSPDLinDirectBlockSolver),
@@ -116,6 +117,7 @@ ProfileSPDLinDirectBlockSolver::solve(void)
 	X[ii] = B[ii];
     
     if (theSOE->isAfactored == false)  {
+	OpenSees::Profiler::count(OpenSees::Profiler::Factorizations);
 
 	// FACTOR 
 	invD[0] = 1.0/theSOE->A[0];	
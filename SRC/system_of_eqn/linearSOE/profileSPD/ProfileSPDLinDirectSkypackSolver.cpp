@@ -35,6 +35,7 @@
 #include <math.h>
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
+#include <Profiler.h>
 
 
 ProfileSPDLinDirectSkypackSolver::ProfileSPDLinDirectSkypackSolver()
@@ -142,6 +143,7 @@ ProfileSPDLinDirectSkypackSolver::solve(void)
     const char *filename = "INCORE";
     
     if (theSOE->isAfactored == false)  {
+	OpenSees::Profiler::count(OpenSees::Profiler::Factorizations);
       
 	// FACTOR 
 	if (mRows == 0 || mCols == 0) { // factor using skysf2_
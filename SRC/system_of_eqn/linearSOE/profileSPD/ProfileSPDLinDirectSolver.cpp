@@ -35,6 +35,7 @@
 
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
+#include <Profiler.h>
 
 
 ProfileSPDLinDirectSolver::ProfileSPDLinDirectSolver(double tol)
@@ -123,6 +124,7 @@ ProfileSPDLinDirectSolver::solve(void)
 
     
     if (theSOE->isAfactored == false)  {
+	OpenSees::Profiler::count(OpenSees::Profiler::Factorizations);
 
 	// FACTOR & SOLVE
 	double *ajiPtr, *akjPtr, *akiPtr, *bjPtr;    
@@ -315,6 +317,7 @@ ProfileSPDLinDirectSolver::factor(int n)
 
     // set some pointers
     if (theSOE->isAfactored == false)  {
+	OpenSees::Profiler::count(OpenSees::Profiler::Factorizations);
 
 	// FACTOR & SOLVE
 	double *ajiPtr, *akjPtr, *akiPtr;    
@@ -397,8 +397,11 @@ ProfileSPDLinSubstrSolver::getCondensedRHS(void)
     if (Yext == nullptr)
 	Yext = new Vector(Y,matSize);
 
-    // check that current Yext is big enough if not enllarge
-    if (Yext->Size() != matSize) {
+    // point it at B, which the SOE reallocates when its size changes
+    else if (matSize > 0)
+	Yext->setData(Y,matSize);
+
+    else if (Yext->Size() != matSize) {
 	delete Yext;
 	Yext = new Vector(Y,matSize);
     }
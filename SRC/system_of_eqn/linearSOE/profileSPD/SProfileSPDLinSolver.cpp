@@ -36,6 +36,7 @@
 
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
+#include <Profiler.h>
 
 void* OPS_SProfileSPDLinSolver()
 {
@@ -121,6 +122,7 @@ SProfileSPDLinSolver::solve(void)
     } 
 
     if (theSOE->isAfactored == false)  {
+      OpenSees::Profiler::count(OpenSees::Profiler::Factorizations);
       
       // FACTOR & SOLVE
       float *ajiPtr, *akjPtr, *akiPtr, *bjPtr;    
@@ -300,6 +302,7 @@ SProfileSPDLinSolver::factor(int n)
 
     // set some pointers
     if (theSOE->isAfactored == false)  {
+	OpenSees::Profiler::count(OpenSees::Profiler::Factorizations);
 
 	// FACTOR & SOLVE
 	float *ajiPtr, *akjPtr, *akiPtr;    
@@ -35,6 +35,7 @@
 #include <iostream>
 #include <elementAPI.h>
 #include <string>
+#include <Profiler.h>
 using std::nothrow;
 
 void* OPS_SuperLUSolver()
@@ -220,6 +221,7 @@ SuperLU::solve(void)
     GlobalLU_t Glu; /* Not needed on return. */
 
     if (theSOE->factored == false) {
+	OpenSees::Profiler::count(OpenSees::Profiler::Factorizations);
 	// factor the matrix
 	int info;
 
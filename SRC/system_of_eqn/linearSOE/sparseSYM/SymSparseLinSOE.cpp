@@ -52,6 +52,24 @@ SymSparseLinSOE::SymSparseLinSOE(SymSparseLinSolver &the_Solver, int lSparse)
  * row, the deallocated needs some special care.
  */
 SymSparseLinSOE::~SymSparseLinSOE()
+{
+    this->freeFactorization();
+
+    // free the "C++" style vectors.
+    if (B != 0) delete [] B;
+    if (X != 0) delete [] X;
+    if (vectX != 0) delete vectX;    
+    if (vectB != 0) delete vectB;
+    if (rowStartA != 0) delete [] rowStartA;
+    if (colA != 0) delete [] colA;
+}
+
+
+/* Free the elimination structure and the numerical values of the
+ * factorization, e.g. before the system is sized again.
+ */
+void
+SymSparseLinSOE::freeFactorization(void)
 {
     // free the diagonal vector
     if (diag != NULL) free(diag);
@@ -64,12 +82,12 @@ SymSparseLinSOE::~SymSparseLinSOE()
         free(penv);
     } 
 
-    // free the row segments.
+    // free the row segments, if the system was ever sized
     OFFDBLK *blkPtr = first;
     OFFDBLK *tempBlk;
     int curRow = -1;
 
-    while (1) {
+    while (blkPtr != NULL) {
       if (blkPtr->next == blkPtr) {
 	if (blkPtr != NULL) {
 	  free(blkPtr);
@@ -94,17 +112,14 @@ SymSparseLinSOE::~SymSparseLinSOE()
     if (xblk != 0)  free(xblk);
     if (rowblks != 0)   free(rowblks);
     if (invp != 0)  free(invp);
-    
-    // free the "C++" style vectors.
-    if (B != 0) delete [] B;
-    if (X != 0) delete [] X;
-    if (vectX != 0) delete vectX;    
-    if (vectB != 0) delete vectB;
-    if (rowStartA != 0) delete [] rowStartA;
-    if (colA != 0) delete [] colA;
-}
+    if (begblk != 0)  free(begblk);
 
+    diag = 0; penv = 0; first = 0;
+    xblk = 0; rowblks = 0; invp = 0; begblk = 0;
+    nblks = 0;
+}
 
+    
 int SymSparseLinSOE::getNumEqn(void) const
 {
     return size;
@@ -132,6 +147,7 @@ int SymSparseLinSOE::setSize(Graph &theGraph)
     }
     nnz = newNNZ;
  
+    if (colA != 0) delete [] colA;
     colA = new int[newNNZ];
 	
     factored = false;
@@ -212,6 +228,9 @@ int SymSparseLinSOE::setSize(Graph &theGraph)
 	}
     }
     
+    // a previous factorization has a different structure
+    this->freeFactorization();
+
     // call "C" function to form elimination tree and to do the symbolic factorization.
     nblks = symFactorization(rowStartA, colA, size, this->LSPARSE,
 			     &xblk, &invp, &rowblks, &begblk, &first, &penv, &diag);
@@ -250,7 +269,10 @@ int SymSparseLinSOE::addA(const Matrix &in_m, const ID &in_id, double fact)
    }
 
    idSize = newPt;
-   if (idSize == 0)  return 0;
+   if (idSize == 0)  {
+       delete [] id;
+       return 0;
+   }
    double *m = new double[idSize*idSize];
 
    int newII = 0;
@@ -292,7 +314,8 @@ int SymSparseLinSOE::addA(const Matrix &in_m, const ID &in_id, double fact)
    int lnee = nee;
    
    /* initialize isort */
-   for(int i = 0, k = 0; i < lnee ; i++ )
+   k = 0;
+   for (int i = 0; i < lnee ; i++ )
    {
        if( newID[i] >= 0 ) {
 	   isort[k] = i;
@@ -451,19 +474,20 @@ SymSparseLinSOE::setB(const Vector &v, double fact)
       return 0;
 
     
+    // B is stored in the order of the factorization, as in addB()
     if (fact == 1.0) { // do not need to multiply if fact == 1.0
 	for (int i=0; i<size; i++) {
-	    B[i] = v(i);
+	    B[invp[i]] = v(i);
 	}
 
     } else if (fact == -1.0) {
 	for (int i=0; i<size; i++) {
-	    B[i] = -v(i);
+	    B[invp[i]] = -v(i);
 	}
 
     } else {
 	for (int i=0; i<size; i++) {
-	    B[i] = v(i) * fact;
+	    B[invp[i]] = v(i) * fact;
 	}
     }	
     return 0;
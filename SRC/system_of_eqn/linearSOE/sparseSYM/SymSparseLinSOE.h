@@ -63,6 +63,8 @@ class SymSparseLinSOE : public LinearSOE
   protected:
     
   private:
+    void freeFactorization(void);  // release the symbolic factorization
+
     int size;            // order of A
     int nnz;             // number of non-zeros in A
     double *B, *X;       // 1d arrays containing coefficients of B and X
@@ -17,6 +17,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <elementAPI.h>
+#include <Profiler.h>
 
 extern "C" {
 #include "nmat.h"
@@ -95,6 +96,7 @@ SymSparseLinSolver::solve(void)
     double *Xptr = theSOE->X;
 
     if (theSOE->factored == false) {
+        OpenSees::Profiler::count(OpenSees::Profiler::Factorizations);
 
         //factor the matrix
         //call the "C" function to do the numerical factorization.
@@ -78,9 +78,11 @@ int pfordr(int neqns, int **padj, int *perm, int *invp, int *parent, int *fchild
    -------------------------------------------------------
 */
    bntree ( neqns, parent, fchild, sibling ) ;
-   zeroi(neqns, list ) ;
+/* list has room for neqns+1 entries; when every node begins a block
+   the terminator is the last one */
+   zeroi(neqns+1, list ) ;
    list[0] = neqns ;
-   minoni(neqns, list);
+   minoni(neqns+1, list);
 
 /* set the static variables to the right values */
    initValues();
@@ -95,9 +97,11 @@ int pfordr(int neqns, int **padj, int *perm, int *invp, int *parent, int *fchild
    nblks = 0 ;
    i = parent ;
    while (*list >=0 )  {
-      j = parent[list[1] - 1 ] ;
-      for ( ; i < parent + list[1]; i++)
-         *i = j ;
+      if (list[1] > 0) {   /* the last block is set below */
+         j = parent[list[1] - 1 ] ;
+         for ( ; i < parent + list[1]; i++)
+            *i = j ;
+      }
       nblks++ ;
       list++ ;
    }
@@ -43,14 +43,14 @@
 #include <ID.h>
 
 UmfpackGenLinSOE::UmfpackGenLinSOE(UmfpackGenLinSolver &the_Solver)
-    :LinearSOE(the_Solver, LinSOE_TAGS_UmfpackGenLinSOE), X(), B(), Ap(), Ai(), Ax()
+    :LinearSOE(the_Solver, LinSOE_TAGS_UmfpackGenLinSOE), X(), B(), Ap(), Ai(), Ax(), factored(false)
 {
     the_Solver.setLinearSOE(*this);
 }
 
 
 UmfpackGenLinSOE::UmfpackGenLinSOE()
-    :LinearSOE(LinSOE_TAGS_UmfpackGenLinSOE), X(), B(), Ap(), Ai(), Ax()
+    :LinearSOE(LinSOE_TAGS_UmfpackGenLinSOE), X(), B(), Ap(), Ai(), Ax(), factored(false)
 {
 }
 
@@ -85,9 +85,12 @@ UmfpackGenLinSOE::setSize(Graph &theGraph)
     }
 
     // resize A, B, X
+    Ap.clear();
+    Ai.clear();
     Ap.reserve(size+1);
     Ai.reserve(nnz);
-    Ax.resize(nnz,0.0);
+    Ax.assign(nnz,0.0);
+    factored = false;
     B.resize(size);
     B.Zero();
     X.resize(size);
@@ -154,6 +157,8 @@ UmfpackGenLinSOE::addA(const Matrix &m, const ID &id, double fact)
 	return -1;
     }
 
+    factored = false;
+
     int size = X.Size();
     if (fact == 1.0) { // do not need to multiply
 	for (int j=0; j<idSize; j++) {
@@ -277,6 +282,7 @@ void
 UmfpackGenLinSOE::zeroA(void)
 {
     Ax.assign(Ax.size(),0.0);
+    factored = false;
 }
 
 void
@@ -71,6 +71,7 @@ private:
     Vector X,B;
     std::vector<int> Ap, Ai;
     std::vector<double> Ax;
+    bool factored;
 };
 
 
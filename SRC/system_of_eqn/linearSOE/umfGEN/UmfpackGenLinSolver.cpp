@@ -32,11 +32,12 @@
 #include <Constants.h>
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
+#include <Profiler.h>
 
 
 UmfpackGenLinSolver::UmfpackGenLinSolver(bool doDet_)
     :LinearSOESolver(SOLVER_TAGS_UmfpackGenLinSolver), 
-     Symbolic(nullptr), theSOE(nullptr),
+     Symbolic(nullptr), Numeric(nullptr), theSOE(nullptr),
      det(0.0), doDet(doDet_)
 {
 }
@@ -44,6 +45,9 @@ UmfpackGenLinSolver::UmfpackGenLinSolver(bool doDet_)
 
 UmfpackGenLinSolver::~UmfpackGenLinSolver()
 {
+    if (Numeric != nullptr) {
+	umfpack_di_free_numeric(&Numeric);
+    }
     if (Symbolic != nullptr) {
 	umfpack_di_free_symbolic(&Symbolic);
     }
@@ -68,35 +72,11 @@ UmfpackGenLinSolver::solve()
     double* X = &(theSOE->X(0));
     double* B = &(theSOE->B(0));
 
-    // check if symbolic is done
-    assert(Symbolic != 0);
-    // if (Symbolic == 0) {
-    //     opserr<<"WARNING: setSize has not been called -- Umfpackgenlinsolver::solve\n";
-    //     return -1;
-    // }
-    
-    //  perform the numerical factorization
-    // numerical analysis
-    void* Numeric = nullptr;
-    int status = umfpack_di_numeric(Ap,Ai,Ax,Symbolic,&Numeric,Control,Info);
-
-    // check error
-    if (status!=UMFPACK_OK) {
-      // TODO
-      // opserr<<"WARNING: numeric analysis returns "<<status<<" -- Umfpackgenlinsolver::solve\n";
-	return -1;
-    }
+    if (this->factor() < 0)
+      return -1;
 
     // solve
-    status = umfpack_di_solve(UMFPACK_A,Ap,Ai,Ax,X,B,Numeric,Control,Info);
-    
-    if (doDet == true)
-      umfpack_di_get_determinant(&det, nullptr, Numeric, Info);
-
-    // delete Numeric
-    if (Numeric != nullptr) {
-	umfpack_di_free_numeric(&Numeric);
-    }
+    int status = umfpack_di_solve(UMFPACK_A,Ap,Ai,Ax,X,B,Numeric,Control,Info);
 
     // check error
     if (status != UMFPACK_OK) {
@@ -107,6 +87,78 @@ UmfpackGenLinSolver::solve()
     return 0;
 }
 
+int
+UmfpackGenLinSolver::solveMultiple(int numRHS, double *B)
+{
+    int n = theSOE->X.Size();
+    int nnz = (int)theSOE->Ai.size();
+    if (n == 0 || nnz==0) return 0;
+
+    int* Ap = &(theSOE->Ap[0]);
+    int* Ai = &(theSOE->Ai[0]);
+    double* Ax = &(theSOE->Ax[0]);
+    double* X = &(theSOE->X(0));
+
+    if (this->factor() < 0)
+      return -1;
+
+    // triangular solves with the one factorization, using X as the
+    // work vector for each column
+    for (int k=0; k<numRHS; k++) {
+      double *Bk = B + (std::size_t)k*n;
+      int status = umfpack_di_solve(UMFPACK_A,Ap,Ai,Ax,X,Bk,Numeric,Control,Info);
+      if (status != UMFPACK_OK)
+        return -1;
+      for (int i=0; i<n; i++)
+        Bk[i] = X[i];
+    }
+
+    return 0;
+}
+
+int
+UmfpackGenLinSolver::factor()
+{
+    int* Ap = &(theSOE->Ap[0]);
+    int* Ai = &(theSOE->Ai[0]);
+    double* Ax = &(theSOE->Ax[0]);
+
+    // check if symbolic is done
+    assert(Symbolic != 0);
+    // if (Symbolic == 0) {
+    //     opserr<<"WARNING: setSize has not been called -- Umfpackgenlinsolver::solve\n";
+    //     return -1;
+    // }
+    
+    //  perform the numerical factorization; it is kept until A
+    //  changes, so repeated solves with the same A (e.g. the shift-invert
+    //  iterations of an eigen analysis) only do the triangular solves
+    if (theSOE->factored == false || Numeric == nullptr) {
+	OpenSees::Profiler::count(OpenSees::Profiler::Factorizations);
+	if (Numeric != nullptr) {
+	    umfpack_di_free_numeric(&Numeric);
+	}
+
+	int status = umfpack_di_numeric(Ap,Ai,Ax,Symbolic,&Numeric,Control,Info);
+
+	// check error
+	if (status!=UMFPACK_OK) {
+	    // opserr<<"WARNING: numeric analysis returns "<<status<<" -- Umfpackgenlinsolver::solve\n";
+	    if (Numeric != nullptr) {
+		umfpack_di_free_numeric(&Numeric);
+	    }
+	    return -1;
+	}
+
+	if (doDet == true)
+	    umfpack_di_get_determinant(&det, nullptr, Numeric, Info);
+
+	theSOE->factored = true;
+    }
+
+    return 0;
+}
+
 
 int
 UmfpackGenLinSolver::setSize()
@@ -125,6 +177,9 @@ UmfpackGenLinSolver::setSize()
     double* Ax = &(theSOE->Ax[0]);
 
     // symbolic analysis
+    if (Numeric != nullptr) {
+	umfpack_di_free_numeric(&Numeric);
+    }
     if (Symbolic != nullptr) {
 	umfpack_di_free_symbolic(&Symbolic);
     }
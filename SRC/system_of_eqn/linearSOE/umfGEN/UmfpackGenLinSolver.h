@@ -40,6 +40,7 @@ class UmfpackGenLinSolver : public LinearSOESolver
     ~UmfpackGenLinSolver();
 
     int solve(void);
+    int solveMultiple(int numRHS, double *X);
     int setSize(void);
 
     int setLinearSOE(UmfpackGenLinSOE &theSOE);
@@ -53,7 +54,10 @@ class UmfpackGenLinSolver : public LinearSOESolver
   protected:
 
   private:
+    int factor();
+
     void *Symbolic;
+    void *Numeric;
     double Control[UMFPACK_CONTROL], Info[UMFPACK_INFO];
     UmfpackGenLinSOE *theSOE;
     double det;
@@ -0,0 +1,163 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: Implementation of Profiler.
+//
+#include <Profiler.h>
+#include <fstream>
+#include <iomanip>
+
+namespace OpenSees {
+
+Profiler &
+Profiler::get()
+{
+  static thread_local Profiler profiler;
+  return profiler;
+}
+
+Profiler::Profiler()
+ : active(false), tracing(false)
+{
+  this->reset();
+}
+
+void
+Profiler::start(bool trace)
+{
+  if (!active && events.empty())
+    origin = Clock::now();
+  tracing = trace;
+  active  = true;
+}
+
+void
+Profiler::stop()
+{
+  active = false;
+}
+
+void
+Profiler::reset()
+{
+  for (int i=0; i<NumPhases; i++)
+    phases[i] = {0, 0.0, 0.0};
+  for (int i=0; i<NumCounters; i++)
+    counts[i] = 0;
+  events.clear();
+  origin = Clock::now();
+}
+
+void
+Profiler::add(Phase phase, Clock::time_point begin, Clock::time_point end)
+{
+  const double elapsed = std::chrono::duration<double>(end - begin).count();
+
+  PhaseData &data = phases[phase];
+  data.calls++;
+  data.total += elapsed;
+  if (elapsed > data.max)
+    data.max = elapsed;
+
+  if (tracing && events.size() < max_events) {
+    const double ts = std::chrono::duration<double, std::micro>(begin - origin).count();
+    events.push_back({phase, ts, elapsed*1e6});
+  }
+}
+
+const char *
+Profiler::name(Phase phase)
+{
+  switch (phase) {
+    case Step:          return "Step";
+    case Update:        return "Update";
+    case FormTangent:   return "FormTangent";
+    case FormUnbalance: return "FormUnbalance";
+    case Solve:         return "Solve";
+    case Commit:        return "Commit";
+    case Record:        return "Record";
+    default:            return "Unknown";
+  }
+}
+
+const char *
+Profiler::name(Counter counter)
+{
+  switch (counter) {
+    case Iterations:     return "Iterations";
+    case Factorizations: return "Factorizations";
+    case ElementUpdates: return "ElementUpdates";
+    case RecorderWrites: return "RecorderWrites";
+    default:             return "Unknown";
+  }
+}
+
+void
+Profiler::report(std::ostream &s, bool json) const
+{
+  if (json) {
+    s << "{\"phases\": {";
+    for (int i=0; i<NumPhases; i++) {
+      const PhaseData &data = phases[i];
+      s << (i == 0 ? "" : ", ")
+        << "\"" << name(Phase(i)) << "\": {"
+        << "\"calls\": " << data.calls << ", "
+        << "\"total\": " << data.total << ", "
+        << "\"max\": "   << data.max   << "}";
+    }
+    s << "}, \"counters\": {";
+    for (int i=0; i<NumCounters; i++)
+      s << (i == 0 ? "" : ", ")
+        << "\"" << name(Counter(i)) << "\": " << counts[i];
+    s << "}}";
+    return;
+  }
+
+  s << std::left  << std::setw(16) << "Phase"
+    << std::right << std::setw(12) << "Calls"
+                  << std::setw(14) << "Total [s]"
+                  << std::setw(14) << "Mean [ms]"
+                  << std::setw(14) << "Max [ms]"
+                  << "\n";
+  for (int i=0; i<NumPhases; i++) {
+    const PhaseData &data = phases[i];
+    const double mean = data.calls > 0 ? data.total/data.calls : 0.0;
+    s << std::left  << std::setw(16) << name(Phase(i))
+      << std::right << std::setw(12) << data.calls
+      << std::fixed << std::setprecision(6)
+                    << std::setw(14) << data.total
+                    << std::setw(14) << mean*1e3
+                    << std::setw(14) << data.max*1e3
+      << std::defaultfloat << "\n";
+  }
+  s << "\n";
+  for (int i=0; i<NumCounters; i++)
+    s << std::left  << std::setw(16) << name(Counter(i))
+      << std::right << std::setw(12) << counts[i] << "\n";
+}
+
+int
+Profiler::writeTrace(const char *filename) const
+{
+  std::ofstream file(filename);
+  if (!file)
+    return -1;
+
+  file << "{\"traceEvents\": [";
+  for (std::size_t i=0; i<events.size(); i++) {
+    const Event &event = events[i];
+    file << (i == 0 ? "\n" : ",\n")
+         << "{\"name\": \"" << name(event.phase) << "\", \"ph\": \"X\""
+         << ", \"ts\": "  << std::fixed << std::setprecision(3) << event.begin
+         << ", \"dur\": " << event.duration
+         << ", \"pid\": 1, \"tid\": 1}";
+  }
+  file << "\n],\n\"displayTimeUnit\": \"ms\"}\n";
+
+  return file.good() ? 0 : -1;
+}
+
+} // namespace OpenSees
@@ -0,0 +1,139 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: Profiler collects wall-clock time spent in the phases of
+// an analysis (step, element state determination, tangent and residual
+// assembly, linear solve, commit and recording) together with a small
+// set of event counters.
+//
+// The profiler is inactive by default. While inactive, an instrumented
+// scope costs a single branch, so the hooks can stay in the hot paths.
+// Each thread owns its own profiler, so analyses that run concurrently
+// on separate domains do not interfere with one another.
+//
+// Phase times are inclusive; for example, the time spent in Update while
+// forming the unbalance is also counted in FormUnbalance.
+//
+#ifndef Profiler_h
+#define Profiler_h
+
+#include <chrono>
+#include <vector>
+#include <ostream>
+
+namespace OpenSees {
+
+class Profiler {
+public:
+  enum Phase {
+    Step,
+    Update,
+    FormTangent,
+    FormUnbalance,
+    Solve,
+    Commit,
+    Record,
+    NumPhases
+  };
+
+  enum Counter {
+    Iterations,
+    Factorizations,
+    ElementUpdates,
+    RecorderWrites,
+    NumCounters
+  };
+
+  typedef std::chrono::steady_clock Clock;
+
+  // Profiler belonging to the calling thread
+  static Profiler &get();
+
+  void start(bool trace = false);
+  void stop();
+  void reset();
+  bool isActive() const {return active;}
+
+  static void
+  count(Counter counter, long n = 1)
+  {
+    Profiler &profiler = get();
+    if (profiler.active)
+      profiler.counts[counter] += n;
+  }
+
+  long   getCount(Counter counter) const {return counts[counter];}
+  long   getCalls(Phase phase) const     {return phases[phase].calls;}
+  double getTime(Phase phase) const      {return phases[phase].total;}
+
+  static const char *name(Phase);
+  static const char *name(Counter);
+
+  // Write a summary table, or the same summary as a JSON object
+  void report(std::ostream &, bool json = false) const;
+
+  // Write the recorded events in the Chrome trace event format
+  // (chrome://tracing, Perfetto)
+  int writeTrace(const char *filename) const;
+
+  //
+  // RAII timer for one phase
+  //
+  class Scope {
+  public:
+    Scope(Phase phase)
+     : profiler(nullptr), phase(phase)
+    {
+      Profiler &p = get();
+      if (p.active) {
+        profiler = &p;
+        begin = Clock::now();
+      }
+    }
+    ~Scope()
+    {
+      if (profiler != nullptr)
+        profiler->add(phase, begin, Clock::now());
+    }
+    Scope(const Scope&) = delete;
+    Scope &operator=(const Scope&) = delete;
+
+  private:
+    Profiler *profiler;
+    Phase phase;
+    Clock::time_point begin;
+  };
+
+private:
+  Profiler();
+  void add(Phase, Clock::time_point begin, Clock::time_point end);
+
+  struct PhaseData {
+    long   calls;
+    double total;
+    double max;
+  };
+
+  struct Event {
+    Phase  phase;
+    double begin; // microseconds since start()
+    double duration;
+  };
+
+  // Upper bound on the number of trace events kept in memory
+  static constexpr std::size_t max_events = 1u<<22;
+
+  bool active;
+  bool tracing;
+  Clock::time_point origin;
+  PhaseData phases[NumPhases];
+  long      counts[NumCounters];
+  std::vector<Event> events;
+};
+
+} // namespace OpenSees
+
+#endif // Profiler_h